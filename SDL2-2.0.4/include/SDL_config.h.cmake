@@ -180,6 +180,9 @@
 /* SDL internal assertion support */
 #cmakedefine SDL_DEFAULT_ASSERT_LEVEL @SDL_DEFAULT_ASSERT_LEVEL@
 
+/* Count the memory SDL_malloc() hands out by tag */
+#cmakedefine SDL_MEMORY_TRACKING @SDL_MEMORY_TRACKING@
+
 /* Allow disabling of core subsystems */
 #cmakedefine SDL_ATOMIC_DISABLED @SDL_ATOMIC_DISABLED@
 #cmakedefine SDL_AUDIO_DISABLED @SDL_AUDIO_DISABLED@
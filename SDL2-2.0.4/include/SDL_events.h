@@ -655,6 +655,20 @@ extern DECLSPEC int SDLCALL SDL_WaitEventTimeout(SDL_Event * event,
  */
 extern DECLSPEC int SDLCALL SDL_PushEvent(SDL_Event * event);
 
+/**
+ *  \brief Add several events to the event queue.
+ *
+ *  Each event is passed through the event filter and watchers as if it was
+ *  pushed with SDL_PushEvent(), but the events that are kept are added to
+ *  the queue together.  This is cheaper than pushing them one at a time when
+ *  many threads are adding events.
+ *
+ *  \return The number of events added to the queue, not counting filtered
+ *          events, or -1 if the event queue was full before any events could
+ *          be added or there was some other error.
+ */
+extern DECLSPEC int SDLCALL SDL_PushEvents(SDL_Event * events, int numevents);
+
 typedef int (SDLCALL * SDL_EventFilter) (void *userdata, SDL_Event * event);
 
 /**
@@ -141,6 +141,32 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_VSYNC               "SDL_RENDER_VSYNC"
 
+/**
+ *  \brief  A variable controlling whether the 2D render API batches draw calls.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Every draw call is passed straight to the render backend
+ *    "1"       - Consecutive fills and copies sharing the same state are queued
+ *                and submitted together on the next state change or present
+ *
+ *  The hint is checked when the renderer is created.  By default batching is disabled.
+ */
+#define SDL_HINT_RENDER_BATCHING            "SDL_RENDER_BATCHING"
+
+/**
+ *  \brief  A variable controlling how many worker threads the software renderer uses.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - All drawing is done on the thread calling the render API
+ *    "N"       - Clears, fills and unscaled copies are split into N horizontal
+ *                bands of the target, each drawn by its own worker thread
+ *
+ *  Points, lines, scaled and rotated copies are always drawn on the calling thread,
+ *  after any queued work has finished.  The hint is checked when the renderer is
+ *  created.  By default no worker threads are used.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS    "SDL_RENDER_SOFTWARE_THREADS"
+
 /**
  *  \brief  A variable controlling whether the screensaver is enabled. 
  *
@@ -630,6 +656,18 @@ extern "C" {
  */
 #define SDL_HINT_WINDOWS_NO_CLOSE_ON_ALT_F4	"SDL_WINDOWS_NO_CLOSE_ON_ALT_F4"
 
+/**
+ *  \brief  A variable controlling how SDL_AudioCVT changes the sample rate.
+ *
+ *  This variable can be set to the following values:
+ *    "default" - Use a windowed-sinc polyphase filter, working in floating point
+ *    "fast"    - Use the older interpolating converters, which are cheaper but
+ *                alias and roll off high frequencies
+ *
+ *  The hint is checked when SDL_BuildAudioCVT() is called.
+ */
+#define SDL_HINT_AUDIO_RESAMPLING_MODE   "SDL_AUDIO_RESAMPLING_MODE"
+
 #define SDL_HINT_BACKGROUND_AUDIO "SDL_BACKGROUND_AUDIO"
 #define SDL_HINT_BLE "SDL_BLE"
 
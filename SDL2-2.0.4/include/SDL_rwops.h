@@ -45,6 +45,8 @@ extern "C" {
 #define SDL_RWOPS_JNIFILE   3   /* Android asset */
 #define SDL_RWOPS_MEMORY    4   /* Memory stream */
 #define SDL_RWOPS_MEMORY_RO 5   /* Read-Only memory stream */
+#define SDL_RWOPS_MAPPED    6   /* Read-Only memory mapped file */
+#define SDL_RWOPS_BUFFERED  7   /* Buffered wrapper around another stream */
 
 /**
  * This is the read/write operation structure -- very basic.
@@ -134,6 +136,11 @@ typedef struct SDL_RWops
             Uint8 *stop;
         } mem;
         struct
+        {
+            struct SDL_RWops *src;
+            void *buffer;
+        } buffered;
+        struct
         {
             void *data1;
             void *data2;
@@ -165,12 +172,69 @@ extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMem(void *mem, int size);
 extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromConstMem(const void *mem,
                                                       int size);
 
+/**
+ *  Open a file for reading by mapping it into memory.
+ *
+ *  Reads copy straight out of the mapping without any system calls, and
+ *  SDL_RWGetMemory() gives direct access to the contents, so loaders that
+ *  can parse from memory don't need to copy the file at all.  The file is
+ *  kept mapped until the stream is closed.
+ *
+ *  Files that can't be mapped, such as Android assets, are read into memory
+ *  with SDL_RWFromFile() instead; the stream is then SDL_RWOPS_MEMORY_RO.
+ *
+ *  \return A read-only stream of type SDL_RWOPS_MAPPED, or NULL on error.
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromFileMapped(const char *file);
+
+/**
+ *  Wrap a stream in a read-ahead and write-behind buffer.
+ *
+ *  Small reads are served from a buffer that is refilled with one large
+ *  read from \c src, and small writes are collected and written to \c src
+ *  in one go, so the many tiny reads of SDL_ReadLE16() and friends don't
+ *  each become a call into a slow stream, such as one reading from the
+ *  network or an archive.  Seeks within the buffered data don't touch
+ *  \c src at all.
+ *
+ *  Buffered writes reach \c src when the buffer fills up, before the next
+ *  read, on seeks outside the buffer and when the stream is closed; an
+ *  error writing them is reported by that call.  \c src must not be used
+ *  directly while it is wrapped.
+ *
+ *  \param src       The stream to wrap.  Streams that can't seek work too,
+ *                   as long as seeks stay within the buffered data.
+ *  \param size      The size of the buffer in bytes, or 0 for a default.
+ *  \param autoclose If SDL_TRUE, \c src is closed along with the buffer.
+ *
+ *  \return A stream of type SDL_RWOPS_BUFFERED, or NULL on error.  If this
+ *          fails \c src is left open.
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromRW(SDL_RWops * src, int size,
+                                               SDL_bool autoclose);
+
 /* @} *//* RWFrom functions */
 
 
 extern DECLSPEC SDL_RWops *SDLCALL SDL_AllocRW(void);
 extern DECLSPEC void SDLCALL SDL_FreeRW(SDL_RWops * area);
 
+/**
+ *  Get the data of a stream that reads from memory.
+ *
+ *  This works for streams from SDL_RWFromMem(), SDL_RWFromConstMem() and
+ *  SDL_RWFromFileMapped(), and the pointer stays valid until the stream is
+ *  closed.  The data must not be changed unless the stream came from
+ *  SDL_RWFromMem().
+ *
+ *  \param context The stream.
+ *  \param size    Filled in with the size of the data in bytes, may be NULL.
+ *
+ *  \return The start of the data, or NULL if the stream isn't in memory.
+ */
+extern DECLSPEC const void *SDLCALL SDL_RWGetMemory(SDL_RWops * context,
+                                                    Sint64 * size);
+
 #define RW_SEEK_SET 0       /**< Seek from the beginning of data */
 #define RW_SEEK_CUR 1       /**< Seek relative to current read point */
 #define RW_SEEK_END 2       /**< Seek relative to the end of data */
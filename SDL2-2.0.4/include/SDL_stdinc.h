@@ -333,11 +333,122 @@ extern DECLSPEC void *SDLCALL SDL_calloc(size_t nmemb, size_t size);
 extern DECLSPEC void *SDLCALL SDL_realloc(void *mem, size_t size);
 extern DECLSPEC void SDLCALL SDL_free(void *mem);
 
+/**
+ *  Counters of the per-thread caches in front of the heap SDL uses when
+ *  it's built without the C runtime.  They are all zero when SDL_malloc()
+ *  uses the C runtime's malloc().
+ */
+typedef struct SDL_MallocCacheStats
+{
+    Uint64 hits;        /**< Allocations served by a thread's cache */
+    Uint64 misses;      /**< Allocations that had to go to the heap */
+    Uint64 released;    /**< Blocks given back to the heap by the caches */
+    size_t cached;      /**< Bytes kept in the caches */
+    int threads;        /**< Threads with a cache */
+} SDL_MallocCacheStats;
+
+/**
+ *  Get the counters of the heap's per-thread caches, added up over all
+ *  threads.  The counters of a running thread are only added in every
+ *  few hundred calls, so they are a little behind.
+ */
+extern DECLSPEC void SDLCALL SDL_GetMallocCacheStats(SDL_MallocCacheStats *stats);
+
+/**
+ *  \name Memory tags
+ *
+ *  When SDL is built with SDL_MEMORY_TRACKING, every block from
+ *  SDL_malloc() is counted under a tag naming what it's for.  Blocks
+ *  from SDL_malloc() itself are counted as SDL_MEMTAG_OTHER.  Builds
+ *  without the atomic subsystem don't track memory.
+ */
+/* @{ */
+#define SDL_MEMTAG_OTHER        0   /**< Anything not tagged below */
+#define SDL_MEMTAG_SURFACE      1   /**< Surface pixels */
+#define SDL_MEMTAG_AUDIO        2   /**< Audio device buffers, streams and waves */
+#define SDL_MEMTAG_EVENT        3   /**< The event queue */
+#define SDL_MEMTAG_RWOPS        4   /**< RWops and their buffers */
+#define SDL_MEMTAG_IMAGE        5   /**< SDL_image loaders and decoders */
+#define SDL_MEMTAG_FONT         6   /**< SDL_ttf fonts, glyph bitmaps and atlases */
+#define SDL_MEMTAG_MIXER        7   /**< SDL_mixer chunks, music and mixing buffers */
+#define SDL_MEMTAG_APPLICATION  8   /**< Free for the application to use */
+#define SDL_NUM_MEMTAGS         9
+#define SDL_MEMTAG_ALL          (-1)    /**< All tags together, for SDL_GetMemoryStats() */
+/* @} */
+
+/**
+ *  Allocate memory counted under a tag.  The memory is freed with SDL_free()
+ *  like any other.  Without SDL_MEMORY_TRACKING these are SDL_malloc(),
+ *  SDL_calloc() and SDL_realloc().
+ *
+ *  SDL_TaggedRealloc() moves the block to the given tag, while SDL_realloc()
+ *  keeps the tag the block already has.
+ */
+extern DECLSPEC void *SDLCALL SDL_TaggedMalloc(int tag, size_t size);
+extern DECLSPEC void *SDLCALL SDL_TaggedCalloc(int tag, size_t nmemb, size_t size);
+extern DECLSPEC void *SDLCALL SDL_TaggedRealloc(int tag, void *mem, size_t size);
+
+/**
+ *  Memory counted under a tag.
+ */
+typedef struct SDL_MemoryStats
+{
+    Uint64 live_bytes;      /**< Bytes allocated and not yet freed */
+    Uint64 peak_bytes;      /**< The most live_bytes has been */
+    Uint64 live_blocks;     /**< Blocks allocated and not yet freed */
+    Uint64 allocations;     /**< Blocks allocated in all */
+} SDL_MemoryStats;
+
+/**
+ *  Get the memory counted under a tag, or under all of them with
+ *  SDL_MEMTAG_ALL.  The peak of SDL_MEMTAG_ALL is the most memory held at
+ *  once, not the sum of the peaks of the tags.
+ *
+ *  \return 0 on success, or -1 if the tag is out of range or SDL wasn't
+ *          built with SDL_MEMORY_TRACKING.
+ */
+extern DECLSPEC int SDLCALL SDL_GetMemoryStats(int tag, SDL_MemoryStats *stats);
+
+/**
+ *  Get a short name for a tag, such as "surface", or NULL if it's out of
+ *  range.
+ */
+extern DECLSPEC const char *SDLCALL SDL_GetMemoryTagName(int tag);
+
+/**
+ *  Log the memory counted under every tag with SDL_Log(), or that memory
+ *  tracking isn't built in.
+ */
+extern DECLSPEC void SDLCALL SDL_DumpMemoryStats(void);
+
 extern DECLSPEC char *SDLCALL SDL_getenv(const char *name);
 extern DECLSPEC int SDLCALL SDL_setenv(const char *name, const char *value, int overwrite);
 
 extern DECLSPEC void SDLCALL SDL_qsort(void *base, size_t nmemb, size_t size, int (*compare) (const void *, const void *));
 
+/**
+ *  Sort an array of 32-bit values in ascending order with a radix sort,
+ *  which is much faster than SDL_qsort() for big arrays.
+ *
+ *  \return 0 on success, or -1 if the temporary buffer couldn't be allocated.
+ */
+extern DECLSPEC int SDLCALL SDL_RadixSort32(Uint32 *values, size_t count);
+
+/**
+ *  Sort an array of records by a Uint32 key at key_offset bytes into each
+ *  record, such as sprites by depth or draw calls by state.  The sort is
+ *  stable: records with the same key keep their order.
+ *
+ *  The array, the record size and the key offset have to be multiples of
+ *  4 bytes.  To sort by a signed key, store it with the sign bit flipped,
+ *  (Uint32)key ^ 0x80000000, and by a float key, flip every bit of
+ *  negative values and just the sign bit of the others.
+ *
+ *  \return 0 on success, or -1 if the parameters are invalid or the
+ *          temporary buffer couldn't be allocated.
+ */
+extern DECLSPEC int SDLCALL SDL_RadixSortKeyed(void *base, size_t nmemb, size_t size, size_t key_offset);
+
 extern DECLSPEC int SDLCALL SDL_abs(int x);
 
 /* !!! FIXME: these have side effects. You probably shouldn't use them. */
@@ -355,35 +466,13 @@ extern DECLSPEC void *SDLCALL SDL_memset(SDL_OUT_BYTECAP(len) void *dst, int c,
 #define SDL_zero(x) SDL_memset(&(x), 0, sizeof((x)))
 #define SDL_zerop(x) SDL_memset((x), 0, sizeof(*(x)))
 
-/* Note that memset() is a byte assignment and this is a 32-bit assignment, so they're not directly equivalent. */
-SDL_FORCE_INLINE void SDL_memset4(void *dst, Uint32 val, size_t dwords)
-{
-#if defined(__GNUC__) && defined(i386)
-    int u0, u1, u2;
-    __asm__ __volatile__ (
-        "cld \n\t"
-        "rep ; stosl \n\t"
-        : "=&D" (u0), "=&a" (u1), "=&c" (u2)
-        : "0" (dst), "1" (val), "2" (SDL_static_cast(Uint32, dwords))
-        : "memory"
-    );
-#else
-    size_t _n = (dwords + 3) / 4;
-    Uint32 *_p = SDL_static_cast(Uint32 *, dst);
-    Uint32 _val = (val);
-    if (dwords == 0)
-        return;
-    switch (dwords % 4)
-    {
-        case 0: do {    *_p++ = _val;
-        case 3:         *_p++ = _val;
-        case 2:         *_p++ = _val;
-        case 1:         *_p++ = _val;
-        } while ( --_n );
-    }
-#endif
-}
-
+/**
+ *  Set 'dwords' 32-bit values at dst to val.  Note that memset() is a byte
+ *  assignment and this is a 32-bit assignment, so they're not directly
+ *  equivalent.  Fills of several megabytes, such as clearing a big
+ *  framebuffer, bypass the cache on CPUs with SSE2.
+ */
+extern DECLSPEC void SDLCALL SDL_memset4(void *dst, Uint32 val, size_t dwords);
 
 extern DECLSPEC void *SDLCALL SDL_memcpy(SDL_OUT_BYTECAP(len) void *dst, SDL_IN_BYTECAP(len) const void *src, size_t len);
 
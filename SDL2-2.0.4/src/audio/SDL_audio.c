@@ -506,7 +506,7 @@ SDL_QueueAudio(SDL_AudioDeviceID devid, const void *_data, Uint32 len)
                 device->buffer_queue_pool = packet->next;
             } else {
                 /* Have to allocate a new one! */
-                packet = (SDL_AudioBufferQueue *) SDL_malloc(sizeof (SDL_AudioBufferQueue));
+                packet = (SDL_AudioBufferQueue *) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, sizeof (SDL_AudioBufferQueue));
                 if (packet == NULL) {
                     /* uhoh, reset so we've queued nothing new, free what we can. */
                     if (!origtail) {
@@ -599,6 +599,7 @@ SDL_RunAudio(void *devicep)
     const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
     const int stream_len = (device->convert.needed) ? device->convert.len : device->spec.size;
     Uint8 *stream;
+    int got;
     void *udata = device->spec.userdata;
     void (SDLCALL *fill) (void *, Uint8 *, int) = device->spec.callback;
 
@@ -611,10 +612,7 @@ SDL_RunAudio(void *devicep)
 
     /* Loop, filling the audio buffers */
     while (!device->shutdown) {
-        /* Fill the current buffer with sound */
-        if (device->convert.needed) {
-            stream = device->convert.buf;
-        } else if (device->enabled) {
+        if (device->enabled) {
             stream = current_audio.impl.GetDeviceBuf(device);
         } else {
             /* if the device isn't enabled, we still write to the
@@ -629,25 +627,35 @@ SDL_RunAudio(void *devicep)
             stream = device->fake_stream;
         }
 
-        /* !!! FIXME: this should be LockDevice. */
-        SDL_LockMutex(device->mixer_lock);
-        if (device->paused) {
-            SDL_memset(stream, silence, stream_len);
+        if (device->stream) {
+            /* The callback's buffers don't line up with the device's, so
+               call it until a whole device buffer has been converted.  While
+               paused, what was converted already waits in the stream. */
+            got = 0;
+            if (!device->paused) {
+                while (SDL_AudioStreamAvailable(device->stream) < (int) device->spec.size) {
+                    SDL_LockMutex(device->mixer_lock);
+                    (*fill) (udata, device->convert.buf, stream_len);
+                    SDL_UnlockMutex(device->mixer_lock);
+
+                    if (SDL_AudioStreamPut(device->stream, device->convert.buf, stream_len) < 0) {
+                        break;
+                    }
+                }
+                got = SDL_AudioStreamGet(device->stream, stream, device->spec.size);
+            }
+            if (got < (int) device->spec.size) {
+                SDL_memset(stream + got, silence, device->spec.size - got);
+            }
         } else {
-            (*fill) (udata, stream, stream_len);
-        }
-        SDL_UnlockMutex(device->mixer_lock);
-
-        /* Convert the audio if necessary */
-        if (device->enabled && device->convert.needed) {
-            SDL_ConvertAudio(&device->convert);
-            stream = current_audio.impl.GetDeviceBuf(device);
-            if (stream == NULL) {
-                stream = device->fake_stream;
+            /* !!! FIXME: this should be LockDevice. */
+            SDL_LockMutex(device->mixer_lock);
+            if (device->paused) {
+                SDL_memset(stream, silence, stream_len);
             } else {
-                SDL_memcpy(stream, device->convert.buf,
-                           device->convert.len_cvt);
+                (*fill) (udata, stream, stream_len);
             }
+            SDL_UnlockMutex(device->mixer_lock);
         }
 
         /* Ready current buffer for play and change current buffer */
@@ -884,6 +892,7 @@ close_audio_device(SDL_AudioDevice * device)
     if (device->convert.needed) {
         SDL_FreeAudioMem(device->convert.buf);
     }
+    SDL_FreeAudioStream(device->stream);
     if (device->opened) {
         current_audio.impl.CloseDevice(device);
         device->opened = 0;
@@ -1142,6 +1151,21 @@ open_audio_device(const char *devname, int iscapture,
             device->convert.len = (int) (((double) device->spec.size) /
                                          device->convert.len_ratio);
 
+            /* The audio thread converts through a stream, and calls back
+               with the buffer size the app asked for.  Drivers with their
+               own thread still use the SDL_AudioCVT.
+             */
+            if (!current_audio.impl.ProvidesOwnCallbackThread) {
+                device->stream = SDL_NewAudioStream(obtained->format, obtained->channels,
+                                                    obtained->freq, device->spec.format,
+                                                    device->spec.channels, device->spec.freq);
+                if (device->stream == NULL) {
+                    close_audio_device(device);
+                    return 0;
+                }
+                device->convert.len = obtained->size;
+            }
+
             device->convert.buf =
                 (Uint8 *) SDL_AllocAudioMem(device->convert.len *
                                             device->convert.len_mult);
@@ -1172,7 +1196,7 @@ open_audio_device(const char *devname, int iscapture,
         const int wantbytes = ((device->convert.needed) ? device->convert.len : device->spec.size) * 2;
         const int wantpackets = (wantbytes / packetlen) + ((wantbytes % packetlen) ? packetlen : 0);
         for (i = 0; i < wantpackets; i++) {
-            SDL_AudioBufferQueue *packet = (SDL_AudioBufferQueue *) SDL_malloc(sizeof (SDL_AudioBufferQueue));
+            SDL_AudioBufferQueue *packet = (SDL_AudioBufferQueue *) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, sizeof (SDL_AudioBufferQueue));
             if (packet) { /* don't care if this fails, we'll deal later. */
                 packet->datalen = 0;
                 packet->startpos = 0;
@@ -52,4 +52,19 @@ typedef struct
 } SDL_AudioRateFilters;
 extern const SDL_AudioRateFilters sdl_audio_rate_filters[];
 
+/* Windowed-sinc resampler working on interleaved float frames, see SDL_audiocvt.c.
+   SDL_ResampleAudio() reads SDL_ResamplerPadding() frames before and after
+   'inbuf' from 'lpadding' and 'rpadding', or repeats the edge frames if those
+   are NULL.  'position' is the time of the next output frame in 1/outrate
+   input frames, relative to the start of 'inbuf'; it's updated to be relative
+   to the end of 'inbuf', so consecutive buffers can be resampled seamlessly.
+ */
+extern int SDL_ResamplerPadding(const int inrate, const int outrate);
+extern int SDL_ResamplerOutputFrames(const int inrate, const int outrate,
+                                     const int inframes, const Sint64 position);
+extern int SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+                             const float *lpadding, const float *rpadding,
+                             const float *inbuf, const int inframes,
+                             float *outbuf, Sint64 *position);
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,1062 @@
+/* DO NOT EDIT!  This file is generated by sdlgenresampler.pl */
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* One side of a Kaiser windowed sinc (beta 8), sampled
+   256 times between each of its 8 zero crossings. */
+
+#define RESAMPLER_ZERO_CROSSINGS 8
+#define RESAMPLER_SAMPLES_PER_ZERO_CROSSING 256
+#define RESAMPLER_FILTER_SIZE ((RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_ZERO_CROSSINGS) + 1)
+
+static const float ResamplerFilter[RESAMPLER_FILTER_SIZE] = {
+    1.000000000e+00f, 9.999740086e-01f, 9.998960369e-01f, 9.997660926e-01f,
+    9.995841884e-01f, 9.993503420e-01f, 9.990645763e-01f, 9.987269193e-01f,
+    9.983374039e-01f, 9.978960682e-01f, 9.974029553e-01f, 9.968581134e-01f,
+    9.962615958e-01f, 9.956134608e-01f, 9.949137716e-01f, 9.941625966e-01f,
+    9.933600092e-01f, 9.925060877e-01f, 9.916009156e-01f, 9.906445812e-01f,
+    9.896371779e-01f, 9.885788040e-01f, 9.874695628e-01f, 9.863095626e-01f,
+    9.850989164e-01f, 9.838377425e-01f, 9.825261637e-01f, 9.811643081e-01f,
+    9.797523082e-01f, 9.782903019e-01f, 9.767784314e-01f, 9.752168442e-01f,
+    9.736056922e-01f, 9.719451325e-01f, 9.702353265e-01f, 9.684764409e-01f,
+    9.666686465e-01f, 9.648121194e-01f, 9.629070401e-01f, 9.609535937e-01f,
+    9.589519701e-01f, 9.569023637e-01f, 9.548049736e-01f, 9.526600035e-01f,
+    9.504676616e-01f, 9.482281604e-01f, 9.459417174e-01f, 9.436085540e-01f,
+    9.412288965e-01f, 9.388029754e-01f, 9.363310257e-01f, 9.338132866e-01f,
+    9.312500017e-01f, 9.286414191e-01f, 9.259877908e-01f, 9.232893734e-01f,
+    9.205464276e-01f, 9.177592181e-01f, 9.149280141e-01f, 9.120530885e-01f,
+    9.091347186e-01f, 9.061731857e-01f, 9.031687750e-01f, 9.001217757e-01f,
+    8.970324812e-01f, 8.939011885e-01f, 8.907281986e-01f, 8.875138163e-01f,
+    8.842583503e-01f, 8.809621131e-01f, 8.776254207e-01f, 8.742485929e-01f,
+    8.708319534e-01f, 8.673758292e-01f, 8.638805509e-01f, 8.603464529e-01f,
+    8.567738728e-01f, 8.531631518e-01f, 8.495146346e-01f, 8.458286691e-01f,
+    8.421056066e-01f, 8.383458017e-01f, 8.345496123e-01f, 8.307173995e-01f,
+    8.268495274e-01f, 8.229463635e-01f, 8.190082781e-01f, 8.150356447e-01f,
+    8.110288399e-01f, 8.069882429e-01f, 8.029142361e-01f, 7.988072046e-01f,
+    7.946675364e-01f, 7.904956222e-01f, 7.862918555e-01f, 7.820566324e-01f,
+    7.777903517e-01f, 7.734934145e-01f, 7.691662249e-01f, 7.648091891e-01f,
+    7.604227158e-01f, 7.560072163e-01f, 7.515631040e-01f, 7.470907948e-01f,
+    7.425907065e-01f, 7.380632594e-01f, 7.335088759e-01f, 7.289279803e-01f,
+    7.243209993e-01f, 7.196883612e-01f, 7.150304964e-01f, 7.103478374e-01f,
+    7.056408181e-01f, 7.009098746e-01f, 6.961554445e-01f, 6.913779673e-01f,
+    6.865778838e-01f, 6.817556367e-01f, 6.769116701e-01f, 6.720464297e-01f,
+    6.671603624e-01f, 6.622539166e-01f, 6.573275422e-01f, 6.523816900e-01f,
+    6.474168125e-01f, 6.424333629e-01f, 6.374317958e-01f, 6.324125668e-01f,
+    6.273761325e-01f, 6.223229504e-01f, 6.172534791e-01f, 6.121681779e-01f,
+    6.070675068e-01f, 6.019519268e-01f, 5.968218995e-01f, 5.916778870e-01f,
+    5.865203521e-01f, 5.813497583e-01f, 5.761665693e-01f, 5.709712495e-01f,
+    5.657642633e-01f, 5.605460759e-01f, 5.553171524e-01f, 5.500779583e-01f,
+    5.448289592e-01f, 5.395706209e-01f, 5.343034092e-01f, 5.290277898e-01f,
+    5.237442286e-01f, 5.184531912e-01f, 5.131551431e-01f, 5.078505497e-01f,
+    5.025398759e-01f, 4.972235867e-01f, 4.919021463e-01f, 4.865760188e-01f,
+    4.812456677e-01f, 4.759115560e-01f, 4.705741462e-01f, 4.652339001e-01f,
+    4.598912788e-01f, 4.545467429e-01f, 4.492007520e-01f, 4.438537650e-01f,
+    4.385062398e-01f, 4.331586335e-01f, 4.278114022e-01f, 4.224650010e-01f,
+    4.171198839e-01f, 4.117765037e-01f, 4.064353122e-01f, 4.010967598e-01f,
+    3.957612957e-01f, 3.904293679e-01f, 3.851014229e-01f, 3.797779058e-01f,
+    3.744592601e-01f, 3.691459282e-01f, 3.638383504e-01f, 3.585369659e-01f,
+    3.532422119e-01f, 3.479545239e-01f, 3.426743360e-01f, 3.374020801e-01f,
+    3.321381865e-01f, 3.268830836e-01f, 3.216371976e-01f, 3.164009531e-01f,
+    3.111747726e-01f, 3.059590762e-01f, 3.007542824e-01f, 2.955608070e-01f,
+    2.903790642e-01f, 2.852094655e-01f, 2.800524202e-01f, 2.749083354e-01f,
+    2.697776159e-01f, 2.646606638e-01f, 2.595578789e-01f, 2.544696587e-01f,
+    2.493963979e-01f, 2.443384887e-01f, 2.392963207e-01f, 2.342702809e-01f,
+    2.292607536e-01f, 2.242681203e-01f, 2.192927597e-01f, 2.143350479e-01f,
+    2.093953580e-01f, 2.044740602e-01f, 1.995715218e-01f, 1.946881073e-01f,
+    1.898241780e-01f, 1.849800924e-01f, 1.801562056e-01f, 1.753528699e-01f,
+    1.705704345e-01f, 1.658092453e-01f, 1.610696449e-01f, 1.563519730e-01f,
+    1.516565658e-01f, 1.469837562e-01f, 1.423338740e-01f, 1.377072453e-01f,
+    1.331041932e-01f, 1.285250371e-01f, 1.239700931e-01f, 1.194396739e-01f,
+    1.149340884e-01f, 1.104536424e-01f, 1.059986378e-01f, 1.015693730e-01f,
+    9.716614295e-02f, 9.278923882e-02f, 8.843894815e-02f, 8.411555484e-02f,
+    7.981933903e-02f, 7.555057717e-02f, 7.130954195e-02f, 6.709650226e-02f,
+    6.291172322e-02f, 5.875546613e-02f, 5.462798843e-02f, 5.052954371e-02f,
+    4.646038167e-02f, 4.242074813e-02f, 3.841088496e-02f, 3.443103012e-02f,
+    3.048141758e-02f, 2.656227738e-02f, 2.267383552e-02f, 1.881631403e-02f,
+    1.498993089e-02f, 1.119490005e-02f, 7.431431419e-03f, 3.699730820e-03f,
+    3.676061815e-17f, -3.667563389e-03f, -7.302765803e-03f, -1.090541782e-02f,
+    -1.447533414e-02f, -1.801233363e-02f, -2.151623928e-02f, -2.498687825e-02f,
+    -2.842408190e-02f, -3.182768574e-02f, -3.519752947e-02f, -3.853345701e-02f,
+    -4.183531647e-02f, -4.510296017e-02f, -4.833624465e-02f, -5.153503067e-02f,
+    -5.469918322e-02f, -5.782857153e-02f, -6.092306905e-02f, -6.398255349e-02f,
+    -6.700690677e-02f, -6.999601509e-02f, -7.294976887e-02f, -7.586806281e-02f,
+    -7.875079581e-02f, -8.159787106e-02f, -8.440919598e-02f, -8.718468224e-02f,
+    -8.992424575e-02f, -9.262780668e-02f, -9.529528942e-02f, -9.792662260e-02f,
+    -1.005217391e-01f, -1.030805760e-01f, -1.056030747e-01f, -1.080891806e-01f,
+    -1.105388436e-01f, -1.129520177e-01f, -1.153286609e-01f, -1.176687356e-01f,
+    -1.199722085e-01f, -1.222390501e-01f, -1.244692355e-01f, -1.266627436e-01f,
+    -1.288195577e-01f, -1.309396652e-01f, -1.330230574e-01f, -1.350697300e-01f,
+    -1.370796826e-01f, -1.390529191e-01f, -1.409894473e-01f, -1.428892792e-01f,
+    -1.447524307e-01f, -1.465789218e-01f, -1.483687766e-01f, -1.501220232e-01f,
+    -1.518386936e-01f, -1.535188237e-01f, -1.551624537e-01f, -1.567696274e-01f,
+    -1.583403927e-01f, -1.598748013e-01f, -1.613729088e-01f, -1.628347749e-01f,
+    -1.642604627e-01f, -1.656500396e-01f, -1.670035765e-01f, -1.683211482e-01f,
+    -1.696028333e-01f, -1.708487141e-01f, -1.720588765e-01f, -1.732334104e-01f,
+    -1.743724091e-01f, -1.754759696e-01f, -1.765441928e-01f, -1.775771828e-01f,
+    -1.785750475e-01f, -1.795378985e-01f, -1.804658506e-01f, -1.813590223e-01f,
+    -1.822175356e-01f, -1.830415159e-01f, -1.838310920e-01f, -1.845863962e-01f,
+    -1.853075641e-01f, -1.859947347e-01f, -1.866480501e-01f, -1.872676560e-01f,
+    -1.878537013e-01f, -1.884063378e-01f, -1.889257209e-01f, -1.894120090e-01f,
+    -1.898653637e-01f, -1.902859496e-01f, -1.906739344e-01f, -1.910294890e-01f,
+    -1.913527871e-01f, -1.916440056e-01f, -1.919033241e-01f, -1.921309254e-01f,
+    -1.923269949e-01f, -1.924917211e-01f, -1.926252951e-01f, -1.927279110e-01f,
+    -1.927997656e-01f, -1.928410582e-01f, -1.928519910e-01f, -1.928327689e-01f,
+    -1.927835992e-01f, -1.927046920e-01f, -1.925962597e-01f, -1.924585174e-01f,
+    -1.922916826e-01f, -1.920959753e-01f, -1.918716178e-01f, -1.916188348e-01f,
+    -1.913378534e-01f, -1.910289029e-01f, -1.906922149e-01f, -1.903280231e-01f,
+    -1.899365636e-01f, -1.895180744e-01f, -1.890727957e-01f, -1.886009699e-01f,
+    -1.881028413e-01f, -1.875786561e-01f, -1.870286627e-01f, -1.864531111e-01f,
+    -1.858522533e-01f, -1.852263434e-01f, -1.845756368e-01f, -1.839003911e-01f,
+    -1.832008654e-01f, -1.824773204e-01f, -1.817300187e-01f, -1.809592243e-01f,
+    -1.801652027e-01f, -1.793482212e-01f, -1.785085484e-01f, -1.776464543e-01f,
+    -1.767622103e-01f, -1.758560893e-01f, -1.749283655e-01f, -1.739793141e-01f,
+    -1.730092120e-01f, -1.720183370e-01f, -1.710069681e-01f, -1.699753854e-01f,
+    -1.689238702e-01f, -1.678527047e-01f, -1.667621723e-01f, -1.656525571e-01f,
+    -1.645241443e-01f, -1.633772200e-01f, -1.622120710e-01f, -1.610289851e-01f,
+    -1.598282505e-01f, -1.586101566e-01f, -1.573749931e-01f, -1.561230506e-01f,
+    -1.548546200e-01f, -1.535699931e-01f, -1.522694620e-01f, -1.509533194e-01f,
+    -1.496218583e-01f, -1.482753723e-01f, -1.469141551e-01f, -1.455385010e-01f,
+    -1.441487045e-01f, -1.427450602e-01f, -1.413278630e-01f, -1.398974080e-01f,
+    -1.384539904e-01f, -1.369979056e-01f, -1.355294488e-01f, -1.340489155e-01f,
+    -1.325566008e-01f, -1.310528002e-01f, -1.295378087e-01f, -1.280119215e-01f,
+    -1.264754332e-01f, -1.249286386e-01f, -1.233718320e-01f, -1.218053074e-01f,
+    -1.202293587e-01f, -1.186442793e-01f, -1.170503619e-01f, -1.154478994e-01f,
+    -1.138371836e-01f, -1.122185061e-01f, -1.105921580e-01f, -1.089584296e-01f,
+    -1.073176107e-01f, -1.056699906e-01f, -1.040158575e-01f, -1.023554993e-01f,
+    -1.006892030e-01f, -9.901725458e-02f, -9.733993949e-02f, -9.565754220e-02f,
+    -9.397034626e-02f, -9.227863432e-02f, -9.058268806e-02f, -8.888278815e-02f,
+    -8.717921425e-02f, -8.547224493e-02f, -8.376215769e-02f, -8.204922889e-02f,
+    -8.033373372e-02f, -7.861594620e-02f, -7.689613911e-02f, -7.517458397e-02f,
+    -7.345155104e-02f, -7.172730925e-02f, -7.000212619e-02f, -6.827626806e-02f,
+    -6.654999967e-02f, -6.482358440e-02f, -6.309728416e-02f, -6.137135936e-02f,
+    -5.964606890e-02f, -5.792167014e-02f, -5.619841886e-02f, -5.447656921e-02f,
+    -5.275637376e-02f, -5.103808338e-02f, -4.932194728e-02f, -4.760821295e-02f,
+    -4.589712616e-02f, -4.418893089e-02f, -4.248386938e-02f, -4.078218203e-02f,
+    -3.908410739e-02f, -3.738988219e-02f, -3.569974127e-02f, -3.401391753e-02f,
+    -3.233264198e-02f, -3.065614367e-02f, -2.898464967e-02f, -2.731838506e-02f,
+    -2.565757290e-02f, -2.400243421e-02f, -2.235318796e-02f, -2.071005104e-02f,
+    -1.907323823e-02f, -1.744296220e-02f, -1.581943349e-02f, -1.420286047e-02f,
+    -1.259344933e-02f, -1.099140409e-02f, -9.396926527e-03f, -7.810216216e-03f,
+    -6.231470473e-03f, -4.660884353e-03f, -3.098650632e-03f, -1.544959791e-03f,
+    -3.074692570e-17f, 1.536042895e-03f, 3.062985390e-03f, 4.580646334e-03f,
+    6.088846949e-03f, 7.587410835e-03f, 9.076163989e-03f, 1.055493482e-02f,
+    1.202355415e-02f, 1.348185524e-02f, 1.492967380e-02f, 1.636684798e-02f,
+    1.779321842e-02f, 1.920862821e-02f, 2.061292296e-02f, 2.200595074e-02f,
+    2.338756216e-02f, 2.475761032e-02f, 2.611595086e-02f, 2.746244194e-02f,
+    2.879694428e-02f, 3.011932112e-02f, 3.142943827e-02f, 3.272716411e-02f,
+    3.401236955e-02f, 3.528492812e-02f, 3.654471589e-02f, 3.779161154e-02f,
+    3.902549631e-02f, 4.024625406e-02f, 4.145377123e-02f, 4.264793685e-02f,
+    4.382864259e-02f, 4.499578268e-02f, 4.614925398e-02f, 4.728895595e-02f,
+    4.841479068e-02f, 4.952666285e-02f, 5.062447975e-02f, 5.170815132e-02f,
+    5.277759007e-02f, 5.383271113e-02f, 5.487343228e-02f, 5.589967386e-02f,
+    5.691135885e-02f, 5.790841283e-02f, 5.889076399e-02f, 5.985834311e-02f,
+    6.081108359e-02f, 6.174892140e-02f, 6.267179514e-02f, 6.357964597e-02f,
+    6.447241763e-02f, 6.535005648e-02f, 6.621251140e-02f, 6.705973389e-02f,
+    6.789167799e-02f, 6.870830029e-02f, 6.950955995e-02f, 7.029541866e-02f,
+    7.106584066e-02f, 7.182079271e-02f, 7.256024411e-02f, 7.328416664e-02f,
+    7.399253462e-02f, 7.468532485e-02f, 7.536251662e-02f, 7.602409171e-02f,
+    7.667003434e-02f, 7.730033123e-02f, 7.791497151e-02f, 7.851394676e-02f,
+    7.909725100e-02f, 7.966488065e-02f, 8.021683454e-02f, 8.075311390e-02f,
+    8.127372231e-02f, 8.177866575e-02f, 8.226795255e-02f, 8.274159335e-02f,
+    8.319960116e-02f, 8.364199127e-02f, 8.406878130e-02f, 8.447999113e-02f,
+    8.487564292e-02f, 8.525576111e-02f, 8.562037234e-02f, 8.596950550e-02f,
+    8.630319170e-02f, 8.662146423e-02f, 8.692435857e-02f, 8.721191234e-02f,
+    8.748416534e-02f, 8.774115947e-02f, 8.798293877e-02f, 8.820954935e-02f,
+    8.842103940e-02f, 8.861745920e-02f, 8.879886105e-02f, 8.896529925e-02f,
+    8.911683016e-02f, 8.925351208e-02f, 8.937540531e-02f, 8.948257207e-02f,
+    8.957507654e-02f, 8.965298478e-02f, 8.971636478e-02f, 8.976528636e-02f,
+    8.979982122e-02f, 8.982004288e-02f, 8.982602667e-02f, 8.981784971e-02f,
+    8.979559089e-02f, 8.975933085e-02f, 8.970915197e-02f, 8.964513831e-02f,
+    8.956737564e-02f, 8.947595137e-02f, 8.937095457e-02f, 8.925247592e-02f,
+    8.912060771e-02f, 8.897544379e-02f, 8.881707958e-02f, 8.864561201e-02f,
+    8.846113955e-02f, 8.826376212e-02f, 8.805358112e-02f, 8.783069941e-02f,
+    8.759522123e-02f, 8.734725225e-02f, 8.708689948e-02f, 8.681427130e-02f,
+    8.652947741e-02f, 8.623262881e-02f, 8.592383776e-02f, 8.560321781e-02f,
+    8.527088372e-02f, 8.492695144e-02f, 8.457153814e-02f, 8.420476212e-02f,
+    8.382674282e-02f, 8.343760080e-02f, 8.303745769e-02f, 8.262643621e-02f,
+    8.220466008e-02f, 8.177225408e-02f, 8.132934393e-02f, 8.087605636e-02f,
+    8.041251900e-02f, 7.993886044e-02f, 7.945521012e-02f, 7.896169837e-02f,
+    7.845845637e-02f, 7.794561609e-02f, 7.742331033e-02f, 7.689167264e-02f,
+    7.635083730e-02f, 7.580093935e-02f, 7.524211449e-02f, 7.467449911e-02f,
+    7.409823023e-02f, 7.351344552e-02f, 7.292028324e-02f, 7.231888219e-02f,
+    7.170938177e-02f, 7.109192187e-02f, 7.046664290e-02f, 6.983368573e-02f,
+    6.919319169e-02f, 6.854530255e-02f, 6.789016047e-02f, 6.722790798e-02f,
+    6.655868799e-02f, 6.588264372e-02f, 6.519991872e-02f, 6.451065680e-02f,
+    6.381500204e-02f, 6.311309877e-02f, 6.240509151e-02f, 6.169112498e-02f,
+    6.097134407e-02f, 6.024589380e-02f, 5.951491933e-02f, 5.877856589e-02f,
+    5.803697879e-02f, 5.729030341e-02f, 5.653868514e-02f, 5.578226936e-02f,
+    5.502120146e-02f, 5.425562676e-02f, 5.348569055e-02f, 5.271153800e-02f,
+    5.193331419e-02f, 5.115116407e-02f, 5.036523243e-02f, 4.957566389e-02f,
+    4.878260286e-02f, 4.798619356e-02f, 4.718657995e-02f, 4.638390573e-02f,
+    4.557831432e-02f, 4.476994885e-02f, 4.395895212e-02f, 4.314546656e-02f,
+    4.232963428e-02f, 4.151159696e-02f, 4.069149591e-02f, 3.986947200e-02f,
+    3.904566564e-02f, 3.822021680e-02f, 3.739326495e-02f, 3.656494905e-02f,
+    3.573540756e-02f, 3.490477837e-02f, 3.407319883e-02f, 3.324080568e-02f,
+    3.240773510e-02f, 3.157412262e-02f, 3.074010315e-02f, 2.990581094e-02f,
+    2.907137957e-02f, 2.823694193e-02f, 2.740263022e-02f, 2.656857588e-02f,
+    2.573490965e-02f, 2.490176147e-02f, 2.406926055e-02f, 2.323753527e-02f,
+    2.240671324e-02f, 2.157692120e-02f, 2.074828511e-02f, 1.992093001e-02f,
+    1.909498013e-02f, 1.827055878e-02f, 1.744778838e-02f, 1.662679043e-02f,
+    1.580768551e-02f, 1.499059325e-02f, 1.417563232e-02f, 1.336292042e-02f,
+    1.255257428e-02f, 1.174470960e-02f, 1.093944110e-02f, 1.013688245e-02f,
+    9.337146299e-03f, 8.540344238e-03f, 7.746586799e-03f, 6.955983436e-03f,
+    6.168642519e-03f, 5.384671319e-03f, 4.604175997e-03f, 3.827261595e-03f,
+    3.054032021e-03f, 2.284590043e-03f, 1.519037274e-03f, 7.574741675e-04f,
+    2.261504193e-17f, -7.532871323e-04f, -1.502290326e-03f, -2.246913879e-03f,
+    -2.987063301e-03f, -3.722645319e-03f, -4.453567889e-03f, -5.179740205e-03f,
+    -5.901072701e-03f, -6.617477068e-03f, -7.328866254e-03f, -8.035154474e-03f,
+    -8.736257220e-03f, -9.432091263e-03f, -1.012257466e-02f, -1.080762677e-02f,
+    -1.148716825e-02f, -1.216112105e-02f, -1.282940845e-02f, -1.349195503e-02f,
+    -1.414868673e-02f, -1.479953076e-02f, -1.544441572e-02f, -1.608327150e-02f,
+    -1.671602937e-02f, -1.734262192e-02f, -1.796298310e-02f, -1.857704821e-02f,
+    -1.918475391e-02f, -1.978603821e-02f, -2.038084049e-02f, -2.096910149e-02f,
+    -2.155076333e-02f, -2.212576948e-02f, -2.269406480e-02f, -2.325559551e-02f,
+    -2.381030921e-02f, -2.435815487e-02f, -2.489908284e-02f, -2.543304487e-02f,
+    -2.595999404e-02f, -2.647988485e-02f, -2.699267316e-02f, -2.749831622e-02f,
+    -2.799677265e-02f, -2.848800245e-02f, -2.897196699e-02f, -2.944862903e-02f,
+    -2.991795269e-02f, -3.037990347e-02f, -3.083444825e-02f, -3.128155528e-02f,
+    -3.172119415e-02f, -3.215333585e-02f, -3.257795271e-02f, -3.299501844e-02f,
+    -3.340450809e-02f, -3.380639808e-02f, -3.420066616e-02f, -3.458729145e-02f,
+    -3.496625441e-02f, -3.533753682e-02f, -3.570112182e-02f, -3.605699388e-02f,
+    -3.640513877e-02f, -3.674554362e-02f, -3.707819685e-02f, -3.740308820e-02f,
+    -3.772020874e-02f, -3.802955080e-02f, -3.833110804e-02f, -3.862487539e-02f,
+    -3.891084908e-02f, -3.918902662e-02f, -3.945940677e-02f, -3.972198957e-02f,
+    -3.997677632e-02f, -4.022376958e-02f, -4.046297313e-02f, -4.069439202e-02f,
+    -4.091803249e-02f, -4.113390205e-02f, -4.134200939e-02f, -4.154236442e-02f,
+    -4.173497824e-02f, -4.191986317e-02f, -4.209703267e-02f, -4.226650141e-02f,
+    -4.242828520e-02f, -4.258240104e-02f, -4.272886703e-02f, -4.286770246e-02f,
+    -4.299892772e-02f, -4.312256433e-02f, -4.323863491e-02f, -4.334716319e-02f,
+    -4.344817400e-02f, -4.354169324e-02f, -4.362774789e-02f, -4.370636598e-02f,
+    -4.377757660e-02f, -4.384140989e-02f, -4.389789700e-02f, -4.394707012e-02f,
+    -4.398896244e-02f, -4.402360815e-02f, -4.405104243e-02f, -4.407130144e-02f,
+    -4.408442228e-02f, -4.409044305e-02f, -4.408940276e-02f, -4.408134136e-02f,
+    -4.406629971e-02f, -4.404431961e-02f, -4.401544372e-02f, -4.397971561e-02f,
+    -4.393717972e-02f, -4.388788133e-02f, -4.383186660e-02f, -4.376918250e-02f,
+    -4.369987686e-02f, -4.362399827e-02f, -4.354159618e-02f, -4.345272078e-02f,
+    -4.335742306e-02f, -4.325575477e-02f, -4.314776841e-02f, -4.303351721e-02f,
+    -4.291305514e-02f, -4.278643687e-02f, -4.265371777e-02f, -4.251495390e-02f,
+    -4.237020199e-02f, -4.221951944e-02f, -4.206296430e-02f, -4.190059523e-02f,
+    -4.173247154e-02f, -4.155865314e-02f, -4.137920052e-02f, -4.119417478e-02f,
+    -4.100363756e-02f, -4.080765108e-02f, -4.060627809e-02f, -4.039958188e-02f,
+    -4.018762624e-02f, -3.997047547e-02f, -3.974819436e-02f, -3.952084818e-02f,
+    -3.928850266e-02f, -3.905122399e-02f, -3.880907876e-02f, -3.856213403e-02f,
+    -3.831045724e-02f, -3.805411623e-02f, -3.779317923e-02f, -3.752771484e-02f,
+    -3.725779201e-02f, -3.698348003e-02f, -3.670484852e-02f, -3.642196743e-02f,
+    -3.613490700e-02f, -3.584373777e-02f, -3.554853053e-02f, -3.524935637e-02f,
+    -3.494628660e-02f, -3.463939278e-02f, -3.432874670e-02f, -3.401442036e-02f,
+    -3.369648593e-02f, -3.337501580e-02f, -3.305008251e-02f, -3.272175877e-02f,
+    -3.239011742e-02f, -3.205523146e-02f, -3.171717399e-02f, -3.137601821e-02f,
+    -3.103183744e-02f, -3.068470505e-02f, -3.033469451e-02f, -2.998187933e-02f,
+    -2.962633306e-02f, -2.926812930e-02f, -2.890734166e-02f, -2.854404374e-02f,
+    -2.817830916e-02f, -2.781021150e-02f, -2.743982434e-02f, -2.706722120e-02f,
+    -2.669247553e-02f, -2.631566075e-02f, -2.593685018e-02f, -2.555611704e-02f,
+    -2.517353449e-02f, -2.478917553e-02f, -2.440311307e-02f, -2.401541987e-02f,
+    -2.362616855e-02f, -2.323543156e-02f, -2.284328120e-02f, -2.244978956e-02f,
+    -2.205502857e-02f, -2.165906994e-02f, -2.126198518e-02f, -2.086384556e-02f,
+    -2.046472213e-02f, -2.006468568e-02f, -1.966380676e-02f, -1.926215565e-02f,
+    -1.885980234e-02f, -1.845681655e-02f, -1.805326770e-02f, -1.764922491e-02f,
+    -1.724475697e-02f, -1.683993235e-02f, -1.643481919e-02f, -1.602948528e-02f,
+    -1.562399806e-02f, -1.521842461e-02f, -1.481283161e-02f, -1.440728540e-02f,
+    -1.400185189e-02f, -1.359659663e-02f, -1.319158473e-02f, -1.278688090e-02f,
+    -1.238254941e-02f, -1.197865411e-02f, -1.157525841e-02f, -1.117242525e-02f,
+    -1.077021714e-02f, -1.036869610e-02f, -9.967923688e-03f, -9.567960980e-03f,
+    -9.168868561e-03f, -8.770706519e-03f, -8.373534442e-03f, -7.977411403e-03f,
+    -7.582395959e-03f, -7.188546145e-03f, -6.795919461e-03f, -6.404572869e-03f,
+    -6.014562790e-03f, -5.625945090e-03f, -5.238775080e-03f, -4.853107508e-03f,
+    -4.468996550e-03f, -4.086495811e-03f, -3.705658310e-03f, -3.326536485e-03f,
+    -2.949182176e-03f, -2.573646631e-03f, -2.199980492e-03f, -1.828233794e-03f,
+    -1.458455959e-03f, -1.090695794e-03f, -7.250014798e-04f, -3.614205736e-04f,
+    -1.438319074e-17f, 3.592139518e-04f, 7.161756320e-04f, 1.070840035e-03f,
+    1.423162802e-03f, 1.773100226e-03f, 2.120609255e-03f, 2.465647497e-03f,
+    2.808173219e-03f, 3.148145355e-03f, 3.485523508e-03f, 3.820267950e-03f,
+    4.152339628e-03f, 4.481700168e-03f, 4.808311873e-03f, 5.132137728e-03f,
+    5.453141403e-03f, 5.771287254e-03f, 6.086540326e-03f, 6.398866354e-03f,
+    6.708231765e-03f, 7.014603681e-03f, 7.317949918e-03f, 7.618238989e-03f,
+    7.915440108e-03f, 8.209523185e-03f, 8.500458831e-03f, 8.788218360e-03f,
+    9.072773787e-03f, 9.354097831e-03f, 9.632163911e-03f, 9.906946155e-03f,
+    1.017841939e-02f, 1.044655915e-02f, 1.071134168e-02f, 1.097274391e-02f,
+    1.123074349e-02f, 1.148531877e-02f, 1.173644881e-02f, 1.198411336e-02f,
+    1.222829288e-02f, 1.246896853e-02f, 1.270612218e-02f, 1.293973637e-02f,
+    1.316979437e-02f, 1.339628013e-02f, 1.361917830e-02f, 1.383847424e-02f,
+    1.405415397e-02f, 1.426620423e-02f, 1.447461244e-02f, 1.467936669e-02f,
+    1.488045579e-02f, 1.507786921e-02f, 1.527159709e-02f, 1.546163028e-02f,
+    1.564796029e-02f, 1.583057929e-02f, 1.600948015e-02f, 1.618465639e-02f,
+    1.635610219e-02f, 1.652381241e-02f, 1.668778256e-02f, 1.684800881e-02f,
+    1.700448797e-02f, 1.715721753e-02f, 1.730619558e-02f, 1.745142091e-02f,
+    1.759289289e-02f, 1.773061158e-02f, 1.786457763e-02f, 1.799479234e-02f,
+    1.812125763e-02f, 1.824397604e-02f, 1.836295072e-02f, 1.847818545e-02f,
+    1.858968459e-02f, 1.869745312e-02f, 1.880149662e-02f, 1.890182126e-02f,
+    1.899843380e-02f, 1.909134158e-02f, 1.918055252e-02f, 1.926607514e-02f,
+    1.934791849e-02f, 1.942609221e-02f, 1.950060651e-02f, 1.957147212e-02f,
+    1.963870036e-02f, 1.970230306e-02f, 1.976229262e-02f, 1.981868195e-02f,
+    1.987148451e-02f, 1.992071426e-02f, 1.996638570e-02f, 2.000851382e-02f,
+    2.004711414e-02f, 2.008220267e-02f, 2.011379591e-02f, 2.014191086e-02f,
+    2.016656498e-02f, 2.018777624e-02f, 2.020556307e-02f, 2.021994435e-02f,
+    2.023093943e-02f, 2.023856812e-02f, 2.024285066e-02f, 2.024380776e-02f,
+    2.024146054e-02f, 2.023583055e-02f, 2.022693977e-02f, 2.021481059e-02f,
+    2.019946581e-02f, 2.018092864e-02f, 2.015922269e-02f, 2.013437193e-02f,
+    2.010640076e-02f, 2.007533391e-02f, 2.004119651e-02f, 2.000401405e-02f,
+    1.996381237e-02f, 1.992061766e-02f, 1.987445646e-02f, 1.982535565e-02f,
+    1.977334243e-02f, 1.971844433e-02f, 1.966068919e-02f, 1.960010518e-02f,
+    1.953672074e-02f, 1.947056464e-02f, 1.940166592e-02f, 1.933005391e-02f,
+    1.925575822e-02f, 1.917880871e-02f, 1.909923554e-02f, 1.901706908e-02f,
+    1.893233999e-02f, 1.884507914e-02f, 1.875531765e-02f, 1.866308687e-02f,
+    1.856841838e-02f, 1.847134395e-02f, 1.837189557e-02f, 1.827010544e-02f,
+    1.816600594e-02f, 1.805962965e-02f, 1.795100932e-02f, 1.784017788e-02f,
+    1.772716843e-02f, 1.761201421e-02f, 1.749474864e-02f, 1.737540527e-02f,
+    1.725401779e-02f, 1.713062004e-02f, 1.700524597e-02f, 1.687792965e-02f,
+    1.674870527e-02f, 1.661760712e-02f, 1.648466959e-02f, 1.634992717e-02f,
+    1.621341444e-02f, 1.607516604e-02f, 1.593521671e-02f, 1.579360122e-02f,
+    1.565035445e-02f, 1.550551129e-02f, 1.535910669e-02f, 1.521117567e-02f,
+    1.506175323e-02f, 1.491087445e-02f, 1.475857441e-02f, 1.460488820e-02f,
+    1.444985093e-02f, 1.429349770e-02f, 1.413586364e-02f, 1.397698382e-02f,
+    1.381689335e-02f, 1.365562728e-02f, 1.349322064e-02f, 1.332970845e-02f,
+    1.316512566e-02f, 1.299950719e-02f, 1.283288791e-02f, 1.266530264e-02f,
+    1.249678613e-02f, 1.232737305e-02f, 1.215709802e-02f, 1.198599557e-02f,
+    1.181410014e-02f, 1.164144609e-02f, 1.146806768e-02f, 1.129399907e-02f,
+    1.111927431e-02f, 1.094392735e-02f, 1.076799201e-02f, 1.059150199e-02f,
+    1.041449086e-02f, 1.023699208e-02f, 1.005903895e-02f, 9.880664627e-03f,
+    9.701902136e-03f, 9.522784340e-03f, 9.343343948e-03f, 9.163613506e-03f,
+    8.983625396e-03f, 8.803411826e-03f, 8.623004833e-03f, 8.442436269e-03f,
+    8.261737806e-03f, 8.080940925e-03f, 7.900076914e-03f, 7.719176865e-03f,
+    7.538271667e-03f, 7.357392005e-03f, 7.176568351e-03f, 6.995830967e-03f,
+    6.815209894e-03f, 6.634734955e-03f, 6.454435745e-03f, 6.274341630e-03f,
+    6.094481742e-03f, 5.914884981e-03f, 5.735580001e-03f, 5.556595217e-03f,
+    5.377958794e-03f, 5.199698648e-03f, 5.021842442e-03f, 4.844417580e-03f,
+    4.667451208e-03f, 4.490970207e-03f, 4.315001193e-03f, 4.139570512e-03f,
+    3.964704238e-03f, 3.790428171e-03f, 3.616767832e-03f, 3.443748463e-03f,
+    3.271395020e-03f, 3.099732178e-03f, 2.928784320e-03f, 2.758575539e-03f,
+    2.589129637e-03f, 2.420470120e-03f, 2.252620195e-03f, 2.085602772e-03f,
+    1.919440457e-03f, 1.754155554e-03f, 1.589770060e-03f, 1.426305665e-03f,
+    1.263783751e-03f, 1.102225386e-03f, 9.416513282e-04f, 7.820820194e-04f,
+    6.235375862e-04f, 4.660378377e-04f, 3.096022641e-04f, 1.542500354e-04f,
+    7.668744912e-18f, -1.531293162e-04f, -3.051197114e-04f, -4.559533085e-04f,
+    -6.056125564e-04f, -7.540802312e-04f, -9.013394363e-04f, -1.047373604e-03f,
+    -1.192166496e-03f, -1.335702205e-03f, -1.477965151e-03f, -1.618940090e-03f,
+    -1.758612107e-03f, -1.896966618e-03f, -2.033989376e-03f, -2.169666461e-03f,
+    -2.303984292e-03f, -2.436929616e-03f, -2.568489518e-03f, -2.698651414e-03f,
+    -2.827403053e-03f, -2.954732519e-03f, -3.080628228e-03f, -3.205078931e-03f,
+    -3.328073710e-03f, -3.449601981e-03f, -3.569653491e-03f, -3.688218320e-03f,
+    -3.805286877e-03f, -3.920849906e-03f, -4.034898478e-03f, -4.147423993e-03f,
+    -4.258418183e-03f, -4.367873106e-03f, -4.475781148e-03f, -4.582135021e-03f,
+    -4.686927763e-03f, -4.790152735e-03f, -4.891803625e-03f, -4.991874440e-03f,
+    -5.090359511e-03f, -5.187253486e-03f, -5.282551335e-03f, -5.376248344e-03f,
+    -5.468340117e-03f, -5.558822570e-03f, -5.647691934e-03f, -5.734944754e-03f,
+    -5.820577883e-03f, -5.904588482e-03f, -5.986974023e-03f, -6.067732281e-03f,
+    -6.146861335e-03f, -6.224359567e-03f, -6.300225660e-03f, -6.374458592e-03f,
+    -6.447057643e-03f, -6.518022383e-03f, -6.587352678e-03f, -6.655048683e-03f,
+    -6.721110842e-03f, -6.785539887e-03f, -6.848336831e-03f, -6.909502974e-03f,
+    -6.969039892e-03f, -7.026949442e-03f, -7.083233755e-03f, -7.137895234e-03f,
+    -7.190936557e-03f, -7.242360666e-03f, -7.292170773e-03f, -7.340370351e-03f,
+    -7.386963135e-03f, -7.431953119e-03f, -7.475344554e-03f, -7.517141943e-03f,
+    -7.557350041e-03f, -7.595973851e-03f, -7.633018622e-03f, -7.668489846e-03f,
+    -7.702393255e-03f, -7.734734820e-03f, -7.765520743e-03f, -7.794757463e-03f,
+    -7.822451646e-03f, -7.848610183e-03f, -7.873240190e-03f, -7.896349004e-03f,
+    -7.917944179e-03f, -7.938033485e-03f, -7.956624901e-03f, -7.973726619e-03f,
+    -7.989347033e-03f, -8.003494742e-03f, -8.016178546e-03f, -8.027407439e-03f,
+    -8.037190611e-03f, -8.045537442e-03f, -8.052457500e-03f, -8.057960538e-03f,
+    -8.062056488e-03f, -8.064755464e-03f, -8.066067753e-03f, -8.066003815e-03f,
+    -8.064574278e-03f, -8.061789937e-03f, -8.057661748e-03f, -8.052200829e-03f,
+    -8.045418452e-03f, -8.037326043e-03f, -8.027935177e-03f, -8.017257577e-03f,
+    -8.005305108e-03f, -7.992089778e-03f, -7.977623727e-03f, -7.961919234e-03f,
+    -7.944988706e-03f, -7.926844677e-03f, -7.907499806e-03f, -7.886966872e-03f,
+    -7.865258774e-03f, -7.842388523e-03f, -7.818369241e-03f, -7.793214159e-03f,
+    -7.766936614e-03f, -7.739550041e-03f, -7.711067977e-03f, -7.681504051e-03f,
+    -7.650871986e-03f, -7.619185593e-03f, -7.586458768e-03f, -7.552705489e-03f,
+    -7.517939815e-03f, -7.482175879e-03f, -7.445427886e-03f, -7.407710114e-03f,
+    -7.369036904e-03f, -7.329422662e-03f, -7.288881853e-03f, -7.247429000e-03f,
+    -7.205078679e-03f, -7.161845518e-03f, -7.117744192e-03f, -7.072789420e-03f,
+    -7.026995963e-03f, -6.980378622e-03f, -6.932952232e-03f, -6.884731660e-03f,
+    -6.835731803e-03f, -6.785967586e-03f, -6.735453954e-03f, -6.684205877e-03f,
+    -6.632238338e-03f, -6.579566339e-03f, -6.526204892e-03f, -6.472169015e-03f,
+    -6.417473738e-03f, -6.362134089e-03f, -6.306165099e-03f, -6.249581796e-03f,
+    -6.192399203e-03f, -6.134632334e-03f, -6.076296193e-03f, -6.017405771e-03f,
+    -5.957976043e-03f, -5.898021963e-03f, -5.837558467e-03f, -5.776600464e-03f,
+    -5.715162837e-03f, -5.653260441e-03f, -5.590908098e-03f, -5.528120596e-03f,
+    -5.464912685e-03f, -5.401299077e-03f, -5.337294442e-03f, -5.272913406e-03f,
+    -5.208170546e-03f, -5.143080393e-03f, -5.077657425e-03f, -5.011916067e-03f,
+    -4.945870687e-03f, -4.879535595e-03f, -4.812925042e-03f, -4.746053213e-03f,
+    -4.678934230e-03f, -4.611582150e-03f, -4.544010956e-03f, -4.476234563e-03f,
+    -4.408266813e-03f, -4.340121470e-03f, -4.271812221e-03f, -4.203352676e-03f,
+    -4.134756360e-03f, -4.066036719e-03f, -3.997207109e-03f, -3.928280801e-03f,
+    -3.859270979e-03f, -3.790190733e-03f, -3.721053062e-03f, -3.651870870e-03f,
+    -3.582656967e-03f, -3.513424063e-03f, -3.444184769e-03f, -3.374951596e-03f,
+    -3.305736953e-03f, -3.236553142e-03f, -3.167412363e-03f, -3.098326707e-03f,
+    -3.029308157e-03f, -2.960368584e-03f, -2.891519751e-03f, -2.822773306e-03f,
+    -2.754140783e-03f, -2.685633601e-03f, -2.617263064e-03f, -2.549040355e-03f,
+    -2.480976539e-03f, -2.413082563e-03f, -2.345369249e-03f, -2.277847299e-03f,
+    -2.210527290e-03f, -2.143419675e-03f, -2.076534782e-03f, -2.009882811e-03f,
+    -1.943473835e-03f, -1.877317799e-03f, -1.811424518e-03f, -1.745803676e-03f,
+    -1.680464828e-03f, -1.615417396e-03f, -1.550670668e-03f, -1.486233800e-03f,
+    -1.422115816e-03f, -1.358325601e-03f, -1.294871908e-03f, -1.231763353e-03f,
+    -1.169008415e-03f, -1.106615437e-03f, -1.044592623e-03f, -9.829480410e-04f,
+    -9.216896182e-04f, -8.608251443e-04f, -8.003622696e-04f, -7.403085045e-04f,
+    -6.806712196e-04f, -6.214576451e-04f, -5.626748706e-04f, -5.043298453e-04f,
+    -4.464293769e-04f, -3.889801324e-04f, -3.319886371e-04f, -2.754612753e-04f,
+    -2.194042894e-04f, -1.638237804e-04f, -1.087257076e-04f, -5.411588877e-05f,
+    -3.225340165e-18f, 5.361642415e-05f, 1.067279906e-04f, 1.593294477e-04f,
+    2.114156850e-04f, 2.629817331e-04f, 3.140227636e-04f, 3.645340887e-04f,
+    4.145111612e-04f, 4.639495739e-04f, 5.128450598e-04f, 5.611934911e-04f,
+    6.089908797e-04f, 6.562333761e-04f, 7.029172693e-04f, 7.490389867e-04f,
+    7.945950929e-04f, 8.395822902e-04f, 8.839974172e-04f, 9.278374489e-04f,
+    9.710994960e-04f, 1.013780804e-03f, 1.055878754e-03f, 1.097390860e-03f,
+    1.138314769e-03f, 1.178648262e-03f, 1.218389251e-03f, 1.257535779e-03f,
+    1.296086022e-03f, 1.334038283e-03f, 1.371390997e-03f, 1.408142723e-03f,
+    1.444292153e-03f, 1.479838103e-03f, 1.514779514e-03f, 1.549115454e-03f,
+    1.582845116e-03f, 1.615967813e-03f, 1.648482984e-03f, 1.680390188e-03f,
+    1.711689105e-03f, 1.742379534e-03f, 1.772461395e-03f, 1.801934723e-03f,
+    1.830799672e-03f, 1.859056510e-03f, 1.886705621e-03f, 1.913747502e-03f,
+    1.940182764e-03f, 1.966012127e-03f, 1.991236424e-03f, 2.015856597e-03f,
+    2.039873694e-03f, 2.063288875e-03f, 2.086103400e-03f, 2.108318638e-03f,
+    2.129936062e-03f, 2.150957245e-03f, 2.171383862e-03f, 2.191217690e-03f,
+    2.210460604e-03f, 2.229114575e-03f, 2.247181674e-03f, 2.264664064e-03f,
+    2.281564004e-03f, 2.297883846e-03f, 2.313626032e-03f, 2.328793096e-03f,
+    2.343387659e-03f, 2.357412432e-03f, 2.370870211e-03f, 2.383763878e-03f,
+    2.396096397e-03f, 2.407870817e-03f, 2.419090267e-03f, 2.429757955e-03f,
+    2.439877169e-03f, 2.449451273e-03f, 2.458483709e-03f, 2.466977991e-03f,
+    2.474937707e-03f, 2.482366518e-03f, 2.489268154e-03f, 2.495646414e-03f,
+    2.501505166e-03f, 2.506848343e-03f, 2.511679945e-03f, 2.516004033e-03f,
+    2.519824733e-03f, 2.523146230e-03f, 2.525972768e-03f, 2.528308652e-03f,
+    2.530158240e-03f, 2.531525950e-03f, 2.532416249e-03f, 2.532833660e-03f,
+    2.532782756e-03f, 2.532268161e-03f, 2.531294546e-03f, 2.529866630e-03f,
+    2.527989178e-03f, 2.525666999e-03f, 2.522904945e-03f, 2.519707910e-03f,
+    2.516080828e-03f, 2.512028672e-03f, 2.507556453e-03f, 2.502669218e-03f,
+    2.497372050e-03f, 2.491670062e-03f, 2.485568404e-03f, 2.479072254e-03f,
+    2.472186820e-03f, 2.464917339e-03f, 2.457269073e-03f, 2.449247313e-03f,
+    2.440857371e-03f, 2.432104583e-03f, 2.422994309e-03f, 2.413531925e-03f,
+    2.403722831e-03f, 2.393572441e-03f, 2.383086187e-03f, 2.372269518e-03f,
+    2.361127893e-03f, 2.349666789e-03f, 2.337891690e-03f, 2.325808093e-03f,
+    2.313421503e-03f, 2.300737434e-03f, 2.287761406e-03f, 2.274498944e-03f,
+    2.260955579e-03f, 2.247136843e-03f, 2.233048272e-03f, 2.218695401e-03f,
+    2.204083767e-03f, 2.189218903e-03f, 2.174106341e-03f, 2.158751609e-03f,
+    2.143160230e-03f, 2.127337720e-03f, 2.111289592e-03f, 2.095021345e-03f,
+    2.078538474e-03f, 2.061846461e-03f, 2.044950777e-03f, 2.027856882e-03f,
+    2.010570222e-03f, 1.993096229e-03f, 1.975440318e-03f, 1.957607890e-03f,
+    1.939604327e-03f, 1.921434994e-03f, 1.903105237e-03f, 1.884620381e-03f,
+    1.865985730e-03f, 1.847206566e-03f, 1.828288148e-03f, 1.809235713e-03f,
+    1.790054472e-03f, 1.770749610e-03f, 1.751326286e-03f, 1.731789633e-03f,
+    1.712144754e-03f, 1.692396726e-03f, 1.672550593e-03f, 1.652611372e-03f,
+    1.632584047e-03f, 1.612473569e-03f, 1.592284859e-03f, 1.572022803e-03f,
+    1.551692253e-03f, 1.531298027e-03f, 1.510844907e-03f, 1.490337639e-03f,
+    1.469780931e-03f, 1.449179455e-03f, 1.428537846e-03f, 1.407860697e-03f,
+    1.387152563e-03f, 1.366417962e-03f, 1.345661366e-03f, 1.324887212e-03f,
+    1.304099890e-03f, 1.283303751e-03f, 1.262503103e-03f, 1.241702210e-03f,
+    1.220905292e-03f, 1.200116526e-03f, 1.179340044e-03f, 1.158579933e-03f,
+    1.137840234e-03f, 1.117124943e-03f, 1.096438007e-03f, 1.075783330e-03f,
+    1.055164766e-03f, 1.034586123e-03f, 1.014051161e-03f, 9.935635906e-04f,
+    9.731270750e-04f, 9.527452280e-04f, 9.324216144e-04f, 9.121597496e-04f,
+    8.919630990e-04f, 8.718350782e-04f, 8.517790525e-04f, 8.317983367e-04f,
+    8.118961947e-04f, 7.920758396e-04f, 7.723404335e-04f, 7.526930869e-04f,
+    7.331368590e-04f, 7.136747573e-04f, 6.943097375e-04f, 6.750447032e-04f,
+    6.558825062e-04f, 6.368259461e-04f, 6.178777700e-04f, 5.990406729e-04f,
+    5.803172973e-04f, 5.617102332e-04f, 5.432220181e-04f, 5.248551368e-04f,
+    5.066120218e-04f, 4.884950528e-04f, 4.705065568e-04f, 4.526488086e-04f,
+    4.349240299e-04f, 4.173343904e-04f, 3.998820069e-04f, 3.825689440e-04f,
+    3.653972140e-04f, 3.483687766e-04f, 3.314855396e-04f, 3.147493586e-04f,
+    2.981620373e-04f, 2.817253275e-04f, 2.654409291e-04f, 2.493104907e-04f,
+    2.333356094e-04f, 2.175178308e-04f, 2.018586497e-04f, 1.863595098e-04f,
+    1.710218042e-04f, 1.558468754e-04f, 1.408360156e-04f, 1.259904670e-04f,
+    1.113114218e-04f, 9.680002267e-05f, 8.245736290e-05f, 6.828448666e-05f,
+    5.428238925e-05f, 4.045201742e-05f, 2.679426959e-05f, 1.330999621e-05f,
+    9.236680200e-19f, -1.313496371e-05f, -2.609418669e-05f, -3.887700746e-05f,
+    -5.148281099e-05f, -6.391102834e-05f, -7.616113634e-05f, -8.823265722e-05f,
+    -1.001251582e-04f, -1.118382514e-04f, -1.233715929e-04f, -1.347248830e-04f,
+    -1.458978655e-04f, -1.568903272e-04f, -1.677020978e-04f, -1.783330494e-04f,
+    -1.887830960e-04f, -1.990521930e-04f, -2.091403371e-04f, -2.190475657e-04f,
+    -2.287739563e-04f, -2.383196263e-04f, -2.476847326e-04f, -2.568694709e-04f,
+    -2.658740753e-04f, -2.746988183e-04f, -2.833440096e-04f, -2.918099962e-04f,
+    -3.000971616e-04f, -3.082059258e-04f, -3.161367440e-04f, -3.238901071e-04f,
+    -3.314665404e-04f, -3.388666037e-04f, -3.460908903e-04f, -3.531400271e-04f,
+    -3.600146736e-04f, -3.667155214e-04f, -3.732432942e-04f, -3.795987468e-04f,
+    -3.857826648e-04f, -3.917958641e-04f, -3.976391903e-04f, -4.033135183e-04f,
+    -4.088197516e-04f, -4.141588222e-04f, -4.193316894e-04f, -4.243393401e-04f,
+    -4.291827874e-04f, -4.338630710e-04f, -4.383812558e-04f, -4.427384322e-04f,
+    -4.469357149e-04f, -4.509742426e-04f, -4.548551778e-04f, -4.585797057e-04f,
+    -4.621490342e-04f, -4.655643929e-04f, -4.688270332e-04f, -4.719382270e-04f,
+    -4.748992667e-04f, -4.777114647e-04f, -4.803761526e-04f, -4.828946808e-04f,
+    -4.852684179e-04f, -4.874987504e-04f, -4.895870819e-04f, -4.915348329e-04f,
+    -4.933434399e-04f, -4.950143550e-04f, -4.965490458e-04f, -4.979489943e-04f,
+    -4.992156967e-04f, -5.003506627e-04f, -5.013554153e-04f, -5.022314899e-04f,
+    -5.029804343e-04f, -5.036038075e-04f, -5.041031799e-04f, -5.044801324e-04f,
+    -5.047362559e-04f, -5.048731510e-04f, -5.048924275e-04f, -5.047957037e-04f,
+    -5.045846059e-04f, -5.042607684e-04f, -5.038258324e-04f, -5.032814459e-04f,
+    -5.026292631e-04f, -5.018709440e-04f, -5.010081538e-04f, -5.000425625e-04f,
+    -4.989758447e-04f, -4.978096786e-04f, -4.965457461e-04f, -4.951857320e-04f,
+    -4.937313235e-04f, -4.921842102e-04f, -4.905460832e-04f, -4.888186349e-04f,
+    -4.870035586e-04f, -4.851025478e-04f, -4.831172961e-04f, -4.810494966e-04f,
+    -4.789008416e-04f, -4.766730221e-04f, -4.743677274e-04f, -4.719866447e-04f,
+    -4.695314590e-04f, -4.670038520e-04f, -4.644055025e-04f, -4.617380855e-04f,
+    -4.590032722e-04f, -4.562027292e-04f, -4.533381185e-04f, -4.504110970e-04f,
+    -4.474233160e-04f, -4.443764214e-04f, -4.412720524e-04f, -4.381118420e-04f,
+    -4.348974165e-04f, -4.316303949e-04f, -4.283123886e-04f, -4.249450013e-04f,
+    -4.215298287e-04f, -4.180684580e-04f, -4.145624674e-04f, -4.110134266e-04f,
+    -4.074228954e-04f, -4.037924244e-04f, -4.001235542e-04f, -3.964178150e-04f,
+    -3.926767270e-04f, -3.889017992e-04f, -3.850945299e-04f, -3.812564061e-04f,
+    -3.773889034e-04f, -3.734934855e-04f, -3.695716042e-04f, -3.656246993e-04f,
+    -3.616541978e-04f, -3.576615143e-04f, -3.536480506e-04f, -3.496151951e-04f,
+    -3.455643232e-04f, -3.414967966e-04f, -3.374139636e-04f, -3.333171583e-04f,
+    -3.292077009e-04f, -3.250868974e-04f, -3.209560393e-04f, -3.168164036e-04f,
+    -3.126692525e-04f, -3.085158333e-04f, -3.043573782e-04f, -3.001951044e-04f,
+    -2.960302135e-04f, -2.918638919e-04f, -2.876973103e-04f, -2.835316235e-04f,
+    -2.793679706e-04f, -2.752074748e-04f, -2.710512433e-04f, -2.669003668e-04f,
+    -2.627559201e-04f, -2.586189614e-04f, -2.544905326e-04f, -2.503716589e-04f,
+    -2.462633492e-04f, -2.421665955e-04f, -2.380823730e-04f, -2.340116403e-04f,
+    -2.299553391e-04f, -2.259143939e-04f, -2.218897127e-04f, -2.178821862e-04f,
+    -2.138926881e-04f, -2.099220752e-04f, -2.059711871e-04f, -2.020408461e-04f,
+    -1.981318577e-04f, -1.942450100e-04f, -1.903810741e-04f, -1.865408040e-04f,
+    -1.827249363e-04f, -1.789341906e-04f, -1.751692694e-04f, -1.714308581e-04f,
+    -1.677196248e-04f, -1.640362208e-04f, -1.603812801e-04f, -1.567554197e-04f,
+    -1.531592399e-04f, -1.495933238e-04f, -1.460582375e-04f, -1.425545306e-04f,
+    -1.390827356e-04f, -1.356433684e-04f, -1.322369282e-04f, -1.288638975e-04f,
+    -1.255247425e-04f, -1.222199126e-04f, -1.189498410e-04f, -1.157149445e-04f,
+    -1.125156237e-04f, -1.093522631e-04f, -1.062252310e-04f, -1.031348799e-04f,
+    -1.000815462e-04f, -9.706555076e-05f, -9.408719863e-05f, -9.114677933e-05f,
+    -8.824456695e-05f, -8.538082020e-05f, -8.255578259e-05f, -7.976968249e-05f,
+    -7.702273332e-05f, -7.431513359e-05f, -7.164706711e-05f, -6.901870306e-05f,
+    -6.643019615e-05f, -6.388168673e-05f, -6.137330098e-05f, -5.890515097e-05f,
+    -5.647733488e-05f, -5.408993708e-05f, -5.174302833e-05f, -4.943666589e-05f,
+    -4.717089368e-05f, -4.494574244e-05f, -4.276122990e-05f, -4.061736089e-05f,
+    -3.851412754e-05f, -3.645150943e-05f, -3.442947375e-05f, -3.244797545e-05f,
+    -3.050695744e-05f, -2.860635070e-05f, -2.674607453e-05f, -2.492603665e-05f,
+    -2.314613338e-05f, -2.140624987e-05f, -1.970626019e-05f, -1.804602757e-05f,
+    -1.642540456e-05f, -1.484423318e-05f, -1.330234515e-05f, -1.179956202e-05f,
+    -1.033569536e-05f, -8.910546978e-06f, -7.523909066e-06f, -6.175564389e-06f,
+    -4.865286477e-06f, -3.592839802e-06f, -2.357979969e-06f, -1.160453895e-06f,
+    0.000000000e+00f,
+};
+
+static const float ResamplerFilterDifference[RESAMPLER_FILTER_SIZE] = {
+    -2.599140028e-05f, -7.797166010e-05f, -1.299442980e-04f, -1.819042336e-04f,
+    -2.338463883e-04f, -2.857656855e-04f, -3.376570513e-04f, -3.895154153e-04f,
+    -4.413357112e-04f, -4.931128770e-04f, -5.448418562e-04f, -5.965175980e-04f,
+    -6.481350582e-04f, -6.996891994e-04f, -7.511749921e-04f, -8.025874150e-04f,
+    -8.539214557e-04f, -9.051721112e-04f, -9.563343887e-04f, -1.007403306e-03f,
+    -1.058373892e-03f, -1.109241189e-03f, -1.160000249e-03f, -1.210646139e-03f,
+    -1.261173940e-03f, -1.311578747e-03f, -1.361855668e-03f, -1.411999829e-03f,
+    -1.462006371e-03f, -1.511870451e-03f, -1.561587245e-03f, -1.611151945e-03f,
+    -1.660559762e-03f, -1.709805926e-03f, -1.758885688e-03f, -1.807794315e-03f,
+    -1.856527100e-03f, -1.905079353e-03f, -1.953446408e-03f, -2.001623620e-03f,
+    -2.049606368e-03f, -2.097390055e-03f, -2.144970106e-03f, -2.192341972e-03f,
+    -2.239501129e-03f, -2.286443078e-03f, -2.333163347e-03f, -2.379657490e-03f,
+    -2.425921088e-03f, -2.471949752e-03f, -2.517739118e-03f, -2.563284852e-03f,
+    -2.608582652e-03f, -2.653628241e-03f, -2.698417376e-03f, -2.742945844e-03f,
+    -2.787209462e-03f, -2.831204081e-03f, -2.874925583e-03f, -2.918369882e-03f,
+    -2.961532926e-03f, -3.004410699e-03f, -3.046999215e-03f, -3.089294526e-03f,
+    -3.131292718e-03f, -3.172989912e-03f, -3.214382266e-03f, -3.255465975e-03f,
+    -3.296237268e-03f, -3.336692416e-03f, -3.376827724e-03f, -3.416639536e-03f,
+    -3.456124237e-03f, -3.495278248e-03f, -3.534098030e-03f, -3.572580087e-03f,
+    -3.610720959e-03f, -3.648517229e-03f, -3.685965521e-03f, -3.723062501e-03f,
+    -3.759804874e-03f, -3.796189392e-03f, -3.832212844e-03f, -3.867872067e-03f,
+    -3.903163938e-03f, -3.938085378e-03f, -3.972633354e-03f, -4.006804876e-03f,
+    -4.040596998e-03f, -4.074006820e-03f, -4.107031486e-03f, -4.139668188e-03f,
+    -4.171914162e-03f, -4.203766690e-03f, -4.235223102e-03f, -4.266280774e-03f,
+    -4.296937128e-03f, -4.327189637e-03f, -4.357035816e-03f, -4.386473234e-03f,
+    -4.415499503e-03f, -4.444112286e-03f, -4.472309295e-03f, -4.500088290e-03f,
+    -4.527447079e-03f, -4.554383522e-03f, -4.580895527e-03f, -4.606981051e-03f,
+    -4.632638102e-03f, -4.657864739e-03f, -4.682659070e-03f, -4.707019254e-03f,
+    -4.730943500e-03f, -4.754430069e-03f, -4.777477273e-03f, -4.800083475e-03f,
+    -4.822247088e-03f, -4.843966579e-03f, -4.865240465e-03f, -4.886067315e-03f,
+    -4.906445751e-03f, -4.926374444e-03f, -4.945852122e-03f, -4.964877560e-03f,
+    -4.983449589e-03f, -5.001567091e-03f, -5.019229001e-03f, -5.036434306e-03f,
+    -5.053182045e-03f, -5.069471313e-03f, -5.085301253e-03f, -5.100671064e-03f,
+    -5.115579997e-03f, -5.130027356e-03f, -5.144012498e-03f, -5.157534832e-03f,
+    -5.170593821e-03f, -5.183188981e-03f, -5.195319880e-03f, -5.206986140e-03f,
+    -5.218187435e-03f, -5.228923492e-03f, -5.239194091e-03f, -5.248999066e-03f,
+    -5.258338302e-03f, -5.267211737e-03f, -5.275619364e-03f, -5.283561224e-03f,
+    -5.291037416e-03f, -5.298048087e-03f, -5.304593439e-03f, -5.310673725e-03f,
+    -5.316289252e-03f, -5.321440375e-03f, -5.326127507e-03f, -5.330351107e-03f,
+    -5.334111690e-03f, -5.337409820e-03f, -5.340246114e-03f, -5.342621239e-03f,
+    -5.344535915e-03f, -5.345990912e-03f, -5.346987050e-03f, -5.347525201e-03f,
+    -5.347606287e-03f, -5.347231280e-03f, -5.346401203e-03f, -5.345117128e-03f,
+    -5.343380177e-03f, -5.341191523e-03f, -5.338552387e-03f, -5.335464037e-03f,
+    -5.331927795e-03f, -5.327945026e-03f, -5.323517148e-03f, -5.318645624e-03f,
+    -5.313331968e-03f, -5.307577737e-03f, -5.301384541e-03f, -5.294754032e-03f,
+    -5.287687913e-03f, -5.280187931e-03f, -5.272255880e-03f, -5.263893600e-03f,
+    -5.255102976e-03f, -5.245885941e-03f, -5.236244469e-03f, -5.226180582e-03f,
+    -5.215696345e-03f, -5.204793868e-03f, -5.193475304e-03f, -5.181742849e-03f,
+    -5.169598744e-03f, -5.157045270e-03f, -5.144084754e-03f, -5.130719562e-03f,
+    -5.116952103e-03f, -5.102784826e-03f, -5.088220224e-03f, -5.073260827e-03f,
+    -5.057909207e-03f, -5.042167976e-03f, -5.026039785e-03f, -5.009527325e-03f,
+    -4.992633323e-03f, -4.975360546e-03f, -4.957711800e-03f, -4.939689927e-03f,
+    -4.921297805e-03f, -4.902538351e-03f, -4.883414515e-03f, -4.863929287e-03f,
+    -4.844085687e-03f, -4.823886775e-03f, -4.803335642e-03f, -4.782435413e-03f,
+    -4.761189249e-03f, -4.739600342e-03f, -4.717671917e-03f, -4.695407231e-03f,
+    -4.672809573e-03f, -4.649882263e-03f, -4.626628651e-03f, -4.603052120e-03f,
+    -4.579156078e-03f, -4.554943968e-03f, -4.530419256e-03f, -4.505585441e-03f,
+    -4.480446048e-03f, -4.455004628e-03f, -4.429264761e-03f, -4.403230053e-03f,
+    -4.376904134e-03f, -4.350290662e-03f, -4.323393317e-03f, -4.296215806e-03f,
+    -4.268761858e-03f, -4.241035226e-03f, -4.213039686e-03f, -4.184779035e-03f,
+    -4.156257094e-03f, -4.127477702e-03f, -4.098444722e-03f, -4.069162036e-03f,
+    -4.039633544e-03f, -4.009863167e-03f, -3.979854844e-03f, -3.949612532e-03f,
+    -3.919140206e-03f, -3.888441858e-03f, -3.857521494e-03f, -3.826383140e-03f,
+    -3.795030835e-03f, -3.763468631e-03f, -3.731700599e-03f, -3.699730820e-03f,
+    -3.667563389e-03f, -3.635202414e-03f, -3.602652015e-03f, -3.569916325e-03f,
+    -3.536999485e-03f, -3.503905648e-03f, -3.470638978e-03f, -3.437203647e-03f,
+    -3.403603836e-03f, -3.369843735e-03f, -3.335927541e-03f, -3.301859459e-03f,
+    -3.267643699e-03f, -3.233284479e-03f, -3.198786021e-03f, -3.164152553e-03f,
+    -3.129388308e-03f, -3.094497521e-03f, -3.059484432e-03f, -3.024353283e-03f,
+    -2.989108319e-03f, -2.953753786e-03f, -2.918293932e-03f, -2.882733004e-03f,
+    -2.847075251e-03f, -2.811324920e-03f, -2.775486260e-03f, -2.739563514e-03f,
+    -2.703560926e-03f, -2.667482737e-03f, -2.631333184e-03f, -2.595116502e-03f,
+    -2.558836921e-03f, -2.522498664e-03f, -2.486105953e-03f, -2.449663002e-03f,
+    -2.413174017e-03f, -2.376643201e-03f, -2.340074747e-03f, -2.303472842e-03f,
+    -2.266841661e-03f, -2.230185376e-03f, -2.193508143e-03f, -2.156814115e-03f,
+    -2.120107428e-03f, -2.083392212e-03f, -2.046672584e-03f, -2.009952647e-03f,
+    -1.973236496e-03f, -1.936528210e-03f, -1.899831854e-03f, -1.863151482e-03f,
+    -1.826491132e-03f, -1.789854827e-03f, -1.753246575e-03f, -1.716670369e-03f,
+    -1.680130184e-03f, -1.643629980e-03f, -1.607173699e-03f, -1.570765266e-03f,
+    -1.534408587e-03f, -1.498107550e-03f, -1.461866025e-03f, -1.425687859e-03f,
+    -1.389576884e-03f, -1.353536908e-03f, -1.317571720e-03f, -1.281685088e-03f,
+    -1.245880756e-03f, -1.210162448e-03f, -1.174533866e-03f, -1.138998688e-03f,
+    -1.103560568e-03f, -1.068223139e-03f, -1.032990006e-03f, -9.978647529e-04f,
+    -9.628509370e-04f, -9.279520907e-04f, -8.931717206e-04f, -8.585133072e-04f,
+    -8.239803045e-04f, -7.895761399e-04f, -7.553042134e-04f, -7.211678975e-04f,
+    -6.871705366e-04f, -6.533154471e-04f, -6.196059165e-04f, -5.860452034e-04f,
+    -5.526365371e-04f, -5.193831173e-04f, -4.862881135e-04f, -4.533546650e-04f,
+    -4.205858805e-04f, -3.879848376e-04f, -3.555545827e-04f, -3.232981306e-04f,
+    -2.912184643e-04f, -2.593185344e-04f, -2.276012591e-04f, -1.960695240e-04f,
+    -1.647261815e-04f, -1.335740506e-04f, -1.026159169e-04f, -7.185453197e-05f,
+    -4.129261337e-05f, -1.093284422e-05f, 1.922212699e-05f, 4.916968663e-05f,
+    7.890725618e-05f, 1.084322925e-04f, 1.377422880e-04f, 1.668347708e-04f,
+    1.957073053e-04f, 2.243574918e-04f, 2.527829674e-04f, 2.809814054e-04f,
+    3.089505163e-04f, 3.366880475e-04f, 3.641917835e-04f, 3.914595464e-04f,
+    4.184891958e-04f, 4.452786288e-04f, 4.718257806e-04f, 4.981286245e-04f,
+    5.241851718e-04f, 5.499934724e-04f, 5.755516144e-04f, 6.008577246e-04f,
+    6.259099688e-04f, 6.507065512e-04f, 6.752457153e-04f, 6.995257437e-04f,
+    7.235449581e-04f, 7.473017195e-04f, 7.707944283e-04f, 7.940215244e-04f,
+    8.169814872e-04f, 8.396728358e-04f, 8.620941291e-04f, 8.842439656e-04f,
+    9.061209836e-04f, 9.277238616e-04f, 9.490513177e-04f, 9.701021101e-04f,
+    9.908750371e-04f, 1.011368937e-03f, 1.031582688e-03f, 1.051515209e-03f,
+    1.071165458e-03f, 1.090532433e-03f, 1.109615175e-03f, 1.128412761e-03f,
+    1.146924310e-03f, 1.165148983e-03f, 1.183085977e-03f, 1.200734533e-03f,
+    1.218093929e-03f, 1.235163484e-03f, 1.251942559e-03f, 1.268430552e-03f,
+    1.284626901e-03f, 1.300531087e-03f, 1.316142627e-03f, 1.331461079e-03f,
+    1.346486042e-03f, 1.361217152e-03f, 1.375654086e-03f, 1.389796560e-03f,
+    1.403644330e-03f, 1.417197189e-03f, 1.430454972e-03f, 1.443417551e-03f,
+    1.456084836e-03f, 1.468456779e-03f, 1.480533366e-03f, 1.492314626e-03f,
+    1.503800623e-03f, 1.514991460e-03f, 1.525887280e-03f, 1.536488261e-03f,
+    1.546794620e-03f, 1.556806613e-03f, 1.566524529e-03f, 1.575948700e-03f,
+    1.585079491e-03f, 1.593917305e-03f, 1.602462582e-03f, 1.610715799e-03f,
+    1.618677466e-03f, 1.626348135e-03f, 1.633728388e-03f, 1.640818846e-03f,
+    1.647620165e-03f, 1.654133036e-03f, 1.660358185e-03f, 1.666296373e-03f,
+    1.671948396e-03f, 1.677315083e-03f, 1.682397298e-03f, 1.687195940e-03f,
+    1.691711939e-03f, 1.695946262e-03f, 1.699899906e-03f, 1.703573902e-03f,
+    1.706969314e-03f, 1.710087238e-03f, 1.712928803e-03f, 1.715495167e-03f,
+    1.717787524e-03f, 1.719807095e-03f, 1.721555135e-03f, 1.723032929e-03f,
+    1.724241790e-03f, 1.725183065e-03f, 1.725858129e-03f, 1.726268386e-03f,
+    1.726415270e-03f, 1.726300244e-03f, 1.725924799e-03f, 1.725290455e-03f,
+    1.724398759e-03f, 1.723251288e-03f, 1.721849643e-03f, 1.720195455e-03f,
+    1.718290380e-03f, 1.716136101e-03f, 1.713734328e-03f, 1.711086794e-03f,
+    1.708195260e-03f, 1.705061512e-03f, 1.701687358e-03f, 1.698074634e-03f,
+    1.694225197e-03f, 1.690140929e-03f, 1.685823736e-03f, 1.681275546e-03f,
+    1.676498310e-03f, 1.671494000e-03f, 1.666264612e-03f, 1.660812163e-03f,
+    1.655138689e-03f, 1.649246249e-03f, 1.643136923e-03f, 1.636812809e-03f,
+    1.630276026e-03f, 1.623528712e-03f, 1.616573023e-03f, 1.609411136e-03f,
+    1.602045244e-03f, 1.594477559e-03f, 1.586710310e-03f, 1.578745743e-03f,
+    1.570586120e-03f, 1.562233721e-03f, 1.553690841e-03f, 1.544959791e-03f,
+    1.536042895e-03f, 1.526942495e-03f, 1.517660945e-03f, 1.508200614e-03f,
+    1.498563886e-03f, 1.488753154e-03f, 1.478770829e-03f, 1.468619330e-03f,
+    1.458301092e-03f, 1.447818557e-03f, 1.437174183e-03f, 1.426370437e-03f,
+    1.415409795e-03f, 1.404294744e-03f, 1.393027783e-03f, 1.381611417e-03f,
+    1.370048161e-03f, 1.358340540e-03f, 1.346491086e-03f, 1.334502337e-03f,
+    1.322376841e-03f, 1.310117153e-03f, 1.297725832e-03f, 1.285205446e-03f,
+    1.272558566e-03f, 1.259787772e-03f, 1.246895645e-03f, 1.233884773e-03f,
+    1.220757749e-03f, 1.207517168e-03f, 1.194165629e-03f, 1.180705734e-03f,
+    1.167140088e-03f, 1.153471299e-03f, 1.139701975e-03f, 1.125834727e-03f,
+    1.111872168e-03f, 1.097816909e-03f, 1.083671564e-03f, 1.069438747e-03f,
+    1.055121069e-03f, 1.040721143e-03f, 1.026241581e-03f, 1.011684991e-03f,
+    9.970539808e-04f, 9.823511571e-04f, 9.675791224e-04f, 9.527404769e-04f,
+    9.378378174e-04f, 9.228737372e-04f, 9.078508255e-04f, 8.927716672e-04f,
+    8.776388426e-04f, 8.624549267e-04f, 8.472224894e-04f, 8.319440946e-04f,
+    8.166223003e-04f, 8.012596580e-04f, 7.858587123e-04f, 7.704220007e-04f,
+    7.549520536e-04f, 7.394513930e-04f, 7.239225334e-04f, 7.083679804e-04f,
+    6.927902310e-04f, 6.771917731e-04f, 6.615750852e-04f, 6.459426359e-04f,
+    6.302968839e-04f, 6.146402775e-04f, 5.989752542e-04f, 5.833042407e-04f,
+    5.676296522e-04f, 5.519538925e-04f, 5.362793533e-04f, 5.206084141e-04f,
+    5.049434421e-04f, 4.892867916e-04f, 4.736408037e-04f, 4.580078064e-04f,
+    4.423901139e-04f, 4.267900264e-04f, 4.112098300e-04f, 3.956517964e-04f,
+    3.801181825e-04f, 3.646112302e-04f, 3.491331660e-04f, 3.336862010e-04f,
+    3.182725306e-04f, 3.028943340e-04f, 2.875537741e-04f, 2.722529974e-04f,
+    2.569941336e-04f, 2.417792953e-04f, 2.266105779e-04f, 2.114900593e-04f,
+    1.964197997e-04f, 1.814018413e-04f, 1.664382082e-04f, 1.515309061e-04f,
+    1.366819222e-04f, 1.218932247e-04f, 1.071667630e-04f, 9.250446706e-05f,
+    7.790824762e-05f, 6.337999571e-05f, 4.892158258e-05f, 3.453485948e-05f,
+    2.022165747e-05f, 5.983787269e-06f, -8.176960954e-06f, -2.225881774e-05f,
+    -3.626003450e-05f, -5.017888372e-05f, -6.401365907e-05f, -7.776267559e-05f,
+    -9.142426987e-05f, -1.049968001e-04f, -1.184786465e-04f, -1.318682109e-04f,
+    -1.451639176e-04f, -1.583642128e-04f, -1.714675654e-04f, -1.844724666e-04f,
+    -1.973774302e-04f, -2.101809928e-04f, -2.228817139e-04f, -2.354781759e-04f,
+    -2.479689843e-04f, -2.603527678e-04f, -2.726281783e-04f, -2.847938911e-04f,
+    -2.968486051e-04f, -3.087910425e-04f, -3.206199494e-04f, -3.323340955e-04f,
+    -3.439322743e-04f, -3.554133031e-04f, -3.667760232e-04f, -3.780193000e-04f,
+    -3.891420228e-04f, -4.001431050e-04f, -4.110214844e-04f, -4.217761229e-04f,
+    -4.324060065e-04f, -4.429101456e-04f, -4.532875752e-04f, -4.635373543e-04f,
+    -4.736585664e-04f, -4.836503197e-04f, -4.935117466e-04f, -5.032420039e-04f,
+    -5.128402730e-04f, -5.223057600e-04f, -5.316376951e-04f, -5.408353334e-04f,
+    -5.498979541e-04f, -5.588248612e-04f, -5.676153832e-04f, -5.762688729e-04f,
+    -5.847847076e-04f, -5.931622891e-04f, -6.014010436e-04f, -6.095004218e-04f,
+    -6.174598986e-04f, -6.252789732e-04f, -6.329571694e-04f, -6.404940348e-04f,
+    -6.478891415e-04f, -6.551420858e-04f, -6.622524878e-04f, -6.692199920e-04f,
+    -6.760442667e-04f, -6.827250042e-04f, -6.892619205e-04f, -6.956547555e-04f,
+    -7.019032730e-04f, -7.080072602e-04f, -7.139665279e-04f, -7.197809105e-04f,
+    -7.254502657e-04f, -7.309744744e-04f, -7.363534410e-04f, -7.415870929e-04f,
+    -7.466753803e-04f, -7.516182766e-04f, -7.564157780e-04f, -7.610679032e-04f,
+    -7.655746937e-04f, -7.699362134e-04f, -7.741525485e-04f, -7.782238075e-04f,
+    -7.821501212e-04f, -7.859316420e-04f, -7.895685446e-04f, -7.930610251e-04f,
+    -7.964093013e-04f, -7.996136126e-04f, -8.026742196e-04f, -8.055914041e-04f,
+    -8.083654689e-04f, -8.109967377e-04f, -8.134855549e-04f, -8.158322858e-04f,
+    -8.180373156e-04f, -8.201010501e-04f, -8.220239153e-04f, -8.238063568e-04f,
+    -8.254488403e-04f, -8.269518509e-04f, -8.283158934e-04f, -8.295414915e-04f,
+    -8.306291883e-04f, -8.315795457e-04f, -8.323931444e-04f, -8.330705835e-04f,
+    -8.336124807e-04f, -8.340194717e-04f, -8.342922104e-04f, -8.344313682e-04f,
+    -8.344376345e-04f, -8.343117158e-04f, -8.340543360e-04f, -8.336662360e-04f,
+    -8.331481736e-04f, -8.325009232e-04f, -8.317252755e-04f, -8.308220375e-04f,
+    -8.297920324e-04f, -8.286360990e-04f, -8.273550917e-04f, -8.259498806e-04f,
+    -8.244213505e-04f, -8.227704016e-04f, -8.209979486e-04f, -8.191049208e-04f,
+    -8.170922619e-04f, -8.149609297e-04f, -8.127118958e-04f, -8.103461454e-04f,
+    -8.078646773e-04f, -8.052685035e-04f, -8.025586488e-04f, -7.997361510e-04f,
+    -7.968020604e-04f, -7.937574395e-04f, -7.906033628e-04f, -7.873409170e-04f,
+    -7.839712002e-04f, -7.804953218e-04f, -7.769144024e-04f, -7.732295738e-04f,
+    -7.694419781e-04f, -7.655527682e-04f, -7.615631070e-04f, -7.574741675e-04f,
+    -7.532871323e-04f, -7.490031937e-04f, -7.446235533e-04f, -7.401494216e-04f,
+    -7.355820180e-04f, -7.309225704e-04f, -7.261723151e-04f, -7.213324965e-04f,
+    -7.164043667e-04f, -7.113891858e-04f, -7.062882207e-04f, -7.011027460e-04f,
+    -6.958340430e-04f, -6.904833994e-04f, -6.850521097e-04f, -6.795414745e-04f,
+    -6.739528001e-04f, -6.682873989e-04f, -6.625465884e-04f, -6.567316916e-04f,
+    -6.508440364e-04f, -6.448849554e-04f, -6.388557858e-04f, -6.327578690e-04f,
+    -6.265925506e-04f, -6.203611798e-04f, -6.140651096e-04f, -6.077056961e-04f,
+    -6.012842987e-04f, -5.948022797e-04f, -5.882610039e-04f, -5.816618384e-04f,
+    -5.750061529e-04f, -5.682953186e-04f, -5.615307086e-04f, -5.547136975e-04f,
+    -5.478456612e-04f, -5.409279764e-04f, -5.339620210e-04f, -5.269491730e-04f,
+    -5.198908111e-04f, -5.127883140e-04f, -5.056430604e-04f, -4.984564285e-04f,
+    -4.912297960e-04f, -4.839645401e-04f, -4.766620367e-04f, -4.693236606e-04f,
+    -4.619507853e-04f, -4.545447826e-04f, -4.471070223e-04f, -4.396388725e-04f,
+    -4.321416988e-04f, -4.246168642e-04f, -4.170657294e-04f, -4.094896520e-04f,
+    -4.018899863e-04f, -3.942680837e-04f, -3.866252918e-04f, -3.789629547e-04f,
+    -3.712824124e-04f, -3.635850011e-04f, -3.558720523e-04f, -3.481448934e-04f,
+    -3.404048469e-04f, -3.326532305e-04f, -3.248913568e-04f, -3.171205332e-04f,
+    -3.093420616e-04f, -3.015572384e-04f, -2.937673540e-04f, -2.859736930e-04f,
+    -2.781775338e-04f, -2.703801483e-04f, -2.625828023e-04f, -2.547867544e-04f,
+    -2.469932566e-04f, -2.392035540e-04f, -2.314188842e-04f, -2.236404777e-04f,
+    -2.158695573e-04f, -2.081073384e-04f, -2.003550281e-04f, -1.926138258e-04f,
+    -1.848849228e-04f, -1.771695020e-04f, -1.694687377e-04f, -1.617837958e-04f,
+    -1.541158333e-04f, -1.464659985e-04f, -1.388354304e-04f, -1.312252590e-04f,
+    -1.236366049e-04f, -1.160705792e-04f, -1.085282836e-04f, -1.010108098e-04f,
+    -9.351923993e-05f, -8.605464595e-05f, -7.861808979e-05f, -7.121062314e-05f,
+    -6.383328734e-05f, -5.648711328e-05f, -4.917312127e-05f, -4.189232091e-05f,
+    -3.464571103e-05f, -2.743427950e-05f, -2.025900322e-05f, -1.312084794e-05f,
+    -6.020768186e-06f, 1.040292821e-06f, 8.061403296e-06f, 1.504164296e-05f,
+    2.198010315e-05f, 2.887588690e-05f, 3.572810901e-05f, 4.253589617e-05f,
+    4.929838702e-05f, 5.601473221e-05f, 6.268409454e-05f, 6.930564896e-05f,
+    7.587858269e-05f, 8.240209529e-05f, 8.887539870e-05f, 9.529771735e-05f,
+    1.016682882e-04f, 1.079863607e-04f, 1.142511971e-04f, 1.204620724e-04f,
+    1.266182740e-04f, 1.327191025e-04f, 1.387638712e-04f, 1.447519062e-04f,
+    1.506825469e-04f, 1.565551453e-04f, 1.623690666e-04f, 1.681236892e-04f,
+    1.738184043e-04f, 1.794526165e-04f, 1.850257434e-04f, 1.905372160e-04f,
+    1.959864783e-04f, 2.013729877e-04f, 2.066962148e-04f, 2.119556434e-04f,
+    2.171507708e-04f, 2.222811075e-04f, 2.273461773e-04f, 2.323455174e-04f,
+    2.372786782e-04f, 2.421452238e-04f, 2.469447312e-04f, 2.516767911e-04f,
+    2.563410074e-04f, 2.609369973e-04f, 2.654643914e-04f, 2.699228338e-04f,
+    2.743119815e-04f, 2.786315053e-04f, 2.828810890e-04f, 2.870604297e-04f,
+    2.911692377e-04f, 2.952072368e-04f, 2.991741638e-04f, 3.030697687e-04f,
+    3.068938146e-04f, 3.106460780e-04f, 3.143263481e-04f, 3.179344276e-04f,
+    3.214701318e-04f, 3.249332893e-04f, 3.283237415e-04f, 3.316413428e-04f,
+    3.348859604e-04f, 3.380574743e-04f, 3.411557773e-04f, 3.441807750e-04f,
+    3.471323855e-04f, 3.500105397e-04f, 3.528151809e-04f, 3.555462650e-04f,
+    3.582037603e-04f, 3.607876475e-04f, 3.632979197e-04f, 3.657345821e-04f,
+    3.680976522e-04f, 3.703871596e-04f, 3.726031460e-04f, 3.747456650e-04f,
+    3.768147821e-04f, 3.788105748e-04f, 3.807331322e-04f, 3.825825551e-04f,
+    3.843589560e-04f, 3.860624588e-04f, 3.876931989e-04f, 3.892513231e-04f,
+    3.907369894e-04f, 3.921503670e-04f, 3.934916363e-04f, 3.947609884e-04f,
+    3.959586258e-04f, 3.970847614e-04f, 3.981396190e-04f, 3.991234331e-04f,
+    4.000364486e-04f, 4.008789209e-04f, 4.016511158e-04f, 4.023533092e-04f,
+    4.029857873e-04f, 4.035488462e-04f, 4.040427920e-04f, 4.044679408e-04f,
+    4.048246180e-04f, 4.051131589e-04f, 4.053339085e-04f, 4.054872207e-04f,
+    4.055734591e-04f, 4.055929962e-04f, 4.055462139e-04f, 4.054335026e-04f,
+    4.052552620e-04f, 4.050119002e-04f, 4.047038339e-04f, 4.043314886e-04f,
+    4.038952978e-04f, 4.033957035e-04f, 4.028331556e-04f, 4.022081123e-04f,
+    4.015210395e-04f, 4.007724109e-04f, 3.999627079e-04f, 3.990924193e-04f,
+    3.981620414e-04f, 3.971720778e-04f, 3.961230391e-04f, 3.950154431e-04f,
+    3.938498144e-04f, 3.926266845e-04f, 3.913465913e-04f, 3.900100795e-04f,
+    3.886176999e-04f, 3.871700098e-04f, 3.856675725e-04f, 3.841109574e-04f,
+    3.825007396e-04f, 3.808375003e-04f, 3.791218258e-04f, 3.773543084e-04f,
+    3.755355453e-04f, 3.736661393e-04f, 3.717466981e-04f, 3.697778343e-04f,
+    3.677601655e-04f, 3.656943139e-04f, 3.635809062e-04f, 3.614205736e-04f,
+    3.592139518e-04f, 3.569616802e-04f, 3.546644028e-04f, 3.523227669e-04f,
+    3.499374242e-04f, 3.475090295e-04f, 3.450382415e-04f, 3.425257220e-04f,
+    3.399721362e-04f, 3.373781525e-04f, 3.347444420e-04f, 3.320716789e-04f,
+    3.293605399e-04f, 3.266117047e-04f, 3.238258549e-04f, 3.210036749e-04f,
+    3.181458511e-04f, 3.152530719e-04f, 3.123260279e-04f, 3.093654111e-04f,
+    3.063719156e-04f, 3.033462369e-04f, 3.002890718e-04f, 2.972011186e-04f,
+    2.940830767e-04f, 2.909356464e-04f, 2.877595292e-04f, 2.845554272e-04f,
+    2.813240432e-04f, 2.780660807e-04f, 2.747822433e-04f, 2.714732353e-04f,
+    2.681397608e-04f, 2.647825243e-04f, 2.614022300e-04f, 2.579995820e-04f,
+    2.545752840e-04f, 2.511300394e-04f, 2.476645511e-04f, 2.441795212e-04f,
+    2.406756511e-04f, 2.371536412e-04f, 2.336141911e-04f, 2.300579991e-04f,
+    2.264857623e-04f, 2.228981765e-04f, 2.192959360e-04f, 2.156797335e-04f,
+    2.120502601e-04f, 2.084082051e-04f, 2.047542557e-04f, 2.010890974e-04f,
+    1.974134134e-04f, 1.937278846e-04f, 1.900331898e-04f, 1.863300053e-04f,
+    1.826190046e-04f, 1.789008590e-04f, 1.751762368e-04f, 1.714458035e-04f,
+    1.677102217e-04f, 1.639701508e-04f, 1.602262475e-04f, 1.564791647e-04f,
+    1.527295525e-04f, 1.489780572e-04f, 1.452253219e-04f, 1.414719859e-04f,
+    1.377186849e-04f, 1.339660508e-04f, 1.302147116e-04f, 1.264652914e-04f,
+    1.227184104e-04f, 1.189746843e-04f, 1.152347251e-04f, 1.114991400e-04f,
+    1.077685323e-04f, 1.040435006e-04f, 1.003246390e-04f, 9.661253702e-05f,
+    9.290777954e-05f, 8.921094665e-05f, 8.552261366e-05f, 8.184335093e-05f,
+    7.817372392e-05f, 7.451429299e-05f, 7.086561345e-05f, 6.722823541e-05f,
+    6.360270375e-05f, 5.998955806e-05f, 5.638933256e-05f, 5.280255604e-05f,
+    4.922975182e-05f, 4.567143765e-05f, 4.212812571e-05f, 3.860032250e-05f,
+    3.508852880e-05f, 3.159323964e-05f, 2.811494422e-05f, 2.465412587e-05f,
+    2.121126198e-05f, 1.778682400e-05f, 1.438127734e-05f, 1.099508136e-05f,
+    7.628689281e-06f, 4.282548208e-06f, 9.570990319e-07f, -2.347223589e-06f,
+    -5.629991272e-06f, -8.890781945e-06f, -1.212917989e-05f, -1.534477576e-05f,
+    -1.853716666e-05f, -2.170595610e-05f, -2.485075412e-05f, -2.797117723e-05f,
+    -3.106684853e-05f, -3.413739765e-05f, -3.718246083e-05f, -4.020168094e-05f,
+    -4.319470747e-05f, -4.616119661e-05f, -4.910081121e-05f, -5.201322084e-05f,
+    -5.489810178e-05f, -5.775513708e-05f, -6.058401653e-05f, -6.338443668e-05f,
+    -6.615610090e-05f, -6.889871933e-05f, -7.161200892e-05f, -7.429569345e-05f,
+    -7.694950351e-05f, -7.957317654e-05f, -8.216645681e-05f, -8.472909542e-05f,
+    -8.726085033e-05f, -8.976148635e-05f, -9.223077512e-05f, -9.466849515e-05f,
+    -9.707443176e-05f, -9.944837715e-05f, -1.017901303e-04f, -1.040994972e-04f,
+    -1.063762903e-04f, -1.086203293e-04f, -1.108314405e-04f, -1.130094568e-04f,
+    -1.151542183e-04f, -1.172655716e-04f, -1.193433701e-04f, -1.213874740e-04f,
+    -1.233977502e-04f, -1.253740723e-04f, -1.273163206e-04f, -1.292243822e-04f,
+    -1.310981506e-04f, -1.329375262e-04f, -1.347424158e-04f, -1.365127329e-04f,
+    -1.382483976e-04f, -1.399493365e-04f, -1.416154826e-04f, -1.432467756e-04f,
+    -1.448431615e-04f, -1.464045927e-04f, -1.479310281e-04f, -1.494224330e-04f,
+    -1.508787789e-04f, -1.523000436e-04f, -1.536862114e-04f, -1.550372725e-04f,
+    -1.563532235e-04f, -1.576340671e-04f, -1.588798121e-04f, -1.600904735e-04f,
+    -1.612660722e-04f, -1.624066351e-04f, -1.635121952e-04f, -1.645827911e-04f,
+    -1.656184678e-04f, -1.666192755e-04f, -1.675852708e-04f, -1.685165155e-04f,
+    -1.694130775e-04f, -1.702750301e-04f, -1.711024523e-04f, -1.718954286e-04f,
+    -1.726540491e-04f, -1.733784092e-04f, -1.740686099e-04f, -1.747247573e-04f,
+    -1.753469630e-04f, -1.759353437e-04f, -1.764900214e-04f, -1.770111233e-04f,
+    -1.774987815e-04f, -1.779531331e-04f, -1.783743205e-04f, -1.787624907e-04f,
+    -1.791177957e-04f, -1.794403922e-04f, -1.797304418e-04f, -1.799881106e-04f,
+    -1.802135695e-04f, -1.804069938e-04f, -1.805685636e-04f, -1.806984631e-04f,
+    -1.807968811e-04f, -1.808640106e-04f, -1.809000490e-04f, -1.809051979e-04f,
+    -1.808796628e-04f, -1.808236537e-04f, -1.807373842e-04f, -1.806210721e-04f,
+    -1.804749390e-04f, -1.802992104e-04f, -1.800941155e-04f, -1.798598871e-04f,
+    -1.795967617e-04f, -1.793049796e-04f, -1.789847843e-04f, -1.786364228e-04f,
+    -1.782601456e-04f, -1.778562062e-04f, -1.774248618e-04f, -1.769663723e-04f,
+    -1.764810010e-04f, -1.759690142e-04f, -1.754306810e-04f, -1.748662737e-04f,
+    -1.742760670e-04f, -1.736603389e-04f, -1.730193696e-04f, -1.723534423e-04f,
+    -1.716628425e-04f, -1.709478584e-04f, -1.702087805e-04f, -1.694459018e-04f,
+    -1.686595173e-04f, -1.678499247e-04f, -1.670174233e-04f, -1.661623150e-04f,
+    -1.652849033e-04f, -1.643854940e-04f, -1.634643946e-04f, -1.625219144e-04f,
+    -1.615583646e-04f, -1.605740579e-04f, -1.595693088e-04f, -1.585444332e-04f,
+    -1.574997485e-04f, -1.564355736e-04f, -1.553522287e-04f, -1.542500354e-04f,
+    -1.531293162e-04f, -1.519903952e-04f, -1.508335971e-04f, -1.496592480e-04f,
+    -1.484676747e-04f, -1.472592051e-04f, -1.460341678e-04f, -1.447928922e-04f,
+    -1.435357082e-04f, -1.422629467e-04f, -1.409749389e-04f, -1.396720165e-04f,
+    -1.383545118e-04f, -1.370227572e-04f, -1.356770857e-04f, -1.343178304e-04f,
+    -1.329453246e-04f, -1.315599018e-04f, -1.301618954e-04f, -1.287516390e-04f,
+    -1.273294659e-04f, -1.258957095e-04f, -1.244507030e-04f, -1.229947792e-04f,
+    -1.215282708e-04f, -1.200515099e-04f, -1.185648285e-04f, -1.170685578e-04f,
+    -1.155630287e-04f, -1.140485715e-04f, -1.125255157e-04f, -1.109941902e-04f,
+    -1.094549231e-04f, -1.079080418e-04f, -1.063538728e-04f, -1.047927416e-04f,
+    -1.032249727e-04f, -1.016508898e-04f, -1.000708152e-04f, -9.848507030e-05f,
+    -9.689397529e-05f, -9.529784908e-05f, -9.369700931e-05f, -9.209177228e-05f,
+    -9.048245293e-05f, -8.886936475e-05f, -8.725281977e-05f, -8.563312848e-05f,
+    -8.401059980e-05f, -8.238554104e-05f, -8.075825785e-05f, -7.912905414e-05f,
+    -7.749823210e-05f, -7.586609212e-05f, -7.423293272e-05f, -7.259905056e-05f,
+    -7.096474037e-05f, -6.933029492e-05f, -6.769600496e-05f, -6.606215920e-05f,
+    -6.442904426e-05f, -6.279694462e-05f, -6.116614263e-05f, -5.953691840e-05f,
+    -5.790954982e-05f, -5.628431251e-05f, -5.466147977e-05f, -5.304132256e-05f,
+    -5.142410945e-05f, -4.981010661e-05f, -4.819957774e-05f, -4.659278410e-05f,
+    -4.498998441e-05f, -4.339143486e-05f, -4.179738905e-05f, -4.020809801e-05f,
+    -3.862381012e-05f, -3.704477110e-05f, -3.547122400e-05f, -3.390340914e-05f,
+    -3.234156412e-05f, -3.078592376e-05f, -2.923672009e-05f, -2.769418234e-05f,
+    -2.615853690e-05f, -2.463000730e-05f, -2.310881418e-05f, -2.159517528e-05f,
+    -2.008930543e-05f, -1.859141651e-05f, -1.710171743e-05f, -1.562041413e-05f,
+    -1.414770954e-05f, -1.268380358e-05f, -1.122889313e-05f, -9.783172047e-06f,
+    -8.346831088e-06f, -6.920057953e-06f, -5.503037243e-06f, -4.095950456e-06f,
+    -2.698975972e-06f, -1.312289038e-06f, 6.393823677e-08f, 1.429536897e-06f,
+    2.784341147e-06f, 4.128188363e-06f, 5.460919100e-06f, 6.782377099e-06f,
+    8.092409298e-06f, 9.390865832e-06f, 1.067760005e-05f, 1.195246849e-05f,
+    1.321533095e-05f, 1.446605040e-05f, 1.570449307e-05f, 1.693052840e-05f,
+    1.814402905e-05f, 1.934487094e-05f, 2.053293319e-05f, 2.170809816e-05f,
+    2.287025146e-05f, 2.401928189e-05f, 2.515508152e-05f, 2.627754561e-05f,
+    2.738657268e-05f, 2.848206443e-05f, 2.956392581e-05f, 3.063206495e-05f,
+    3.168639322e-05f, 3.272682515e-05f, 3.375327849e-05f, 3.476567418e-05f,
+    3.576393631e-05f, 3.674799218e-05f, 3.771777223e-05f, 3.867321004e-05f,
+    3.961424237e-05f, 4.054080907e-05f, 4.145285316e-05f, 4.235032074e-05f,
+    4.323316101e-05f, 4.410132627e-05f, 4.495477188e-05f, 4.579345628e-05f,
+    4.661734095e-05f, 4.742639039e-05f, 4.822057213e-05f, 4.899985671e-05f,
+    4.976421765e-05f, 5.051363143e-05f, 5.124807751e-05f, 5.196753825e-05f,
+    5.267199898e-05f, 5.336144789e-05f, 5.403587606e-05f, 5.469527745e-05f,
+    5.533964887e-05f, 5.596898992e-05f, 5.658330304e-05f, 5.718259344e-05f,
+    5.776686911e-05f, 5.833614075e-05f, 5.889042182e-05f, 5.942972844e-05f,
+    5.995407944e-05f, 6.046349628e-05f, 6.095800307e-05f, 6.143762652e-05f,
+    6.190239591e-05f, 6.235234309e-05f, 6.278750245e-05f, 6.320791088e-05f,
+    6.361360776e-05f, 6.400463492e-05f, 6.438103665e-05f, 6.474285960e-05f,
+    6.509015285e-05f, 6.542296780e-05f, 6.574135820e-05f, 6.604538008e-05f,
+    6.633509176e-05f, 6.661055380e-05f, 6.687182897e-05f, 6.711898223e-05f,
+    6.735208072e-05f, 6.757119368e-05f, 6.777639249e-05f, 6.796775056e-05f,
+    6.814534340e-05f, 6.830924848e-05f, 6.845954529e-05f, 6.859631526e-05f,
+    6.871964177e-05f, 6.882961008e-05f, 6.892630730e-05f, 6.900982239e-05f,
+    6.908024614e-05f, 6.913767107e-05f, 6.918219147e-05f, 6.921390333e-05f,
+    6.923290433e-05f, 6.923929380e-05f, 6.923317268e-05f, 6.921464351e-05f,
+    6.918381037e-05f, 6.914077888e-05f, 6.908565614e-05f, 6.901855071e-05f,
+    6.893957260e-05f, 6.884883318e-05f, 6.874644523e-05f, 6.863252283e-05f,
+    6.850718136e-05f, 6.837053750e-05f, 6.822270914e-05f, 6.806381539e-05f,
+    6.789397651e-05f, 6.771331393e-05f, 6.752195017e-05f, 6.732000884e-05f,
+    6.710761459e-05f, 6.688489308e-05f, 6.665197095e-05f, 6.640897579e-05f,
+    6.615603611e-05f, 6.589328131e-05f, 6.562084163e-05f, 6.533884815e-05f,
+    6.504743273e-05f, 6.474672797e-05f, 6.443686723e-05f, 6.411798455e-05f,
+    6.379021464e-05f, 6.345369282e-05f, 6.310855505e-05f, 6.275493782e-05f,
+    6.239297820e-05f, 6.202281373e-05f, 6.164458246e-05f, 6.125842287e-05f,
+    6.086447385e-05f, 6.046287471e-05f, 6.005376508e-05f, 5.963728493e-05f,
+    5.921357454e-05f, 5.878277443e-05f, 5.834502537e-05f, 5.790046836e-05f,
+    5.744924454e-05f, 5.699149522e-05f, 5.652736184e-05f, 5.605698591e-05f,
+    5.558050902e-05f, 5.509807278e-05f, 5.460981883e-05f, 5.411588877e-05f,
+    5.361642415e-05f, 5.311156647e-05f, 5.260145709e-05f, 5.208623727e-05f,
+    5.156604810e-05f, 5.104103049e-05f, 5.051132513e-05f, 4.997707248e-05f,
+    4.943841275e-05f, 4.889548585e-05f, 4.834843137e-05f, 4.779738858e-05f,
+    4.724249637e-05f, 4.668389325e-05f, 4.612171733e-05f, 4.555610626e-05f,
+    4.498719724e-05f, 4.441512699e-05f, 4.384003172e-05f, 4.326204711e-05f,
+    4.268130829e-05f, 4.209794981e-05f, 4.151210562e-05f, 4.092390906e-05f,
+    4.033349282e-05f, 3.974098893e-05f, 3.914652875e-05f, 3.855024290e-05f,
+    3.795226131e-05f, 3.735271316e-05f, 3.675172685e-05f, 3.614943000e-05f,
+    3.554594944e-05f, 3.494141116e-05f, 3.433594031e-05f, 3.372966121e-05f,
+    3.312269725e-05f, 3.251517097e-05f, 3.190720398e-05f, 3.129891696e-05f,
+    3.069042964e-05f, 3.008186079e-05f, 2.947332820e-05f, 2.886494868e-05f,
+    2.825683800e-05f, 2.764911092e-05f, 2.704188117e-05f, 2.643526142e-05f,
+    2.582936324e-05f, 2.522429716e-05f, 2.462017259e-05f, 2.401709784e-05f,
+    2.341518008e-05f, 2.281452537e-05f, 2.221523860e-05f, 2.161742351e-05f,
+    2.102118267e-05f, 2.042661746e-05f, 1.983382807e-05f, 1.924291350e-05f,
+    1.865397151e-05f, 1.806709866e-05f, 1.748239025e-05f, 1.689994036e-05f,
+    1.631984180e-05f, 1.574218614e-05f, 1.516706367e-05f, 1.459456338e-05f,
+    1.402477302e-05f, 1.345777901e-05f, 1.289366648e-05f, 1.233251927e-05f,
+    1.177441988e-05f, 1.121944952e-05f, 1.066768806e-05f, 1.011921403e-05f,
+    9.574104650e-06f, 9.032435780e-06f, 8.494281943e-06f, 7.959716314e-06f,
+    7.428810713e-06f, 6.901635605e-06f, 6.378260096e-06f, 5.858751929e-06f,
+    5.343177483e-06f, 4.831601767e-06f, 4.324088423e-06f, 3.820699722e-06f,
+    3.321496561e-06f, 2.826538463e-06f, 2.335883577e-06f, 1.849588677e-06f,
+    1.367709161e-06f, 8.902990510e-07f, 4.174109940e-07f, -5.090373790e-08f,
+    -5.145952463e-07f, -9.736150057e-07f, -1.427915862e-06f, -1.877452031e-06f,
+    -2.322179097e-06f, -2.762054008e-06f, -3.197035076e-06f, -3.627081975e-06f,
+    -4.052155734e-06f, -4.472218737e-06f, -4.887234719e-06f, -5.297168761e-06f,
+    -5.701987287e-06f, -6.101658061e-06f, -6.496150178e-06f, -6.885434064e-06f,
+    -7.269481470e-06f, -7.648265464e-06f, -8.021760429e-06f, -8.389942055e-06f,
+    -8.752787334e-06f, -9.110274553e-06f, -9.462383290e-06f, -9.809094403e-06f,
+    -1.015039003e-05f, -1.048625357e-05f, -1.081666969e-05f, -1.114162432e-05f,
+    -1.146110461e-05f, -1.177509897e-05f, -1.208359704e-05f, -1.238658968e-05f,
+    -1.268406895e-05f, -1.297602813e-05f, -1.326246170e-05f, -1.354336530e-05f,
+    -1.381873579e-05f, -1.408857117e-05f, -1.435287060e-05f, -1.461163440e-05f,
+    -1.486486402e-05f, -1.511256205e-05f, -1.535473218e-05f, -1.559137924e-05f,
+    -1.582250914e-05f, -1.604812887e-05f, -1.626824651e-05f, -1.648287120e-05f,
+    -1.669201314e-05f, -1.689568358e-05f, -1.709389478e-05f, -1.728666003e-05f,
+    -1.747399366e-05f, -1.765591095e-05f, -1.783242819e-05f, -1.800356265e-05f,
+    -1.816933255e-05f, -1.832975707e-05f, -1.848485632e-05f, -1.863465132e-05f,
+    -1.877916404e-05f, -1.891841731e-05f, -1.905243489e-05f, -1.918124137e-05f,
+    -1.930486223e-05f, -1.942332380e-05f, -1.953665322e-05f, -1.964487849e-05f,
+    -1.974802839e-05f, -1.984613251e-05f, -1.993922122e-05f, -2.002732565e-05f,
+    -2.011047772e-05f, -2.018871005e-05f, -2.026205602e-05f, -2.033054971e-05f,
+    -2.039422591e-05f, -2.045312011e-05f, -2.050726844e-05f, -2.055670774e-05f,
+    -2.060147545e-05f, -2.064160969e-05f, -2.067714916e-05f, -2.070813318e-05f,
+    -2.073460169e-05f, -2.075659517e-05f, -2.077415468e-05f, -2.078732185e-05f,
+    -2.079613881e-05f, -2.080064824e-05f, -2.080089333e-05f, -2.079691776e-05f,
+    -2.078876569e-05f, -2.077648174e-05f, -2.076011102e-05f, -2.073969904e-05f,
+    -2.071529175e-05f, -2.068693553e-05f, -2.065467714e-05f, -2.061856372e-05f,
+    -2.057864282e-05f, -2.053496230e-05f, -2.048757040e-05f, -2.043651568e-05f,
+    -2.038184700e-05f, -2.032361357e-05f, -2.026186484e-05f, -2.019665056e-05f,
+    -2.012802076e-05f, -2.005602569e-05f, -1.998071586e-05f, -1.990214200e-05f,
+    -1.982035504e-05f, -1.973540613e-05f, -1.964734658e-05f, -1.955622789e-05f,
+    -1.946210172e-05f, -1.936501986e-05f, -1.926503426e-05f, -1.916219696e-05f,
+    -1.905656015e-05f, -1.894817607e-05f, -1.883709709e-05f, -1.872337561e-05f,
+    -1.860706412e-05f, -1.848821514e-05f, -1.836688124e-05f, -1.824311501e-05f,
+    -1.811696904e-05f, -1.798849594e-05f, -1.785774828e-05f, -1.772477864e-05f,
+    -1.758963954e-05f, -1.745238348e-05f, -1.731306287e-05f, -1.717173008e-05f,
+    -1.702843738e-05f, -1.688323698e-05f, -1.673618096e-05f, -1.658732130e-05f,
+    -1.643670986e-05f, -1.628439836e-05f, -1.613043838e-05f, -1.597488137e-05f,
+    -1.581777858e-05f, -1.565918111e-05f, -1.549913988e-05f, -1.533770560e-05f,
+    -1.517492880e-05f, -1.501085978e-05f, -1.484554862e-05f, -1.467904520e-05f,
+    -1.451139912e-05f, -1.434265976e-05f, -1.417287624e-05f, -1.400209741e-05f,
+    -1.383037184e-05f, -1.365774783e-05f, -1.348427338e-05f, -1.330999621e-05f,
+    -1.313496371e-05f, -1.295922298e-05f, -1.278282077e-05f, -1.260580353e-05f,
+    -1.242821735e-05f, -1.225010800e-05f, -1.207152088e-05f, -1.189250103e-05f,
+    -1.171309314e-05f, -1.153334152e-05f, -1.135329011e-05f, -1.117298245e-05f,
+    -1.099246171e-05f, -1.081177064e-05f, -1.063095160e-05f, -1.045004655e-05f,
+    -1.026909702e-05f, -1.008814413e-05f, -9.907228565e-06f, -9.726390593e-06f,
+    -9.545670038e-06f, -9.365106284e-06f, -9.184738271e-06f, -9.004604488e-06f,
+    -8.824742971e-06f, -8.645191296e-06f, -8.465986576e-06f, -8.287165456e-06f,
+    -8.108764111e-06f, -7.930818241e-06f, -7.753363067e-06f, -7.576433327e-06f,
+    -7.400063275e-06f, -7.224286674e-06f, -7.049136797e-06f, -6.874646422e-06f,
+    -6.700847828e-06f, -6.527772794e-06f, -6.355452598e-06f, -6.183918011e-06f,
+    -6.013199295e-06f, -5.843326205e-06f, -5.674327984e-06f, -5.506233360e-06f,
+    -5.339070548e-06f, -5.172867242e-06f, -5.007650624e-06f, -4.843447351e-06f,
+    -4.680283563e-06f, -4.518184875e-06f, -4.357176382e-06f, -4.197282655e-06f,
+    -4.038527740e-06f, -3.880935160e-06f, -3.724527911e-06f, -3.569328466e-06f,
+    -3.415358770e-06f, -3.262640245e-06f, -3.111193786e-06f, -2.961039765e-06f,
+    -2.812198027e-06f, -2.664687894e-06f, -2.518528165e-06f, -2.373737113e-06f,
+    -2.230332494e-06f, -2.088331538e-06f, -1.947750958e-06f, -1.808606946e-06f,
+    -1.670915177e-06f, -1.534690812e-06f, -1.399948493e-06f, -1.266702353e-06f,
+    -1.134966011e-06f, -1.004752577e-06f, -8.760746543e-07f, -7.489443391e-07f,
+    -6.233732252e-07f, -4.993724047e-07f, -3.769524709e-07f, -2.561235207e-07f,
+    -1.368951569e-07f, -1.927649113e-08f, 9.672385377e-08f, 2.110977406e-07f,
+    3.238375151e-07f, 4.349360029e-07f, 5.443865065e-07f, 6.521828021e-07f,
+    7.583191361e-07f, 8.627902222e-07f, 9.655912377e-07f, 1.066717820e-06f,
+    1.166166064e-06f, 1.263932515e-06f, 1.360014170e-06f, 1.454408472e-06f,
+    1.547113302e-06f, 1.638126983e-06f, 1.727448268e-06f, 1.815076341e-06f,
+    1.901010812e-06f, 1.985251711e-06f, 2.067799485e-06f, 2.148654995e-06f,
+    2.227819508e-06f, 2.305294696e-06f, 2.381082630e-06f, 2.455185776e-06f,
+    2.527606988e-06f, 2.598349508e-06f, 2.667416957e-06f, 2.734813332e-06f,
+    2.800543001e-06f, 2.864610699e-06f, 2.927021521e-06f, 2.987780919e-06f,
+    3.046894695e-06f, 3.104368999e-06f, 3.160210321e-06f, 3.214425487e-06f,
+    3.267021655e-06f, 3.318006308e-06f, 3.367387248e-06f, 3.415172595e-06f,
+    3.461370777e-06f, 3.505990528e-06f, 3.549040879e-06f, 3.590531159e-06f,
+    3.630470981e-06f, 3.668870245e-06f, 3.705739126e-06f, 3.741088074e-06f,
+    3.774927805e-06f, 3.807269294e-06f, 3.838123777e-06f, 3.867502736e-06f,
+    3.895417900e-06f, 3.921881238e-06f, 3.946904951e-06f, 3.970501471e-06f,
+    3.992683451e-06f, 4.013463762e-06f, 4.032855488e-06f, 4.050871917e-06f,
+    4.067526541e-06f, 4.082833044e-06f, 4.096805302e-06f, 4.109457374e-06f,
+    4.120803498e-06f, 4.130858087e-06f, 4.139635718e-06f, 4.147151134e-06f,
+    4.153419232e-06f, 4.158455062e-06f, 4.162273818e-06f, 4.164890837e-06f,
+    4.166321589e-06f, 4.166581673e-06f, 4.165686815e-06f, 4.163652856e-06f,
+    4.160495753e-06f, 4.156231570e-06f, 4.150876475e-06f, 4.144446732e-06f,
+    4.136958699e-06f, 4.128428819e-06f, 4.118873618e-06f, 4.108309699e-06f,
+    4.096753735e-06f, 4.084222468e-06f, 4.070732699e-06f, 4.056301286e-06f,
+    4.040945138e-06f, 4.024681212e-06f, 4.007526504e-06f, 3.989498048e-06f,
+    3.970612910e-06f, 3.950888180e-06f, 3.930340972e-06f, 3.908988419e-06f,
+    3.886847664e-06f, 3.863935857e-06f, 3.840270154e-06f, 3.815867709e-06f,
+    3.790745668e-06f, 3.764921169e-06f, 3.738411335e-06f, 3.711233268e-06f,
+    3.683404048e-06f, 3.654940726e-06f, 3.625860323e-06f, 3.596179822e-06f,
+    3.565916165e-06f, 3.535086251e-06f, 3.503706930e-06f, 3.471794998e-06f,
+    3.439367196e-06f, 3.406440204e-06f, 3.373030637e-06f, 3.339155044e-06f,
+    3.304829900e-06f, 3.270071606e-06f, 3.234896482e-06f, 3.199320767e-06f,
+    3.163360614e-06f, 3.127032085e-06f, 3.090351149e-06f, 3.053333680e-06f,
+    3.015995452e-06f, 2.978352135e-06f, 2.940419293e-06f, 2.902212383e-06f,
+    2.863746748e-06f, 2.825037615e-06f, 2.786100095e-06f, 2.746949177e-06f,
+    2.707599726e-06f, 2.668066480e-06f, 2.628364050e-06f, 2.588506913e-06f,
+    2.548509413e-06f, 2.508385755e-06f, 2.468150006e-06f, 2.427816093e-06f,
+    2.387397797e-06f, 2.346908751e-06f, 2.306362444e-06f, 2.265772211e-06f,
+    2.225151234e-06f, 2.184512544e-06f, 2.143869010e-06f, 2.103233347e-06f,
+    2.062618108e-06f, 2.022035683e-06f, 1.981498298e-06f, 1.941018017e-06f,
+    1.900606732e-06f, 1.860276170e-06f, 1.820037886e-06f, 1.779903264e-06f,
+    1.739883517e-06f, 1.699989680e-06f, 1.660232617e-06f, 1.620623012e-06f,
+    1.581171374e-06f, 1.541888033e-06f, 1.502783137e-06f, 1.463866657e-06f,
+    1.425148380e-06f, 1.386637912e-06f, 1.348344677e-06f, 1.310277913e-06f,
+    1.272446675e-06f, 1.234859834e-06f, 1.197526074e-06f, 1.160453895e-06f,
+    0.000000000e+00f,
+};
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -26,6 +26,13 @@
 #include "SDL_audio_c.h"
 
 #include "SDL_assert.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
+
+#include "SDL_audio_resampler_filter.h"
+
+/* Limit the filter length for extreme downsampling ratios */
+#define RESAMPLER_MAX_PADDING       256
 
 /* #define DEBUG_CONVERT */
 
@@ -895,6 +902,264 @@ SDL_BuildAudioTypeCVT(SDL_AudioCVT * cvt,
 }
 
 
+/* Polyphase windowed-sinc resampler.
+
+   Each output frame is a weighted sum of the input frames within
+   RESAMPLER_ZERO_CROSSINGS of it.  The weights come from a precomputed
+   table of one side of the filter, interpolated for the fractional position
+   of the output frame.  When downsampling the filter is stretched so it
+   cuts off at the new Nyquist frequency, which makes it longer.
+ */
+int
+SDL_ResamplerPadding(const int inrate, const int outrate)
+{
+    int padding;
+
+    if (inrate <= outrate) {
+        return RESAMPLER_ZERO_CROSSINGS;
+    }
+    padding = (int) ((((Sint64) RESAMPLER_ZERO_CROSSINGS * inrate) + outrate - 1) / outrate);
+    return SDL_min(padding, RESAMPLER_MAX_PADDING);
+}
+
+int
+SDL_ResamplerOutputFrames(const int inrate, const int outrate,
+                          const int inframes, const Sint64 position)
+{
+    const Sint64 end = (Sint64) inframes * outrate;
+
+    if (position >= end) {
+        return 0;
+    }
+    return (int) ((end - position + inrate - 1) / inrate);
+}
+
+/* Accumulate one output frame from 'ntaps' input frames, 'ntaps' is a multiple of 4 */
+static void
+SDL_ResampleFrame(const int chans, const float *coef, const int ntaps,
+                  const float *src, float *dst, const SDL_bool simd)
+{
+    int i, j;
+
+#ifdef __SSE__
+    if (simd) {
+        if (chans == 1) {
+            __m128 acc = _mm_setzero_ps();
+            for (j = 0; j < ntaps; j += 4) {
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&coef[j]), _mm_loadu_ps(&src[j])));
+            }
+            acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+            acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, _MM_SHUFFLE(1, 1, 1, 1)));
+            _mm_store_ss(dst, acc);
+            return;
+        } else if (chans == 2) {
+            __m128 acc = _mm_setzero_ps();
+            for (j = 0; j < ntaps; j += 4) {
+                const __m128 c = _mm_loadu_ps(&coef[j]);
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_unpacklo_ps(c, c), _mm_loadu_ps(&src[j * 2])));
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_unpackhi_ps(c, c), _mm_loadu_ps(&src[j * 2 + 4])));
+            }
+            acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+            _mm_storel_pi((__m64 *) dst, acc);
+            return;
+        } else if ((chans % 4) == 0) {
+            for (i = 0; i < chans; i += 4) {
+                __m128 acc = _mm_setzero_ps();
+                for (j = 0; j < ntaps; ++j) {
+                    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(coef[j]), _mm_loadu_ps(&src[j * chans + i])));
+                }
+                _mm_storeu_ps(&dst[i], acc);
+            }
+            return;
+        }
+    }
+#endif
+
+    for (i = 0; i < chans; ++i) {
+        float sample = 0.0f;
+        for (j = 0; j < ntaps; ++j) {
+            sample += coef[j] * src[j * chans + i];
+        }
+        dst[i] = sample;
+    }
+}
+
+static SDL_INLINE float
+SDL_ResamplerWeight(const float distance)
+{
+    const float pos = distance * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+    const int index = (int) pos;
+
+    if (index >= (RESAMPLER_FILTER_SIZE - 1)) {
+        return 0.0f;
+    }
+    return ResamplerFilter[index] + (pos - index) * ResamplerFilterDifference[index];
+}
+
+int
+SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+                  const float *lpadding, const float *rpadding,
+                  const float *inbuf, const int inframes,
+                  float *outbuf, Sint64 *position)
+{
+    const int padding = SDL_ResamplerPadding(inrate, outrate);
+    const int ntaps = padding * 2;
+    const int ntaps4 = (ntaps + 3) & ~3;
+    const float scale = (inrate > outrate) ? ((float) RESAMPLER_ZERO_CROSSINGS / padding) : 1.0f;
+    const Sint64 end = (Sint64) inframes * outrate;
+    Sint64 pos = position ? *position : 0;
+    float coef[(RESAMPLER_MAX_PADDING * 2) + 4];
+    float *dst = outbuf;
+    SDL_bool simd = SDL_FALSE;
+    int i, j, written = 0;
+
+#ifdef __SSE__
+    simd = SDL_HasSSE();
+#endif
+
+    for (j = ntaps; j < ntaps4; ++j) {
+        coef[j] = 0.0f;
+    }
+
+    for ( ; pos < end; pos += inrate) {
+        const int ipos = (int) (pos / outrate);
+        const float frac = (float) (pos - ((Sint64) ipos * outrate)) / outrate;
+        const int first = ipos - padding + 1;
+
+        /* Weights for the frames before and after the output position */
+        for (j = 0; j < padding; ++j) {
+            coef[padding - 1 - j] = scale * SDL_ResamplerWeight((frac + j) * scale);
+            coef[padding + j] = scale * SDL_ResamplerWeight((1.0f - frac + j) * scale);
+        }
+
+        if (first >= 0 && (first + ntaps4) <= inframes) {
+            SDL_ResampleFrame(chans, coef, ntaps4, &inbuf[first * chans], dst, simd);
+        } else {
+            /* Near the edges of the buffer, fetch each frame separately */
+            for (i = 0; i < chans; ++i) {
+                float sample = 0.0f;
+                for (j = 0; j < ntaps; ++j) {
+                    const int frame = first + j;
+                    const float *src;
+                    if (frame < 0) {
+                        src = lpadding ? &lpadding[(padding + frame) * chans] : inbuf;
+                    } else if (frame >= inframes) {
+                        src = rpadding ? &rpadding[(frame - inframes) * chans] : &inbuf[(inframes - 1) * chans];
+                    } else {
+                        src = &inbuf[frame * chans];
+                    }
+                    sample += coef[j] * src[i];
+                }
+                dst[i] = sample;
+            }
+        }
+        dst += chans;
+        ++written;
+    }
+
+    if (position) {
+        *position = pos - end;
+    }
+    return written;
+}
+
+/* SDL_AudioCVT only keeps the ratio of the rates, in rate_incr.  Turn it
+   back into a pair of rates with that ratio, from the continued fraction
+   of rate_incr: the first convergent that gives the same double is the
+   ratio of the original rates in lowest terms.
+ */
+static void
+SDL_GetResampleRates(const SDL_AudioCVT * cvt, int *inrate, int *outrate)
+{
+    const double incr = cvt->rate_incr;
+    Sint64 p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+    double x = incr;
+    int i;
+
+    for (i = 0; i < 64; ++i) {
+        const double a = SDL_floor(x);
+        const Sint64 p2 = ((Sint64) a * p1) + p0;
+        const Sint64 q2 = ((Sint64) a * q1) + q0;
+
+        if (p2 > 0x7FFFFFFF || q2 > 0x7FFFFFFF) {
+            break;
+        }
+        p0 = p1;
+        q0 = q1;
+        p1 = p2;
+        q1 = q2;
+        if ((q1 > 0 && ((double) p1 / (double) q1) == incr) || x == a) {
+            break;
+        }
+        x = 1.0 / (x - a);
+    }
+    *outrate = (int) p1;
+    *inrate = (int) q1;
+}
+
+static void
+SDL_ResampleCVT(SDL_AudioCVT * cvt, const int chans, const SDL_AudioFormat format)
+{
+    const int framelen = chans * sizeof (float);
+    const int inframes = cvt->len_cvt / framelen;
+    int inrate, outrate, outframes;
+    float *inbuf;
+
+    SDL_assert(format == AUDIO_F32SYS);
+
+    SDL_GetResampleRates(cvt, &inrate, &outrate);
+    outframes = SDL_ResamplerOutputFrames(inrate, outrate, inframes, 0);
+    inbuf = (float *) (cvt->buf + (outframes * framelen));
+
+    /* Move the input past the end of the output, so the output can be
+       written in a single forward pass.  SDL_BuildAudioResampleCVT() made
+       room for this in len_mult.
+     */
+    SDL_memmove(inbuf, cvt->buf, inframes * framelen);
+    SDL_ResampleAudio(chans, inrate, outrate, NULL, NULL,
+                      inbuf, inframes, (float *) cvt->buf, NULL);
+
+    cvt->len_cvt = outframes * framelen;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+/* SDL_AudioFilter doesn't carry the channel count, so use one filter per layout */
+#define RESAMPLER_FUNCS(chans) \
+    static void SDLCALL \
+    SDL_ResampleCVT_c##chans(SDL_AudioCVT *cvt, SDL_AudioFormat format) { \
+        SDL_ResampleCVT(cvt, chans, format); \
+    }
+RESAMPLER_FUNCS(1)
+RESAMPLER_FUNCS(2)
+RESAMPLER_FUNCS(4)
+RESAMPLER_FUNCS(6)
+RESAMPLER_FUNCS(8)
+#undef RESAMPLER_FUNCS
+
+static SDL_AudioFilter
+SDL_ChooseResampleCVT(const int chans)
+{
+    switch (chans) {
+    case 1: return SDL_ResampleCVT_c1;
+    case 2: return SDL_ResampleCVT_c2;
+    case 4: return SDL_ResampleCVT_c4;
+    case 6: return SDL_ResampleCVT_c6;
+    case 8: return SDL_ResampleCVT_c8;
+    default: return NULL;
+    }
+}
+
+static SDL_bool
+SDL_UseFastResampling(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_RESAMPLING_MODE);
+
+    return (hint && SDL_strcasecmp(hint, "fast") == 0) ? SDL_TRUE : SDL_FALSE;
+}
+
+
 static SDL_AudioFilter
 SDL_HandTunedResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
                          int src_rate, int dst_rate)
@@ -942,12 +1207,35 @@ SDL_FindFrequencyMultiple(const int src_rate, const int dst_rate)
 
 static int
 SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
-                          int src_rate, int dst_rate)
+                          int src_rate, int dst_rate, SDL_bool fast)
 {
     if (src_rate != dst_rate) {
         SDL_AudioFilter filter = SDL_HandTunedResampleCVT(cvt, dst_channels,
                                                           src_rate, dst_rate);
 
+        if (filter == NULL && !fast) {
+            /* The polyphase resampler; the data is AUDIO_F32SYS at this point */
+            filter = SDL_ChooseResampleCVT(dst_channels);
+            if (filter == NULL) {
+                SDL_SetError("No conversion available for these rates");
+                return -1;
+            }
+
+            /* The filter gets the rates back from cvt->rate_incr */
+            cvt->filters[cvt->filter_index++] = filter;
+
+            /* The input is moved past the end of the output while resampling */
+            if (src_rate < dst_rate) {
+                const double mult = ((double) dst_rate) / ((double) src_rate);
+                cvt->len_mult *= (int) SDL_ceil(mult) + 1;
+                cvt->len_ratio *= mult;
+            } else {
+                cvt->len_mult *= 2;
+                cvt->len_ratio /= ((double) src_rate) / ((double) dst_rate);
+            }
+            return 1;
+        }
+
         /* No hand-tuned converter? Try the autogenerated ones. */
         if (filter == NULL) {
             int i;
@@ -999,6 +1287,9 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
                   SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
                   SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate)
 {
+    SDL_AudioFormat work_fmt;
+    SDL_bool fast_resample;
+
     /*
      * !!! FIXME: reorder filters based on which grow/shrink the buffer.
      * !!! FIXME: ideally, we should do everything that shrinks the buffer
@@ -1043,8 +1334,18 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
     cvt->len_ratio = 1.0;
     cvt->rate_incr = ((double) dst_rate) / ((double) src_rate);
 
+    /* The polyphase resampler works in floating point, so convert to that
+       first and to the destination format after resampling.
+     */
+    fast_resample = SDL_UseFastResampling();
+    if (src_rate != dst_rate && !fast_resample) {
+        work_fmt = AUDIO_F32SYS;
+    } else {
+        work_fmt = dst_fmt;
+    }
+
     /* Convert data types, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioTypeCVT(cvt, src_fmt, dst_fmt) == -1) {
+    if (SDL_BuildAudioTypeCVT(cvt, src_fmt, work_fmt) == -1) {
         return -1;              /* shouldn't happen, but just in case... */
     }
 
@@ -1100,8 +1401,12 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
     }
 
     /* Do rate conversion, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioResampleCVT(cvt, dst_channels, src_rate, dst_rate) ==
-        -1) {
+    if (SDL_BuildAudioResampleCVT(cvt, dst_channels, src_rate, dst_rate,
+                                  fast_resample) == -1) {
+        return -1;              /* shouldn't happen, but just in case... */
+    }
+
+    if (SDL_BuildAudioTypeCVT(cvt, work_fmt, dst_fmt) == -1) {
         return -1;              /* shouldn't happen, but just in case... */
     }
 
@@ -1118,4 +1423,343 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
 }
 
 
+
+/* Source sample frames converted at a time by SDL_AudioStreamPut() */
+#define SDL_AUDIOSTREAM_CHUNK_FRAMES    1024
+
+struct _SDL_AudioStream
+{
+    SDL_AudioCVT cvt_before_resampling;
+    SDL_AudioCVT cvt_after_resampling;
+    SDL_AudioFormat src_format;
+    Uint8 src_channels;
+    int src_rate;
+    SDL_AudioFormat dst_format;
+    Uint8 dst_channels;
+    int dst_rate;
+    int src_sample_frame_size;
+    int dst_sample_frame_size;
+    SDL_bool resampling;
+
+    /* Conversion space for one chunk of input, allocated with the stream */
+    Uint8 *work_buffer;
+    int work_buffer_len;
+
+    /* When resampling, resampler_input holds resampler_padding frames that
+       were already resampled, followed by resampler_frames frames that are
+       waiting for the frames after them to arrive.
+     */
+    float *resampler_input;
+    float *resampler_output;
+    int resampler_padding;
+    int resampler_frames;
+    Sint64 resampler_position;
+
+    /* Converted data waiting for SDL_AudioStreamGet() */
+    Uint8 *queue;
+    int queue_size;
+    int queue_head;
+    int queue_len;
+};
+
+static void
+SDL_ResetAudioStreamResampler(SDL_AudioStream *stream)
+{
+    if (stream->resampling) {
+        /* Treat the time before the first frame as silence */
+        SDL_memset(stream->resampler_input, '\0',
+                   stream->resampler_padding * stream->dst_channels * sizeof (float));
+        stream->resampler_frames = 0;
+        stream->resampler_position = 0;
+    }
+}
+
+SDL_AudioStream *
+SDL_NewAudioStream(const SDL_AudioFormat src_format,
+                   const Uint8 src_channels,
+                   const int src_rate,
+                   const SDL_AudioFormat dst_format,
+                   const Uint8 dst_channels,
+                   const int dst_rate)
+{
+    const int chunk_len = SDL_AUDIOSTREAM_CHUNK_FRAMES * (SDL_AUDIO_BITSIZE(src_format) / 8) * src_channels;
+    SDL_AudioStream *stream;
+    int max_output_frames;
+
+    stream = (SDL_AudioStream *) SDL_TaggedCalloc(SDL_MEMTAG_AUDIO, 1, sizeof (SDL_AudioStream));
+    if (stream == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    stream->src_format = src_format;
+    stream->src_channels = src_channels;
+    stream->src_rate = src_rate;
+    stream->dst_format = dst_format;
+    stream->dst_channels = dst_channels;
+    stream->dst_rate = dst_rate;
+    stream->src_sample_frame_size = (SDL_AUDIO_BITSIZE(src_format) / 8) * src_channels;
+    stream->dst_sample_frame_size = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+    stream->resampling = (src_rate != dst_rate) ? SDL_TRUE : SDL_FALSE;
+
+    if (!stream->resampling) {
+        /* Everything can be done by a single SDL_AudioCVT */
+        if (SDL_BuildAudioCVT(&stream->cvt_before_resampling,
+                              src_format, src_channels, src_rate,
+                              dst_format, dst_channels, dst_rate) < 0) {
+            SDL_FreeAudioStream(stream);
+            return NULL;
+        }
+        stream->work_buffer_len = chunk_len * stream->cvt_before_resampling.len_mult;
+        max_output_frames = SDL_AUDIOSTREAM_CHUNK_FRAMES;
+    } else {
+        int input_len;
+
+        /* Convert to float with the destination channels, resample, and
+           convert to the destination format in place.
+         */
+        if (SDL_BuildAudioCVT(&stream->cvt_before_resampling,
+                              src_format, src_channels, src_rate,
+                              AUDIO_F32SYS, dst_channels, src_rate) < 0 ||
+            SDL_BuildAudioCVT(&stream->cvt_after_resampling,
+                              AUDIO_F32SYS, dst_channels, dst_rate,
+                              dst_format, dst_channels, dst_rate) < 0) {
+            SDL_FreeAudioStream(stream);
+            return NULL;
+        }
+        SDL_assert(stream->cvt_after_resampling.len_mult == 1);
+
+        stream->resampler_padding = SDL_ResamplerPadding(src_rate, dst_rate);
+        max_output_frames = (int) (((Sint64) SDL_AUDIOSTREAM_CHUNK_FRAMES * dst_rate) / src_rate) + 1;
+
+        /* Converted input is appended after at most two padding's worth of
+           frames, and needs len_mult headroom while it's being converted.
+         */
+        input_len = (stream->resampler_padding * 2 * dst_channels * sizeof (float)) +
+                    (chunk_len * stream->cvt_before_resampling.len_mult);
+        stream->resampler_input = (float *) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, input_len);
+        stream->resampler_output = (float *) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, max_output_frames * dst_channels * sizeof (float));
+        if (!stream->resampler_input || !stream->resampler_output) {
+            SDL_FreeAudioStream(stream);
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        SDL_ResetAudioStreamResampler(stream);
+    }
+
+    if (stream->work_buffer_len > 0) {
+        stream->work_buffer = (Uint8 *) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, stream->work_buffer_len);
+    }
+    stream->queue_size = max_output_frames * stream->dst_sample_frame_size * 4;
+    stream->queue = (Uint8 *) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, stream->queue_size);
+    if ((stream->work_buffer_len > 0 && !stream->work_buffer) || !stream->queue) {
+        SDL_FreeAudioStream(stream);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    return stream;
+}
+
+/* Append converted data to the queue ring, growing it if the caller isn't keeping up */
+static int
+SDL_AudioStreamEnqueue(SDL_AudioStream *stream, const Uint8 *data, int len)
+{
+    int tail, cpy;
+
+    if ((stream->queue_len + len) > stream->queue_size) {
+        int size = stream->queue_size;
+        Uint8 *queue;
+
+        while ((stream->queue_len + len) > size) {
+            size *= 2;
+        }
+        queue = (Uint8 *) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, size);
+        if (queue == NULL) {
+            return SDL_OutOfMemory();
+        }
+        cpy = SDL_min(stream->queue_len, stream->queue_size - stream->queue_head);
+        SDL_memcpy(queue, stream->queue + stream->queue_head, cpy);
+        SDL_memcpy(queue + cpy, stream->queue, stream->queue_len - cpy);
+        SDL_free(stream->queue);
+        stream->queue = queue;
+        stream->queue_size = size;
+        stream->queue_head = 0;
+    }
+
+    tail = (stream->queue_head + stream->queue_len) % stream->queue_size;
+    cpy = SDL_min(len, stream->queue_size - tail);
+    SDL_memcpy(stream->queue + tail, data, cpy);
+    SDL_memcpy(stream->queue, data + cpy, len - cpy);
+    stream->queue_len += len;
+    return 0;
+}
+
+/* Resample every pending frame that has enough frames after it */
+static int
+SDL_AudioStreamResample(SDL_AudioStream *stream)
+{
+    const int chans = stream->dst_channels;
+    const int padding = stream->resampler_padding;
+    const int inframes = stream->resampler_frames - padding;
+    float *inbuf = stream->resampler_input + (padding * chans);
+    SDL_AudioCVT *cvt = &stream->cvt_after_resampling;
+    int outframes;
+
+    if (inframes <= 0) {
+        return 0;
+    }
+
+    outframes = SDL_ResampleAudio(chans, stream->src_rate, stream->dst_rate,
+                                  stream->resampler_input, inbuf + (inframes * chans),
+                                  inbuf, inframes, stream->resampler_output,
+                                  &stream->resampler_position);
+
+    /* Keep the last frames as history and lookahead for the next call */
+    SDL_memmove(stream->resampler_input, inbuf + ((inframes - padding) * chans),
+                padding * 2 * chans * sizeof (float));
+    stream->resampler_frames = padding;
+
+    cvt->buf = (Uint8 *) stream->resampler_output;
+    cvt->len = outframes * chans * sizeof (float);
+    if (SDL_ConvertAudio(cvt) < 0) {
+        return -1;
+    }
+    return SDL_AudioStreamEnqueue(stream, cvt->buf, cvt->len_cvt);
+}
+
+int
+SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
+{
+    const Uint8 *src = (const Uint8 *) buf;
+    SDL_AudioCVT *cvt;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len == 0) {
+        return 0;
+    } else if ((len < 0) || ((len % stream->src_sample_frame_size) != 0)) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    cvt = &stream->cvt_before_resampling;
+    if (!stream->resampling && !cvt->needed) {
+        return SDL_AudioStreamEnqueue(stream, src, len);
+    }
+
+    while (len > 0) {
+        const int frames = SDL_min(len / stream->src_sample_frame_size, SDL_AUDIOSTREAM_CHUNK_FRAMES);
+        const int bytes = frames * stream->src_sample_frame_size;
+
+        if (!stream->resampling) {
+            cvt->buf = stream->work_buffer;
+        } else {
+            /* Convert straight into the resampler input */
+            cvt->buf = (Uint8 *) (stream->resampler_input +
+                                  ((stream->resampler_padding + stream->resampler_frames) * stream->dst_channels));
+        }
+        cvt->len = bytes;
+        SDL_memcpy(cvt->buf, src, bytes);
+        if (SDL_ConvertAudio(cvt) < 0) {
+            return -1;
+        }
+
+        if (!stream->resampling) {
+            if (SDL_AudioStreamEnqueue(stream, cvt->buf, cvt->len_cvt) < 0) {
+                return -1;
+            }
+        } else {
+            stream->resampler_frames += cvt->len_cvt / (stream->dst_channels * sizeof (float));
+            if (SDL_AudioStreamResample(stream) < 0) {
+                return -1;
+            }
+        }
+
+        src += bytes;
+        len -= bytes;
+    }
+
+    return 0;
+}
+
+int
+SDL_AudioStreamFlush(SDL_AudioStream *stream)
+{
+    int retval;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!stream->resampling) {
+        return 0;   /* all data is converted as soon as it's added */
+    }
+
+    /* Follow the pending frames with silence, so they can all be resampled */
+    SDL_memset(stream->resampler_input +
+               ((stream->resampler_padding + stream->resampler_frames) * stream->dst_channels),
+               '\0', stream->resampler_padding * stream->dst_channels * sizeof (float));
+    stream->resampler_frames += stream->resampler_padding;
+    retval = SDL_AudioStreamResample(stream);
+
+    /* Anything added later starts a new stretch of audio */
+    SDL_ResetAudioStreamResampler(stream);
+    return retval;
+}
+
+int
+SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
+{
+    Uint8 *dst = (Uint8 *) buf;
+    int cpy;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len <= 0) {
+        return 0;
+    }
+
+    len -= len % stream->dst_sample_frame_size;
+    len = SDL_min(len, stream->queue_len);
+
+    cpy = SDL_min(len, stream->queue_size - stream->queue_head);
+    SDL_memcpy(dst, stream->queue + stream->queue_head, cpy);
+    SDL_memcpy(dst + cpy, stream->queue, len - cpy);
+    stream->queue_head = (stream->queue_head + len) % stream->queue_size;
+    stream->queue_len -= len;
+    return len;
+}
+
+int
+SDL_AudioStreamAvailable(SDL_AudioStream *stream)
+{
+    return stream ? stream->queue_len : 0;
+}
+
+void
+SDL_AudioStreamClear(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return;
+    }
+    stream->queue_head = 0;
+    stream->queue_len = 0;
+    SDL_ResetAudioStreamResampler(stream);
+}
+
+void
+SDL_FreeAudioStream(SDL_AudioStream *stream)
+{
+    if (stream) {
+        SDL_free(stream->work_buffer);
+        SDL_free(stream->resampler_input);
+        SDL_free(stream->resampler_output);
+        SDL_free(stream->queue);
+        SDL_free(stream);
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -20,6 +20,6 @@
 */
 #include "../SDL_internal.h"
 
-#define SDL_AllocAudioMem   SDL_malloc
+#define SDL_AllocAudioMem(size) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, size)
 #define SDL_FreeAudioMem    SDL_free
 /* vi: set ts=4 sw=4 expandtab: */
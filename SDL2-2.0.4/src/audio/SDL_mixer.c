@@ -27,6 +27,10 @@
 #include "SDL_audio.h"
 #include "SDL_sysaudio.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
  * Changed to use 0xFE instead of 0xFF for better sound quality.
@@ -125,6 +129,227 @@ static const Uint8 mix8[] = {
 	}	\
 }
 
+/* Vectorized mixing for the 16-bit, 32-bit and float formats.  The kernels
+   only handle volumes from 1 to SDL_MIX_MAXVOLUME, where they give exactly
+   the same results as the C code below (for floats, as evaluated in single
+   and double precision).  They mix whole vectors and then any remaining
+   samples through a padded vector, so a buffer is never split between two
+   implementations, and return the number of bytes mixed.
+ */
+typedef Uint32 (*SDL_MixAudioKernel) (Uint8 * dst, const Uint8 * src,
+                                      Uint32 len, int volume, SDL_bool swap);
+
+static SDL_MixAudioKernel SDL_MixAudio_S16_SIMD = NULL;
+static SDL_MixAudioKernel SDL_MixAudio_S32_SIMD = NULL;
+static SDL_MixAudioKernel SDL_MixAudio_F32_SIMD = NULL;
+static SDL_bool SDL_MixAudio_KernelsChosen = SDL_FALSE;
+
+/* Defines a kernel from a function mixing one vector of 'samplesize' samples */
+#define SDL_MIX_AUDIO_KERNEL(name, vectype, vecsize, load, store, mix, swapfn, samplesize) \
+static Uint32 \
+name(Uint8 * dst, const Uint8 * src, Uint32 len, int volume, SDL_bool swap) \
+{ \
+    Uint32 i, rest; \
+    for (i = 0; (i + vecsize) <= len; i += vecsize) { \
+        vectype s = load((const vectype *) (src + i)); \
+        vectype d = load((const vectype *) (dst + i)); \
+        if (swap) { \
+            s = swapfn(s, samplesize); \
+            d = swapfn(d, samplesize); \
+        } \
+        d = mix(s, d, volume); \
+        if (swap) { \
+            d = swapfn(d, samplesize); \
+        } \
+        store((vectype *) (dst + i), d); \
+    } \
+    rest = (len - i) - ((len - i) % samplesize); \
+    if (rest > 0) { \
+        Uint8 srcpad[vecsize], dstpad[vecsize]; \
+        SDL_zero(srcpad); \
+        SDL_zero(dstpad); \
+        SDL_memcpy(srcpad, src + i, rest); \
+        SDL_memcpy(dstpad, dst + i, rest); \
+        name(dstpad, srcpad, vecsize, volume, swap); \
+        SDL_memcpy(dst + i, dstpad, rest); \
+        i += rest; \
+    } \
+    return i; \
+}
+
+#if defined(__SSE2__)
+static SDL_INLINE __m128i
+SDL_MixSwap_SSE2(__m128i x, const int size)
+{
+    if (size == 4) {
+        x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+        x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+
+/* (x / SDL_MIX_MAXVOLUME), rounding toward zero like C integer division */
+static SDL_INLINE __m128i
+SDL_MixDivVolume_SSE2(__m128i x)
+{
+    const __m128i bias = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    x = _mm_add_epi32(x, _mm_and_si128(_mm_srai_epi32(x, 31), bias));
+    return _mm_srai_epi32(x, 7);
+}
+
+static SDL_INLINE __m128i
+SDL_MixS16_SSE2(__m128i s, __m128i d, int volume)
+{
+    const __m128i vol = _mm_set1_epi16((Sint16) volume);
+    const __m128i lo = _mm_mullo_epi16(s, vol);
+    const __m128i hi = _mm_mulhi_epi16(s, vol);
+
+    s = _mm_packs_epi32(SDL_MixDivVolume_SSE2(_mm_unpacklo_epi16(lo, hi)),
+                        SDL_MixDivVolume_SSE2(_mm_unpackhi_epi16(lo, hi)));
+    /* The C code clamps the adjusted sample to -32767 */
+    return _mm_adds_epi16(d, _mm_max_epi16(s, _mm_set1_epi16(-32767)));
+}
+
+static SDL_INLINE __m128i
+SDL_MixS32_SSE2(__m128i s, __m128i d, int volume)
+{
+    /* s * volume fits in a double's mantissa, so this is exact */
+    const __m128d vol = _mm_set1_pd((double) volume / SDL_MIX_MAXVOLUME);
+    const __m128i lo = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(s), vol));
+    const __m128i hi = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(s, s)), vol));
+    __m128i sum, overflow;
+
+    s = _mm_unpacklo_epi64(lo, hi);
+    /* The C code clamps the adjusted sample to -2147483647 */
+    s = _mm_sub_epi32(s, _mm_cmpeq_epi32(s, _mm_set1_epi32(0x80000000)));
+
+    /* Add, saturating to [INT_MIN, INT_MAX] */
+    sum = _mm_add_epi32(d, s);
+    overflow = _mm_srai_epi32(_mm_andnot_si128(_mm_xor_si128(d, s), _mm_xor_si128(d, sum)), 31);
+    d = _mm_xor_si128(_mm_srai_epi32(d, 31), _mm_set1_epi32(0x7FFFFFFF));
+    return _mm_or_si128(_mm_and_si128(overflow, d), _mm_andnot_si128(overflow, sum));
+}
+
+static SDL_INLINE __m128i
+SDL_MixF32_SSE2(__m128i s, __m128i d, int volume)
+{
+    const __m128 fvolume = _mm_set1_ps((float) volume);
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    __m128 sum;
+
+    /* A float add rounds the same as adding in double and converting */
+    sum = _mm_mul_ps(_mm_mul_ps(_mm_castsi128_ps(s), fvolume), fmaxvolume);
+    sum = _mm_add_ps(sum, _mm_castsi128_ps(d));
+    /* Clamp overflow to the float range; NaNs pass through as in C */
+    sum = _mm_min_ps(_mm_set1_ps(3.402823466e+38F), sum);
+    sum = _mm_max_ps(_mm_set1_ps(-3.402823466e+38F), sum);
+    return _mm_castps_si128(sum);
+}
+
+SDL_MIX_AUDIO_KERNEL(SDL_MixAudio_S16_SSE2, __m128i, 16, _mm_loadu_si128, _mm_storeu_si128, SDL_MixS16_SSE2, SDL_MixSwap_SSE2, 2)
+SDL_MIX_AUDIO_KERNEL(SDL_MixAudio_S32_SSE2, __m128i, 16, _mm_loadu_si128, _mm_storeu_si128, SDL_MixS32_SSE2, SDL_MixSwap_SSE2, 4)
+SDL_MIX_AUDIO_KERNEL(SDL_MixAudio_F32_SSE2, __m128i, 16, _mm_loadu_si128, _mm_storeu_si128, SDL_MixF32_SSE2, SDL_MixSwap_SSE2, 4)
+#endif /* __SSE2__ */
+
+#if defined(__AVX2__)
+static SDL_INLINE __m256i
+SDL_MixSwap_AVX2(__m256i x, const int size)
+{
+    const __m256i swap16 = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m256i swap32 = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    return _mm256_shuffle_epi8(x, (size == 2) ? swap16 : swap32);
+}
+
+static SDL_INLINE __m256i
+SDL_MixDivVolume_AVX2(__m256i x)
+{
+    const __m256i bias = _mm256_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    x = _mm256_add_epi32(x, _mm256_and_si256(_mm256_srai_epi32(x, 31), bias));
+    return _mm256_srai_epi32(x, 7);
+}
+
+static SDL_INLINE __m256i
+SDL_MixS16_AVX2(__m256i s, __m256i d, int volume)
+{
+    const __m256i vol = _mm256_set1_epi16((Sint16) volume);
+    const __m256i lo = _mm256_mullo_epi16(s, vol);
+    const __m256i hi = _mm256_mulhi_epi16(s, vol);
+
+    /* unpack and pack both work within 128-bit lanes, so the order is kept */
+    s = _mm256_packs_epi32(SDL_MixDivVolume_AVX2(_mm256_unpacklo_epi16(lo, hi)),
+                           SDL_MixDivVolume_AVX2(_mm256_unpackhi_epi16(lo, hi)));
+    return _mm256_adds_epi16(d, _mm256_max_epi16(s, _mm256_set1_epi16(-32767)));
+}
+
+static SDL_INLINE __m256i
+SDL_MixS32_AVX2(__m256i s, __m256i d, int volume)
+{
+    const __m256d vol = _mm256_set1_pd((double) volume / SDL_MIX_MAXVOLUME);
+    const __m128i lo = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(s)), vol));
+    const __m128i hi = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(s, 1)), vol));
+    __m256i sum, overflow;
+
+    s = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    s = _mm256_max_epi32(s, _mm256_set1_epi32(-2147483647));
+
+    sum = _mm256_add_epi32(d, s);
+    overflow = _mm256_srai_epi32(_mm256_andnot_si256(_mm256_xor_si256(d, s), _mm256_xor_si256(d, sum)), 31);
+    d = _mm256_xor_si256(_mm256_srai_epi32(d, 31), _mm256_set1_epi32(0x7FFFFFFF));
+    return _mm256_blendv_epi8(sum, d, overflow);
+}
+
+static SDL_INLINE __m256i
+SDL_MixF32_AVX2(__m256i s, __m256i d, int volume)
+{
+    const __m256 fvolume = _mm256_set1_ps((float) volume);
+    const __m256 fmaxvolume = _mm256_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    __m256 sum;
+
+    /* Separate multiply and add, a fused multiply-add would round differently */
+    sum = _mm256_mul_ps(_mm256_mul_ps(_mm256_castsi256_ps(s), fvolume), fmaxvolume);
+    sum = _mm256_add_ps(sum, _mm256_castsi256_ps(d));
+    sum = _mm256_min_ps(_mm256_set1_ps(3.402823466e+38F), sum);
+    sum = _mm256_max_ps(_mm256_set1_ps(-3.402823466e+38F), sum);
+    return _mm256_castps_si256(sum);
+}
+
+SDL_MIX_AUDIO_KERNEL(SDL_MixAudio_S16_AVX2, __m256i, 32, _mm256_loadu_si256, _mm256_storeu_si256, SDL_MixS16_AVX2, SDL_MixSwap_AVX2, 2)
+SDL_MIX_AUDIO_KERNEL(SDL_MixAudio_S32_AVX2, __m256i, 32, _mm256_loadu_si256, _mm256_storeu_si256, SDL_MixS32_AVX2, SDL_MixSwap_AVX2, 4)
+SDL_MIX_AUDIO_KERNEL(SDL_MixAudio_F32_AVX2, __m256i, 32, _mm256_loadu_si256, _mm256_storeu_si256, SDL_MixF32_AVX2, SDL_MixSwap_AVX2, 4)
+#endif /* __AVX2__ */
+
+static void
+SDL_ChooseMixAudioKernels(void)
+{
+#if defined(__SSE2__)
+    if (SDL_HasSSE2()) {
+        SDL_MixAudio_S16_SIMD = SDL_MixAudio_S16_SSE2;
+        SDL_MixAudio_S32_SIMD = SDL_MixAudio_S32_SSE2;
+        SDL_MixAudio_F32_SIMD = SDL_MixAudio_F32_SSE2;
+    }
+#endif
+#if defined(__AVX2__)
+    if (SDL_HasAVX2()) {
+        SDL_MixAudio_S16_SIMD = SDL_MixAudio_S16_AVX2;
+        SDL_MixAudio_S32_SIMD = SDL_MixAudio_S32_AVX2;
+        SDL_MixAudio_F32_SIMD = SDL_MixAudio_F32_AVX2;
+    }
+#endif
+    SDL_MixAudio_KernelsChosen = SDL_TRUE;
+}
+
+/* Mix with a SIMD kernel if one applies, leaving nothing for the C code */
+#define SDL_MIX_AUDIO_SIMD(kernel, swap) do { \
+        if ((kernel) && (volume > 0) && (volume <= SDL_MIX_MAXVOLUME)) { \
+            const Uint32 done = (kernel)(dst, src, len, volume, swap); \
+            dst += done; \
+            src += done; \
+            len -= done; \
+        } \
+    } while (0)
+
 void
 SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
                    Uint32 len, int volume)
@@ -133,6 +358,10 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         return;
     }
 
+    if (!SDL_MixAudio_KernelsChosen) {
+        SDL_ChooseMixAudioKernels();
+    }
+
     switch (format) {
 
     case AUDIO_U8:
@@ -185,6 +414,7 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         break;
 
     case AUDIO_S16LSB:
+        SDL_MIX_AUDIO_SIMD(SDL_MixAudio_S16_SIMD, SDL_BYTEORDER != SDL_LIL_ENDIAN);
         {
             Sint16 src1, src2;
             int dst_sample;
@@ -213,6 +443,7 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         break;
 
     case AUDIO_S16MSB:
+        SDL_MIX_AUDIO_SIMD(SDL_MixAudio_S16_SIMD, SDL_BYTEORDER != SDL_BIG_ENDIAN);
         {
 #if defined(__GNUC__) && defined(__M68000__) && !defined(__mcoldfire__) && defined(SDL_ASSEMBLY_ROUTINES)
             SDL_MixAudio_m68k_S16MSB((short *) dst, (short *) src,
@@ -246,6 +477,7 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         break;
 
     case AUDIO_S32LSB:
+        SDL_MIX_AUDIO_SIMD(SDL_MixAudio_S32_SIMD, SDL_BYTEORDER != SDL_LIL_ENDIAN);
         {
             const Uint32 *src32 = (Uint32 *) src;
             Uint32 *dst32 = (Uint32 *) dst;
@@ -273,6 +505,7 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         break;
 
     case AUDIO_S32MSB:
+        SDL_MIX_AUDIO_SIMD(SDL_MixAudio_S32_SIMD, SDL_BYTEORDER != SDL_BIG_ENDIAN);
         {
             const Uint32 *src32 = (Uint32 *) src;
             Uint32 *dst32 = (Uint32 *) dst;
@@ -300,6 +533,7 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         break;
 
     case AUDIO_F32LSB:
+        SDL_MIX_AUDIO_SIMD(SDL_MixAudio_F32_SIMD, SDL_BYTEORDER != SDL_LIL_ENDIAN);
         {
             const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
             const float fvolume = (float) volume;
@@ -329,6 +563,7 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         break;
 
     case AUDIO_F32MSB:
+        SDL_MIX_AUDIO_SIMD(SDL_MixAudio_F32_SIMD, SDL_BYTEORDER != SDL_BIG_ENDIAN);
         {
             const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
             const float fvolume = (float) volume;
@@ -153,6 +153,10 @@ struct SDL_AudioDevice
     /* An audio conversion block for audio format emulation */
     SDL_AudioCVT convert;
 
+    /* Converts the callback's audio in the audio thread, so the resampler
+       keeps its history from one callback to the next */
+    SDL_AudioStream *stream;
+
     /* The streamer, if sample rate conversion necessitates it */
     int use_streamer;
     SDL_AudioStreamer streamer;
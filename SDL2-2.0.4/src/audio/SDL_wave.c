@@ -133,7 +133,7 @@ MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
     *audio_len = (encoded_len / MS_ADPCM_state.wavefmt.blockalign) *
         MS_ADPCM_state.wSamplesPerBlock *
         MS_ADPCM_state.wavefmt.channels * sizeof(Sint16);
-    *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
+    *audio_buf = (Uint8 *) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, *audio_len);
     if (*audio_buf == NULL) {
         return SDL_OutOfMemory();
     }
@@ -358,7 +358,7 @@ IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
     *audio_len = (encoded_len / IMA_ADPCM_state.wavefmt.blockalign) *
         IMA_ADPCM_state.wSamplesPerBlock *
         IMA_ADPCM_state.wavefmt.channels * sizeof(Sint16);
-    *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
+    *audio_buf = (Uint8 *) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, *audio_len);
     if (*audio_buf == NULL) {
         return SDL_OutOfMemory();
     }
@@ -609,7 +609,7 @@ ReadChunk(SDL_RWops * src, Chunk * chunk)
 {
     chunk->magic = SDL_ReadLE32(src);
     chunk->length = SDL_ReadLE32(src);
-    chunk->data = (Uint8 *) SDL_malloc(chunk->length);
+    chunk->data = (Uint8 *) SDL_TaggedMalloc(SDL_MEMTAG_AUDIO, chunk->length);
     if (chunk->data == NULL) {
         return SDL_OutOfMemory();
     }
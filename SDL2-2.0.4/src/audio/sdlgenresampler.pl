@@ -0,0 +1,117 @@
+#!/usr/bin/perl -w
+
+# Generates SDL_audio_resampler_filter.h, the windowed-sinc lookup table
+#  used by the polyphase resampler in SDL_audiocvt.c:
+#
+#    perl sdlgenresampler.pl > SDL_audio_resampler_filter.h
+
+use warnings;
+use strict;
+
+# Number of zero crossings on each side of the sinc. The filter is
+#  (2 * zero crossings) taps long when upsampling.
+my $zero_crossings = 8;
+
+# Table entries between zero crossings. The resampler interpolates
+#  linearly between entries, so this sets the phase resolution.
+my $samples_per_zero_crossing = 256;
+
+# Kaiser window shape, roughly 80 dB of stopband attenuation.
+my $kaiser_beta = 8.0;
+
+my $filter_size = ($samples_per_zero_crossing * $zero_crossings) + 1;
+my $pi = 4.0 * atan2(1.0, 1.0);
+
+
+# Zeroth order modified Bessel function of the first kind.
+sub bessel_i0 {
+    my $x = shift;
+    my $sum = 1.0;
+    my $term = 1.0;
+    my $k = 1;
+
+    while ($term > ($sum * 1e-21)) {
+        my $half = $x / (2.0 * $k);
+        $term *= $half * $half;
+        $sum += $term;
+        $k++;
+    }
+    return $sum;
+}
+
+
+sub kaiser {
+    my ($n, $len) = @_;    # $n in [0, $len]
+    my $ratio = $n / $len;
+    return bessel_i0($kaiser_beta * sqrt(1.0 - $ratio * $ratio)) / bessel_i0($kaiser_beta);
+}
+
+
+sub outputHeader {
+    print <<EOF;
+/* DO NOT EDIT!  This file is generated by sdlgenresampler.pl */
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2016 Sam Lantinga <slouken\@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* One side of a Kaiser windowed sinc (beta $kaiser_beta), sampled
+   $samples_per_zero_crossing times between each of its $zero_crossings zero crossings. */
+
+#define RESAMPLER_ZERO_CROSSINGS $zero_crossings
+#define RESAMPLER_SAMPLES_PER_ZERO_CROSSING $samples_per_zero_crossing
+#define RESAMPLER_FILTER_SIZE ((RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_ZERO_CROSSINGS) + 1)
+
+EOF
+}
+
+
+sub outputTable {
+    my ($name, @values) = @_;
+
+    print "static const float ${name}[RESAMPLER_FILTER_SIZE] = {\n";
+    for (my $i = 0; $i < @values; $i += 4) {
+        my $line = '   ';
+        for (my $j = $i; $j < $i + 4 && $j < @values; $j++) {
+            $line .= sprintf(' %.9ef,', $values[$j]);
+        }
+        print "$line\n";
+    }
+    print "};\n\n";
+}
+
+
+my @filter;
+for (my $i = 0; $i < $filter_size; $i++) {
+    my $x = $i / $samples_per_zero_crossing;
+    my $sinc = ($i == 0) ? 1.0 : sin($pi * $x) / ($pi * $x);
+    push @filter, $sinc * kaiser($i, $filter_size - 1);
+}
+$filter[$filter_size - 1] = 0.0;
+
+my @difference;
+for (my $i = 0; $i < $filter_size - 1; $i++) {
+    push @difference, $filter[$i + 1] - $filter[$i];
+}
+push @difference, 0.0;
+
+outputHeader();
+outputTable('ResamplerFilter', @filter);
+outputTable('ResamplerFilterDifference', @difference);
+print "/* vi: set ts=4 sw=4 expandtab: */\n";
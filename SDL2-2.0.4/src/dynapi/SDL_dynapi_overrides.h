@@ -620,3 +620,25 @@
 #define SDL_BleDiscoverDescriptors SDL_BleDiscoverDescriptors_REAL
 #define SDL_BleAuthorizationStatus SDL_BleAuthorizationStatus_REAL
 #define SDL_BleUuidEqual SDL_BleUuidEqual_REAL
+
+#define SDL_PushEvents SDL_PushEvents_REAL
+#define SDL_NewAudioStream SDL_NewAudioStream_REAL
+#define SDL_AudioStreamPut SDL_AudioStreamPut_REAL
+#define SDL_AudioStreamGet SDL_AudioStreamGet_REAL
+#define SDL_AudioStreamAvailable SDL_AudioStreamAvailable_REAL
+#define SDL_AudioStreamFlush SDL_AudioStreamFlush_REAL
+#define SDL_AudioStreamClear SDL_AudioStreamClear_REAL
+#define SDL_FreeAudioStream SDL_FreeAudioStream_REAL
+#define SDL_RWFromFileMapped SDL_RWFromFileMapped_REAL
+#define SDL_RWGetMemory SDL_RWGetMemory_REAL
+#define SDL_RWFromRW SDL_RWFromRW_REAL
+#define SDL_GetMallocCacheStats SDL_GetMallocCacheStats_REAL
+#define SDL_TaggedMalloc SDL_TaggedMalloc_REAL
+#define SDL_TaggedCalloc SDL_TaggedCalloc_REAL
+#define SDL_TaggedRealloc SDL_TaggedRealloc_REAL
+#define SDL_GetMemoryStats SDL_GetMemoryStats_REAL
+#define SDL_GetMemoryTagName SDL_GetMemoryTagName_REAL
+#define SDL_DumpMemoryStats SDL_DumpMemoryStats_REAL
+#define SDL_RadixSort32 SDL_RadixSort32_REAL
+#define SDL_RadixSortKeyed SDL_RadixSortKeyed_REAL
+#define SDL_memset4 SDL_memset4_REAL
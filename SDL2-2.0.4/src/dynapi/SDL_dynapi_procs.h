@@ -654,4 +654,25 @@ SDL_DYNAPI_PROC(void,SDL_BleWriteCharacteristic,(SDL_BlePeripheral* a, SDL_BleCh
 SDL_DYNAPI_PROC(void,SDL_BleSetNotify,(SDL_BlePeripheral* a, SDL_BleCharacteristic* b),(a,b),)
 SDL_DYNAPI_PROC(void,SDL_BleDiscoverDescriptors,(SDL_BlePeripheral* a, SDL_BleCharacteristic* b),(a,b),)
 SDL_DYNAPI_PROC(int,SDL_BleAuthorizationStatus,(void),(),return)
-SDL_DYNAPI_PROC(SDL_bool,SDL_BleUuidEqual,(const char* a, const char* b),(a,b),return)
\ No newline at end of file
+SDL_DYNAPI_PROC(SDL_bool,SDL_BleUuidEqual,(const char* a, const char* b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_PushEvents,(SDL_Event *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_NewAudioStream,(const SDL_AudioFormat a, const Uint8 b, const int c, const SDL_AudioFormat d, const Uint8 e, const int f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamPut,(SDL_AudioStream *a, const void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamGet,(SDL_AudioStream *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamAvailable,(SDL_AudioStream *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamFlush,(SDL_AudioStream *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_AudioStreamClear,(SDL_AudioStream *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_FreeAudioStream,(SDL_AudioStream *a),(a),)
+SDL_DYNAPI_PROC(SDL_RWops*,SDL_RWFromFileMapped,(const char *a),(a),return)
+SDL_DYNAPI_PROC(const void*,SDL_RWGetMemory,(SDL_RWops *a, Sint64 *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_RWops*,SDL_RWFromRW,(SDL_RWops *a, int b, SDL_bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_GetMallocCacheStats,(SDL_MallocCacheStats *a),(a),)
+SDL_DYNAPI_PROC(void*,SDL_TaggedMalloc,(int a, size_t b),(a,b),return)
+SDL_DYNAPI_PROC(void*,SDL_TaggedCalloc,(int a, size_t b, size_t c),(a,b,c),return)
+SDL_DYNAPI_PROC(void*,SDL_TaggedRealloc,(int a, void *b, size_t c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_GetMemoryStats,(int a, SDL_MemoryStats *b),(a,b),return)
+SDL_DYNAPI_PROC(const char*,SDL_GetMemoryTagName,(int a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DumpMemoryStats,(void),(),)
+SDL_DYNAPI_PROC(int,SDL_RadixSort32,(Uint32 *a, size_t b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_RadixSortKeyed,(void *a, size_t b, size_t c, size_t d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_memset4,(void *a, Uint32 b, size_t c),(a,b,c),)
\ No newline at end of file
@@ -36,6 +36,10 @@
 /* An arbitrary limit so we don't have unbounded growth */
 #define SDL_MAX_QUEUED_EVENTS   65535
 
+/* The number of entries in the lock-free ring, must be a power of 2 */
+#define SDL_EVENT_RING_SIZE     4096
+#define SDL_EVENT_RING_MASK     (SDL_EVENT_RING_SIZE-1)
+
 /* Public data -- the event filter */
 SDL_EventFilter SDL_EventOK = NULL;
 void *SDL_EventOKParam;
@@ -70,18 +74,46 @@ typedef struct _SDL_SysWMEntry
     struct _SDL_SysWMEntry *next;
 } SDL_SysWMEntry;
 
+/* Events are pushed into a bounded lock-free ring, which any number of
+   threads may add to at once.  Whoever holds the queue lock moves them
+   from the ring onto the end of the event list before looking at it, so
+   the list can still be searched and have events cut from the middle.
+   Threads adding events are counted in SDL_EventQ.adding, so the ring
+   isn't freed under them when the event loop stops.
+ */
+typedef struct
+{
+    SDL_atomic_t sequence;
+    SDL_Event event;
+} SDL_EventRingEntry;
+
+typedef struct
+{
+    SDL_EventRingEntry entries[SDL_EVENT_RING_SIZE];
+
+    char cache_pad1[SDL_CACHELINE_SIZE-((sizeof(SDL_EventRingEntry)*SDL_EVENT_RING_SIZE)%SDL_CACHELINE_SIZE)];
+
+    SDL_atomic_t enqueue_pos;
+
+    char cache_pad2[SDL_CACHELINE_SIZE-sizeof(SDL_atomic_t)];
+
+    unsigned dequeue_pos;   /* Only used with the queue locked */
+} SDL_EventRing;
+
 static struct
 {
     SDL_mutex *lock;
     volatile SDL_bool active;
-    volatile int count;
+    SDL_atomic_t count;     /* Events in the ring and the list */
+    SDL_atomic_t adding;    /* Threads in SDL_AddEvents() */
     volatile int max_events_seen;
+    SDL_EventRing *ring;
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
     SDL_SysWMEntry *wmmsg_used;
     SDL_SysWMEntry *wmmsg_free;
-} SDL_EventQ = { NULL, SDL_TRUE, 0, 0, NULL, NULL, NULL, NULL, NULL };
+} SDL_EventQ = { NULL, SDL_TRUE, { 0 }, { 0 }, 0, NULL, NULL, NULL, NULL, NULL, NULL };
 
 
 /* Public functions */
@@ -94,11 +126,21 @@ SDL_StopEventLoop(void)
     SDL_EventEntry *entry;
     SDL_SysWMEntry *wmmsg;
 
+    /* Threads adding events don't take the lock, so wait for the ones that
+       got in before the queue was shut down.  The compare-and-swap is a
+       full barrier, so they either see the queue inactive or get counted.
+     */
+    SDL_EventQ.active = SDL_FALSE;
+    while (!SDL_AtomicCAS(&SDL_EventQ.adding, 0, 0)) {
+        SDL_Delay(0);
+    }
+
     if (SDL_EventQ.lock) {
         SDL_LockMutex(SDL_EventQ.lock);
     }
 
-    SDL_EventQ.active = SDL_FALSE;
+    SDL_free(SDL_EventQ.ring);
+    SDL_EventQ.ring = NULL;
 
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d\n",
@@ -127,7 +169,7 @@ SDL_StopEventLoop(void)
         wmmsg = next;
     }
 
-    SDL_EventQ.count = 0;
+    SDL_AtomicSet(&SDL_EventQ.count, 0);
     SDL_EventQ.max_events_seen = 0;
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
@@ -175,6 +217,23 @@ SDL_StartEventLoop(void)
     }
 #endif /* !SDL_THREADS_DISABLED */
 
+    /* Without the ring, events are added to the list with the queue locked */
+    if (!SDL_EventQ.ring) {
+        SDL_EventRing *ring = (SDL_EventRing *)SDL_TaggedMalloc(SDL_MEMTAG_EVENT, sizeof(*ring));
+        if (ring) {
+            int i;
+
+            for (i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+                SDL_AtomicSet(&ring->entries[i].sequence, i);
+            }
+            SDL_AtomicSet(&ring->enqueue_pos, 0);
+            ring->dequeue_pos = 0;
+        }
+        SDL_LockMutex(SDL_EventQ.lock);
+        SDL_EventQ.ring = ring;
+        SDL_UnlockMutex(SDL_EventQ.lock);
+    }
+
     /* Process most event types */
     SDL_EventState(SDL_TEXTINPUT, SDL_DISABLE);
     SDL_EventState(SDL_TEXTEDITING, SDL_DISABLE);
@@ -186,20 +245,19 @@ SDL_StartEventLoop(void)
 }
 
 
-/* Add an event to the event queue -- called with the queue locked */
+/* Append an event to the event list -- called with the queue locked.
+   The event has already been counted in SDL_EventQ.count.
+ */
 static int
-SDL_AddEvent(SDL_Event * event)
+SDL_AppendEvent(const SDL_Event * event)
 {
     SDL_EventEntry *entry;
-
-    if (SDL_EventQ.count >= SDL_MAX_QUEUED_EVENTS) {
-        SDL_SetError("Event queue is full (%d events)", SDL_EventQ.count);
-        return 0;
-    }
+    int count;
 
     if (SDL_EventQ.free == NULL) {
-        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
+        entry = (SDL_EventEntry *)SDL_TaggedMalloc(SDL_MEMTAG_EVENT, sizeof(*entry));
         if (!entry) {
+            SDL_AtomicAdd(&SDL_EventQ.count, -1);
             return 0;
         }
     } else {
@@ -225,15 +283,166 @@ SDL_AddEvent(SDL_Event * event)
         entry->prev = NULL;
         entry->next = NULL;
     }
-    ++SDL_EventQ.count;
 
-    if (SDL_EventQ.count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = SDL_EventQ.count;
+    count = SDL_AtomicGet(&SDL_EventQ.count);
+    if (count > SDL_EventQ.max_events_seen) {
+        SDL_EventQ.max_events_seen = count;
     }
 
     return 1;
 }
 
+/* Move events from the lock-free ring onto the event list -- called with
+   the queue locked.  This stops at the first entry that is still being
+   written, so events from each thread stay in the order they were pushed.
+   With 'wait', it waits for the entries taken so far to be written, so
+   every event added before is on the list afterwards.
+ */
+static void
+SDL_DrainEventRing(SDL_bool wait)
+{
+    SDL_EventRing *ring = SDL_EventQ.ring;
+    unsigned end;
+
+    if (!ring) {
+        return;
+    }
+
+    end = (unsigned)SDL_AtomicGet(&ring->enqueue_pos);
+    for ( ; ; ) {
+        SDL_EventRingEntry *entry = &ring->entries[ring->dequeue_pos & SDL_EVENT_RING_MASK];
+        unsigned entry_seq = (unsigned)SDL_AtomicGet(&entry->sequence);
+
+        if ((int)(entry_seq - (ring->dequeue_pos + 1)) < 0) {
+            if (!wait || (int)(ring->dequeue_pos - end) >= 0) {
+                break;
+            }
+            /* Another thread is writing the entry, it won't take long */
+            SDL_Delay(0);
+            continue;
+        }
+        SDL_AppendEvent(&entry->event);
+        SDL_AtomicSet(&entry->sequence, (int)(ring->dequeue_pos + SDL_EVENT_RING_SIZE));
+        ++ring->dequeue_pos;
+    }
+}
+
+/* Reserve 'numevents' consecutive ring entries, returning how many were
+   reserved and the position of the first one.
+ */
+static int
+SDL_ReserveEventRing(SDL_EventRing *ring, int numevents, unsigned *first)
+{
+    unsigned queue_pos = (unsigned)SDL_AtomicGet(&ring->enqueue_pos);
+
+    for ( ; ; ) {
+        SDL_EventRingEntry *entry;
+        unsigned entry_seq;
+        int delta;
+
+        /* Entries are freed in order, so if the last one we want is free
+           the ones before it are as well.
+         */
+        entry = &ring->entries[(queue_pos + numevents - 1) & SDL_EVENT_RING_MASK];
+        entry_seq = (unsigned)SDL_AtomicGet(&entry->sequence);
+
+        delta = (int)(entry_seq - (queue_pos + numevents - 1));
+        if (delta == 0) {
+            if (SDL_AtomicCAS(&ring->enqueue_pos, (int)queue_pos, (int)(queue_pos + numevents))) {
+                *first = queue_pos;
+                return numevents;
+            }
+        } else if (delta < 0) {
+            /* Not enough room, see if a single entry is free */
+            if (numevents == 1) {
+                return 0;
+            }
+            numevents = 1;
+            continue;
+        }
+        /* Another thread took the entries, get the new queue position */
+        queue_pos = (unsigned)SDL_AtomicGet(&ring->enqueue_pos);
+    }
+}
+
+/* Add events to the event queue, without taking the queue lock unless
+   the ring is full or isn't available.
+ */
+static int
+SDL_AddEvents(SDL_Event * events, int numevents)
+{
+    SDL_EventRing *ring = SDL_EventQ.ring;
+    int used = 0;
+
+    while (used < numevents) {
+        int i, count, reserved = 0;
+        unsigned queue_pos = 0;
+
+        /* System messages are copied when they're added to the list */
+        for (count = 0; used + count < numevents; ++count) {
+            if (events[used + count].type == SDL_SYSWMEVENT) {
+                break;
+            }
+        }
+        if (count == 0) {
+            count = 1;
+        }
+
+        /* Reserve space for the events in the queue */
+        i = SDL_AtomicAdd(&SDL_EventQ.count, count);
+        if (i + count > SDL_MAX_QUEUED_EVENTS) {
+            int extra = SDL_min(i + count - SDL_MAX_QUEUED_EVENTS, count);
+            SDL_AtomicAdd(&SDL_EventQ.count, -extra);
+            count -= extra;
+            if (count == 0) {
+                SDL_SetError("Event queue is full (%d events)", i);
+                break;
+            }
+        }
+
+        if (ring && events[used].type != SDL_SYSWMEVENT) {
+            reserved = SDL_ReserveEventRing(ring, count, &queue_pos);
+        }
+        if (reserved > 0) {
+            if (reserved < count) {
+                SDL_AtomicAdd(&SDL_EventQ.count, reserved - count);
+            }
+            for (i = 0; i < reserved; ++i) {
+                SDL_EventRingEntry *entry = &ring->entries[(queue_pos + i) & SDL_EVENT_RING_MASK];
+                entry->event = events[used + i];
+                SDL_AtomicSet(&entry->sequence, (int)(queue_pos + i + 1));
+            }
+            used += reserved;
+            continue;
+        }
+
+        /* The ring is full, add a single event with the queue locked.
+           Everything in the ring goes on the list before it, including
+           entries other threads are still writing, so this thread's
+           earlier events can't be stuck behind one of those.
+         */
+        if (count > 1) {
+            SDL_AtomicAdd(&SDL_EventQ.count, 1 - count);
+        }
+        if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
+            int added;
+
+            SDL_DrainEventRing(SDL_TRUE);
+            added = SDL_AppendEvent(&events[used]);
+            SDL_UnlockMutex(SDL_EventQ.lock);
+            if (!added) {
+                break;
+            }
+            ++used;
+        } else {
+            SDL_AtomicAdd(&SDL_EventQ.count, -1);
+            SDL_SetError("Couldn't lock event queue");
+            break;
+        }
+    }
+    return used;
+}
+
 /* Remove an event from the queue -- called with the queue locked */
 static void
 SDL_CutEvent(SDL_EventEntry *entry)
@@ -256,8 +465,8 @@ SDL_CutEvent(SDL_EventEntry *entry)
 
     entry->next = SDL_EventQ.free;
     SDL_EventQ.free = entry;
-    SDL_assert(SDL_EventQ.count > 0);
-    --SDL_EventQ.count;
+    SDL_assert(SDL_AtomicGet(&SDL_EventQ.count) > 0);
+    SDL_AtomicAdd(&SDL_EventQ.count, -1);
 }
 
 /* Lock the event queue, take a peep at it, and unlock it */
@@ -265,7 +474,7 @@ int
 SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                Uint32 minType, Uint32 maxType)
 {
-    int i, used;
+    int used;
 
     /* Don't look after we've quit */
     if (!SDL_EventQ.active) {
@@ -275,62 +484,73 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
         }
         return (-1);
     }
+    /* Adding events doesn't need the lock */
+    if (action == SDL_ADDEVENT) {
+        used = -1;
+        SDL_AtomicIncRef(&SDL_EventQ.adding);
+        if (SDL_EventQ.active) {
+            used = SDL_AddEvents(events, numevents);
+        }
+        SDL_AtomicAdd(&SDL_EventQ.adding, -1);
+        return used;
+    }
+    /* Nothing to look at, so don't contend for the lock */
+    if (SDL_AtomicGet(&SDL_EventQ.count) == 0) {
+        return 0;
+    }
+
     /* Lock the event queue */
     used = 0;
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
-        if (action == SDL_ADDEVENT) {
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
-            }
-        } else {
-            SDL_EventEntry *entry, *next;
-            SDL_SysWMEntry *wmmsg, *wmmsg_next;
-            SDL_Event tmpevent;
-            Uint32 type;
-
-            /* If 'events' is NULL, just see if they exist */
-            if (events == NULL) {
-                action = SDL_PEEKEVENT;
-                numevents = 1;
-                events = &tmpevent;
-            }
+        SDL_EventEntry *entry, *next;
+        SDL_SysWMEntry *wmmsg, *wmmsg_next;
+        SDL_Event tmpevent;
+        Uint32 type;
 
-            /* Clean out any used wmmsg data
-               FIXME: Do we want to retain the data for some period of time?
-             */
-            for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; wmmsg = wmmsg_next) {
-                wmmsg_next = wmmsg->next;
-                wmmsg->next = SDL_EventQ.wmmsg_free;
-                SDL_EventQ.wmmsg_free = wmmsg;
-            }
-            SDL_EventQ.wmmsg_used = NULL;
-
-            for (entry = SDL_EventQ.head; entry && used < numevents; entry = next) {
-                next = entry->next;
-                type = entry->event.type;
-                if (minType <= type && type <= maxType) {
-                    events[used] = entry->event;
-                    if (entry->event.type == SDL_SYSWMEVENT) {
-                        /* We need to copy the wmmsg somewhere safe.
-                           For now we'll guarantee it's valid at least until
-                           the next call to SDL_PeepEvents()
-                         */
-                        if (SDL_EventQ.wmmsg_free) {
-                            wmmsg = SDL_EventQ.wmmsg_free;
-                            SDL_EventQ.wmmsg_free = wmmsg->next;
-                        } else {
-                            wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
-                        }
-                        wmmsg->msg = *entry->event.syswm.msg;
-                        wmmsg->next = SDL_EventQ.wmmsg_used;
-                        SDL_EventQ.wmmsg_used = wmmsg;
-                        events[used].syswm.msg = &wmmsg->msg;
-                    }
-                    ++used;
+        /* If 'events' is NULL, just see if they exist */
+        if (events == NULL) {
+            action = SDL_PEEKEVENT;
+            numevents = 1;
+            events = &tmpevent;
+        }
+
+        /* Clean out any used wmmsg data
+           FIXME: Do we want to retain the data for some period of time?
+         */
+        for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; wmmsg = wmmsg_next) {
+            wmmsg_next = wmmsg->next;
+            wmmsg->next = SDL_EventQ.wmmsg_free;
+            SDL_EventQ.wmmsg_free = wmmsg;
+        }
+        SDL_EventQ.wmmsg_used = NULL;
+
+        SDL_DrainEventRing(SDL_FALSE);
 
-                    if (action == SDL_GETEVENT) {
-                        SDL_CutEvent(entry);
+        for (entry = SDL_EventQ.head; entry && used < numevents; entry = next) {
+            next = entry->next;
+            type = entry->event.type;
+            if (minType <= type && type <= maxType) {
+                events[used] = entry->event;
+                if (entry->event.type == SDL_SYSWMEVENT) {
+                    /* We need to copy the wmmsg somewhere safe.
+                       For now we'll guarantee it's valid at least until
+                       the next call to SDL_PeepEvents()
+                     */
+                    if (SDL_EventQ.wmmsg_free) {
+                        wmmsg = SDL_EventQ.wmmsg_free;
+                        SDL_EventQ.wmmsg_free = wmmsg->next;
+                    } else {
+                        wmmsg = (SDL_SysWMEntry *)SDL_TaggedMalloc(SDL_MEMTAG_EVENT, sizeof(*wmmsg));
                     }
+                    wmmsg->msg = *entry->event.syswm.msg;
+                    wmmsg->next = SDL_EventQ.wmmsg_used;
+                    SDL_EventQ.wmmsg_used = wmmsg;
+                    events[used].syswm.msg = &wmmsg->msg;
+                }
+                ++used;
+
+                if (action == SDL_GETEVENT) {
+                    SDL_CutEvent(entry);
                 }
             }
         }
@@ -379,6 +599,7 @@ SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     if (SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
         Uint32 type;
+        SDL_DrainEventRing(SDL_FALSE);
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -454,20 +675,30 @@ SDL_WaitEventTimeout(SDL_Event * event, int timeout)
     }
 }
 
-int
-SDL_PushEvent(SDL_Event * event)
+/* Run the event filter and watchers, returns SDL_FALSE if the event was filtered */
+static SDL_bool
+SDL_FilterPushedEvent(SDL_Event * event, Uint32 timestamp)
 {
     SDL_EventWatcher *curr;
 
-    event->common.timestamp = SDL_GetTicks();
+    event->common.timestamp = timestamp;
 
     if (SDL_EventOK && !SDL_EventOK(SDL_EventOKParam, event)) {
-        return 0;
+        return SDL_FALSE;
     }
 
     for (curr = SDL_event_watchers; curr; curr = curr->next) {
         curr->callback(curr->userdata, event);
     }
+    return SDL_TRUE;
+}
+
+int
+SDL_PushEvent(SDL_Event * event)
+{
+    if (!SDL_FilterPushedEvent(event, SDL_GetTicks())) {
+        return 0;
+    }
 
     if (SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) <= 0) {
         return -1;
@@ -478,6 +709,38 @@ SDL_PushEvent(SDL_Event * event)
     return 1;
 }
 
+int
+SDL_PushEvents(SDL_Event * events, int numevents)
+{
+    Uint32 timestamp = SDL_GetTicks();
+    int i, j, first = 0, pushed = 0;
+
+    if (!events && numevents > 0) {
+        return SDL_InvalidParamError("events");
+    }
+
+    /* Add each run of events that got past the filter in one go */
+    for (i = 0; i <= numevents; ++i) {
+        if (i < numevents && SDL_FilterPushedEvent(&events[i], timestamp)) {
+            continue;
+        }
+        if (i > first) {
+            int added = SDL_PeepEvents(&events[first], i - first, SDL_ADDEVENT, 0, 0);
+            for (j = 0; j < added; ++j) {
+                SDL_GestureProcessEvent(&events[first + j]);
+            }
+            if (added > 0) {
+                pushed += added;
+            }
+            if (added < i - first) {
+                return pushed ? pushed : -1;
+            }
+        }
+        first = i + 1;
+    }
+    return pushed;
+}
+
 void
 SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
 {
@@ -553,6 +816,7 @@ SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     if (SDL_EventQ.lock && SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing(SDL_FALSE);
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -47,6 +47,19 @@
 #include "nacl_io/nacl_io.h"
 #endif
 
+#if defined(__WIN32__) && !defined(__WINRT__)
+#define SDL_RWOPS_MMAP_WIN32
+#elif defined(__LINUX__) || defined(__ANDROID__) || defined(__MACOSX__) || \
+      defined(__IPHONEOS__) || defined(__FREEBSD__) || defined(__NETBSD__) || \
+      defined(__OPENBSD__) || defined(__SOLARIS__)
+#define SDL_RWOPS_MMAP_POSIX
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #ifdef __WIN32__
 
 /* Functions to read/write Win32 API file pointers */
@@ -93,7 +106,7 @@ windows_file_open(SDL_RWops * context, const char *filename, const char *mode)
         return -1;              /* failed (invalid call) */
 
     context->hidden.windowsio.buffer.data =
-        (char *) SDL_malloc(READAHEAD_BUFFER_SIZE);
+        (char *) SDL_TaggedMalloc(SDL_MEMTAG_RWOPS, READAHEAD_BUFFER_SIZE);
     if (!context->hidden.windowsio.buffer.data) {
         return SDL_OutOfMemory();
     }
@@ -460,6 +473,434 @@ mem_close(SDL_RWops * context)
 }
 
 
+/* Functions to read read-only files mapped into memory */
+
+/* Empty files can't be mapped, they all share this instead */
+static const Uint8 mapped_empty[1] = { 0 };
+
+static void
+mapped_setup(SDL_RWops * rwops, const Uint8 * base, size_t size)
+{
+    rwops->size = mem_size;
+    rwops->seek = mem_seek;
+    rwops->read = mem_read;
+    rwops->write = mem_writeconst;
+    rwops->hidden.mem.base = (Uint8 *) base;
+    rwops->hidden.mem.here = rwops->hidden.mem.base;
+    rwops->hidden.mem.stop = rwops->hidden.mem.base + size;
+}
+
+#if defined(SDL_RWOPS_MMAP_WIN32) || defined(SDL_RWOPS_MMAP_POSIX)
+
+static int SDLCALL
+mapped_close(SDL_RWops * context)
+{
+    if (context) {
+        if (context->hidden.mem.base != mapped_empty) {
+#ifdef SDL_RWOPS_MMAP_WIN32
+            UnmapViewOfFile(context->hidden.mem.base);
+#else
+            munmap(context->hidden.mem.base,
+                   context->hidden.mem.stop - context->hidden.mem.base);
+#endif
+        }
+        SDL_FreeRW(context);
+    }
+    return 0;
+}
+
+/* Returns NULL without setting an error if the file can't be mapped, the
+   caller falls back to reading it through SDL_RWFromFile() */
+static SDL_RWops *
+mapped_open(const char *file)
+{
+    SDL_RWops *rwops;
+    const Uint8 *base;
+    size_t size;
+
+#ifdef SDL_RWOPS_MMAP_WIN32
+    HANDLE h, mapping;
+    LARGE_INTEGER filesize;
+    UINT old_error_mode;
+
+    /* Do not open a dialog box if failure */
+    old_error_mode =
+        SetErrorMode(SEM_NOOPENFILEERRORBOX | SEM_FAILCRITICALERRORS);
+    {
+        LPTSTR tstr = WIN_UTF8ToString(file);
+        h = CreateFile(tstr, GENERIC_READ, FILE_SHARE_READ, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        SDL_free(tstr);
+    }
+    SetErrorMode(old_error_mode);
+
+    if (h == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+    if (!GetFileSizeEx(h, &filesize) ||
+        (Uint64) filesize.QuadPart > (Uint64) ((size_t) -1)) {
+        CloseHandle(h);
+        return NULL;
+    }
+    size = (size_t) filesize.QuadPart;
+    if (size == 0) {
+        base = mapped_empty;
+    } else {
+        /* The view keeps the file open, the handles aren't needed */
+        mapping = CreateFileMapping(h, NULL, PAGE_READONLY, 0, 0, NULL);
+        base = NULL;
+        if (mapping) {
+            base = (const Uint8 *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(h);
+    if (!base) {
+        return NULL;
+    }
+#else
+    struct stat st;
+    int fd;
+
+    fd = open(file, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) ||
+        (Uint64) st.st_size > (Uint64) ((size_t) -1)) {
+        close(fd);
+        return NULL;
+    }
+    size = (size_t) st.st_size;
+    if (size == 0) {
+        base = mapped_empty;
+    } else {
+        /* The mapping keeps the file open, the descriptor isn't needed */
+        void *mem = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        base = (mem == MAP_FAILED) ? NULL : (const Uint8 *) mem;
+    }
+    close(fd);
+    if (!base) {
+        return NULL;
+    }
+#endif
+
+    rwops = SDL_AllocRW();
+    if (rwops == NULL) {
+        if (base != mapped_empty) {
+#ifdef SDL_RWOPS_MMAP_WIN32
+            UnmapViewOfFile(base);
+#else
+            munmap((void *) base, size);
+#endif
+        }
+        return NULL;
+    }
+    mapped_setup(rwops, base, size);
+    rwops->close = mapped_close;
+    rwops->type = SDL_RWOPS_MAPPED;
+    return rwops;
+}
+
+#endif /* SDL_RWOPS_MMAP_WIN32 || SDL_RWOPS_MMAP_POSIX */
+
+static int SDLCALL
+loaded_close(SDL_RWops * context)
+{
+    if (context) {
+        if (context->hidden.mem.base != mapped_empty) {
+            SDL_free(context->hidden.mem.base);
+        }
+        SDL_FreeRW(context);
+    }
+    return 0;
+}
+
+/* Read the whole file into memory, for files that can't be mapped */
+static SDL_RWops *
+loaded_open(const char *file)
+{
+    SDL_RWops *src, *rwops;
+    Uint8 *data;
+    Sint64 size;
+
+    src = SDL_RWFromFile(file, "rb");
+    if (src == NULL) {
+        return NULL;
+    }
+    size = SDL_RWsize(src);
+    if (size < 0 || (Uint64) size > (Uint64) ((size_t) -1)) {
+        SDL_RWclose(src);
+        SDL_SetError("Couldn't get the size of %s", file);
+        return NULL;
+    }
+    if (size == 0) {
+        data = (Uint8 *) mapped_empty;
+    } else {
+        data = (Uint8 *) SDL_TaggedMalloc(SDL_MEMTAG_RWOPS, (size_t) size);
+        if (data == NULL) {
+            SDL_RWclose(src);
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        if (SDL_RWread(src, data, 1, (size_t) size) != (size_t) size) {
+            SDL_free(data);
+            SDL_RWclose(src);
+            SDL_SetError("Couldn't read %s", file);
+            return NULL;
+        }
+    }
+    SDL_RWclose(src);
+
+    rwops = SDL_AllocRW();
+    if (rwops == NULL) {
+        if (data != mapped_empty) {
+            SDL_free(data);
+        }
+        return NULL;
+    }
+    mapped_setup(rwops, data, (size_t) size);
+    rwops->close = loaded_close;
+    rwops->type = SDL_RWOPS_MEMORY_RO;
+    return rwops;
+}
+
+
+/* Functions to buffer reads and writes to another stream */
+
+#define RWBUFFER_DEFAULT_SIZE   (32 * 1024)
+
+/* The buffer either holds data read ahead from the source, bytes
+   [base, base + fill) with the source positioned at base + fill, or data
+   waiting to be written at base, bytes [base, base + dirty) with the
+   source positioned at base.  It's never both at once, and pos is always
+   within the buffered bytes or right after them.
+*/
+typedef struct
+{
+    Uint8 *data;
+    size_t size;
+    Sint64 base;
+    Sint64 pos;
+    size_t fill;
+    size_t dirty;
+    SDL_bool writable;
+    SDL_bool autoclose;
+} SDL_RWBuffer;
+
+static int
+buffered_flush(SDL_RWops * context)
+{
+    SDL_RWops *src = context->hidden.buffered.src;
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.buffered.buffer;
+    size_t written;
+
+    if (buffer->dirty == 0) {
+        return 0;
+    }
+    written = SDL_RWwrite(src, buffer->data, 1, buffer->dirty);
+    buffer->base += written;
+    if (written < buffer->dirty) {
+        /* The rest is lost, the stream ends up where the writes stopped */
+        buffer->pos = buffer->base;
+        buffer->dirty = 0;
+        return SDL_SetError("Couldn't write buffered data: %s", SDL_GetError());
+    }
+    buffer->dirty = 0;
+    return 0;
+}
+
+/* Flush any writes, drop the buffer and move the source to pos */
+static Sint64
+buffered_moveto(SDL_RWops * context, Sint64 pos)
+{
+    SDL_RWops *src = context->hidden.buffered.src;
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.buffered.buffer;
+    Sint64 srcpos;
+
+    if (buffered_flush(context) < 0) {
+        return -1;
+    }
+    srcpos = buffer->base + buffer->fill;
+    if (pos != srcpos) {
+        srcpos = SDL_RWseek(src, pos, RW_SEEK_SET);
+        if (srcpos < 0) {
+            return -1;
+        }
+    }
+    buffer->base = srcpos;
+    buffer->pos = srcpos;
+    buffer->fill = 0;
+    return srcpos;
+}
+
+static Sint64 SDLCALL
+buffered_size(SDL_RWops * context)
+{
+    if (buffered_flush(context) < 0) {
+        return -1;
+    }
+    return SDL_RWsize(context->hidden.buffered.src);
+}
+
+static Sint64 SDLCALL
+buffered_seek(SDL_RWops * context, Sint64 offset, int whence)
+{
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.buffered.buffer;
+    Sint64 pos;
+
+    switch (whence) {
+    case RW_SEEK_SET:
+        pos = offset;
+        break;
+    case RW_SEEK_CUR:
+        pos = buffer->pos + offset;
+        break;
+    case RW_SEEK_END:
+        if (buffered_flush(context) < 0) {
+            return -1;
+        }
+        pos = SDL_RWseek(context->hidden.buffered.src, offset, RW_SEEK_END);
+        if (pos < 0) {
+            return -1;
+        }
+        buffer->base = pos;
+        buffer->pos = pos;
+        buffer->fill = 0;
+        return pos;
+    default:
+        return SDL_SetError("Unknown value for 'whence'");
+    }
+    if (pos < 0) {
+        return SDL_SetError("Can't seek before the start of the stream");
+    }
+
+    /* Seeks within the data read ahead don't need the source.  Pending
+       writes have to be flushed first, they end where pos is. */
+    if (pos == buffer->pos ||
+        (buffer->dirty == 0 &&
+         pos >= buffer->base && pos <= buffer->base + (Sint64) buffer->fill)) {
+        buffer->pos = pos;
+        return pos;
+    }
+    return buffered_moveto(context, pos);
+}
+
+static size_t SDLCALL
+buffered_read(SDL_RWops * context, void *ptr, size_t size, size_t maxnum)
+{
+    SDL_RWops *src = context->hidden.buffered.src;
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.buffered.buffer;
+    Uint8 *dst = (Uint8 *) ptr;
+    size_t total_bytes, left, amount;
+
+    total_bytes = (maxnum * size);
+    if ((maxnum <= 0) || (size <= 0)
+        || ((total_bytes / maxnum) != (size_t) size)) {
+        return 0;
+    }
+    if (buffered_flush(context) < 0) {
+        return 0;
+    }
+
+    left = total_bytes;
+    while (left > 0) {
+        amount = (size_t) (buffer->base + buffer->fill - buffer->pos);
+        if (amount > 0) {
+            if (amount > left) {
+                amount = left;
+            }
+            SDL_memcpy(dst, buffer->data + (size_t) (buffer->pos - buffer->base), amount);
+            buffer->pos += amount;
+            dst += amount;
+            left -= amount;
+            continue;
+        }
+
+        /* The buffer is used up and the source is at pos */
+        buffer->base = buffer->pos;
+        buffer->fill = 0;
+        if (left >= buffer->size) {
+            /* Big reads go straight into the caller's memory */
+            amount = SDL_RWread(src, dst, 1, left);
+            buffer->base += amount;
+            buffer->pos += amount;
+            left -= amount;
+            break;
+        }
+        buffer->fill = SDL_RWread(src, buffer->data, 1, buffer->size);
+        if (buffer->fill == 0) {
+            break;
+        }
+    }
+    return (total_bytes - left) / size;
+}
+
+static size_t SDLCALL
+buffered_write(SDL_RWops * context, const void *ptr, size_t size, size_t num)
+{
+    SDL_RWops *src = context->hidden.buffered.src;
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.buffered.buffer;
+    size_t total_bytes, written;
+
+    total_bytes = (num * size);
+    if ((num <= 0) || (size <= 0)
+        || ((total_bytes / num) != (size_t) size)) {
+        return 0;
+    }
+
+    /* Data read ahead is dropped, and the source goes back to pos */
+    if (buffer->fill > 0 && buffered_moveto(context, buffer->pos) < 0) {
+        return 0;
+    }
+    if (buffer->dirty + total_bytes > buffer->size &&
+        buffered_flush(context) < 0) {
+        return 0;
+    }
+    if (total_bytes >= buffer->size || !buffer->writable) {
+        /* Big writes go straight to the source, and so does the first one,
+           so writing to a read-only source fails right away */
+        written = SDL_RWwrite(src, ptr, 1, total_bytes);
+        if (written > 0) {
+            buffer->writable = SDL_TRUE;
+        }
+        buffer->base += written;
+        buffer->pos = buffer->base;
+        return written / size;
+    }
+    SDL_memcpy(buffer->data + buffer->dirty, ptr, total_bytes);
+    buffer->dirty += total_bytes;
+    buffer->pos += total_bytes;
+    return num;
+}
+
+static int SDLCALL
+buffered_close(SDL_RWops * context)
+{
+    int status = 0;
+
+    if (context) {
+        SDL_RWops *src = context->hidden.buffered.src;
+        SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.buffered.buffer;
+
+        if (buffer->autoclose) {
+            status = buffered_flush(context);
+            if (SDL_RWclose(src) < 0) {
+                status = -1;
+            }
+        } else {
+            /* Leave the source where the caller was, not where we read to */
+            if (buffered_moveto(context, buffer->pos) < 0) {
+                status = -1;
+            }
+        }
+        SDL_free(buffer);
+        SDL_FreeRW(context);
+    }
+    return status;
+}
+
+
 /* Functions to create SDL_RWops structures from various data sources */
 
 SDL_RWops *
@@ -633,12 +1074,83 @@ SDL_RWFromConstMem(const void *mem, int size)
     return rwops;
 }
 
+SDL_RWops *
+SDL_RWFromFileMapped(const char *file)
+{
+    SDL_RWops *rwops = NULL;
+    if (!file || !*file) {
+        SDL_SetError("SDL_RWFromFileMapped(): No file specified");
+        return NULL;
+    }
+#if defined(SDL_RWOPS_MMAP_WIN32) || defined(SDL_RWOPS_MMAP_POSIX)
+    rwops = mapped_open(file);
+#endif
+    if (!rwops) {
+        /* Android assets, application bundles and systems without mmap */
+        rwops = loaded_open(file);
+    }
+    return rwops;
+}
+
+SDL_RWops *
+SDL_RWFromRW(SDL_RWops * src, int size, SDL_bool autoclose)
+{
+    SDL_RWops *rwops;
+    SDL_RWBuffer *buffer;
+    Sint64 pos;
+
+    if (!src) {
+        SDL_InvalidParamError("src");
+        return NULL;
+    }
+    if (size < 0) {
+        SDL_InvalidParamError("size");
+        return NULL;
+    }
+    if (size == 0) {
+        size = RWBUFFER_DEFAULT_SIZE;
+    }
+
+    /* Streams that can't seek or tell are taken to start at 0 */
+    pos = SDL_RWtell(src);
+    if (pos < 0) {
+        pos = 0;
+    }
+
+    buffer = (SDL_RWBuffer *) SDL_TaggedMalloc(SDL_MEMTAG_RWOPS, sizeof (*buffer) + size);
+    if (buffer == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    rwops = SDL_AllocRW();
+    if (rwops == NULL) {
+        SDL_free(buffer);
+        return NULL;
+    }
+    SDL_zerop(buffer);
+    buffer->data = (Uint8 *) (buffer + 1);
+    buffer->size = (size_t) size;
+    buffer->base = pos;
+    buffer->pos = pos;
+    buffer->autoclose = autoclose;
+
+    rwops->size = buffered_size;
+    rwops->seek = buffered_seek;
+    rwops->read = buffered_read;
+    rwops->write = buffered_write;
+    rwops->close = buffered_close;
+    rwops->hidden.buffered.src = src;
+    rwops->hidden.buffered.buffer = buffer;
+    rwops->type = SDL_RWOPS_BUFFERED;
+    return rwops;
+}
+
 SDL_RWops *
 SDL_AllocRW(void)
 {
     SDL_RWops *area;
 
-    area = (SDL_RWops *) SDL_malloc(sizeof *area);
+    area = (SDL_RWops *) SDL_TaggedMalloc(SDL_MEMTAG_RWOPS, sizeof *area);
     if (area == NULL) {
         SDL_OutOfMemory();
     } else {
@@ -653,6 +1165,28 @@ SDL_FreeRW(SDL_RWops * area)
     SDL_free(area);
 }
 
+const void *
+SDL_RWGetMemory(SDL_RWops * context, Sint64 * size)
+{
+    if (!context) {
+        SDL_InvalidParamError("context");
+        return NULL;
+    }
+    switch (context->type) {
+    case SDL_RWOPS_MEMORY:
+    case SDL_RWOPS_MEMORY_RO:
+    case SDL_RWOPS_MAPPED:
+        if (size) {
+            *size = (Sint64) (context->hidden.mem.stop - context->hidden.mem.base);
+        }
+        return context->hidden.mem.base;
+    default:
+        break;
+    }
+    SDL_SetError("Stream isn't in memory");
+    return NULL;
+}
+
 /* Functions for dynamically reading and writing endian-specific values */
 
 Uint8
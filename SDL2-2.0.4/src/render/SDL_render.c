@@ -77,6 +77,104 @@ static char texture_magic;
 
 static int UpdateLogicalSize(SDL_Renderer *renderer);
 
+/* Submit any queued draw calls to the backend */
+static int
+FlushRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderBatch *batch = &renderer->batch;
+    int count = batch->count;
+    int i, status = 0;
+
+    if (count == 0) {
+        return 0;
+    }
+    batch->count = 0;
+
+    switch (batch->type) {
+    case SDL_RENDERCMD_FILLRECTS:
+        status = renderer->RenderFillRects(renderer, batch->dstrects, count);
+        break;
+    case SDL_RENDERCMD_COPY:
+        if (renderer->RenderCopies) {
+            status = renderer->RenderCopies(renderer, batch->texture,
+                                            batch->srcrects, batch->dstrects,
+                                            count);
+        } else {
+            for (i = 0; i < count; ++i) {
+                if (renderer->RenderCopy(renderer, batch->texture,
+                                         &batch->srcrects[i],
+                                         &batch->dstrects[i]) < 0) {
+                    status = -1;
+                }
+            }
+        }
+        break;
+    default:
+        break;
+    }
+    batch->type = SDL_RENDERCMD_NONE;
+    batch->texture = NULL;
+
+    return status;
+}
+
+/* Reserve room for 'count' rectangles in the batch, returning the index of
+   the first one or -1 on error.  Draws that can't be merged with the queued
+   ones flush them first.
+ */
+static int
+QueueRenderCommand(SDL_Renderer *renderer, SDL_RenderCommandType type,
+                   SDL_Texture *texture, int count)
+{
+    SDL_RenderBatch *batch = &renderer->batch;
+    int first;
+
+    if (batch->type != type || batch->texture != texture) {
+        if (FlushRenderCommands(renderer) < 0) {
+            return -1;
+        }
+        batch->type = type;
+        batch->texture = texture;
+    }
+
+    if (batch->count + count > batch->max_count) {
+        int max_count = SDL_max(batch->max_count * 2, 64);
+        SDL_Rect *srcrects;
+        SDL_FRect *dstrects;
+
+        while (max_count < batch->count + count) {
+            max_count *= 2;
+        }
+        srcrects = (SDL_Rect *) SDL_realloc(batch->srcrects, max_count * sizeof(*srcrects));
+        if (!srcrects) {
+            return SDL_OutOfMemory();
+        }
+        batch->srcrects = srcrects;
+        dstrects = (SDL_FRect *) SDL_realloc(batch->dstrects, max_count * sizeof(*dstrects));
+        if (!dstrects) {
+            return SDL_OutOfMemory();
+        }
+        batch->dstrects = dstrects;
+        batch->max_count = max_count;
+    }
+
+    first = batch->count;
+    batch->count += count;
+    return first;
+}
+
+static void
+InitRenderBatching(SDL_Renderer *renderer)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_BATCHING);
+
+    if (hint && *hint != '0') {
+        renderer->batching = SDL_TRUE;
+    } else {
+        renderer->batching = SDL_FALSE;
+    }
+}
+
 int
 SDL_GetNumRenderDrivers(void)
 {
@@ -110,6 +208,8 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
     if (event->type == SDL_WINDOWEVENT) {
         SDL_Window *window = SDL_GetWindowFromID(event->window.windowID);
         if (window == renderer->window) {
+            FlushRenderCommands(renderer);
+
             if (renderer->WindowEvent) {
                 renderer->WindowEvent(renderer, &event->window);
             }
@@ -290,6 +390,7 @@ SDL_CreateRenderer(SDL_Window * window, int index, Uint32 flags)
         renderer->window = window;
         renderer->scale.x = 1.0f;
         renderer->scale.y = 1.0f;
+        InitRenderBatching(renderer);
 
         if (SDL_GetWindowFlags(window) & (SDL_WINDOW_HIDDEN|SDL_WINDOW_MINIMIZED)) {
             renderer->hidden = SDL_TRUE;
@@ -325,6 +426,7 @@ SDL_CreateSoftwareRenderer(SDL_Surface * surface)
         renderer->magic = &renderer_magic;
         renderer->scale.x = 1.0f;
         renderer->scale.y = 1.0f;
+        InitRenderBatching(renderer);
 
         SDL_RenderSetViewport(renderer, NULL);
     }
@@ -618,6 +720,9 @@ SDL_SetTextureColorMod(SDL_Texture * texture, Uint8 r, Uint8 g, Uint8 b)
     CHECK_TEXTURE_MAGIC(texture, -1);
 
     renderer = texture->renderer;
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
     if (r < 255 || g < 255 || b < 255) {
         texture->modMode |= SDL_TEXTUREMODULATE_COLOR;
     } else {
@@ -661,6 +766,9 @@ SDL_SetTextureAlphaMod(SDL_Texture * texture, Uint8 alpha)
     CHECK_TEXTURE_MAGIC(texture, -1);
 
     renderer = texture->renderer;
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
     if (alpha < 255) {
         texture->modMode |= SDL_TEXTUREMODULATE_ALPHA;
     } else {
@@ -695,6 +803,9 @@ SDL_SetTextureBlendMode(SDL_Texture * texture, SDL_BlendMode blendMode)
     CHECK_TEXTURE_MAGIC(texture, -1);
 
     renderer = texture->renderer;
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
     texture->blendMode = blendMode;
     if (texture->native) {
         return SDL_SetTextureBlendMode(texture->native, blendMode);
@@ -814,6 +925,9 @@ SDL_UpdateTexture(SDL_Texture * texture, const SDL_Rect * rect,
     if (!pitch) {
         return SDL_InvalidParamError("pitch");
     }
+    if (FlushRenderCommands(texture->renderer) < 0) {
+        return -1;
+    }
 
     if (!rect) {
         full_rect.x = 0;
@@ -911,6 +1025,9 @@ int SDL_UpdateYUVTexture(SDL_Texture * texture, const SDL_Rect * rect,
     if (!Vpitch) {
         return SDL_InvalidParamError("Vpitch");
     }
+    if (FlushRenderCommands(texture->renderer) < 0) {
+        return -1;
+    }
 
     if (texture->format != SDL_PIXELFORMAT_YV12 &&
         texture->format != SDL_PIXELFORMAT_IYUV) {
@@ -970,6 +1087,9 @@ SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
     if (texture->access != SDL_TEXTUREACCESS_STREAMING) {
         return SDL_SetError("SDL_LockTexture(): texture must be streaming");
     }
+    if (FlushRenderCommands(texture->renderer) < 0) {
+        return -1;
+    }
 
     if (!rect) {
         full_rect.x = 0;
@@ -1070,6 +1190,9 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         /* Nothing to do! */
         return 0;
     }
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
 
     /* texture == NULL is valid and means reset the target to the window */
     if (texture) {
@@ -1220,6 +1343,10 @@ SDL_RenderSetViewport(SDL_Renderer * renderer, const SDL_Rect * rect)
 {
     CHECK_RENDERER_MAGIC(renderer, -1);
 
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
+
     if (rect) {
         renderer->viewport.x = (int)SDL_floor(rect->x * renderer->scale.x);
         renderer->viewport.y = (int)SDL_floor(rect->y * renderer->scale.y);
@@ -1253,6 +1380,10 @@ SDL_RenderSetClipRect(SDL_Renderer * renderer, const SDL_Rect * rect)
 {
     CHECK_RENDERER_MAGIC(renderer, -1)
 
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
+
     if (rect) {
         renderer->clipping_enabled = SDL_TRUE;
         renderer->clip_rect.x = (int)SDL_floor(rect->x * renderer->scale.x);
@@ -1315,6 +1446,12 @@ SDL_SetRenderDrawColor(SDL_Renderer * renderer,
 {
     CHECK_RENDERER_MAGIC(renderer, -1);
 
+    if (r != renderer->r || g != renderer->g ||
+        b != renderer->b || a != renderer->a) {
+        if (FlushRenderCommands(renderer) < 0) {
+            return -1;
+        }
+    }
     renderer->r = r;
     renderer->g = g;
     renderer->b = b;
@@ -1348,6 +1485,11 @@ SDL_SetRenderDrawBlendMode(SDL_Renderer * renderer, SDL_BlendMode blendMode)
 {
     CHECK_RENDERER_MAGIC(renderer, -1);
 
+    if (blendMode != renderer->blendMode) {
+        if (FlushRenderCommands(renderer) < 0) {
+            return -1;
+        }
+    }
     renderer->blendMode = blendMode;
     return 0;
 }
@@ -1370,6 +1512,9 @@ SDL_RenderClear(SDL_Renderer * renderer)
     if (renderer->hidden) {
         return 0;
     }
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
     return renderer->RenderClear(renderer);
 }
 
@@ -1429,6 +1574,9 @@ SDL_RenderDrawPoints(SDL_Renderer * renderer,
     if (renderer->hidden) {
         return 0;
     }
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
 
     if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
         return RenderDrawPointsWithRects(renderer, points, count);
@@ -1538,6 +1686,9 @@ SDL_RenderDrawLines(SDL_Renderer * renderer,
     if (renderer->hidden) {
         return 0;
     }
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
 
     if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
         return RenderDrawLinesWithRects(renderer, points, count);
@@ -1653,9 +1804,17 @@ SDL_RenderFillRects(SDL_Renderer * renderer,
         return 0;
     }
 
-    frects = SDL_stack_alloc(SDL_FRect, count);
-    if (!frects) {
-        return SDL_OutOfMemory();
+    if (renderer->batching) {
+        int first = QueueRenderCommand(renderer, SDL_RENDERCMD_FILLRECTS, NULL, count);
+        if (first < 0) {
+            return -1;
+        }
+        frects = &renderer->batch.dstrects[first];
+    } else {
+        frects = SDL_stack_alloc(SDL_FRect, count);
+        if (!frects) {
+            return SDL_OutOfMemory();
+        }
     }
     for (i = 0; i < count; ++i) {
         frects[i].x = rects[i].x * renderer->scale.x;
@@ -1663,6 +1822,9 @@ SDL_RenderFillRects(SDL_Renderer * renderer,
         frects[i].w = rects[i].w * renderer->scale.x;
         frects[i].h = rects[i].h * renderer->scale.y;
     }
+    if (renderer->batching) {
+        return 0;
+    }
 
     status = renderer->RenderFillRects(renderer, frects, count);
 
@@ -1720,6 +1882,16 @@ SDL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     frect.w = real_dstrect.w * renderer->scale.x;
     frect.h = real_dstrect.h * renderer->scale.y;
 
+    if (renderer->batching) {
+        int first = QueueRenderCommand(renderer, SDL_RENDERCMD_COPY, texture, 1);
+        if (first < 0) {
+            return -1;
+        }
+        renderer->batch.srcrects[first] = real_srcrect;
+        renderer->batch.dstrects[first] = frect;
+        return 0;
+    }
+
     return renderer->RenderCopy(renderer, texture, &real_srcrect, &frect);
 }
 
@@ -1786,6 +1958,10 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     fcenter.x = real_center.x * renderer->scale.x;
     fcenter.y = real_center.y * renderer->scale.y;
 
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
+
     return renderer->RenderCopyEx(renderer, texture, &real_srcrect, &frect, angle, &fcenter, flip);
 }
 
@@ -1800,6 +1976,9 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
     if (!renderer->RenderReadPixels) {
         return SDL_Unsupported();
     }
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
 
     if (!format) {
         format = SDL_GetWindowPixelFormat(renderer->window);
@@ -1831,6 +2010,9 @@ SDL_RenderPresent(SDL_Renderer * renderer)
 {
     CHECK_RENDERER_MAGIC(renderer, );
 
+    /* Submit anything queued before we were hidden */
+    FlushRenderCommands(renderer);
+
     /* Don't draw while we're hidden */
     if (renderer->hidden) {
         return;
@@ -1849,6 +2031,7 @@ SDL_DestroyTexture(SDL_Texture * texture)
     if (texture == renderer->target) {
         SDL_SetRenderTarget(renderer, NULL);
     }
+    FlushRenderCommands(renderer);
 
     texture->magic = NULL;
 
@@ -1880,6 +2063,11 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
 
     SDL_DelEventWatch(SDL_RendererEventWatch, renderer);
 
+    FlushRenderCommands(renderer);
+    SDL_free(renderer->batch.srcrects);
+    SDL_free(renderer->batch.dstrects);
+    SDL_zero(renderer->batch);
+
     /* Free existing textures for this renderer */
     while (renderer->textures) {
         SDL_DestroyTexture(renderer->textures);
@@ -1902,6 +2090,9 @@ int SDL_GL_BindTexture(SDL_Texture *texture, float *texw, float *texh)
 
     CHECK_TEXTURE_MAGIC(texture, -1);
     renderer = texture->renderer;
+    if (renderer && FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
     if (texture->native) {
         return SDL_GL_BindTexture(texture->native, texw, texh);
     } else if (renderer && renderer->GL_BindTexture) {
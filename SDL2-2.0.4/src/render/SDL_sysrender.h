@@ -45,6 +45,24 @@ typedef struct
     float h;
 } SDL_FRect;
 
+/* Draw calls queued while batching is enabled */
+typedef enum
+{
+    SDL_RENDERCMD_NONE,
+    SDL_RENDERCMD_FILLRECTS,
+    SDL_RENDERCMD_COPY
+} SDL_RenderCommandType;
+
+typedef struct
+{
+    SDL_RenderCommandType type;
+    SDL_Texture *texture;       /**< The source texture for SDL_RENDERCMD_COPY */
+    int count;                  /**< The number of queued rectangles */
+    int max_count;              /**< The allocated size of the rectangle arrays */
+    SDL_Rect *srcrects;
+    SDL_FRect *dstrects;
+} SDL_RenderBatch;
+
 /* Define the SDL texture structure */
 struct SDL_Texture
 {
@@ -109,6 +127,9 @@ struct SDL_Renderer
                             int count);
     int (*RenderCopy) (SDL_Renderer * renderer, SDL_Texture * texture,
                        const SDL_Rect * srcrect, const SDL_FRect * dstrect);
+    int (*RenderCopies) (SDL_Renderer * renderer, SDL_Texture * texture,
+                         const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                         int count);
     int (*RenderCopyEx) (SDL_Renderer * renderer, SDL_Texture * texture,
                        const SDL_Rect * srcquad, const SDL_FRect * dstrect,
                        const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
@@ -158,6 +179,10 @@ struct SDL_Renderer
     Uint8 r, g, b, a;                   /**< Color for drawing operations values */
     SDL_BlendMode blendMode;            /**< The drawing blend mode */
 
+    /* Draw calls waiting to be submitted to the backend */
+    SDL_bool batching;
+    SDL_RenderBatch batch;
+
     void *driverdata;
 };
 
@@ -79,6 +79,9 @@ static int GL_RenderFillRects(SDL_Renderer * renderer,
                               const SDL_FRect * rects, int count);
 static int GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
                          const SDL_Rect * srcrect, const SDL_FRect * dstrect);
+static int GL_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                           const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                           int count);
 static int GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                          const SDL_Rect * srcrect, const SDL_FRect * dstrect,
                          const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
@@ -442,6 +445,7 @@ GL_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->RenderDrawLines = GL_RenderDrawLines;
     renderer->RenderFillRects = GL_RenderFillRects;
     renderer->RenderCopy = GL_RenderCopy;
+    renderer->RenderCopies = GL_RenderCopies;
     renderer->RenderCopyEx = GL_RenderCopyEx;
     renderer->RenderReadPixels = GL_RenderReadPixels;
     renderer->RenderPresent = GL_RenderPresent;
@@ -1335,6 +1339,59 @@ GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     return GL_CheckError("", renderer);
 }
 
+static int
+GL_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                int count)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
+    GLfloat minx, miny, maxx, maxy;
+    GLfloat minu, maxu, minv, maxv;
+    int i;
+
+    GL_ActivateRenderer(renderer);
+
+    if (GL_SetupCopy(renderer, texture) < 0) {
+        return -1;
+    }
+
+    /* All the copies share the texture state, so submit them as one primitive */
+    data->glBegin(GL_QUADS);
+    for (i = 0; i < count; ++i) {
+        const SDL_Rect *srcrect = &srcrects[i];
+        const SDL_FRect *dstrect = &dstrects[i];
+
+        minx = dstrect->x;
+        miny = dstrect->y;
+        maxx = dstrect->x + dstrect->w;
+        maxy = dstrect->y + dstrect->h;
+
+        minu = (GLfloat) srcrect->x / texture->w;
+        minu *= texturedata->texw;
+        maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
+        maxu *= texturedata->texw;
+        minv = (GLfloat) srcrect->y / texture->h;
+        minv *= texturedata->texh;
+        maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
+        maxv *= texturedata->texh;
+
+        data->glTexCoord2f(minu, minv);
+        data->glVertex2f(minx, miny);
+        data->glTexCoord2f(maxu, minv);
+        data->glVertex2f(maxx, miny);
+        data->glTexCoord2f(maxu, maxv);
+        data->glVertex2f(maxx, maxy);
+        data->glTexCoord2f(minu, maxv);
+        data->glVertex2f(minx, maxy);
+    }
+    data->glEnd();
+
+    data->glDisable(texturedata->type);
+
+    return GL_CheckError("", renderer);
+}
+
 static int
 GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
               const SDL_Rect * srcrect, const SDL_FRect * dstrect,
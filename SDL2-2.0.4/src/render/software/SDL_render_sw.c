@@ -25,6 +25,9 @@
 #include "../SDL_sysrender.h"
 #include "SDL_render_sw_c.h"
 #include "SDL_hints.h"
+#include "SDL_thread.h"
+#include "../../video/SDL_blit.h"
+#include "../../video/SDL_pixels_c.h"
 
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
@@ -65,6 +68,9 @@ static int SW_RenderFillRects(SDL_Renderer * renderer,
                               const SDL_FRect * rects, int count);
 static int SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
                          const SDL_Rect * srcrect, const SDL_FRect * dstrect);
+static int SW_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                           const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                           int count);
 static int SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                           const SDL_Rect * srcrect, const SDL_FRect * dstrect,
                           const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip);
@@ -95,13 +101,281 @@ SDL_RenderDriver SW_RenderDriver = {
      0}
 };
 
+/* The maximum number of operations queued for the worker threads before
+   the renderer waits for them to catch up.
+ */
+#define SW_MAX_QUEUED_OPS   1024
+#define SW_MAX_WORKERS      64
+
+typedef enum
+{
+    SW_OP_CLEAR,
+    SW_OP_FILL,
+    SW_OP_BLENDFILL,
+    SW_OP_COPY
+} SW_RenderOpType;
+
+typedef struct
+{
+    SW_RenderOpType type;
+    SDL_Surface *surface;       /* The render target */
+    SDL_Rect clip_rect;         /* Clip rectangle used for fills and clears */
+    SDL_Rect dstrect;           /* For copies this is already clipped */
+    SDL_Surface *src;           /* The texture surface for copies */
+    SDL_Rect srcrect;
+    Uint32 color;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+} SW_RenderOp;
+
+typedef struct
+{
+    SDL_Thread *thread;
+    int band;                   /* Horizontal band of the target this worker owns */
+    int next_op;                /* Next queued operation this worker will run */
+    void *renderdata;
+} SW_Worker;
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    /* Worker threads, see SDL_HINT_RENDER_SOFTWARE_THREADS */
+    int num_workers;
+    SW_Worker *workers;
+    SDL_mutex *lock;
+    SDL_cond *work_cond;
+    SDL_cond *done_cond;
+    SDL_bool quit;
+    int num_idle;
+    int num_ops;
+    SW_RenderOp *ops;
 } SW_RenderData;
 
 
+static void
+SW_RunOp(SW_RenderData *data, SW_Worker *worker, const SW_RenderOp *op)
+{
+    SDL_Surface view;
+    SDL_Rect band, rect;
+
+    band.x = 0;
+    band.w = op->surface->w;
+    band.y = (op->surface->h * worker->band) / data->num_workers;
+    band.h = (op->surface->h * (worker->band + 1)) / data->num_workers - band.y;
+
+    switch (op->type) {
+    case SW_OP_CLEAR:
+    case SW_OP_FILL:
+    case SW_OP_BLENDFILL:
+        /* Fill through a copy of the target header so each worker can clip
+           to its own band without touching the shared surface.
+         */
+        if (!SDL_IntersectRect(&op->clip_rect, &band, &rect)) {
+            return;
+        }
+        view = *op->surface;
+        view.clip_rect = rect;
+        if (op->type == SW_OP_BLENDFILL) {
+            SDL_BlendFillRect(&view, &op->dstrect, op->blendMode,
+                              op->r, op->g, op->b, op->a);
+        } else {
+            SDL_FillRect(&view, &op->dstrect, op->color);
+        }
+        break;
+
+    case SW_OP_COPY:
+        if (SDL_IntersectRect(&op->dstrect, &band, &rect)) {
+            SDL_Surface *src = op->src;
+            SDL_Surface *dst = op->surface;
+            SDL_BlitInfo info = src->map->info;
+            int srcy = op->srcrect.y + (rect.y - op->dstrect.y);
+
+            info.src = (Uint8 *) src->pixels + srcy * src->pitch +
+                op->srcrect.x * info.src_fmt->BytesPerPixel;
+            info.src_w = rect.w;
+            info.src_h = rect.h;
+            info.src_pitch = src->pitch;
+            info.src_skip = info.src_pitch - info.src_w * info.src_fmt->BytesPerPixel;
+            info.dst = (Uint8 *) dst->pixels + rect.y * dst->pitch +
+                rect.x * info.dst_fmt->BytesPerPixel;
+            info.dst_w = rect.w;
+            info.dst_h = rect.h;
+            info.dst_pitch = dst->pitch;
+            info.dst_skip = info.dst_pitch - info.dst_w * info.dst_fmt->BytesPerPixel;
+            ((SDL_BlitFunc) src->map->data) (&info);
+        }
+        break;
+    }
+}
+
+static int SDLCALL
+SW_WorkerThread(void *_worker)
+{
+    SW_Worker *worker = (SW_Worker *) _worker;
+    SW_RenderData *data = (SW_RenderData *) worker->renderdata;
+
+    SDL_LockMutex(data->lock);
+    for ( ; ; ) {
+        int i, first, last;
+
+        while (!data->quit && worker->next_op == data->num_ops) {
+            ++data->num_idle;
+            SDL_CondWait(data->work_cond, data->lock);
+            --data->num_idle;
+        }
+        if (data->quit) {
+            break;
+        }
+
+        /* Operations below num_ops are never modified while queued, so
+           they can be run without holding the lock.
+         */
+        first = worker->next_op;
+        last = data->num_ops;
+        SDL_UnlockMutex(data->lock);
+        for (i = first; i < last; ++i) {
+            SW_RunOp(data, worker, &data->ops[i]);
+        }
+        SDL_LockMutex(data->lock);
+
+        worker->next_op = last;
+        SDL_CondSignal(data->done_cond);
+    }
+    SDL_UnlockMutex(data->lock);
+
+    return 0;
+}
+
+/* Wait until the worker threads have finished all queued operations.
+   This must be called before anything that the queued operations depend on
+   is changed, or before the target pixels are accessed directly.
+ */
+static void
+SW_WaitForWorkers(SW_RenderData *data)
+{
+    int i;
+
+    if (!data->num_workers) {
+        return;
+    }
+
+    SDL_LockMutex(data->lock);
+    for (i = 0; i < data->num_workers; ++i) {
+        while (data->workers[i].next_op < data->num_ops) {
+            SDL_CondWait(data->done_cond, data->lock);
+        }
+    }
+    for (i = 0; i < data->num_workers; ++i) {
+        data->workers[i].next_op = 0;
+    }
+    data->num_ops = 0;
+    SDL_UnlockMutex(data->lock);
+}
+
+static void
+SW_QueueOp(SW_RenderData *data, const SW_RenderOp *op)
+{
+    if (data->num_ops == SW_MAX_QUEUED_OPS) {
+        SW_WaitForWorkers(data);
+    }
+
+    SDL_LockMutex(data->lock);
+    data->ops[data->num_ops++] = *op;
+    if (data->num_idle) {
+        SDL_CondBroadcast(data->work_cond);
+    }
+    SDL_UnlockMutex(data->lock);
+}
+
+static void
+SW_QuitWorkers(SW_RenderData *data)
+{
+    int i;
+
+    if (data->num_workers) {
+        SW_WaitForWorkers(data);
+
+        SDL_LockMutex(data->lock);
+        data->quit = SDL_TRUE;
+        SDL_CondBroadcast(data->work_cond);
+        SDL_UnlockMutex(data->lock);
+
+        for (i = 0; i < data->num_workers; ++i) {
+            SDL_WaitThread(data->workers[i].thread, NULL);
+        }
+        data->num_workers = 0;
+    }
+    if (data->lock) {
+        SDL_DestroyMutex(data->lock);
+        data->lock = NULL;
+    }
+    if (data->work_cond) {
+        SDL_DestroyCond(data->work_cond);
+        data->work_cond = NULL;
+    }
+    if (data->done_cond) {
+        SDL_DestroyCond(data->done_cond);
+        data->done_cond = NULL;
+    }
+    SDL_free(data->workers);
+    data->workers = NULL;
+    SDL_free(data->ops);
+    data->ops = NULL;
+}
+
+static void
+SW_InitWorkers(SW_RenderData *data)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    int i, count;
+
+    count = hint ? SDL_atoi(hint) : 0;
+    if (count <= 0) {
+        return;
+    }
+    if (count > SW_MAX_WORKERS) {
+        count = SW_MAX_WORKERS;
+    }
+
+    data->workers = (SW_Worker *) SDL_calloc(count, sizeof(*data->workers));
+    data->ops = (SW_RenderOp *) SDL_malloc(SW_MAX_QUEUED_OPS * sizeof(*data->ops));
+    data->lock = SDL_CreateMutex();
+    data->work_cond = SDL_CreateCond();
+    data->done_cond = SDL_CreateCond();
+    if (!data->workers || !data->ops ||
+        !data->lock || !data->work_cond || !data->done_cond) {
+        /* Fall back to rendering on the calling thread */
+        SW_QuitWorkers(data);
+        return;
+    }
+
+    for (i = 0; i < count; ++i) {
+        SW_Worker *worker = &data->workers[data->num_workers];
+        char name[32];
+
+        worker->band = i;
+        worker->renderdata = data;
+        SDL_snprintf(name, sizeof(name), "SDLRenderSW%d", i);
+        worker->thread = SDL_CreateThread(SW_WorkerThread, name, worker);
+        if (!worker->thread) {
+            break;
+        }
+        ++data->num_workers;
+    }
+
+    if (data->num_workers == 0) {
+        SW_QuitWorkers(data);
+    } else {
+        /* Fewer threads than requested started, so spread the bands over them */
+        for (i = 0; i < data->num_workers; ++i) {
+            data->workers[i].band = i;
+        }
+    }
+}
+
+
 static SDL_Surface *
 SW_ActivateRenderer(SDL_Renderer * renderer)
 {
@@ -147,6 +421,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     }
     data->surface = surface;
     data->window = surface;
+    SW_InitWorkers(data);
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -165,6 +440,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     renderer->RenderDrawLines = SW_RenderDrawLines;
     renderer->RenderFillRects = SW_RenderFillRects;
     renderer->RenderCopy = SW_RenderCopy;
+    renderer->RenderCopies = SW_RenderCopies;
     renderer->RenderCopyEx = SW_RenderCopyEx;
     renderer->RenderReadPixels = SW_RenderReadPixels;
     renderer->RenderPresent = SW_RenderPresent;
@@ -196,6 +472,7 @@ SW_WindowEvent(SDL_Renderer * renderer, const SDL_WindowEvent *event)
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
     if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+        SW_WaitForWorkers(data);
         data->surface = NULL;
         data->window = NULL;
     }
@@ -223,6 +500,7 @@ SW_GetOutputSize(SDL_Renderer * renderer, int *w, int *h)
 static int
 SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     int bpp;
     Uint32 Rmask, Gmask, Bmask, Amask;
 
@@ -239,7 +517,8 @@ SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
     SDL_SetSurfaceAlphaMod(texture->driverdata, texture->a);
     SDL_SetSurfaceBlendMode(texture->driverdata, texture->blendMode);
 
-    if (texture->access == SDL_TEXTUREACCESS_STATIC) {
+    /* RLE surfaces can't be split between the worker threads */
+    if (texture->access == SDL_TEXTUREACCESS_STATIC && !data->num_workers) {
         SDL_SetSurfaceRLE(texture->driverdata, 1);
     }
 
@@ -253,6 +532,9 @@ static int
 SW_SetTextureColorMod(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
+
     /* If the color mod is ever enabled (non-white), permanently disable RLE (which doesn't support
      * color mod) to avoid potentially frequent RLE encoding/decoding.
      */
@@ -267,6 +549,9 @@ static int
 SW_SetTextureAlphaMod(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
+
     /* If the texture ever has multiple alpha values (surface alpha plus alpha channel), permanently
      * disable RLE (which doesn't support this) to avoid potentially frequent RLE encoding/decoding.
      */
@@ -280,6 +565,9 @@ static int
 SW_SetTextureBlendMode(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
+
     /* If add or mod blending are ever enabled, permanently disable RLE (which doesn't support
      * them) to avoid potentially frequent RLE encoding/decoding.
      */
@@ -298,6 +586,8 @@ SW_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
     int row;
     size_t length;
 
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
+
     if(SDL_MUSTLOCK(surface))
         SDL_LockSurface(surface);
     src = (Uint8 *) pixels;
@@ -321,6 +611,8 @@ SW_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
 
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
+
     *pixels =
         (void *) ((Uint8 *) surface->pixels + rect->y * surface->pitch +
                   rect->x * surface->format->BytesPerPixel);
@@ -338,6 +630,8 @@ SW_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    SW_WaitForWorkers(data);
+
     if (texture ) {
         data->surface = (SDL_Surface *) texture->driverdata;
     } else {
@@ -357,6 +651,7 @@ SW_UpdateViewport(SDL_Renderer * renderer)
         return 0;
     }
 
+    SW_WaitForWorkers(data);
     SDL_SetClipRect(data->surface, &renderer->viewport);
     return 0;
 }
@@ -367,6 +662,7 @@ SW_UpdateClipRect(SDL_Renderer * renderer)
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = data->surface;
     if (surface) {
+        SW_WaitForWorkers(data);
         if (renderer->clipping_enabled) {
             SDL_SetClipRect(surface, &renderer->clip_rect);
         } else {
@@ -379,6 +675,7 @@ SW_UpdateClipRect(SDL_Renderer * renderer)
 static int
 SW_RenderClear(SDL_Renderer * renderer)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     Uint32 color;
     SDL_Rect clip_rect;
@@ -390,6 +687,22 @@ SW_RenderClear(SDL_Renderer * renderer)
     color = SDL_MapRGBA(surface->format,
                         renderer->r, renderer->g, renderer->b, renderer->a);
 
+    if (data->num_workers) {
+        SW_RenderOp op;
+
+        SDL_zero(op);
+        op.type = SW_OP_CLEAR;
+        op.surface = surface;
+        op.clip_rect.x = 0;
+        op.clip_rect.y = 0;
+        op.clip_rect.w = surface->w;
+        op.clip_rect.h = surface->h;
+        op.dstrect = op.clip_rect;
+        op.color = color;
+        SW_QueueOp(data, &op);
+        return 0;
+    }
+
     /* By definition the clear ignores the clip rect */
     clip_rect = surface->clip_rect;
     SDL_SetClipRect(surface, NULL);
@@ -410,6 +723,8 @@ SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
         return -1;
     }
 
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
+
     final_points = SDL_stack_alloc(SDL_Point, count);
     if (!final_points) {
         return SDL_OutOfMemory();
@@ -459,6 +774,8 @@ SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
         return -1;
     }
 
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
+
     final_points = SDL_stack_alloc(SDL_Point, count);
     if (!final_points) {
         return SDL_OutOfMemory();
@@ -499,6 +816,7 @@ SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
 static int
 SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SDL_Rect *final_rects;
     int i, status;
@@ -530,7 +848,31 @@ SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
         }
     }
 
-    if (renderer->blendMode == SDL_BLENDMODE_NONE) {
+    if (data->num_workers) {
+        SW_RenderOp op;
+
+        SDL_zero(op);
+        op.surface = surface;
+        op.clip_rect = surface->clip_rect;
+        if (renderer->blendMode == SDL_BLENDMODE_NONE) {
+            op.type = SW_OP_FILL;
+            op.color = SDL_MapRGBA(surface->format,
+                                   renderer->r, renderer->g, renderer->b,
+                                   renderer->a);
+        } else {
+            op.type = SW_OP_BLENDFILL;
+            op.blendMode = renderer->blendMode;
+            op.r = renderer->r;
+            op.g = renderer->g;
+            op.b = renderer->b;
+            op.a = renderer->a;
+        }
+        for (i = 0; i < count; ++i) {
+            op.dstrect = final_rects[i];
+            SW_QueueOp(data, &op);
+        }
+        status = 0;
+    } else if (renderer->blendMode == SDL_BLENDMODE_NONE) {
         Uint32 color = SDL_MapRGBA(surface->format,
                                    renderer->r, renderer->g, renderer->b,
                                    renderer->a);
@@ -547,17 +889,87 @@ SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
 }
 
 static int
-SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
-              const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+SW_QueueCopy(SW_RenderData *data, SDL_Surface * surface, SDL_Surface * src,
+             const SDL_Rect * srcrect, const SDL_Rect * dstrect)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
-    SDL_Rect final_rect;
+    SW_RenderOp op;
+    const SDL_Rect *clip = &surface->clip_rect;
+    int dx, dy;
+
+    SDL_zero(op);
+    op.type = SW_OP_COPY;
+    op.surface = surface;
+    op.src = src;
+    op.srcrect = *srcrect;
+    op.dstrect = *dstrect;
+
+    /* Clip the rectangles the same way SDL_UpperBlit() does */
+    if (op.srcrect.x < 0) {
+        op.srcrect.w += op.srcrect.x;
+        op.dstrect.x -= op.srcrect.x;
+        op.srcrect.x = 0;
+    }
+    op.srcrect.w = SDL_min(op.srcrect.w, src->w - op.srcrect.x);
+    if (op.srcrect.y < 0) {
+        op.srcrect.h += op.srcrect.y;
+        op.dstrect.y -= op.srcrect.y;
+        op.srcrect.y = 0;
+    }
+    op.srcrect.h = SDL_min(op.srcrect.h, src->h - op.srcrect.y);
 
-    if (!surface) {
-        return -1;
+    dx = clip->x - op.dstrect.x;
+    if (dx > 0) {
+        op.srcrect.w -= dx;
+        op.dstrect.x += dx;
+        op.srcrect.x += dx;
+    }
+    dx = op.dstrect.x + op.srcrect.w - clip->x - clip->w;
+    if (dx > 0) {
+        op.srcrect.w -= dx;
+    }
+    dy = clip->y - op.dstrect.y;
+    if (dy > 0) {
+        op.srcrect.h -= dy;
+        op.dstrect.y += dy;
+        op.srcrect.y += dy;
+    }
+    dy = op.dstrect.y + op.srcrect.h - clip->y - clip->h;
+    if (dy > 0) {
+        op.srcrect.h -= dy;
+    }
+    if (op.srcrect.w <= 0 || op.srcrect.h <= 0) {
+        return 0;
+    }
+    op.dstrect.w = op.srcrect.w;
+    op.dstrect.h = op.srcrect.h;
+
+    /* The workers read the blit mapping, so only change it once they're idle */
+    if (src->map->dst != surface || (src->map->info.flags & SDL_COPY_NEAREST)) {
+        SW_WaitForWorkers(data);
+        if (src->map->info.flags & SDL_COPY_NEAREST) {
+            src->map->info.flags &= ~SDL_COPY_NEAREST;
+            SDL_InvalidateMap(src->map);
+        }
+        if (SDL_MapSurface(src, surface) < 0) {
+            return -1;
+        }
+    }
+    if (src->flags & SDL_RLEACCEL) {
+        SW_WaitForWorkers(data);
+        return SDL_LowerBlit(src, &op.srcrect, surface, &op.dstrect);
     }
 
+    SW_QueueOp(data, &op);
+    return 0;
+}
+
+static int
+SW_CopyToSurface(SDL_Renderer * renderer, SDL_Surface * surface, SDL_Surface * src,
+                 const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Rect final_rect;
+
     if (renderer->viewport.x || renderer->viewport.y) {
         final_rect.x = (int)(renderer->viewport.x + dstrect->x);
         final_rect.y = (int)(renderer->viewport.y + dstrect->y);
@@ -569,8 +981,14 @@ SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     final_rect.h = (int)dstrect->h;
 
     if ( srcrect->w == final_rect.w && srcrect->h == final_rect.h ) {
+        if (data->num_workers &&
+            !src->format->palette && !surface->format->palette) {
+            return SW_QueueCopy(data, surface, src, srcrect, &final_rect);
+        }
+        SW_WaitForWorkers(data);
         return SDL_BlitSurface(src, srcrect, surface, &final_rect);
     } else {
+        SW_WaitForWorkers(data);
         /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
          * to avoid potentially frequent RLE encoding/decoding.
          */
@@ -579,6 +997,40 @@ SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     }
 }
 
+static int
+SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
+              const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+{
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+
+    if (!surface) {
+        return -1;
+    }
+    return SW_CopyToSurface(renderer, surface, src, srcrect, dstrect);
+}
+
+static int
+SW_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                const SDL_Rect * srcrects, const SDL_FRect * dstrects,
+                int count)
+{
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+    int i, status = 0;
+
+    if (!surface) {
+        return -1;
+    }
+
+    for (i = 0; i < count; ++i) {
+        if (SW_CopyToSurface(renderer, surface, src, &srcrects[i], &dstrects[i]) < 0) {
+            status = -1;
+        }
+    }
+    return status;
+}
+
 static int
 GetScaleQuality(void)
 {
@@ -607,6 +1059,8 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
         return -1;
     }
 
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
+
     if (renderer->viewport.x || renderer->viewport.y) {
         final_rect.x = (int)(renderer->viewport.x + dstrect->x);
         final_rect.y = (int)(renderer->viewport.y + dstrect->y);
@@ -739,6 +1193,8 @@ SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
         return -1;
     }
 
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
+
     if (renderer->viewport.x || renderer->viewport.y) {
         final_rect.x = renderer->viewport.x + rect->x;
         final_rect.y = renderer->viewport.y + rect->y;
@@ -767,6 +1223,8 @@ SW_RenderPresent(SDL_Renderer * renderer)
 {
     SDL_Window *window = renderer->window;
 
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
+
     if (window) {
         SDL_UpdateWindowSurface(window);
     }
@@ -777,6 +1235,7 @@ SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
 
+    SW_WaitForWorkers((SW_RenderData *) renderer->driverdata);
     SDL_FreeSurface(surface);
 }
 
@@ -785,6 +1244,9 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    if (data) {
+        SW_QuitWorkers(data);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -28,29 +28,64 @@
 /* This file contains portable memory management functions for SDL */
 
 #include "SDL_stdinc.h"
+#include "SDL_atomic.h"
+#include "SDL_error.h"
+#include "SDL_log.h"
+
+/* Without atomics SDL's spinlocks are mutexes created on first use, with
+   SDL_malloc(), so the counters would have no lock.  Don't track then. */
+#if defined(SDL_MEMORY_TRACKING) && SDL_ATOMIC_DISABLED
+#undef SDL_MEMORY_TRACKING
+#endif
+
+/* With memory tracking, the allocators below are wrapped by the tracking
+   functions at the end of this file. */
+#ifdef SDL_MEMORY_TRACKING
+#define real_malloc     SDL_malloc_untracked
+#define real_calloc     SDL_calloc_untracked
+#define real_realloc    SDL_realloc_untracked
+#define real_free       SDL_free_untracked
+extern void *real_malloc(size_t size);
+extern void *real_calloc(size_t nmemb, size_t size);
+extern void *real_realloc(void *ptr, size_t size);
+extern void real_free(void *ptr);
+#else
+#define real_malloc     SDL_malloc
+#define real_calloc     SDL_calloc
+#define real_realloc    SDL_realloc
+#define real_free       SDL_free
+#endif /* SDL_MEMORY_TRACKING */
 
 #if defined(HAVE_MALLOC)
 
-void *SDL_malloc(size_t size)
+void *real_malloc(size_t size)
 {
     return malloc(size);
 }
 
-void *SDL_calloc(size_t nmemb, size_t size)
+void *real_calloc(size_t nmemb, size_t size)
 {
     return calloc(nmemb, size);
 }
 
-void *SDL_realloc(void *ptr, size_t size)
+void *real_realloc(void *ptr, size_t size)
 {
     return realloc(ptr, size);
 }
 
-void SDL_free(void *ptr)
+void real_free(void *ptr)
 {
     free(ptr);
 }
 
+void SDL_GetMallocCacheStats(SDL_MallocCacheStats *stats)
+{
+    /* The C runtime keeps its own caches, if any */
+    if (stats) {
+        SDL_zerop(stats);
+    }
+}
+
 #else  /* the rest of this is a LOT of tapdancing to implement malloc. :) */
 
 #define LACKS_SYS_TYPES_H
@@ -60,6 +95,9 @@ void SDL_free(void *ptr)
 #define LACKS_STDLIB_H
 #define ABORT
 #define USE_LOCKS 1
+#ifndef USE_THREAD_CACHE
+#define USE_THREAD_CACHE USE_LOCKS
+#endif
 
 /*
   This is a version (aka dlmalloc) of malloc/free/realloc written by
@@ -638,10 +676,18 @@ DEFAULT_MMAP_THRESHOLD       default: 256K
 
 #define memset  SDL_memset
 #define memcpy  SDL_memcpy
-#define malloc  SDL_malloc
-#define calloc  SDL_calloc
-#define realloc SDL_realloc
-#define free    SDL_free
+#if USE_THREAD_CACHE
+/* SDL_malloc() and friends go through the per-thread caches, see below */
+#define malloc  SDL_dlmalloc
+#define calloc  SDL_dlcalloc
+#define realloc SDL_dlrealloc
+#define free    SDL_dlfree
+#else
+#define malloc  real_malloc
+#define calloc  real_calloc
+#define realloc real_realloc
+#define free    real_free
+#endif /* USE_THREAD_CACHE */
 
 /*
   mallopt tuning options.  SVID/XPG defines four standard parameter
@@ -4532,6 +4578,380 @@ dlmallopt(int param_number, int value)
     return change_mparam(param_number, value);
 }
 
+/* ------------------------- per-thread caches --------------------------- */
+
+/*
+  Small blocks are cached per thread in front of the heap, so most calls
+  to SDL_malloc() and SDL_free() don't take the heap's lock at all.  The
+  blocks in a cache are still in use as far as the heap is concerned,
+  there is one bin of them for each chunk size up to CACHE_MAX_CHUNK.
+
+  A bin that runs out takes a batch of blocks from the heap at once, cut
+  out of one chunk the way ialloc() does it.  A bin that fills up gives
+  half of its blocks back to the heap.  A block freed by another thread
+  than the one that allocated it simply goes into the freeing thread's
+  cache, and a thread's cache is given back to the heap when the thread
+  exits.
+
+  The counters of each cache are only touched by its own thread, and are
+  added to the totals reported by SDL_GetMallocCacheStats() every so
+  often, and when the thread exits.
+*/
+
+#if USE_THREAD_CACHE
+
+#define CACHE_MAX_CHUNK     ((size_t)1024U)     /* largest chunk cached */
+#define CACHE_MAX_REQUEST   (CACHE_MAX_CHUNK - CHUNK_OVERHEAD)
+#define CACHE_BINS          (CACHE_MAX_CHUNK / MALLOC_ALIGNMENT + 1)
+#define CACHE_BIN_BYTES     ((size_t)16U * (size_t)1024U)
+#define CACHE_BIN_BLOCKS    32
+#define CACHE_PUBLISH       256 /* calls between updates of the totals */
+
+typedef struct tcache_s
+{
+    void *bins[CACHE_BINS];     /* blocks linked through their first word */
+    int counts[CACHE_BINS];
+    size_t bytes;               /* bytes in the bins */
+    size_t published_bytes;
+    Uint64 hits;
+    Uint64 misses;
+    Uint64 released;
+    int calls;
+} tcache;
+
+static SDL_MallocCacheStats cache_totals;
+
+#ifndef WIN32
+static MLOCK_T cache_totals_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t cache_key;
+static pthread_once_t cache_key_once = PTHREAD_ONCE_INIT;
+static int cache_key_ok = 0;
+#else /* WIN32 */
+/* Fiber local storage is the only way to hear about a thread exiting,
+   it isn't there before Windows Vista and then nothing is cached. */
+typedef VOID(WINAPI * cache_exit_t) (PVOID);
+typedef DWORD(WINAPI * FlsAlloc_t) (cache_exit_t);
+typedef PVOID(WINAPI * FlsGetValue_t) (DWORD);
+typedef BOOL(WINAPI * FlsSetValue_t) (DWORD, PVOID);
+static MLOCK_T cache_totals_mutex;
+static FlsGetValue_t pFlsGetValue;
+static FlsSetValue_t pFlsSetValue;
+static DWORD cache_key;
+static volatile int cache_key_ok = -1;
+#endif /* WIN32 */
+
+/* The most blocks a bin can hold */
+static int
+cache_bin_limit(size_t size)
+{
+    size_t blocks = CACHE_BIN_BYTES / size;
+    return (blocks < CACHE_BIN_BLOCKS) ? (int) blocks : CACHE_BIN_BLOCKS;
+}
+
+static void
+cache_publish(tcache * cache, int thread_change)
+{
+    ACQUIRE_LOCK(&cache_totals_mutex);
+    cache_totals.hits += cache->hits;
+    cache_totals.misses += cache->misses;
+    cache_totals.released += cache->released;
+    cache_totals.cached += cache->bytes;
+    cache_totals.cached -= cache->published_bytes;
+    cache_totals.threads += thread_change;
+    RELEASE_LOCK(&cache_totals_mutex);
+
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->released = 0;
+    cache->published_bytes = cache->bytes;
+    cache->calls = 0;
+}
+
+/* Give blocks of a bin back to the heap until 'keep' are left */
+static void
+cache_release(tcache * cache, size_t idx, int keep)
+{
+    while (cache->counts[idx] > keep) {
+        void *mem = cache->bins[idx];
+        cache->bins[idx] = *(void **) mem;
+        --cache->counts[idx];
+        cache->bytes -= chunksize(mem2chunk(mem));
+        ++cache->released;
+        dlfree(mem);
+    }
+}
+
+static void
+cache_destroy(void *data)
+{
+    tcache *cache = (tcache *) data;
+    size_t idx;
+
+    for (idx = 0; idx < CACHE_BINS; ++idx) {
+        cache_release(cache, idx, 0);
+    }
+    cache_publish(cache, -1);
+    dlfree(cache);
+}
+
+static tcache *
+cache_create(void)
+{
+    tcache *cache = (tcache *) dlcalloc(1, sizeof(tcache));
+    if (cache != 0) {
+        cache_publish(cache, 1);
+    }
+    return cache;
+}
+
+#ifndef WIN32
+static void
+cache_init_key(void)
+{
+    cache_key_ok = (pthread_key_create(&cache_key, cache_destroy) == 0);
+}
+
+static tcache *
+cache_get(void)
+{
+    tcache *cache;
+
+    pthread_once(&cache_key_once, cache_init_key);
+    if (!cache_key_ok) {
+        return 0;
+    }
+    cache = (tcache *) pthread_getspecific(cache_key);
+    if (cache == 0) {
+        cache = cache_create();
+        if (cache != 0 && pthread_setspecific(cache_key, cache) != 0) {
+            cache_destroy(cache);
+            cache = 0;
+        }
+    }
+    return cache;
+}
+#else /* WIN32 */
+static VOID WINAPI
+cache_exit(PVOID data)
+{
+    if (data != 0) {
+        cache_destroy(data);
+    }
+}
+
+static void
+cache_init_key(void)
+{
+    HMODULE kernel32 = GetModuleHandleA("kernel32.dll");
+    FlsAlloc_t pFlsAlloc = 0;
+    int ok = 0;
+
+    if (kernel32) {
+        pFlsAlloc = (FlsAlloc_t) GetProcAddress(kernel32, "FlsAlloc");
+        pFlsGetValue = (FlsGetValue_t) GetProcAddress(kernel32, "FlsGetValue");
+        pFlsSetValue = (FlsSetValue_t) GetProcAddress(kernel32, "FlsSetValue");
+    }
+    if (pFlsAlloc && pFlsGetValue && pFlsSetValue) {
+        cache_key = pFlsAlloc(cache_exit);
+        ok = (cache_key != FLS_OUT_OF_INDEXES);
+    }
+    cache_key_ok = ok;
+}
+
+static tcache *
+cache_get(void)
+{
+    tcache *cache;
+
+    if (cache_key_ok < 0) {
+        ACQUIRE_MAGIC_INIT_LOCK();
+        if (cache_key_ok < 0) {
+            cache_init_key();
+        }
+        RELEASE_MAGIC_INIT_LOCK();
+    }
+    if (!cache_key_ok) {
+        return 0;
+    }
+    cache = (tcache *) pFlsGetValue(cache_key);
+    if (cache == 0) {
+        cache = cache_create();
+        if (cache != 0 && !pFlsSetValue(cache_key, cache)) {
+            cache_destroy(cache);
+            cache = 0;
+        }
+    }
+    return cache;
+}
+#endif /* WIN32 */
+
+/* Fill an empty bin with chunks of 'size' bytes, returns one more chunk */
+static void *
+cache_refill(tcache * cache, size_t idx, size_t size)
+{
+    int count = cache_bin_limit(size) / 2;
+    void *mem = dlmalloc(count * size - CHUNK_OVERHEAD);
+    mchunkptr p;
+    size_t remainder_size;
+
+    if (mem == 0) {
+        return dlmalloc(size - CHUNK_OVERHEAD);
+    }
+    p = mem2chunk(mem);
+    if (is_mmapped(p) || PREACTION(gm)) {
+        return mem;
+    }
+
+    /*
+       The first chunk is handed out and keeps its pinuse bit, which may
+       have changed since it was allocated.  The last one absorbs any
+       overallocation slop.
+     */
+    remainder_size = chunksize(p) - size;
+    set_inuse(gm, p, size);
+    while (--count > 0) {
+        size_t next_size = (count > 1) ? size : remainder_size;
+        void *next;
+
+        p = chunk_plus_offset(p, size);
+        set_size_and_pinuse_of_inuse_chunk(gm, p, next_size);
+        remainder_size -= next_size;
+
+        next = chunk2mem(p);
+        *(void **) next = cache->bins[idx];
+        cache->bins[idx] = next;
+        ++cache->counts[idx];
+        cache->bytes += next_size;
+    }
+    POSTACTION(gm);
+    return mem;
+}
+
+/* Take a block for a chunk of 'size' bytes */
+static void *
+cache_malloc(tcache * cache, size_t size)
+{
+    size_t idx = size / MALLOC_ALIGNMENT;
+    void *mem = cache->bins[idx];
+
+    if (mem != 0) {
+        cache->bins[idx] = *(void **) mem;
+        --cache->counts[idx];
+        cache->bytes -= chunksize(mem2chunk(mem));
+        ++cache->hits;
+    } else {
+        mem = cache_refill(cache, idx, size);
+        ++cache->misses;
+    }
+    if (++cache->calls >= CACHE_PUBLISH) {
+        cache_publish(cache, 0);
+    }
+    return mem;
+}
+
+/* Keep a freed block, returns 0 if it should go to the heap instead */
+static int
+cache_free(tcache * cache, void *mem)
+{
+    mchunkptr p = mem2chunk(mem);
+    size_t size = chunksize(p);
+    size_t idx = size / MALLOC_ALIGNMENT;
+    int limit;
+
+    /* Chunks this small never come from mmap() */
+    if (size > CACHE_MAX_CHUNK) {
+        return 0;
+    }
+    *(void **) mem = cache->bins[idx];
+    cache->bins[idx] = mem;
+    cache->bytes += size;
+
+    limit = cache_bin_limit(size);
+    if (++cache->counts[idx] > limit) {
+        cache_release(cache, idx, limit / 2);
+    }
+    if (++cache->calls >= CACHE_PUBLISH) {
+        cache_publish(cache, 0);
+    }
+    return 1;
+}
+
+void *
+real_malloc(size_t bytes)
+{
+    if (bytes <= CACHE_MAX_REQUEST) {
+        tcache *cache = cache_get();
+        if (cache != 0) {
+            return cache_malloc(cache, request2size(bytes));
+        }
+    }
+    return dlmalloc(bytes);
+}
+
+void *
+real_calloc(size_t n_elements, size_t elem_size)
+{
+    size_t req = 0;
+    void *mem;
+
+    if (n_elements != 0) {
+        req = n_elements * elem_size;
+        if (((n_elements | elem_size) & ~(size_t) 0xffff) &&
+            (req / n_elements != elem_size))
+            req = MAX_SIZE_T;   /* force downstream failure on overflow */
+    }
+    if (req > CACHE_MAX_REQUEST) {
+        return dlcalloc(n_elements, elem_size);
+    }
+    mem = real_malloc(req);
+    if (mem != 0) {
+        memset(mem, 0, req);
+    }
+    return mem;
+}
+
+void *
+real_realloc(void *ptr, size_t size)
+{
+    if (ptr == 0) {
+        return real_malloc(size);
+    }
+    return dlrealloc(ptr, size);
+}
+
+void
+real_free(void *ptr)
+{
+    if (ptr != 0) {
+        tcache *cache = cache_get();
+        if (cache == 0 || !cache_free(cache, ptr)) {
+            dlfree(ptr);
+        }
+    }
+}
+
+void
+SDL_GetMallocCacheStats(SDL_MallocCacheStats * stats)
+{
+    if (stats) {
+        ACQUIRE_LOCK(&cache_totals_mutex);
+        *stats = cache_totals;
+        RELEASE_LOCK(&cache_totals_mutex);
+    }
+}
+
+#else /* USE_THREAD_CACHE */
+
+void
+SDL_GetMallocCacheStats(SDL_MallocCacheStats * stats)
+{
+    if (stats) {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+#endif /* USE_THREAD_CACHE */
+
 #endif /* !ONLY_MSPACES */
 
 /* ----------------------------- user mspaces ---------------------------- */
@@ -5261,4 +5681,321 @@ History:
 
 #endif /* !HAVE_MALLOC */
 
+/* --------------------------- memory tracking --------------------------- */
+
+static const char *memory_tag_names[SDL_NUM_MEMTAGS] = {
+    "other", "surface", "audio", "event", "rwops",
+    "image", "font", "mixer", "application"
+};
+
+const char *
+SDL_GetMemoryTagName(int tag)
+{
+    if (tag < 0 || tag >= SDL_NUM_MEMTAGS) {
+        return NULL;
+    }
+    return memory_tag_names[tag];
+}
+
+#ifdef SDL_MEMORY_TRACKING
+
+/*
+  Every block starts with a header holding its size and tag, padded so the
+  memory after it is as aligned as the heap's.  Blocks without the magic
+  number weren't allocated here, such as ones an application got from the
+  C runtime and hands to SDL_free(), and are passed through untracked.
+  The heap reuses a freed block's header for its own lists, or unmaps it,
+  so recently freed blocks are remembered in a table instead.  Freeing one
+  of them again is reported rather than handed to the heap.
+*/
+#define MEMORY_MAGIC    0x5D1A110C
+#define MEMORY_FREED_SLOTS  1024
+
+typedef union
+{
+    struct
+    {
+        size_t size;
+        Uint32 tag;
+        Uint32 magic;
+    } info;
+    double align[2];
+} memory_header;
+
+static SDL_SpinLock memory_lock;
+static SDL_MemoryStats memory_stats[SDL_NUM_MEMTAGS];
+static SDL_MemoryStats memory_total;
+static memory_header *memory_freed[MEMORY_FREED_SLOTS];
+
+/* The slot of the table of recently freed blocks a header goes in */
+#define MEMORY_FREED_SLOT(header) \
+    (((size_t) (header) / sizeof(memory_header)) % MEMORY_FREED_SLOTS)
+
+/* Count bytes freed and allocated under a tag, called with memory_lock held */
+static void
+memory_count(SDL_MemoryStats * stats, size_t freed, size_t allocated, int blocks)
+{
+    stats->live_bytes -= freed;
+    stats->live_bytes += allocated;
+    if (stats->live_bytes > stats->peak_bytes) {
+        stats->peak_bytes = stats->live_bytes;
+    }
+    if (blocks > 0) {
+        ++stats->live_blocks;
+        ++stats->allocations;
+    } else if (blocks < 0) {
+        --stats->live_blocks;
+    }
+}
+
+static void *
+memory_track(memory_header * header, int tag, size_t size)
+{
+    if (header == NULL) {
+        return NULL;
+    }
+    header->info.size = size;
+    header->info.tag = (Uint32) tag;
+    header->info.magic = MEMORY_MAGIC;
+
+    SDL_AtomicLock(&memory_lock);
+    if (memory_freed[MEMORY_FREED_SLOT(header)] == header) {
+        memory_freed[MEMORY_FREED_SLOT(header)] = NULL;
+    }
+    memory_count(&memory_stats[tag], 0, size, 1);
+    memory_count(&memory_total, 0, size, 1);
+    SDL_AtomicUnlock(&memory_lock);
+
+    return header + 1;
+}
+
+static memory_header *
+memory_header_of(void *mem)
+{
+    memory_header *header = (memory_header *) mem - 1;
+    return (header->info.magic == MEMORY_MAGIC) ? header : NULL;
+}
+
+/* Report a block that was freed already, without reading its header */
+static SDL_bool
+memory_was_freed(void *mem)
+{
+    memory_header *header = (memory_header *) mem - 1;
+    SDL_bool freed;
+
+    SDL_AtomicLock(&memory_lock);
+    freed = (memory_freed[MEMORY_FREED_SLOT(header)] == header) ? SDL_TRUE : SDL_FALSE;
+    SDL_AtomicUnlock(&memory_lock);
+
+    if (freed) {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Memory at %p was already freed", mem);
+    }
+    return freed;
+}
+
+static void *
+memory_realloc(int tag, void *mem, size_t size)
+{
+    memory_header *header;
+    size_t old_size;
+    int old_tag;
+
+    if (mem == NULL) {
+        return SDL_TaggedMalloc(tag < 0 ? SDL_MEMTAG_OTHER : tag, size);
+    }
+    if (memory_was_freed(mem)) {
+        return NULL;
+    }
+    header = memory_header_of(mem);
+    if (header == NULL) {
+        return real_realloc(mem, size);
+    }
+    if (size > (size_t) -1 - sizeof(memory_header)) {
+        return NULL;
+    }
+    old_size = header->info.size;
+    old_tag = (int) header->info.tag;
+    if (tag < 0) {
+        tag = old_tag;
+    }
+
+    header = (memory_header *) real_realloc(header, sizeof(memory_header) + size);
+    if (header == NULL) {
+        return NULL;
+    }
+    header->info.size = size;
+    header->info.tag = (Uint32) tag;
+
+    SDL_AtomicLock(&memory_lock);
+    if (memory_freed[MEMORY_FREED_SLOT(header)] == header) {
+        memory_freed[MEMORY_FREED_SLOT(header)] = NULL;
+    }
+    if (tag == old_tag) {
+        memory_count(&memory_stats[tag], old_size, size, 0);
+    } else {
+        memory_count(&memory_stats[old_tag], old_size, 0, -1);
+        memory_count(&memory_stats[tag], 0, size, 1);
+    }
+    memory_count(&memory_total, old_size, size, 0);
+    SDL_AtomicUnlock(&memory_lock);
+
+    return header + 1;
+}
+
+void *
+SDL_TaggedMalloc(int tag, size_t size)
+{
+    if (tag < 0 || tag >= SDL_NUM_MEMTAGS) {
+        tag = SDL_MEMTAG_OTHER;
+    }
+    if (size > (size_t) -1 - sizeof(memory_header)) {
+        return NULL;
+    }
+    return memory_track((memory_header *) real_malloc(sizeof(memory_header) + size), tag, size);
+}
+
+void *
+SDL_TaggedCalloc(int tag, size_t nmemb, size_t size)
+{
+    if (tag < 0 || tag >= SDL_NUM_MEMTAGS) {
+        tag = SDL_MEMTAG_OTHER;
+    }
+    if (size != 0 && nmemb > ((size_t) -1 - sizeof(memory_header)) / size) {
+        return NULL;
+    }
+    size *= nmemb;
+    return memory_track((memory_header *) real_calloc(1, sizeof(memory_header) + size), tag, size);
+}
+
+void *
+SDL_TaggedRealloc(int tag, void *mem, size_t size)
+{
+    if (tag < 0 || tag >= SDL_NUM_MEMTAGS) {
+        tag = SDL_MEMTAG_OTHER;
+    }
+    return memory_realloc(tag, mem, size);
+}
+
+void *
+SDL_malloc(size_t size)
+{
+    return SDL_TaggedMalloc(SDL_MEMTAG_OTHER, size);
+}
+
+void *
+SDL_calloc(size_t nmemb, size_t size)
+{
+    return SDL_TaggedCalloc(SDL_MEMTAG_OTHER, nmemb, size);
+}
+
+void *
+SDL_realloc(void *mem, size_t size)
+{
+    /* Keep the tag the block has */
+    return memory_realloc(-1, mem, size);
+}
+
+void
+SDL_free(void *mem)
+{
+    memory_header *header;
+    int tag;
+
+    if (mem == NULL) {
+        return;
+    }
+    if (memory_was_freed(mem)) {
+        return;
+    }
+    header = memory_header_of(mem);
+    if (header == NULL) {
+        real_free(mem);
+        return;
+    }
+    tag = (int) header->info.tag;
+
+    SDL_AtomicLock(&memory_lock);
+    memory_count(&memory_stats[tag], header->info.size, 0, -1);
+    memory_count(&memory_total, header->info.size, 0, -1);
+    memory_freed[MEMORY_FREED_SLOT(header)] = header;
+    SDL_AtomicUnlock(&memory_lock);
+
+    real_free(header);
+}
+
+int
+SDL_GetMemoryStats(int tag, SDL_MemoryStats * stats)
+{
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+    if (tag != SDL_MEMTAG_ALL && (tag < 0 || tag >= SDL_NUM_MEMTAGS)) {
+        return SDL_SetError("Unknown memory tag %d", tag);
+    }
+    SDL_AtomicLock(&memory_lock);
+    *stats = (tag == SDL_MEMTAG_ALL) ? memory_total : memory_stats[tag];
+    SDL_AtomicUnlock(&memory_lock);
+    return 0;
+}
+
+void
+SDL_DumpMemoryStats(void)
+{
+    SDL_MemoryStats stats[SDL_NUM_MEMTAGS], total;
+    int i;
+
+    /* SDL_Log() allocates, so copy the counters first */
+    SDL_AtomicLock(&memory_lock);
+    SDL_memcpy(stats, memory_stats, sizeof(stats));
+    total = memory_total;
+    SDL_AtomicUnlock(&memory_lock);
+
+    SDL_Log("%-12s %14s %14s %10s %12s\n", "Memory", "live bytes", "peak bytes", "blocks", "allocations");
+    for (i = 0; i < SDL_NUM_MEMTAGS; ++i) {
+        SDL_Log("%-12s %14" SDL_PRIu64 " %14" SDL_PRIu64 " %10" SDL_PRIu64 " %12" SDL_PRIu64 "\n",
+                memory_tag_names[i], stats[i].live_bytes, stats[i].peak_bytes,
+                stats[i].live_blocks, stats[i].allocations);
+    }
+    SDL_Log("%-12s %14" SDL_PRIu64 " %14" SDL_PRIu64 " %10" SDL_PRIu64 " %12" SDL_PRIu64 "\n",
+            "total", total.live_bytes, total.peak_bytes,
+            total.live_blocks, total.allocations);
+}
+
+#else /* SDL_MEMORY_TRACKING */
+
+void *
+SDL_TaggedMalloc(int tag, size_t size)
+{
+    return SDL_malloc(size);
+}
+
+void *
+SDL_TaggedCalloc(int tag, size_t nmemb, size_t size)
+{
+    return SDL_calloc(nmemb, size);
+}
+
+void *
+SDL_TaggedRealloc(int tag, void *mem, size_t size)
+{
+    return SDL_realloc(mem, size);
+}
+
+int
+SDL_GetMemoryStats(int tag, SDL_MemoryStats * stats)
+{
+    if (stats) {
+        SDL_zerop(stats);
+    }
+    return SDL_Unsupported();
+}
+
+void
+SDL_DumpMemoryStats(void)
+{
+    SDL_Log("SDL was built without memory tracking\n");
+}
+
+#endif /* SDL_MEMORY_TRACKING */
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -1,46 +1,23 @@
-/* qsort.c
- * (c) 1998 Gareth McCaughan
- *
- * This is a drop-in replacement for the C library's |qsort()| routine.
- *
- * Features:
- *   - Median-of-three pivoting (and more)
- *   - Truncation and final polishing by a single insertion sort
- *   - Early truncation when no swaps needed in pivoting step
- *   - Explicit recursion, guaranteed not to overflow
- *   - A few little wrinkles stolen from the GNU |qsort()|.
- *   - separate code for non-aligned / aligned / word-size objects
- *
- * This code may be reproduced freely provided
- *   - this file is retained unaltered apart from minor
- *     changes for portability and efficiency
- *   - no changes are made to this comment
- *   - any changes that *are* made are clearly flagged
- *   - the _ID string below is altered by inserting, after
- *     the date, the string " altered" followed at your option
- *     by other material. (Exceptions: you may change the name
- *     of the exported routine without changing the ID string.
- *     You may change the values of the macros TRUNC_* and
- *     PIVOT_THRESHOLD without changing the ID string, provided
- *     they remain constants with TRUNC_nonaligned, TRUNC_aligned
- *     and TRUNC_words/WORD_BYTES between 8 and 24, and
- *     PIVOT_THRESHOLD between 32 and 200.)
- *
- * You may use it in anything you like; you may make money
- * out of it; you may distribute it in object form or as
- * part of an executable without including source code;
- * you don't have to credit me. (But it would be nice if
- * you did.)
- *
- * If you find problems with this code, or find ways of
- * making it significantly faster, please let me know!
- * My e-mail address, valid as of early 1998 and certainly
- * OK for at least the next 18 months, is
- *    gjm11@dpmms.cam.ac.uk
- * Thanks!
- *
- * Gareth McCaughan   Peterhouse   Cambridge   1998
- */
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
 
 #if defined(__clang_analyzer__) && !defined(SDL_DISABLE_ANALYZE_MACROS)
 #define SDL_DISABLE_ANALYZE_MACROS 1
@@ -48,434 +25,480 @@
 
 #include "../SDL_internal.h"
 
+/* This file contains the sorting functions for SDL */
+
+#include "SDL_stdinc.h"
+#include "SDL_error.h"
+
 /*
-#include <assert.h>
-#include <stdlib.h>
-#include <string.h>
+  SDL_qsort() is an introsort: a quicksort that takes the median of three
+  elements as the pivot, or the median of three such medians for bigger
+  ranges, and leaves ranges of up to QSORT_INSERTION elements to an
+  insertion sort.  A range that is still being partitioned twice as deep
+  as a balanced quicksort would go is heapsorted instead, so no input
+  takes more than O(n log n) comparisons.  When partitioning moves
+  nothing, the halves are likely in order already: each gets an insertion
+  sort that gives up after a few moves, so input that is already sorted
+  takes close to linear time.  Input in strictly descending order is just
+  turned around.
+
+  The sort is written once as inline functions and instantiated for
+  elements of 4 and 8 bytes, for elements made of 8 or 4 byte words and
+  for anything else, so the swaps for the common sizes are a couple of
+  moves.  It needs no memory besides a small stack.
 */
-#include "SDL_stdinc.h"
-#include "SDL_assert.h"
 
-#if defined(HAVE_QSORT)
-void
-SDL_qsort(void *base, size_t nmemb, size_t size, int (*compare) (const void *, const void *))
+#define QSORT_INSERTION 16
+#define QSORT_NINTHER   128
+#define QSORT_PARTIAL   8
+#define QSORT_STACK     (8 * sizeof(size_t))
+
+typedef int (*qsort_compare) (const void *, const void *);
+
+/* 'align' is the size of the words the elements are swapped in */
+SDL_FORCE_INLINE void
+qsort_swap(char *a, char *b, size_t size, size_t align)
 {
-    qsort(base, nmemb, size, compare);
+    if (align == 8) {
+        Uint64 *x = (Uint64 *) a, *y = (Uint64 *) b, t;
+        size_t n = size / 8;
+        do {
+            t = *x;
+            *x++ = *y;
+            *y++ = t;
+        } while (--n);
+    } else if (align == 4) {
+        Uint32 *x = (Uint32 *) a, *y = (Uint32 *) b, t;
+        size_t n = size / 4;
+        do {
+            t = *x;
+            *x++ = *y;
+            *y++ = t;
+        } while (--n);
+    } else {
+        char t;
+        do {
+            t = *a;
+            *a++ = *b;
+            *b++ = t;
+        } while (--size);
+    }
 }
-#else
 
-#ifdef assert
-#undef assert
-#endif
-#define assert(X) SDL_assert(X)
-#ifdef malloc
-#undef malloc
-#endif
-#define malloc	SDL_malloc
-#ifdef free
-#undef free
-#endif
-#define free	SDL_free
-#ifdef memcpy
-#undef memcpy
-#endif
-#define memcpy	SDL_memcpy
-#ifdef memmove
-#undef memmove
-#endif
-#define memmove	SDL_memmove
-#ifdef qsort
-#undef qsort
-#endif
-#define qsort	SDL_qsort
-
-static const char _ID[] = "<qsort.c gjm 1.12 1998-03-19>";
-
-/* How many bytes are there per word? (Must be a power of 2,
- * and must in fact equal sizeof(int).)
- */
-#define WORD_BYTES sizeof(int)
-
-/* How big does our stack need to be? Answer: one entry per
- * bit in a |size_t|.
- */
-#define STACK_SIZE (8*sizeof(size_t))
-
-/* Different situations have slightly different requirements,
- * and we make life epsilon easier by using different truncation
- * points for the three different cases.
- * So far, I have tuned TRUNC_words and guessed that the same
- * value might work well for the other two cases. Of course
- * what works well on my machine might work badly on yours.
- */
-#define TRUNC_nonaligned	12
-#define TRUNC_aligned		12
-#define TRUNC_words		12*WORD_BYTES   /* nb different meaning */
-
-/* We use a simple pivoting algorithm for shortish sub-arrays
- * and a more complicated one for larger ones. The threshold
- * is PIVOT_THRESHOLD.
- */
-#define PIVOT_THRESHOLD 40
-
-typedef struct
+SDL_FORCE_INLINE void
+qsort_insertion(char *lo, char *hi, size_t size, size_t align, qsort_compare compare)
 {
-    char *first;
-    char *last;
-} stack_entry;
-#define pushLeft {stack[stacktop].first=ffirst;stack[stacktop++].last=last;}
-#define pushRight {stack[stacktop].first=first;stack[stacktop++].last=llast;}
-#define doLeft {first=ffirst;llast=last;continue;}
-#define doRight {ffirst=first;last=llast;continue;}
-#define pop {if (--stacktop<0) break;\
-  first=ffirst=stack[stacktop].first;\
-  last=llast=stack[stacktop].last;\
-  continue;}
-
-/* Some comments on the implementation.
- * 1. When we finish partitioning the array into "low"
- *    and "high", we forget entirely about short subarrays,
- *    because they'll be done later by insertion sort.
- *    Doing lots of little insertion sorts might be a win
- *    on large datasets for locality-of-reference reasons,
- *    but it makes the code much nastier and increases
- *    bookkeeping overhead.
- * 2. We always save the shorter and get to work on the
- *    longer. This guarantees that every time we push
- *    an item onto the stack its size is <= 1/2 of that
- *    of its parent; so the stack can't need more than
- *    log_2(max-array-size) entries.
- * 3. We choose a pivot by looking at the first, last
- *    and middle elements. We arrange them into order
- *    because it's easy to do that in conjunction with
- *    choosing the pivot, and it makes things a little
- *    easier in the partitioning step. Anyway, the pivot
- *    is the middle of these three. It's still possible
- *    to construct datasets where the algorithm takes
- *    time of order n^2, but it simply never happens in
- *    practice.
- * 3' Newsflash: On further investigation I find that
- *    it's easy to construct datasets where median-of-3
- *    simply isn't good enough. So on large-ish subarrays
- *    we do a more sophisticated pivoting: we take three
- *    sets of 3 elements, find their medians, and then
- *    take the median of those.
- * 4. We copy the pivot element to a separate place
- *    because that way we can always do our comparisons
- *    directly against a pointer to that separate place,
- *    and don't have to wonder "did we move the pivot
- *    element?". This makes the inner loop better.
- * 5. It's possible to make the pivoting even more
- *    reliable by looking at more candidates when n
- *    is larger. (Taking this to its logical conclusion
- *    results in a variant of quicksort that doesn't
- *    have that n^2 worst case.) However, the overhead
- *    from the extra bookkeeping means that it's just
- *    not worth while.
- * 6. This is pretty clean and portable code. Here are
- *    all the potential portability pitfalls and problems
- *    I know of:
- *      - In one place (the insertion sort) I construct
- *        a pointer that points just past the end of the
- *        supplied array, and assume that (a) it won't
- *        compare equal to any pointer within the array,
- *        and (b) it will compare equal to a pointer
- *        obtained by stepping off the end of the array.
- *        These might fail on some segmented architectures.
- *      - I assume that there are 8 bits in a |char| when
- *        computing the size of stack needed. This would
- *        fail on machines with 9-bit or 16-bit bytes.
- *      - I assume that if |((int)base&(sizeof(int)-1))==0|
- *        and |(size&(sizeof(int)-1))==0| then it's safe to
- *        get at array elements via |int*|s, and that if
- *        actually |size==sizeof(int)| as well then it's
- *        safe to treat the elements as |int|s. This might
- *        fail on systems that convert pointers to integers
- *        in non-standard ways.
- *      - I assume that |8*sizeof(size_t)<=INT_MAX|. This
- *        would be false on a machine with 8-bit |char|s,
- *        16-bit |int|s and 4096-bit |size_t|s. :-)
- */
-
-/* The recursion logic is the same in each case: */
-#define Recurse(Trunc)				\
-      { size_t l=last-ffirst,r=llast-first;	\
-        if (l<Trunc) {				\
-          if (r>=Trunc) doRight			\
-          else pop				\
-        }					\
-        else if (l<=r) { pushLeft; doRight }	\
-        else if (r>=Trunc) { pushRight; doLeft }\
-        else doLeft				\
-      }
-
-/* and so is the pivoting logic: */
-#define Pivot(swapper,sz)			\
-  if ((size_t)(last-first)>PIVOT_THRESHOLD*sz) mid=pivot_big(first,mid,last,sz,compare);\
-  else {	\
-    if (compare(first,mid)<0) {			\
-      if (compare(mid,last)>0) {		\
-        swapper(mid,last);			\
-        if (compare(first,mid)>0) swapper(first,mid);\
-      }						\
-    }						\
-    else {					\
-      if (compare(mid,last)>0) swapper(first,last)\
-      else {					\
-        swapper(first,mid);			\
-        if (compare(mid,last)>0) swapper(mid,last);\
-      }						\
-    }						\
-    first+=sz; last-=sz;			\
-  }
-
-#ifdef DEBUG_QSORT
-#include <stdio.h>
-#endif
+    char *i, *j;
 
-/* and so is the partitioning logic: */
-#define Partition(swapper,sz) {			\
-  int swapped=0;				\
-  do {						\
-    while (compare(first,pivot)<0) first+=sz;	\
-    while (compare(pivot,last)<0) last-=sz;	\
-    if (first<last) {				\
-      swapper(first,last); swapped=1;		\
-      first+=sz; last-=sz; }			\
-    else if (first==last) { first+=sz; last-=sz; break; }\
-  } while (first<=last);			\
-  if (!swapped) pop				\
+    for (i = lo + size; i <= hi; i += size) {
+        for (j = i; j > lo && compare(j - size, j) > 0; j -= size) {
+            qsort_swap(j - size, j, size, align);
+        }
+    }
 }
 
-/* and so is the pre-insertion-sort operation of putting
- * the smallest element into place as a sentinel.
- * Doing this makes the inner loop nicer. I got this
- * idea from the GNU implementation of qsort().
- */
-#define PreInsertion(swapper,limit,sz)		\
-  first=base;					\
-  last=first + (nmemb>limit ? limit : nmemb-1)*sz;\
-  while (last!=base) {				\
-    if (compare(first,last)>0) first=last;	\
-    last-=sz; }					\
-  if (first!=base) swapper(first,(char*)base);
-
-/* and so is the insertion sort, in the first two cases: */
-#define Insertion(swapper)			\
-  last=((char*)base)+nmemb*size;		\
-  for (first=((char*)base)+size;first!=last;first+=size) {	\
-    char *test;					\
-    /* Find the right place for |first|.	\
-     * My apologies for var reuse. */		\
-    for (test=first-size;compare(test,first)>0;test-=size) ;	\
-    test+=size;					\
-    if (test!=first) {				\
-      /* Shift everything in [test,first)	\
-       * up by one, and place |first|		\
-       * where |test| is. */			\
-      memcpy(pivot,first,size);			\
-      memmove(test+size,test,first-test);	\
-      memcpy(test,pivot,size);			\
-    }						\
-  }
-
-#define SWAP_nonaligned(a,b) { \
-  register char *aa=(a),*bb=(b); \
-  register size_t sz=size; \
-  do { register char t=*aa; *aa++=*bb; *bb++=t; } while (--sz); }
-
-#define SWAP_aligned(a,b) { \
-  register int *aa=(int*)(a),*bb=(int*)(b); \
-  register size_t sz=size; \
-  do { register int t=*aa;*aa++=*bb; *bb++=t; } while (sz-=WORD_BYTES); }
-
-#define SWAP_words(a,b) { \
-  register int t=*((int*)a); *((int*)a)=*((int*)b); *((int*)b)=t; }
-
-/* ---------------------------------------------------------------------- */
-
-static char *
-pivot_big(char *first, char *mid, char *last, size_t size,
-          int compare(const void *, const void *))
+/* Returns SDL_FALSE, leaving the range partly sorted, if more than
+   QSORT_PARTIAL elements have to be moved */
+SDL_FORCE_INLINE SDL_bool
+qsort_partial_insertion(char *lo, char *hi, size_t size, size_t align, qsort_compare compare)
 {
-    size_t d = (((last - first) / size) >> 3) * size;
-    char *m1, *m2, *m3;
-    {
-        char *a = first, *b = first + d, *c = first + 2 * d;
-#ifdef DEBUG_QSORT
-        fprintf(stderr, "< %d %d %d\n", *(int *) a, *(int *) b, *(int *) c);
-#endif
-        m1 = compare(a, b) < 0 ?
-            (compare(b, c) < 0 ? b : (compare(a, c) < 0 ? c : a))
-            : (compare(a, c) < 0 ? a : (compare(b, c) < 0 ? c : b));
+    int moves = 0;
+    char *i, *j;
+
+    for (i = lo + size; i <= hi; i += size) {
+        for (j = i; j > lo && compare(j - size, j) > 0; j -= size) {
+            if (++moves > QSORT_PARTIAL) {
+                return SDL_FALSE;
+            }
+            qsort_swap(j - size, j, size, align);
+        }
     }
-    {
-        char *a = mid - d, *b = mid, *c = mid + d;
-#ifdef DEBUG_QSORT
-        fprintf(stderr, ". %d %d %d\n", *(int *) a, *(int *) b, *(int *) c);
-#endif
-        m2 = compare(a, b) < 0 ?
-            (compare(b, c) < 0 ? b : (compare(a, c) < 0 ? c : a))
-            : (compare(a, c) < 0 ? a : (compare(b, c) < 0 ? c : b));
+    return SDL_TRUE;
+}
+
+SDL_FORCE_INLINE void
+qsort_sift(char *base, size_t root, size_t n, size_t size, size_t align, qsort_compare compare)
+{
+    size_t child;
+
+    while ((child = 2 * root + 1) < n) {
+        if (child + 1 < n && compare(base + child * size, base + (child + 1) * size) < 0) {
+            ++child;
+        }
+        if (compare(base + root * size, base + child * size) >= 0) {
+            return;
+        }
+        qsort_swap(base + root * size, base + child * size, size, align);
+        root = child;
     }
-    {
-        char *a = last - 2 * d, *b = last - d, *c = last;
-#ifdef DEBUG_QSORT
-        fprintf(stderr, "> %d %d %d\n", *(int *) a, *(int *) b, *(int *) c);
-#endif
-        m3 = compare(a, b) < 0 ?
-            (compare(b, c) < 0 ? b : (compare(a, c) < 0 ? c : a))
-            : (compare(a, c) < 0 ? a : (compare(b, c) < 0 ? c : b));
+}
+
+SDL_FORCE_INLINE void
+qsort_heapsort(char *base, size_t n, size_t size, size_t align, qsort_compare compare)
+{
+    size_t i = n / 2;
+
+    while (i-- > 0) {
+        qsort_sift(base, i, n, size, align, compare);
+    }
+    while (--n > 0) {
+        qsort_swap(base, base + n * size, size, align);
+        qsort_sift(base, 0, n, size, align, compare);
     }
-#ifdef DEBUG_QSORT
-    fprintf(stderr, "-> %d %d %d\n", *(int *) m1, *(int *) m2, *(int *) m3);
-#endif
-    return compare(m1, m2) < 0 ?
-        (compare(m2, m3) < 0 ? m2 : (compare(m1, m3) < 0 ? m3 : m1))
-        : (compare(m1, m3) < 0 ? m1 : (compare(m2, m3) < 0 ? m3 : m2));
 }
 
-/* ---------------------------------------------------------------------- */
+SDL_FORCE_INLINE char *
+qsort_median3(char *a, char *b, char *c, qsort_compare compare)
+{
+    if (compare(a, b) < 0) {
+        if (compare(b, c) < 0) {
+            return b;
+        }
+        return (compare(a, c) < 0) ? c : a;
+    }
+    if (compare(a, c) < 0) {
+        return a;
+    }
+    return (compare(b, c) < 0) ? c : b;
+}
 
-static void
-qsort_nonaligned(void *base, size_t nmemb, size_t size,
-                 int (*compare) (const void *, const void *))
+SDL_FORCE_INLINE void
+qsort_introsort(char *base, size_t nmemb, size_t size, size_t align, qsort_compare compare)
 {
+    struct
+    {
+        char *lo;
+        char *hi;
+        int depth;
+    } stack[QSORT_STACK];
+    int top = 0;
+    char *lo = base;
+    char *hi = base + (nmemb - 1) * size;
+    int depth = 0;
+    size_t n, left, right;
+    char *i, *j;
+
+    for (n = nmemb; n > 1; n >>= 1) {
+        depth += 2;
+    }
+
+    /* Turn an array in strictly descending order around, so it's sorted */
+    for (i = lo; i < hi && compare(i, i + size) > 0; i += size) {
+    }
+    if (i == hi) {
+        for (j = hi; lo < j; lo += size, j -= size) {
+            qsort_swap(lo, j, size, align);
+        }
+        return;
+    }
+
+    for (;;) {
+        n = (size_t) (hi - lo) / size + 1;
+        if (n <= QSORT_INSERTION) {
+            qsort_insertion(lo, hi, size, align, compare);
+        } else if (depth == 0) {
+            qsort_heapsort(lo, n, size, align, compare);
+        } else {
+            char *mid = lo + (n / 2) * size;
+            char *pivot;
+            SDL_bool swapped = SDL_FALSE;
+
+            if (n > QSORT_NINTHER) {
+                const size_t step = (n / 8) * size;
+                pivot = qsort_median3(qsort_median3(lo, lo + step, lo + 2 * step, compare),
+                                      qsort_median3(mid - step, mid, mid + step, compare),
+                                      qsort_median3(hi - 2 * step, hi - step, hi, compare),
+                                      compare);
+            } else {
+                pivot = qsort_median3(lo, mid, hi, compare);
+            }
 
-    stack_entry stack[STACK_SIZE];
-    int stacktop = 0;
-    char *first, *last;
-    char *pivot = malloc(size);
-    size_t trunc = TRUNC_nonaligned * size;
-    assert(pivot != 0);
-
-    first = (char *) base;
-    last = first + (nmemb - 1) * size;
-
-    if ((size_t) (last - first) > trunc) {
-        char *ffirst = first, *llast = last;
-        while (1) {
-            /* Select pivot */
-            {
-                char *mid = first + size * ((last - first) / size >> 1);
-                Pivot(SWAP_nonaligned, size);
-                memcpy(pivot, mid, size);
+            /* Move the pivot to lo.  Being a median, it leaves an element no
+               smaller than itself in the range, so the scans need no bounds
+               and an input in order stays in order. */
+            if (pivot != lo) {
+                qsort_swap(lo, pivot, size, align);
             }
-            /* Partition. */
-            Partition(SWAP_nonaligned, size);
-            /* Prepare to recurse/iterate. */
-        Recurse(trunc)}
-    }
-    PreInsertion(SWAP_nonaligned, TRUNC_nonaligned, size);
-    Insertion(SWAP_nonaligned);
-    free(pivot);
+
+            /* Both scans stop on elements equal to the pivot, which keeps
+               the halves even when there are lots of equal elements. */
+            i = lo;
+            j = hi + size;
+            for (;;) {
+                do {
+                    i += size;
+                } while (compare(i, lo) < 0);
+                do {
+                    j -= size;
+                } while (compare(lo, j) < 0);
+                if (i >= j) {
+                    break;
+                }
+                qsort_swap(i, j, size, align);
+                swapped = SDL_TRUE;
+            }
+            if (j != lo) {
+                qsort_swap(lo, j, size, align);
+            }
+            --depth;
+            left = (size_t) (j - lo) / size;
+            right = (size_t) (hi - j) / size;
+
+            if (!swapped &&
+                (left <= 1 || qsort_partial_insertion(lo, j - size, size, align, compare)) &&
+                (right <= 1 || qsort_partial_insertion(j + size, hi, size, align, compare))) {
+                left = right = 0;
+            }
+
+            /* Save the bigger half and go on with the smaller one, so the
+               stack never holds more than log2(nmemb) ranges. */
+            if (left < right) {
+                if (right > 1) {
+                    stack[top].lo = j + size;
+                    stack[top].hi = hi;
+                    stack[top].depth = depth;
+                    ++top;
+                }
+                if (left > 1) {
+                    hi = j - size;
+                    continue;
+                }
+            } else {
+                if (left > 1) {
+                    stack[top].lo = lo;
+                    stack[top].hi = j - size;
+                    stack[top].depth = depth;
+                    ++top;
+                }
+                if (right > 1) {
+                    lo = j + size;
+                    continue;
+                }
+            }
+        }
+        if (top == 0) {
+            break;
+        }
+        --top;
+        lo = stack[top].lo;
+        hi = stack[top].hi;
+        depth = stack[top].depth;
+    }
 }
 
 static void
-qsort_aligned(void *base, size_t nmemb, size_t size,
-              int (*compare) (const void *, const void *))
+qsort_uint32(void *base, size_t nmemb, qsort_compare compare)
 {
+    qsort_introsort((char *) base, nmemb, 4, 4, compare);
+}
 
-    stack_entry stack[STACK_SIZE];
-    int stacktop = 0;
-    char *first, *last;
-    char *pivot = malloc(size);
-    size_t trunc = TRUNC_aligned * size;
-    assert(pivot != 0);
-
-    first = (char *) base;
-    last = first + (nmemb - 1) * size;
-
-    if ((size_t) (last - first) > trunc) {
-        char *ffirst = first, *llast = last;
-        while (1) {
-            /* Select pivot */
-            {
-                char *mid = first + size * ((last - first) / size >> 1);
-                Pivot(SWAP_aligned, size);
-                memcpy(pivot, mid, size);
-            }
-            /* Partition. */
-            Partition(SWAP_aligned, size);
-            /* Prepare to recurse/iterate. */
-        Recurse(trunc)}
-    }
-    PreInsertion(SWAP_aligned, TRUNC_aligned, size);
-    Insertion(SWAP_aligned);
-    free(pivot);
+static void
+qsort_uint64(void *base, size_t nmemb, qsort_compare compare)
+{
+    qsort_introsort((char *) base, nmemb, 8, 8, compare);
 }
 
 static void
-qsort_words(void *base, size_t nmemb,
-            int (*compare) (const void *, const void *))
+qsort_words64(void *base, size_t nmemb, size_t size, qsort_compare compare)
 {
+    qsort_introsort((char *) base, nmemb, size, 8, compare);
+}
 
-    stack_entry stack[STACK_SIZE];
-    int stacktop = 0;
-    char *first, *last;
-    char *pivot = malloc(WORD_BYTES);
-    assert(pivot != 0);
-
-    first = (char *) base;
-    last = first + (nmemb - 1) * WORD_BYTES;
-
-    if (last - first > TRUNC_words) {
-        char *ffirst = first, *llast = last;
-        while (1) {
-#ifdef DEBUG_QSORT
-            fprintf(stderr, "Doing %d:%d: ",
-                    (first - (char *) base) / WORD_BYTES,
-                    (last - (char *) base) / WORD_BYTES);
-#endif
-            /* Select pivot */
-            {
-                char *mid =
-                    first + WORD_BYTES * ((last - first) / (2 * WORD_BYTES));
-                Pivot(SWAP_words, WORD_BYTES);
-                *(int *) pivot = *(int *) mid;
-            }
-#ifdef DEBUG_QSORT
-            fprintf(stderr, "pivot=%d\n", *(int *) pivot);
-#endif
-            /* Partition. */
-            Partition(SWAP_words, WORD_BYTES);
-            /* Prepare to recurse/iterate. */
-        Recurse(TRUNC_words)}
-    }
-    PreInsertion(SWAP_words, (TRUNC_words / WORD_BYTES), WORD_BYTES);
-    /* Now do insertion sort. */
-    last = ((char *) base) + nmemb * WORD_BYTES;
-    for (first = ((char *) base) + WORD_BYTES; first != last;
-         first += WORD_BYTES) {
-        /* Find the right place for |first|. My apologies for var reuse */
-        int *pl = (int *) (first - WORD_BYTES), *pr = (int *) first;
-        *(int *) pivot = *(int *) first;
-        for (; compare(pl, pivot) > 0; pr = pl, --pl) {
-            *pr = *pl;
-        }
-        if (pr != (int *) first)
-            *pr = *(int *) pivot;
-    }
-    free(pivot);
+static void
+qsort_words32(void *base, size_t nmemb, size_t size, qsort_compare compare)
+{
+    qsort_introsort((char *) base, nmemb, size, 4, compare);
 }
 
-/* ---------------------------------------------------------------------- */
+static void
+qsort_bytes(void *base, size_t nmemb, size_t size, qsort_compare compare)
+{
+    qsort_introsort((char *) base, nmemb, size, 1, compare);
+}
 
 void
-qsort(void *base, size_t nmemb, size_t size,
-      int (*compare) (const void *, const void *))
+SDL_qsort(void *base, size_t nmemb, size_t size, int (*compare) (const void *, const void *))
 {
+    const size_t bits = (size_t) (uintptr_t) base | size;
 
-    if (nmemb <= 1)
+    if (nmemb <= 1 || size == 0) {
         return;
-    if (((uintptr_t) base | size) & (WORD_BYTES - 1))
-        qsort_nonaligned(base, nmemb, size, compare);
-    else if (size != WORD_BYTES)
-        qsort_aligned(base, nmemb, size, compare);
-    else
-        qsort_words(base, nmemb, compare);
+    }
+    if (size == 4 && !(bits & 3)) {
+        qsort_uint32(base, nmemb, compare);
+    } else if (size == 8 && !(bits & 7)) {
+        qsort_uint64(base, nmemb, compare);
+    } else if (!(bits & 7)) {
+        qsort_words64(base, nmemb, size, compare);
+    } else if (!(bits & 3)) {
+        qsort_words32(base, nmemb, size, compare);
+    } else {
+        qsort_bytes(base, nmemb, size, compare);
+    }
+}
+
+/*
+  The radix sorts are LSD radix sorts on a byte of the key at a time.  The
+  counts for all four bytes are taken in one pass over the keys, and a
+  byte that is the same in every key is skipped, so small keys take fewer
+  passes.  They're stable, and need a buffer as big as the array.
+*/
+
+/* Turn the counts for a byte into offsets, returns SDL_TRUE if every key
+   has the same value there and the pass can be skipped. */
+static SDL_bool
+radix_offsets(size_t *counts, size_t total)
+{
+    size_t i, sum = 0, n;
+
+    for (i = 0; i < 256; ++i) {
+        n = counts[i];
+        if (n == total) {
+            return SDL_TRUE;
+        }
+        counts[i] = sum;
+        sum += n;
+    }
+    return SDL_FALSE;
 }
 
-#endif /* !SDL_qsort */
+int
+SDL_RadixSort32(Uint32 *values, size_t count)
+{
+    size_t counts[4][256];
+    Uint32 *buffer, *src, *dst, *tmp;
+    Uint32 value;
+    size_t i;
+    int pass, shift;
+
+    if (count <= 1) {
+        return 0;
+    }
+    if (!values) {
+        return SDL_InvalidParamError("values");
+    }
+    if (count > ((size_t) -1) / sizeof(Uint32)) {
+        return SDL_OutOfMemory();
+    }
+    buffer = (Uint32 *) SDL_malloc(count * sizeof(Uint32));
+    if (!buffer) {
+        return SDL_OutOfMemory();
+    }
+
+    SDL_zero(counts);
+    for (i = 0; i < count; ++i) {
+        value = values[i];
+        ++counts[0][value & 0xFF];
+        ++counts[1][(value >> 8) & 0xFF];
+        ++counts[2][(value >> 16) & 0xFF];
+        ++counts[3][value >> 24];
+    }
+
+    src = values;
+    dst = buffer;
+    for (pass = 0; pass < 4; ++pass) {
+        size_t *offsets = counts[pass];
+        if (radix_offsets(offsets, count)) {
+            continue;
+        }
+        shift = pass * 8;
+        for (i = 0; i < count; ++i) {
+            value = src[i];
+            dst[offsets[(value >> shift) & 0xFF]++] = value;
+        }
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    if (src != values) {
+        SDL_memcpy(values, src, count * sizeof(Uint32));
+    }
+    SDL_free(buffer);
+    return 0;
+}
+
+/* Move the records to where their key's byte puts them.  Records are made
+   of 4 byte words, 'size' is a constant for the common sizes. */
+SDL_FORCE_INLINE void
+radix_scatter(const Uint8 *src, Uint8 *dst, size_t nmemb, size_t size,
+              size_t key_offset, int shift, size_t *offsets)
+{
+    const size_t words = size / 4;
+    const Uint32 *from;
+    Uint32 *to;
+    size_t i, k;
+
+    for (i = 0; i < nmemb; ++i) {
+        from = (const Uint32 *) (src + i * size);
+        to = (Uint32 *) (dst + offsets[(*(const Uint32 *) ((const Uint8 *) from + key_offset) >> shift) & 0xFF]++ * size);
+        for (k = 0; k < words; ++k) {
+            to[k] = from[k];
+        }
+    }
+}
+
+int
+SDL_RadixSortKeyed(void *base, size_t nmemb, size_t size, size_t key_offset)
+{
+    size_t counts[4][256];
+    Uint8 *buffer, *src, *dst, *tmp;
+    Uint32 key;
+    size_t i;
+    int pass, shift;
+
+    if (nmemb <= 1) {
+        return 0;
+    }
+    if (!base) {
+        return SDL_InvalidParamError("base");
+    }
+    if (size < sizeof(Uint32) || key_offset > size - sizeof(Uint32)) {
+        return SDL_SetError("The key has to be inside the record");
+    }
+    if (((size_t) (uintptr_t) base | size | key_offset) & 3) {
+        return SDL_SetError("The records and the key have to be aligned to 4 bytes");
+    }
+    if (nmemb > ((size_t) -1) / size) {
+        return SDL_OutOfMemory();
+    }
+    buffer = (Uint8 *) SDL_malloc(nmemb * size);
+    if (!buffer) {
+        return SDL_OutOfMemory();
+    }
+
+    SDL_zero(counts);
+    for (i = 0; i < nmemb; ++i) {
+        key = *(const Uint32 *) ((const Uint8 *) base + i * size + key_offset);
+        ++counts[0][key & 0xFF];
+        ++counts[1][(key >> 8) & 0xFF];
+        ++counts[2][(key >> 16) & 0xFF];
+        ++counts[3][key >> 24];
+    }
+
+    src = (Uint8 *) base;
+    dst = buffer;
+    for (pass = 0; pass < 4; ++pass) {
+        size_t *offsets = counts[pass];
+        if (radix_offsets(offsets, nmemb)) {
+            continue;
+        }
+        shift = pass * 8;
+        if (size == 8) {
+            radix_scatter(src, dst, nmemb, 8, key_offset, shift, offsets);
+        } else if (size == 16) {
+            radix_scatter(src, dst, nmemb, 16, key_offset, shift, offsets);
+        } else {
+            radix_scatter(src, dst, nmemb, size, key_offset, shift, offsets);
+        }
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    if (src != (Uint8 *) base) {
+        SDL_memcpy(base, src, nmemb * size);
+    }
+    SDL_free(buffer);
+    return 0;
+}
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -32,6 +32,11 @@
 /* This file contains portable string manipulation functions for SDL */
 
 #include "SDL_stdinc.h"
+#include "SDL_cpuinfo.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 
 #define SDL_isupperhex(X)   (((X) >= 'A') && ((X) <= 'F'))
@@ -266,50 +271,317 @@ SDL_ScanFloat(const char *text, double *valuep)
 }
 #endif
 
-void *
-SDL_memset(SDL_OUT_BYTECAP(len) void *dst, int c, size_t len)
+/* The memory functions use SSE2 or AVX2 when the C runtime's versions
+   aren't available.  SDL_memset4() always does, and so does SDL_memset()
+   for fills big enough to stream.  As with the blitters the vector code is
+   compiled in when the compiler targets the instruction set, and chosen
+   with SDL_cpuinfo the first time it's needed. */
+
+/* Below this many bytes the C loops are as fast as getting a vector loop
+   aligned */
+#define SDL_MEMORY_SIMD_MIN 64
+
+/* Fills and copies of at least this many bytes use non-temporal stores,
+   which don't read the destination into the cache first, and don't push
+   everything else out of it when clearing a big framebuffer. */
+#define SDL_MEMORY_STREAM_MIN (4 * 1024 * 1024)
+
+/* A fill pattern is a Uint32 as it would be stored at a 4 byte aligned
+   address, so SDL_memset() can share the code with SDL_memset4().  This
+   returns the pattern for a fill starting 'offset' bytes further on, and
+   SDL_PATTERN_BYTE() the first byte it stores. */
+SDL_FORCE_INLINE Uint32
+SDL_PatternAt(Uint32 pattern, size_t offset)
 {
-#if defined(HAVE_MEMSET)
-    return memset(dst, c, len);
+    const int shift = (int) (offset & 3) * 8;
+
+    if (!shift) {
+        return pattern;
+    }
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    return (pattern >> shift) | (pattern << (32 - shift));
+#else
+    return (pattern << shift) | (pattern >> (32 - shift));
+#endif
+}
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define SDL_PATTERN_BYTE(pattern) ((Uint8) (pattern))
 #else
+#define SDL_PATTERN_BYTE(pattern) ((Uint8) ((pattern) >> 24))
+#endif
+
+static void
+SDL_FillC(Uint8 *dst, Uint32 pattern, size_t len)
+{
     size_t left;
     Uint32 *dstp4;
-    Uint8 *dstp1 = (Uint8 *) dst;
-    Uint32 value4 = (c | (c << 8) | (c << 16) | (c << 24));
-    Uint8 value1 = (Uint8) c;
 
     /* The destination pointer needs to be aligned on a 4-byte boundary to
      * execute a 32-bit set. Set first bytes manually if needed until it is
      * aligned. */
-    while ((intptr_t)dstp1 & 0x3) {
-        if (len--) {
-            *dstp1++ = value1;
-        } else {
-            return dst;
-        }
+    while (((uintptr_t) dst & 0x3) && len) {
+        *dst++ = SDL_PATTERN_BYTE(pattern);
+        pattern = SDL_PatternAt(pattern, 1);
+        --len;
     }
 
-    dstp4 = (Uint32 *) dstp1;
+    dstp4 = (Uint32 *) dst;
     left = (len % 4);
     len /= 4;
     while (len--) {
-        *dstp4++ = value4;
+        *dstp4++ = pattern;
     }
 
-    dstp1 = (Uint8 *) dstp4;
-    switch (left) {
-    case 3:
-        *dstp1++ = value1;
-    case 2:
-        *dstp1++ = value1;
-    case 1:
-        *dstp1++ = value1;
+    dst = (Uint8 *) dstp4;
+    while (left--) {
+        *dst++ = SDL_PATTERN_BYTE(pattern);
+        pattern = SDL_PatternAt(pattern, 1);
     }
+}
 
+/* The vector functions take at least SDL_MEMORY_SIMD_MIN bytes.  They
+   store the first vector unaligned, go on from the next aligned address
+   and finish with an unaligned vector that ends at the last byte. */
+#if defined(__SSE2__)
+static void
+SDL_FillSSE2(Uint8 *dst, Uint32 pattern, size_t len)
+{
+    const size_t head = (size_t) (0 - (uintptr_t) dst) & 15;
+    __m128i value = _mm_set1_epi32((int) pattern);
+
+    _mm_storeu_si128((__m128i *) dst, value);
+    dst += head;
+    len -= head;
+    pattern = SDL_PatternAt(pattern, head);
+    value = _mm_set1_epi32((int) pattern);
+
+    if (len >= SDL_MEMORY_STREAM_MIN) {
+        for (; len >= 64; len -= 64, dst += 64) {
+            _mm_stream_si128((__m128i *) dst, value);
+            _mm_stream_si128((__m128i *) (dst + 16), value);
+            _mm_stream_si128((__m128i *) (dst + 32), value);
+            _mm_stream_si128((__m128i *) (dst + 48), value);
+        }
+        _mm_sfence();
+    } else {
+        for (; len >= 64; len -= 64, dst += 64) {
+            _mm_store_si128((__m128i *) dst, value);
+            _mm_store_si128((__m128i *) (dst + 16), value);
+            _mm_store_si128((__m128i *) (dst + 32), value);
+            _mm_store_si128((__m128i *) (dst + 48), value);
+        }
+    }
+    for (; len >= 16; len -= 16, dst += 16) {
+        _mm_store_si128((__m128i *) dst, value);
+    }
+    if (len) {
+        value = _mm_set1_epi32((int) SDL_PatternAt(pattern, len));
+        _mm_storeu_si128((__m128i *) (dst + len - 16), value);
+    }
+}
+
+static void
+SDL_CopySSE2(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    const size_t head = (size_t) (0 - (uintptr_t) dst) & 15;
+
+    _mm_storeu_si128((__m128i *) dst, _mm_loadu_si128((const __m128i *) src));
+    dst += head;
+    src += head;
+    len -= head;
+
+    if (len >= SDL_MEMORY_STREAM_MIN) {
+        for (; len >= 64; len -= 64, dst += 64, src += 64) {
+            _mm_stream_si128((__m128i *) dst, _mm_loadu_si128((const __m128i *) src));
+            _mm_stream_si128((__m128i *) (dst + 16), _mm_loadu_si128((const __m128i *) (src + 16)));
+            _mm_stream_si128((__m128i *) (dst + 32), _mm_loadu_si128((const __m128i *) (src + 32)));
+            _mm_stream_si128((__m128i *) (dst + 48), _mm_loadu_si128((const __m128i *) (src + 48)));
+        }
+        _mm_sfence();
+    } else {
+        for (; len >= 64; len -= 64, dst += 64, src += 64) {
+            _mm_store_si128((__m128i *) dst, _mm_loadu_si128((const __m128i *) src));
+            _mm_store_si128((__m128i *) (dst + 16), _mm_loadu_si128((const __m128i *) (src + 16)));
+            _mm_store_si128((__m128i *) (dst + 32), _mm_loadu_si128((const __m128i *) (src + 32)));
+            _mm_store_si128((__m128i *) (dst + 48), _mm_loadu_si128((const __m128i *) (src + 48)));
+        }
+    }
+    for (; len >= 16; len -= 16, dst += 16, src += 16) {
+        _mm_store_si128((__m128i *) dst, _mm_loadu_si128((const __m128i *) src));
+    }
+    if (len) {
+        _mm_storeu_si128((__m128i *) (dst + len - 16), _mm_loadu_si128((const __m128i *) (src + len - 16)));
+    }
+}
+
+/* Returns how many bytes at the start are the same, in whole vectors */
+static size_t
+SDL_CompareSSE2(const Uint8 *s1, const Uint8 *s2, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i + 16 <= len; i += 16) {
+        const __m128i a = _mm_loadu_si128((const __m128i *) (s1 + i));
+        const __m128i b = _mm_loadu_si128((const __m128i *) (s2 + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF) {
+            break;
+        }
+    }
+    return i;
+}
+#endif /* __SSE2__ */
+
+#if defined(__AVX2__)
+static void
+SDL_FillAVX2(Uint8 *dst, Uint32 pattern, size_t len)
+{
+    const size_t head = (size_t) (0 - (uintptr_t) dst) & 31;
+    __m256i value = _mm256_set1_epi32((int) pattern);
+
+    _mm256_storeu_si256((__m256i *) dst, value);
+    dst += head;
+    len -= head;
+    pattern = SDL_PatternAt(pattern, head);
+    value = _mm256_set1_epi32((int) pattern);
+
+    if (len >= SDL_MEMORY_STREAM_MIN) {
+        for (; len >= 128; len -= 128, dst += 128) {
+            _mm256_stream_si256((__m256i *) dst, value);
+            _mm256_stream_si256((__m256i *) (dst + 32), value);
+            _mm256_stream_si256((__m256i *) (dst + 64), value);
+            _mm256_stream_si256((__m256i *) (dst + 96), value);
+        }
+        _mm_sfence();
+    } else {
+        for (; len >= 128; len -= 128, dst += 128) {
+            _mm256_store_si256((__m256i *) dst, value);
+            _mm256_store_si256((__m256i *) (dst + 32), value);
+            _mm256_store_si256((__m256i *) (dst + 64), value);
+            _mm256_store_si256((__m256i *) (dst + 96), value);
+        }
+    }
+    for (; len >= 32; len -= 32, dst += 32) {
+        _mm256_store_si256((__m256i *) dst, value);
+    }
+    if (len) {
+        value = _mm256_set1_epi32((int) SDL_PatternAt(pattern, len));
+        _mm256_storeu_si256((__m256i *) (dst + len - 32), value);
+    }
+}
+
+static void
+SDL_CopyAVX2(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    const size_t head = (size_t) (0 - (uintptr_t) dst) & 31;
+
+    _mm256_storeu_si256((__m256i *) dst, _mm256_loadu_si256((const __m256i *) src));
+    dst += head;
+    src += head;
+    len -= head;
+
+    if (len >= SDL_MEMORY_STREAM_MIN) {
+        for (; len >= 128; len -= 128, dst += 128, src += 128) {
+            _mm256_stream_si256((__m256i *) dst, _mm256_loadu_si256((const __m256i *) src));
+            _mm256_stream_si256((__m256i *) (dst + 32), _mm256_loadu_si256((const __m256i *) (src + 32)));
+            _mm256_stream_si256((__m256i *) (dst + 64), _mm256_loadu_si256((const __m256i *) (src + 64)));
+            _mm256_stream_si256((__m256i *) (dst + 96), _mm256_loadu_si256((const __m256i *) (src + 96)));
+        }
+        _mm_sfence();
+    } else {
+        for (; len >= 128; len -= 128, dst += 128, src += 128) {
+            _mm256_store_si256((__m256i *) dst, _mm256_loadu_si256((const __m256i *) src));
+            _mm256_store_si256((__m256i *) (dst + 32), _mm256_loadu_si256((const __m256i *) (src + 32)));
+            _mm256_store_si256((__m256i *) (dst + 64), _mm256_loadu_si256((const __m256i *) (src + 64)));
+            _mm256_store_si256((__m256i *) (dst + 96), _mm256_loadu_si256((const __m256i *) (src + 96)));
+        }
+    }
+    for (; len >= 32; len -= 32, dst += 32, src += 32) {
+        _mm256_store_si256((__m256i *) dst, _mm256_loadu_si256((const __m256i *) src));
+    }
+    if (len) {
+        _mm256_storeu_si256((__m256i *) (dst + len - 32), _mm256_loadu_si256((const __m256i *) (src + len - 32)));
+    }
+}
+
+static size_t
+SDL_CompareAVX2(const Uint8 *s1, const Uint8 *s2, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i + 32 <= len; i += 32) {
+        const __m256i a = _mm256_loadu_si256((const __m256i *) (s1 + i));
+        const __m256i b = _mm256_loadu_si256((const __m256i *) (s2 + i));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)) != -1) {
+            break;
+        }
+    }
+    return i;
+}
+#endif /* __AVX2__ */
+
+static void (*SDL_FillSIMD) (Uint8 *dst, Uint32 pattern, size_t len) = NULL;
+static void (*SDL_CopySIMD) (Uint8 *dst, const Uint8 *src, size_t len) = NULL;
+static size_t (*SDL_CompareSIMD) (const Uint8 *s1, const Uint8 *s2, size_t len) = NULL;
+static SDL_bool SDL_MemoryKernelsChosen = SDL_FALSE;
+
+/* Returns SDL_TRUE if there is vector code for this CPU */
+static SDL_bool
+SDL_HasMemoryKernels(void)
+{
+    if (!SDL_MemoryKernelsChosen) {
+#if defined(__SSE2__)
+        if (SDL_HasSSE2()) {
+            SDL_CopySIMD = SDL_CopySSE2;
+            SDL_CompareSIMD = SDL_CompareSSE2;
+            SDL_FillSIMD = SDL_FillSSE2;
+        }
+#endif
+#if defined(__AVX2__)
+        if (SDL_HasAVX2()) {
+            SDL_CopySIMD = SDL_CopyAVX2;
+            SDL_CompareSIMD = SDL_CompareAVX2;
+            SDL_FillSIMD = SDL_FillAVX2;
+        }
+#endif
+        SDL_MemoryKernelsChosen = SDL_TRUE;
+    }
+    return SDL_FillSIMD ? SDL_TRUE : SDL_FALSE;
+}
+
+void *
+SDL_memset(SDL_OUT_BYTECAP(len) void *dst, int c, size_t len)
+{
+#if defined(HAVE_MEMSET)
+    /* The C runtime's memset() is hard to beat, but it fills big buffers
+       through the cache */
+    if (len >= SDL_MEMORY_STREAM_MIN && SDL_HasMemoryKernels()) {
+        SDL_FillSIMD((Uint8 *) dst, 0x01010101u * (Uint8) c, len);
+        return dst;
+    }
+    return memset(dst, c, len);
+#else
+    if (len >= SDL_MEMORY_SIMD_MIN && SDL_HasMemoryKernels()) {
+        SDL_FillSIMD((Uint8 *) dst, 0x01010101u * (Uint8) c, len);
+    } else {
+        SDL_FillC((Uint8 *) dst, 0x01010101u * (Uint8) c, len);
+    }
     return dst;
 #endif /* HAVE_MEMSET */
 }
 
+void
+SDL_memset4(void *dst, Uint32 val, size_t dwords)
+{
+    const size_t len = dwords * 4;
+
+    if (len >= SDL_MEMORY_SIMD_MIN && SDL_HasMemoryKernels()) {
+        SDL_FillSIMD((Uint8 *) dst, val, len);
+    } else {
+        SDL_FillC((Uint8 *) dst, val, len);
+    }
+}
+
 void *
 SDL_memcpy(SDL_OUT_BYTECAP(len) void *dst, SDL_IN_BYTECAP(len) const void *src, size_t len)
 {
@@ -324,6 +596,11 @@ SDL_memcpy(SDL_OUT_BYTECAP(len) void *dst, SDL_IN_BYTECAP(len) const void *src,
     bcopy(src, dst, len);
     return dst;
 #else
+    if (len >= SDL_MEMORY_SIMD_MIN && SDL_HasMemoryKernels()) {
+        SDL_CopySIMD((Uint8 *) dst, (const Uint8 *) src, len);
+        return dst;
+    }
+
     /* GCC 4.9.0 with -O3 will generate movaps instructions with the loop
        using Uint32* pointers, so we need to make sure the pointers are
        aligned before we loop using them.
@@ -395,6 +672,12 @@ SDL_memcmp(const void *s1, const void *s2, size_t len)
 #else
     char *s1p = (char *) s1;
     char *s2p = (char *) s2;
+    if (len >= SDL_MEMORY_SIMD_MIN && SDL_HasMemoryKernels()) {
+        const size_t same = SDL_CompareSIMD((const Uint8 *) s1, (const Uint8 *) s2, len);
+        s1p += same;
+        s2p += same;
+        len -= same;
+    }
     while (len--) {
         if (*s1p != *s2p) {
             return (*s1p - *s2p);
@@ -531,7 +814,8 @@ SDL_strlcat(SDL_INOUT_Z_CAP(maxlen) char *dst, const char *src, size_t maxlen)
 char *
 SDL_strdup(const char *string)
 {
-#if defined(HAVE_STRDUP)
+    /* Tracked memory has to come from SDL_malloc() */
+#if defined(HAVE_STRDUP) && !defined(SDL_MEMORY_TRACKING)
     return strdup(string);
 #else
     size_t len = SDL_strlen(string) + 1;
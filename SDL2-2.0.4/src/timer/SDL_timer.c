@@ -35,23 +35,20 @@ typedef struct _SDL_Timer
     void *param;
     Uint32 interval;
     Uint32 scheduled;
+    Uint32 sequence;
     volatile SDL_bool canceled;
     struct _SDL_Timer *next;
+    struct _SDL_Timer *map_next;
 } SDL_Timer;
 
-typedef struct _SDL_TimerMap
-{
-    int timerID;
-    SDL_Timer *timer;
-    struct _SDL_TimerMap *next;
-} SDL_TimerMap;
-
-/* The timers are kept in a sorted list */
+/* The timers are kept in a binary min-heap, ordered by scheduling time */
 typedef struct {
     /* Data used by the main thread */
     SDL_Thread *thread;
     SDL_atomic_t nextID;
-    SDL_TimerMap *timermap;
+    SDL_Timer **timermap;
+    int timermap_size;
+    int timermap_count;
     SDL_mutex *timermap_lock;
 
     /* Padding to separate cache lines between threads */
@@ -63,9 +60,14 @@ typedef struct {
     SDL_Timer * volatile pending;
     SDL_Timer * volatile freelist;
     volatile SDL_bool active;
-
-    /* List of timers - this is only touched by the timer thread */
-    SDL_Timer *timers;
+    SDL_atomic_t num_timers;
+    SDL_atomic_t num_canceled;
+
+    /* Heap of timers - this is only touched by the timer thread */
+    SDL_Timer **timers;
+    int num_queued;
+    int max_queued;
+    Uint32 sequence;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
@@ -73,28 +75,97 @@ static SDL_TimerData SDL_timer_data;
 /* The idea here is that any thread might add a timer, but a single
  * thread manages the active timer queue, sorted by scheduling time.
  *
- * Timers are removed by simply setting a canceled flag
+ * Timers are removed by simply setting a canceled flag. They are found by
+ * ID in a hash map, and dropped from the queue when they come due, or all
+ * at once when more than half of the queue has been canceled.
  */
 
+static SDL_INLINE SDL_bool
+SDL_TimerBefore(const SDL_Timer *a, const SDL_Timer *b)
+{
+    Sint32 delta = (Sint32)(a->scheduled - b->scheduled);
+
+    if (delta == 0) {
+        /* Timers due on the same tick fire in the order they were queued */
+        return ((Sint32)(a->sequence - b->sequence) < 0) ? SDL_TRUE : SDL_FALSE;
+    }
+    return (delta < 0) ? SDL_TRUE : SDL_FALSE;
+}
+
+static void
+SDL_SiftTimerDown(SDL_TimerData *data, int index, SDL_Timer *timer)
+{
+    SDL_Timer **timers = data->timers;
+    const int count = data->num_queued;
+
+    for ( ; ; ) {
+        int child = (index * 2) + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && SDL_TimerBefore(timers[child + 1], timers[child])) {
+            ++child;
+        }
+        if (!SDL_TimerBefore(timers[child], timer)) {
+            break;
+        }
+        timers[index] = timers[child];
+        index = child;
+    }
+    timers[index] = timer;
+}
+
+/* Make room in the heap for every timer that has been created */
+static SDL_bool
+SDL_ReserveTimerQueue(SDL_TimerData *data)
+{
+    const int needed = SDL_AtomicGet(&data->num_timers);
+
+    if (needed > data->max_queued) {
+        int size = data->max_queued ? (data->max_queued * 2) : 64;
+        SDL_Timer **timers;
+
+        while (size < needed) {
+            size *= 2;
+        }
+        timers = (SDL_Timer **)SDL_realloc(data->timers, size * sizeof(*timers));
+        if (!timers) {
+            return SDL_FALSE;
+        }
+        data->timers = timers;
+        data->max_queued = size;
+    }
+    return SDL_TRUE;
+}
+
 static void
 SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
 {
-    SDL_Timer *prev, *curr;
+    SDL_Timer **timers = data->timers;
+    int index = data->num_queued++;
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if ((Sint32)(timer->scheduled-curr->scheduled) < 0) {
+    timer->sequence = data->sequence++;
+    while (index > 0) {
+        const int parent = (index - 1) / 2;
+        if (!SDL_TimerBefore(timer, timers[parent])) {
             break;
         }
+        timers[index] = timers[parent];
+        index = parent;
     }
+    timers[index] = timer;
+}
 
-    /* Insert the timer here! */
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+static SDL_Timer *
+SDL_RemoveFirstTimer(SDL_TimerData *data)
+{
+    SDL_Timer *first = data->timers[0];
+    SDL_Timer *last = data->timers[--data->num_queued];
+
+    if (data->num_queued > 0) {
+        SDL_SiftTimerDown(data, 0, last);
     }
-    timer->next = curr;
+    return first;
 }
 
 static int
@@ -106,6 +177,8 @@ SDL_TimerThread(void *_data)
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
     Uint32 tick, now, interval, delay;
+    SDL_bool reserved;
+    int i, count;
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
@@ -113,12 +186,19 @@ SDL_TimerThread(void *_data)
      *  3. Wait until next dispatch time or new timer arrives
      */
     for ( ; ; ) {
+        /* Pending timers are only taken when they are sure to fit */
+        reserved = SDL_ReserveTimerQueue(data);
+
         /* Pending and freelist maintenance */
         SDL_AtomicLock(&data->lock);
         {
             /* Get any timers ready to be queued */
-            pending = data->pending;
-            data->pending = NULL;
+            if (reserved) {
+                pending = data->pending;
+                data->pending = NULL;
+            } else {
+                pending = NULL;
+            }
 
             /* Make any unused timer structures available */
             if (freelist_head) {
@@ -128,7 +208,7 @@ SDL_TimerThread(void *_data)
         }
         SDL_AtomicUnlock(&data->lock);
 
-        /* Sort the pending timers into our list */
+        /* Sort the pending timers into our heap */
         while (pending) {
             current = pending;
             pending = pending->next;
@@ -142,14 +222,39 @@ SDL_TimerThread(void *_data)
             break;
         }
 
+        /* Drop canceled timers once they make up most of the heap */
+        if (SDL_AtomicGet(&data->num_canceled) > data->num_queued / 2) {
+            SDL_AtomicSet(&data->num_canceled, 0);
+
+            count = 0;
+            for (i = 0; i < data->num_queued; ++i) {
+                current = data->timers[i];
+                if (current->canceled) {
+                    if (!freelist_head) {
+                        freelist_head = current;
+                    }
+                    if (freelist_tail) {
+                        freelist_tail->next = current;
+                    }
+                    freelist_tail = current;
+                } else {
+                    data->timers[count++] = current;
+                }
+            }
+            data->num_queued = count;
+            for (i = (count / 2) - 1; i >= 0; --i) {
+                SDL_SiftTimerDown(data, i, data->timers[i]);
+            }
+        }
+
         /* Initial delay if there are no timers */
         delay = SDL_MUTEX_MAXWAIT;
 
         tick = SDL_GetTicks();
 
         /* Process all the pending timers for this tick */
-        while (data->timers) {
-            current = data->timers;
+        while (data->num_queued > 0) {
+            current = data->timers[0];
 
             if ((Sint32)(tick-current->scheduled) < 0) {
                 /* Scheduled for the future, wait a bit */
@@ -158,7 +263,7 @@ SDL_TimerThread(void *_data)
             }
 
             /* We're going to do something with this timer */
-            data->timers = current->next;
+            SDL_RemoveFirstTimer(data);
 
             if (current->canceled) {
                 interval = 0;
@@ -179,10 +284,19 @@ SDL_TimerThread(void *_data)
                 }
                 freelist_tail = current;
 
+                /* A canceled timer leaves the heap here, don't count it */
+                if (current->canceled) {
+                    SDL_AtomicAdd(&data->num_canceled, -1);
+                }
                 current->canceled = SDL_TRUE;
             }
         }
 
+        /* Try again soon if there was no memory for the pending timers */
+        if (!reserved && delay > 1) {
+            delay = 1;
+        }
+
         /* Adjust the delay based on processing time */
         now = SDL_GetTicks();
         interval = (now - tick);
@@ -247,7 +361,7 @@ SDL_TimerQuit(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    int i;
 
     if (data->active) {
         data->active = SDL_FALSE;
@@ -263,33 +377,73 @@ SDL_TimerQuit(void)
         data->sem = NULL;
 
         /* Clean up the timer entries */
-        while (data->timers) {
-            timer = data->timers;
-            data->timers = timer->next;
-            SDL_free(timer);
+        for (i = 0; i < data->num_queued; ++i) {
+            SDL_free(data->timers[i]);
         }
+        SDL_free(data->timers);
+        data->timers = NULL;
+        data->num_queued = 0;
+        data->max_queued = 0;
         while (data->freelist) {
             timer = data->freelist;
             data->freelist = timer->next;
             SDL_free(timer);
         }
-        while (data->timermap) {
-            entry = data->timermap;
-            data->timermap = entry->next;
-            SDL_free(entry);
-        }
+        SDL_AtomicSet(&data->num_timers, 0);
+        SDL_AtomicSet(&data->num_canceled, 0);
+
+        SDL_free(data->timermap);
+        data->timermap = NULL;
+        data->timermap_size = 0;
+        data->timermap_count = 0;
 
         SDL_DestroyMutex(data->timermap_lock);
         data->timermap_lock = NULL;
     }
 }
 
+/* Add a timer to the map, doubling the buckets when they fill up */
+static void
+SDL_MapTimer(SDL_TimerData *data, SDL_Timer *timer)
+{
+    int bucket;
+
+    if (data->timermap_count >= data->timermap_size) {
+        int size = data->timermap_size ? (data->timermap_size * 2) : 64;
+        SDL_Timer **timermap = (SDL_Timer **)SDL_calloc(size, sizeof(*timermap));
+
+        /* Without memory the buckets just get longer */
+        if (timermap) {
+            int i;
+            for (i = 0; i < data->timermap_size; ++i) {
+                while (data->timermap[i]) {
+                    SDL_Timer *entry = data->timermap[i];
+                    data->timermap[i] = entry->map_next;
+                    bucket = (Uint32)entry->timerID & (size - 1);
+                    entry->map_next = timermap[bucket];
+                    timermap[bucket] = entry;
+                }
+            }
+            SDL_free(data->timermap);
+            data->timermap = timermap;
+            data->timermap_size = size;
+        }
+    }
+
+    if (data->timermap_size) {
+        bucket = (Uint32)timer->timerID & (data->timermap_size - 1);
+        timer->map_next = data->timermap[bucket];
+        data->timermap[bucket] = timer;
+        ++data->timermap_count;
+    }
+}
+
 SDL_TimerID
 SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    SDL_TimerID id;
 
     if (!data->active) {
         int status = 0;
@@ -320,6 +474,7 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
             SDL_OutOfMemory();
             return 0;
         }
+        SDL_AtomicIncRef(&data->num_timers);
     }
     timer->timerID = SDL_AtomicIncRef(&data->nextID);
     timer->callback = callback;
@@ -327,19 +482,10 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     timer->interval = interval;
     timer->scheduled = SDL_GetTicks() + interval;
     timer->canceled = SDL_FALSE;
-
-    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
-        SDL_free(timer);
-        SDL_OutOfMemory();
-        return 0;
-    }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
+    id = timer->timerID;
 
     SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
+    SDL_MapTimer(data, timer);
     SDL_UnlockMutex(data->timermap_lock);
 
     /* Add the timer to the pending list for the timer thread */
@@ -351,37 +497,42 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     /* Wake up the timer thread if necessary */
     SDL_SemPost(data->sem);
 
-    return entry->timerID;
+    return id;
 }
 
 SDL_bool
 SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_Timer *prev, *timer = NULL;
     SDL_bool canceled = SDL_FALSE;
 
     /* Find the timer */
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
+    if (data->timermap_size) {
+        SDL_Timer **bucket = &data->timermap[(Uint32)id & (data->timermap_size - 1)];
+
+        prev = NULL;
+        for (timer = *bucket; timer; prev = timer, timer = timer->map_next) {
+            if (timer->timerID == id) {
+                if (prev) {
+                    prev->map_next = timer->map_next;
+                } else {
+                    *bucket = timer->map_next;
+                }
+                --data->timermap_count;
+                break;
             }
-            break;
         }
     }
     SDL_UnlockMutex(data->timermap_lock);
 
-    if (entry) {
-        if (!entry->timer->canceled) {
-            entry->timer->canceled = SDL_TRUE;
+    if (timer) {
+        if (!timer->canceled) {
+            timer->canceled = SDL_TRUE;
             canceled = SDL_TRUE;
+            SDL_AtomicIncRef(&data->num_canceled);
         }
-        SDL_free(entry);
     }
     return canceled;
 }
@@ -27,6 +27,10 @@
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 static void SDL_Blit_RGB888_RGB888_Scale(SDL_BlitInfo *info)
 {
     int srcy, srcx;
@@ -7284,131 +7288,4487 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if defined(__SSE2__)
+/* Divide 16-bit lanes in the range [0, 255*255] by 255, exactly like the C code */
+SDL_FORCE_INLINE __m128i
+SDL_BlitDiv255_SSE2(__m128i x)
+{
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE __m128i
+SDL_BlitModulateFactors_SSE2(const SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const int modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+    const int modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+    const int modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+    const int modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+
+    return _mm_unpacklo_epi32(_mm_set1_epi32((modulateG << 16) | modulateB),
+                              _mm_set1_epi32((modulateA << 16) | modulateR));
+}
+
+SDL_FORCE_INLINE __m128i
+SDL_BlitModulate_SSE2(__m128i pixel, __m128i factors)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_unpacklo_epi8(pixel, zero);
+    __m128i hi = _mm_unpackhi_epi8(pixel, zero);
+
+    lo = SDL_BlitDiv255_SSE2(_mm_mullo_epi16(lo, factors));
+    hi = SDL_BlitDiv255_SSE2(_mm_mullo_epi16(hi, factors));
+    return _mm_packus_epi16(lo, hi);
+}
+
+SDL_FORCE_INLINE __m128i
+SDL_BlitBlendChannels_SSE2(__m128i src, __m128i dst, const int mode)
+{
+    const __m128i full = _mm_set1_epi16(255);
+    const __m128i alphamask = _mm_slli_epi64(_mm_set1_epi32(0xFFFF), 48);
+    const __m128i srcA = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i result;
+
+    if (mode & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_BlitDiv255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_andnot_si128(alphamask, srcA), _mm_and_si128(alphamask, full))));
+    }
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        return _mm_add_epi16(src, SDL_BlitDiv255_SSE2(_mm_mullo_epi16(_mm_sub_epi16(full, srcA), dst)));
+    case SDL_COPY_ADD:
+        result = _mm_min_epi16(_mm_add_epi16(src, dst), full);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_BlitDiv255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        return dst;
+    }
+    /* Add and mod leave the destination alpha alone */
+    return _mm_or_si128(_mm_andnot_si128(alphamask, result), _mm_and_si128(alphamask, dst));
+}
+
+SDL_FORCE_INLINE __m128i
+SDL_BlitBlend_SSE2(__m128i src, __m128i dst, const int flags)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const int mode = (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD));
+    __m128i lo, hi;
+
+    lo = SDL_BlitBlendChannels_SSE2(_mm_unpacklo_epi8(src, zero), _mm_unpacklo_epi8(dst, zero), mode);
+    hi = SDL_BlitBlendChannels_SSE2(_mm_unpackhi_epi8(src, zero), _mm_unpackhi_epi8(dst, zero), mode);
+    return _mm_packus_epi16(lo, hi);
+}
+#endif /* defined(__SSE2__) */
+
+#if defined(__AVX2__)
+/* Divide 16-bit lanes in the range [0, 255*255] by 255, exactly like the C code */
+SDL_FORCE_INLINE __m256i
+SDL_BlitDiv255_AVX2(__m256i x)
+{
+    return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(x, _mm256_set1_epi16(1)), _mm256_srli_epi16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE __m256i
+SDL_BlitModulateFactors_AVX2(const SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const int modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+    const int modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+    const int modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+    const int modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+
+    return _mm256_unpacklo_epi32(_mm256_set1_epi32((modulateG << 16) | modulateB),
+                              _mm256_set1_epi32((modulateA << 16) | modulateR));
+}
+
+SDL_FORCE_INLINE __m256i
+SDL_BlitModulate_AVX2(__m256i pixel, __m256i factors)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i lo = _mm256_unpacklo_epi8(pixel, zero);
+    __m256i hi = _mm256_unpackhi_epi8(pixel, zero);
+
+    lo = SDL_BlitDiv255_AVX2(_mm256_mullo_epi16(lo, factors));
+    hi = SDL_BlitDiv255_AVX2(_mm256_mullo_epi16(hi, factors));
+    return _mm256_packus_epi16(lo, hi);
+}
+
+SDL_FORCE_INLINE __m256i
+SDL_BlitBlendChannels_AVX2(__m256i src, __m256i dst, const int mode)
+{
+    const __m256i full = _mm256_set1_epi16(255);
+    const __m256i alphamask = _mm256_slli_epi64(_mm256_set1_epi32(0xFFFF), 48);
+    const __m256i srcA = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m256i result;
+
+    if (mode & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_BlitDiv255_AVX2(_mm256_mullo_epi16(src, _mm256_or_si256(_mm256_andnot_si256(alphamask, srcA), _mm256_and_si256(alphamask, full))));
+    }
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        return _mm256_add_epi16(src, SDL_BlitDiv255_AVX2(_mm256_mullo_epi16(_mm256_sub_epi16(full, srcA), dst)));
+    case SDL_COPY_ADD:
+        result = _mm256_min_epi16(_mm256_add_epi16(src, dst), full);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_BlitDiv255_AVX2(_mm256_mullo_epi16(src, dst));
+        break;
+    default:
+        return dst;
+    }
+    /* Add and mod leave the destination alpha alone */
+    return _mm256_or_si256(_mm256_andnot_si256(alphamask, result), _mm256_and_si256(alphamask, dst));
+}
+
+SDL_FORCE_INLINE __m256i
+SDL_BlitBlend_AVX2(__m256i src, __m256i dst, const int flags)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const int mode = (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD));
+    __m256i lo, hi;
+
+    lo = SDL_BlitBlendChannels_AVX2(_mm256_unpacklo_epi8(src, zero), _mm256_unpacklo_epi8(dst, zero), mode);
+    hi = SDL_BlitBlendChannels_AVX2(_mm256_unpackhi_epi8(src, zero), _mm256_unpackhi_epi8(dst, zero), mode);
+    return _mm256_packus_epi16(lo, hi);
+}
+#endif /* defined(__AVX2__) */
+
+#if defined(__AVX2__)
+
+static void SDL_Blit_RGB888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_slli_epi32(srcpixel, 24));
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_slli_epi32(srcpixel, 24));
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_slli_epi32(srcpixel, 24));
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_slli_epi32(srcpixel, 24));
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_slli_epi32(srcpixel, 24));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0xFF00FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0xFF00FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0xFF00FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0xFF00FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0xFF00FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0xFF00FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0xFF00FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0xFF00FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(srcpixel, _mm256_set1_epi32((int)0xFF00FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(srcpixel, 24), _mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FF0000))), _mm256_slli_epi32(srcpixel, 24));
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(srcpixel, 24), _mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FF0000))), _mm256_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(srcpixel, 24), _mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FF0000))), _mm256_slli_epi32(srcpixel, 24));
+            dstpixel = _mm256_or_si256(_mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF)), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x00FFFFFF));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(srcpixel, 24), _mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FF0000))), _mm256_slli_epi32(srcpixel, 24));
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(srcpixel, 24), _mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FF0000))), _mm256_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(srcpixel, 24), _mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FF0000))), _mm256_slli_epi32(srcpixel, 24));
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000))), _mm256_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x000000FF)), _mm256_and_si256(dstpixel, _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(dstpixel, 16), _mm256_set1_epi32((int)0x00FF0000)));
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(srcpixel, 24), _mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FF0000))), _mm256_slli_epi32(srcpixel, 24));
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel;
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(srcpixel, 24), _mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FF0000))), _mm256_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = srcpixel;
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulate_AVX2 = SDL_BlitModulateFactors_AVX2(info);
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 8) {
+            __m256i srcpixel = _mm256_loadu_si256((const __m256i *)src);
+            __m256i dstpixel = _mm256_loadu_si256((const __m256i *)dst);
+            srcpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_srli_epi32(srcpixel, 24), _mm256_and_si256(_mm256_srli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x0000FF00))), _mm256_and_si256(_mm256_slli_epi32(srcpixel, 8), _mm256_set1_epi32((int)0x00FF0000))), _mm256_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_AVX2(srcpixel, modulate_AVX2);
+            dstpixel = SDL_BlitBlend_AVX2(srcpixel, dstpixel, flags);
+            _mm256_storeu_si256((__m256i *)dst, dstpixel);
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif /* defined(__AVX2__) */
+
+#if defined(__SSE2__)
+
+static void SDL_Blit_RGB888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(srcpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FFFFFF)), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(srcpixel, _mm_set1_epi32((int)0xFF00FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF)), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x00FFFFFF));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000))), _mm_set1_epi32((int)0xFF000000));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x000000FF)), _mm_and_si128(dstpixel, _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(dstpixel, 16), _mm_set1_epi32((int)0x00FF0000)));
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel;
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = srcpixel;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulate_SSE2 = SDL_BlitModulateFactors_SSE2(info);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            __m128i srcpixel = _mm_loadu_si128((const __m128i *)src);
+            __m128i dstpixel = _mm_loadu_si128((const __m128i *)dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            _mm_storeu_si128((__m128i *)dst, dstpixel);
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            __m128i srcpixel = _mm_cvtsi32_si128(*src);
+            __m128i dstpixel = _mm_cvtsi32_si128(*dst);
+            srcpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_srli_epi32(srcpixel, 24), _mm_and_si128(_mm_srli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x0000FF00))), _mm_and_si128(_mm_slli_epi32(srcpixel, 8), _mm_set1_epi32((int)0x00FF0000))), _mm_slli_epi32(srcpixel, 24));
+            srcpixel = SDL_BlitModulate_SSE2(srcpixel, modulate_SSE2);
+            dstpixel = SDL_BlitBlend_SSE2(srcpixel, dstpixel, flags);
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif /* defined(__SSE2__) */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale },
+#if defined(__AVX2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if defined(__SSE2__)
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
     { 0, 0, 0, 0, NULL }
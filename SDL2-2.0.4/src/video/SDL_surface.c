@@ -87,7 +87,7 @@ SDL_CreateRGBSurface(Uint32 flags,
 
     /* Get the pixels */
     if (surface->w && surface->h) {
-        surface->pixels = SDL_malloc(surface->h * surface->pitch);
+        surface->pixels = SDL_TaggedMalloc(SDL_MEMTAG_SURFACE, surface->h * surface->pitch);
         if (!surface->pixels) {
             SDL_FreeSurface(surface);
             SDL_OutOfMemory();
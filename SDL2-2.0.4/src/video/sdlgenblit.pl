@@ -85,6 +85,41 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = ((Uint32)_B << 24) | ((Uint32)_G << 16) | ((Uint32)_R << 8) | _A;",
 );
 
+# Where each channel lives in the pixel, used to build the SIMD swizzles
+my %format_shift = (
+    "RGB888" => { "R" => 16, "G" => 8, "B" => 0 },
+    "BGR888" => { "B" => 16, "G" => 8, "R" => 0 },
+    "ARGB8888" => { "A" => 24, "R" => 16, "G" => 8, "B" => 0 },
+    "RGBA8888" => { "R" => 24, "G" => 16, "B" => 8, "A" => 0 },
+    "ABGR8888" => { "A" => 24, "B" => 16, "G" => 8, "R" => 0 },
+    "BGRA8888" => { "B" => 24, "G" => 16, "R" => 8, "A" => 0 },
+);
+
+# The SIMD kernels work on pixels swizzled into this layout
+my $simd_format = "ARGB8888";
+
+# The SIMD instruction sets we generate blend and modulate kernels for
+my @simd_sets = (
+    {
+        "name" => "AVX2",
+        "cpu" => "SDL_CPU_AVX2",
+        "guard" => "defined(__AVX2__)",
+        "mm" => "_mm256",
+        "vec" => "__m256i",
+        "si" => "si256",
+        "pixels" => 8,
+    },
+    {
+        "name" => "SSE2",
+        "cpu" => "SDL_CPU_SSE2",
+        "guard" => "defined(__SSE2__)",
+        "mm" => "_mm",
+        "vec" => "__m128i",
+        "si" => "si128",
+        "pixels" => 4,
+    },
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -426,6 +461,255 @@ __EOF__
 __EOF__
 }
 
+sub simd_swizzle
+{
+    my $simd = shift;
+    my $pixel = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $mm = $simd->{"mm"};
+    my $si = $simd->{"si"};
+    my $from = $format_shift{$src};
+    my $to = $format_shift{$dst};
+    my %masks;
+    my @terms;
+
+    foreach my $c ("A", "R", "G", "B") {
+        if ( defined($from->{$c}) && defined($to->{$c}) ) {
+            my $delta = $to->{$c} - $from->{$c};
+            $masks{$delta} = ($masks{$delta} || 0) | (0xFF << $to->{$c});
+        }
+    }
+    foreach my $delta (sort { $a <=> $b } keys %masks) {
+        my $term;
+        my $need_mask = 1;
+        if ( $delta > 0 ) {
+            $term = "${mm}_slli_epi32($pixel, $delta)";
+            $need_mask = ($delta != 24);
+        } elsif ( $delta < 0 ) {
+            $term = "${mm}_srli_epi32($pixel, " . (-$delta) . ")";
+            $need_mask = ($delta != -24);
+        } else {
+            $term = $pixel;
+            $need_mask = ($masks{$delta} != 0xFFFFFFFF);
+        }
+        if ( $need_mask ) {
+            $term = sprintf("${mm}_and_${si}($term, ${mm}_set1_epi32((int)0x%08X))", $masks{$delta});
+        }
+        push(@terms, $term);
+    }
+    if ( defined($to->{"A"}) && !defined($from->{"A"}) ) {
+        push(@terms, sprintf("${mm}_set1_epi32((int)0x%08X)", 0xFF << $to->{"A"}));
+    }
+
+    my $string = shift(@terms);
+    foreach my $term (@terms) {
+        $string = "${mm}_or_${si}($string, $term)";
+    }
+    return $string;
+}
+
+sub output_simd_helpers
+{
+    my $simd = shift;
+    my $name = $simd->{"name"};
+    my $guard = $simd->{"guard"};
+    my $mm = $simd->{"mm"};
+    my $vec = $simd->{"vec"};
+    my $si = $simd->{"si"};
+
+    print FILE <<__EOF__;
+#if $guard
+/* Divide 16-bit lanes in the range [0, 255*255] by 255, exactly like the C code */
+SDL_FORCE_INLINE $vec
+SDL_BlitDiv255_$name($vec x)
+{
+    return ${mm}_srli_epi16(${mm}_add_epi16(${mm}_add_epi16(x, ${mm}_set1_epi16(1)), ${mm}_srli_epi16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE $vec
+SDL_BlitModulateFactors_$name(const SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const int modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+    const int modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+    const int modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+    const int modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+
+    return ${mm}_unpacklo_epi32(${mm}_set1_epi32((modulateG << 16) | modulateB),
+                              ${mm}_set1_epi32((modulateA << 16) | modulateR));
+}
+
+SDL_FORCE_INLINE $vec
+SDL_BlitModulate_$name($vec pixel, $vec factors)
+{
+    const $vec zero = ${mm}_setzero_${si}();
+    $vec lo = ${mm}_unpacklo_epi8(pixel, zero);
+    $vec hi = ${mm}_unpackhi_epi8(pixel, zero);
+
+    lo = SDL_BlitDiv255_$name(${mm}_mullo_epi16(lo, factors));
+    hi = SDL_BlitDiv255_$name(${mm}_mullo_epi16(hi, factors));
+    return ${mm}_packus_epi16(lo, hi);
+}
+
+SDL_FORCE_INLINE $vec
+SDL_BlitBlendChannels_$name($vec src, $vec dst, const int mode)
+{
+    const $vec full = ${mm}_set1_epi16(255);
+    const $vec alphamask = ${mm}_slli_epi64(${mm}_set1_epi32(0xFFFF), 48);
+    const $vec srcA = ${mm}_shufflehi_epi16(${mm}_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    $vec result;
+
+    if (mode & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_BlitDiv255_$name(${mm}_mullo_epi16(src, ${mm}_or_${si}(${mm}_andnot_${si}(alphamask, srcA), ${mm}_and_${si}(alphamask, full))));
+    }
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        return ${mm}_add_epi16(src, SDL_BlitDiv255_$name(${mm}_mullo_epi16(${mm}_sub_epi16(full, srcA), dst)));
+    case SDL_COPY_ADD:
+        result = ${mm}_min_epi16(${mm}_add_epi16(src, dst), full);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_BlitDiv255_$name(${mm}_mullo_epi16(src, dst));
+        break;
+    default:
+        return dst;
+    }
+    /* Add and mod leave the destination alpha alone */
+    return ${mm}_or_${si}(${mm}_andnot_${si}(alphamask, result), ${mm}_and_${si}(alphamask, dst));
+}
+
+SDL_FORCE_INLINE $vec
+SDL_BlitBlend_$name($vec src, $vec dst, const int flags)
+{
+    const $vec zero = ${mm}_setzero_${si}();
+    const int mode = (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD));
+    $vec lo, hi;
+
+    lo = SDL_BlitBlendChannels_$name(${mm}_unpacklo_epi8(src, zero), ${mm}_unpacklo_epi8(dst, zero), mode);
+    hi = SDL_BlitBlendChannels_$name(${mm}_unpackhi_epi8(src, zero), ${mm}_unpackhi_epi8(dst, zero), mode);
+    return ${mm}_packus_epi16(lo, hi);
+}
+#endif /* $guard */
+
+__EOF__
+}
+
+sub output_simd_copycore
+{
+    my $simd = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $indent = "            ";
+    my $name = $simd->{"name"};
+
+    if ( $src ne $simd_format ) {
+        print FILE "${indent}srcpixel = " . simd_swizzle($simd, "srcpixel", $src, $simd_format) . ";\n";
+    }
+    if ( $blend && $dst ne $simd_format ) {
+        print FILE "${indent}dstpixel = " . simd_swizzle($simd, "dstpixel", $dst, $simd_format) . ";\n";
+    }
+    if ( $modulate ) {
+        print FILE "${indent}srcpixel = SDL_BlitModulate_$name(srcpixel, modulate_$name);\n";
+    }
+    if ( $blend ) {
+        print FILE "${indent}dstpixel = SDL_BlitBlend_$name(srcpixel, dstpixel, flags);\n";
+    } else {
+        print FILE "${indent}dstpixel = srcpixel;\n";
+    }
+    if ( $dst ne $simd_format ) {
+        print FILE "${indent}dstpixel = " . simd_swizzle($simd, "dstpixel", $simd_format, $dst) . ";\n";
+    }
+}
+
+sub output_simd_copyfunc
+{
+    my $simd = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $name = $simd->{"name"};
+    my $mm = $simd->{"mm"};
+    my $vec = $simd->{"vec"};
+    my $si = $simd->{"si"};
+    my $pixels = $simd->{"pixels"};
+    my $tail = $simd_sets[$#simd_sets];
+    my $tail_name = $tail->{"name"};
+
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, 0, 0, "_$name(SDL_BlitInfo *info)\n");
+    print FILE <<__EOF__;
+{
+__EOF__
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    const int flags = info->flags;
+__EOF__
+    }
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    const $vec modulate_$name = SDL_BlitModulateFactors_$name(info);
+__EOF__
+        if ( $tail_name ne $name ) {
+            print FILE <<__EOF__;
+    const $tail->{"vec"} modulate_$tail_name = SDL_BlitModulateFactors_$tail_name(info);
+__EOF__
+        }
+    }
+    print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        $format_type{$src} *src = ($format_type{$src} *)info->src;
+        $format_type{$dst} *dst = ($format_type{$dst} *)info->dst;
+        int n = info->dst_w;
+        while (n >= $pixels) {
+            $vec srcpixel = ${mm}_loadu_${si}((const $vec *)src);
+__EOF__
+    if ( $blend ) {
+        print FILE <<__EOF__;
+            $vec dstpixel = ${mm}_loadu_${si}((const $vec *)dst);
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+            $vec dstpixel;
+__EOF__
+    }
+    output_simd_copycore($simd, $src, $dst, $modulate, $blend);
+    print FILE <<__EOF__;
+            ${mm}_storeu_${si}(($vec *)dst, dstpixel);
+            src += $pixels;
+            dst += $pixels;
+            n -= $pixels;
+        }
+        while (n--) {
+            $tail->{"vec"} srcpixel = _mm_cvtsi32_si128(*src);
+__EOF__
+    if ( $blend ) {
+        print FILE <<__EOF__;
+            $tail->{"vec"} dstpixel = _mm_cvtsi32_si128(*dst);
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+            $tail->{"vec"} dstpixel;
+__EOF__
+    }
+    output_simd_copycore($tail, $src, $dst, $modulate, $blend);
+    print FILE <<__EOF__;
+            *dst = _mm_cvtsi128_si32(dstpixel);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+}
+
 sub output_copyfunc_h
 {
 }
@@ -437,6 +721,10 @@ sub output_copyinc
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 __EOF__
 }
 
@@ -452,6 +740,24 @@ __EOF__
             for (my $modulate = 0; $modulate <= 1; ++$modulate) {
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
+                        if ( ($modulate || $blend) && !$scale ) {
+                            foreach my $simd (@simd_sets) {
+                                my $flags = "";
+                                if ( $modulate ) {
+                                    $flags = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
+                                }
+                                if ( $blend ) {
+                                    if ( $flags ne "" ) {
+                                        $flags = "$flags | ";
+                                    }
+                                    $flags = "${flags}SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD";
+                                }
+                                print FILE "#if $simd->{\"guard\"}\n";
+                                print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), $simd->{\"cpu\"},";
+                                output_copyfuncname("", $src, $dst, $modulate, $blend, 0, 0, "_$simd->{\"name\"} },\n");
+                                print FILE "#endif\n";
+                            }
+                        }
                         if ( $modulate || $blend || $scale ) {
                             print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
@@ -514,6 +820,21 @@ sub output_copyfunc_c
     }
 }
 
+sub output_simd_copyfunc_c
+{
+    my $simd = shift;
+    my $src = shift;
+    my $dst = shift;
+
+    for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+        for (my $blend = 0; $blend <= 1; ++$blend) {
+            if ( $modulate || $blend ) {
+                output_simd_copyfunc($simd, $src, $dst, $modulate, $blend);
+            }
+        }
+    }
+}
+
 open_file("SDL_blit_auto.h");
 output_copydefs();
 for (my $i = 0; $i <= $#src_formats; ++$i) {
@@ -531,5 +852,17 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+foreach my $simd (reverse(@simd_sets)) {
+    output_simd_helpers($simd);
+}
+foreach my $simd (@simd_sets) {
+    print FILE "#if $simd->{\"guard\"}\n\n";
+    for (my $i = 0; $i <= $#src_formats; ++$i) {
+        for (my $j = 0; $j <= $#dst_formats; ++$j) {
+            output_simd_copyfunc_c($simd, $src_formats[$i], $dst_formats[$j]);
+        }
+    }
+    print FILE "#endif /* $simd->{\"guard\"} */\n\n";
+}
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
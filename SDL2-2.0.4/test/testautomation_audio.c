@@ -907,6 +907,312 @@ int audio_convertAudio()
 }
 
 
+/**
+ * \brief Resamples a sine wave and checks the length and quality of the result.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_resampleSine()
+{
+  const int rates[][2] = { { 44100, 48000 }, { 48000, 44100 }, { 22050, 48000 }, { 48000, 8000 } };
+  const double frequency = 440.0;
+  const double pi = 3.14159265358979323846;
+  SDL_AudioCVT cvt;
+  int i, j, result;
+
+  for (i = 0; i < SDL_arraysize(rates); i++) {
+    const int src_rate = rates[i][0];
+    const int dst_rate = rates[i][1];
+    const int src_frames = src_rate / 4;
+    const int expected = (int) (((Sint64) src_frames * dst_rate + src_rate - 1) / src_rate);
+    const int margin = dst_rate / 100;
+    double signal = 0.0, noise = 0.0, snr;
+    float *samples;
+    int dst_frames;
+
+    result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, 1, src_rate, AUDIO_F32SYS, 1, dst_rate);
+    SDLTest_AssertPass("Call to SDL_BuildAudioCVT(AUDIO_F32SYS,1,%i ==> AUDIO_F32SYS,1,%i)", src_rate, dst_rate);
+    SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+    if (result != 1) {
+      SDLTest_LogError("%s", SDL_GetError());
+      return TEST_ABORTED;
+    }
+
+    /* Everything after the filters is NULL, applications may walk the list */
+    for (j = cvt.filter_index; j < SDL_arraysize(cvt.filters); j++) {
+      SDLTest_AssertCheck(cvt.filters[j] == NULL, "Verify filters[%i] is NULL after %i filters", j, cvt.filter_index);
+    }
+
+    cvt.len = src_frames * sizeof (float);
+    cvt.buf = (Uint8 *)SDL_malloc(cvt.len * cvt.len_mult);
+    SDLTest_AssertCheck(cvt.buf != NULL, "Check data buffer to convert is not NULL");
+    if (cvt.buf == NULL) return TEST_ABORTED;
+
+    samples = (float *)cvt.buf;
+    for (j = 0; j < src_frames; j++) {
+      samples[j] = (float) SDL_sin(2.0 * pi * frequency * j / src_rate) * 0.5f;
+    }
+
+    result = SDL_ConvertAudio(&cvt);
+    SDLTest_AssertPass("Call to SDL_ConvertAudio()");
+    SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+
+    dst_frames = cvt.len_cvt / sizeof (float);
+    SDLTest_AssertCheck(dst_frames == expected, "Verify converted length; expected: %i; got: %i", expected, dst_frames);
+
+    /* Skip the edges, where the input is extended by repeating the end frames */
+    samples = (float *)cvt.buf;
+    for (j = margin; j < dst_frames - margin; j++) {
+      const double target = SDL_sin(2.0 * pi * frequency * j / dst_rate) * 0.5;
+      const double error = samples[j] - target;
+      signal += target * target;
+      noise += error * error;
+    }
+    snr = (noise > 0.0) ? 10.0 * SDL_log(signal / noise) / SDL_log(10.0) : 999.0;
+    SDLTest_AssertCheck(snr > 60.0, "Verify signal to noise ratio %i ==> %i; expected: >60 dB; got: %f dB", src_rate, dst_rate, snr);
+
+    SDL_free(cvt.buf);
+    cvt.buf = NULL;
+  }
+
+  return TEST_COMPLETED;
+}
+
+
+/**
+ * \brief Feeds audio streams in uneven pieces and checks the output against one-shot conversion.
+ *
+ * \sa https://wiki.libsdl.org/SDL_NewAudioStream
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamPut
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamGet
+ */
+int audio_audioStream()
+{
+  const int frames = 20000;
+  SDL_AudioStream *stream;
+  SDL_AudioCVT cvt;
+  Sint16 *input;
+  Uint8 *output;
+  int i, result, offset, received, expected;
+
+  input = (Sint16 *)SDL_malloc(frames * 2 * sizeof (Sint16));
+  output = (Uint8 *)SDL_malloc(frames * 2 * 2 * sizeof (float));
+  SDLTest_AssertCheck(input != NULL && output != NULL, "Check test buffers are not NULL");
+  if (input == NULL || output == NULL) return TEST_ABORTED;
+  for (i = 0; i < frames * 2; i++) {
+    input[i] = (Sint16) SDLTest_RandomIntegerInRange(-32768, 32767);
+  }
+
+  /* Format and channel conversion only: must match SDL_ConvertAudio() exactly */
+  result = SDL_BuildAudioCVT(&cvt, AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 1, 44100);
+  SDLTest_AssertCheck(result == 1, "Verify result value of SDL_BuildAudioCVT(); expected: 1, got: %i", result);
+  cvt.len = frames * 2 * sizeof (Sint16);
+  cvt.buf = (Uint8 *)SDL_malloc(cvt.len * cvt.len_mult);
+  SDLTest_AssertCheck(cvt.buf != NULL, "Check data buffer to convert is not NULL");
+  if (cvt.buf == NULL) return TEST_ABORTED;
+  SDL_memcpy(cvt.buf, input, cvt.len);
+  SDL_ConvertAudio(&cvt);
+
+  stream = SDL_NewAudioStream(AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 1, 44100);
+  SDLTest_AssertPass("Call to SDL_NewAudioStream(AUDIO_S16SYS,2,44100 ==> AUDIO_F32SYS,1,44100)");
+  SDLTest_AssertCheck(stream != NULL, "Verify stream is not NULL");
+  if (stream == NULL) return TEST_ABORTED;
+
+  result = SDL_AudioStreamPut(stream, input, 3);
+  SDLTest_AssertCheck(result == -1, "Verify partial sample frame is rejected; expected: -1, got: %i", result);
+
+  offset = 0;
+  received = 0;
+  while (offset < frames) {
+    int count = SDLTest_RandomIntegerInRange(1, 5000);
+    count = SDL_min(count, frames - offset);
+    result = SDL_AudioStreamPut(stream, input + offset * 2, count * 2 * sizeof (Sint16));
+    if (result != 0) break;
+    offset += count;
+    received += SDL_AudioStreamGet(stream, output + received, SDLTest_RandomIntegerInRange(1, 10000));
+  }
+  SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamPut() result; expected: 0, got: %i", result);
+  SDLTest_AssertCheck(SDL_AudioStreamFlush(stream) == 0, "Verify SDL_AudioStreamFlush() result");
+  received += SDL_AudioStreamGet(stream, output + received, frames * 2 * 2 * sizeof (float) - received);
+  SDLTest_AssertCheck(received == cvt.len_cvt, "Verify converted length; expected: %i, got: %i", cvt.len_cvt, received);
+  SDLTest_AssertCheck(SDL_memcmp(output, cvt.buf, SDL_min(received, cvt.len_cvt)) == 0, "Verify converted data matches SDL_ConvertAudio()");
+  SDL_FreeAudioStream(stream);
+  SDL_free(cvt.buf);
+
+  /* Resampling: the output length must match the rate ratio exactly */
+  stream = SDL_NewAudioStream(AUDIO_S16SYS, 2, 44100, AUDIO_S16SYS, 2, 48000);
+  SDLTest_AssertPass("Call to SDL_NewAudioStream(AUDIO_S16SYS,2,44100 ==> AUDIO_S16SYS,2,48000)");
+  SDLTest_AssertCheck(stream != NULL, "Verify stream is not NULL");
+  if (stream == NULL) return TEST_ABORTED;
+
+  offset = 0;
+  received = 0;
+  while (offset < frames) {
+    int count = SDLTest_RandomIntegerInRange(1, 5000);
+    count = SDL_min(count, frames - offset);
+    result = SDL_AudioStreamPut(stream, input + offset * 2, count * 2 * sizeof (Sint16));
+    if (result != 0) break;
+    offset += count;
+    received += SDL_AudioStreamGet(stream, output + received, SDLTest_RandomIntegerInRange(1, 10000));
+  }
+  SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamPut() result; expected: 0, got: %i", result);
+  SDLTest_AssertCheck(SDL_AudioStreamFlush(stream) == 0, "Verify SDL_AudioStreamFlush() result");
+  received += SDL_AudioStreamGet(stream, output + received, frames * 2 * 2 * sizeof (float) - received);
+  expected = (int) (((Sint64) frames * 48000 + 44099) / 44100) * 2 * sizeof (Sint16);
+  SDLTest_AssertCheck(received == expected, "Verify resampled length; expected: %i, got: %i", expected, received);
+  SDLTest_AssertCheck(SDL_AudioStreamAvailable(stream) == 0, "Verify stream is empty; got: %i", SDL_AudioStreamAvailable(stream));
+
+  /* Clearing drops everything pending */
+  SDL_AudioStreamPut(stream, input, frames * 2 * sizeof (Sint16));
+  SDL_AudioStreamClear(stream);
+  SDLTest_AssertCheck(SDL_AudioStreamAvailable(stream) == 0, "Verify stream is empty after SDL_AudioStreamClear(); got: %i", SDL_AudioStreamAvailable(stream));
+  SDL_FreeAudioStream(stream);
+
+  SDL_free(output);
+  SDL_free(input);
+  return TEST_COMPLETED;
+}
+
+
+/* Reads and writes one sample of 'size' bytes in the given byte order */
+static Uint32 _audioGetSample(const Uint8 *p, int size, int bigendian)
+{
+  Uint32 value = 0;
+  int i;
+  for (i = 0; i < size; i++) {
+    value |= ((Uint32) p[bigendian ? (size - 1 - i) : i]) << (8 * i);
+  }
+  return value;
+}
+
+static void _audioPutSample(Uint8 *p, Uint32 value, int size, int bigendian)
+{
+  int i;
+  for (i = 0; i < size; i++) {
+    p[bigendian ? (size - 1 - i) : i] = (Uint8) (value >> (8 * i));
+  }
+}
+
+/* Reference mixer for volumes 0-128, following the C code in SDL_mixer.c.
+   Float intermediates are stored to volatiles so they're rounded like the
+   code is written, even where the compiler keeps floats in wider registers. */
+static void _audioReferenceMix(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, int samples, int volume)
+{
+  const int size = SDL_AUDIO_BITSIZE(format) / 8;
+  const int bigendian = SDL_AUDIO_ISBIGENDIAN(format);
+  int i;
+
+  for (i = 0; i < samples; i++, dst += size, src += size) {
+    if (SDL_AUDIO_ISFLOAT(format)) {
+      Uint32 a = _audioGetSample(src, 4, bigendian);
+      Uint32 b = _audioGetSample(dst, 4, bigendian);
+      float fa, fb, result;
+      volatile float adjusted;
+      volatile double sum;
+      SDL_memcpy(&fa, &a, 4);
+      SDL_memcpy(&fb, &b, 4);
+      adjusted = fa * (float) volume;
+      adjusted = adjusted * (1.0f / ((float) SDL_MIX_MAXVOLUME));
+      sum = ((double) adjusted) + ((double) fb);
+      if (sum > 3.402823466e+38F) {
+        sum = 3.402823466e+38F;
+      } else if (sum < -3.402823466e+38F) {
+        sum = -3.402823466e+38F;
+      }
+      result = (float) sum;
+      SDL_memcpy(&a, &result, 4);
+      _audioPutSample(dst, a, 4, bigendian);
+    } else {
+      const Sint64 maxval = (size == 2) ? 32767 : 2147483647;
+      Sint64 a, b;
+      if (size == 2) {
+        a = (Sint16) _audioGetSample(src, 2, bigendian);
+        b = (Sint16) _audioGetSample(dst, 2, bigendian);
+      } else {
+        a = (Sint32) _audioGetSample(src, 4, bigendian);
+        b = (Sint32) _audioGetSample(dst, 4, bigendian);
+      }
+      a = (a * volume) / SDL_MIX_MAXVOLUME;
+      if (a < -maxval) a = -maxval;
+      a += b;
+      if (a > maxval) a = maxval;
+      if (a < -maxval - 1) a = -maxval - 1;
+      _audioPutSample(dst, (Uint32) a, size, bigendian);
+    }
+  }
+}
+
+/**
+ * \brief Mixes 16-bit, 32-bit and float audio and checks the result is bit-exact.
+ *
+ * \sa https://wiki.libsdl.org/SDL_MixAudioFormat
+ */
+int audio_mixAudioFormat()
+{
+  const SDL_AudioFormat formats[] = { AUDIO_S16LSB, AUDIO_S16MSB, AUDIO_S32LSB, AUDIO_S32MSB, AUDIO_F32LSB, AUDIO_F32MSB };
+  const int volumes[] = { 1, 5, 37, 64, 100, 127, SDL_MIX_MAXVOLUME };
+  const int maxsamples = 1031;
+  Uint8 *src, *dst, *expected;
+  int i, j, k, pass;
+
+  src = (Uint8 *)SDL_malloc(maxsamples * 4);
+  dst = (Uint8 *)SDL_malloc(maxsamples * 4);
+  expected = (Uint8 *)SDL_malloc(maxsamples * 4);
+  SDLTest_AssertCheck(src != NULL && dst != NULL && expected != NULL, "Check test buffers are not NULL");
+  if (src == NULL || dst == NULL || expected == NULL) return TEST_ABORTED;
+
+  for (i = 0; i < SDL_arraysize(formats); i++) {
+    const int size = SDL_AUDIO_BITSIZE(formats[i]) / 8;
+    for (j = 0; j < SDL_arraysize(volumes); j++) {
+      int mismatches = 0;
+      for (pass = 0; pass < 4; pass++) {
+        /* Odd lengths exercise the end of the buffer */
+        const int samples = maxsamples - SDLTest_RandomIntegerInRange(0, 40);
+        for (k = 0; k < maxsamples * 4; k++) {
+          src[k] = SDLTest_RandomUint8();
+          dst[k] = SDLTest_RandomUint8();
+        }
+        if (SDL_AUDIO_ISFLOAT(formats[i])) {
+          /* Mostly normal samples, then samples that overflow the float range */
+          for (k = 0; k < samples; k++) {
+            float a = SDLTest_RandomFloat() * 4.0f - 2.0f;
+            float b = SDLTest_RandomFloat() * 4.0f - 2.0f;
+            Uint32 ua, ub;
+            if (pass == 3) {
+              a *= 3.0e38f;
+              b *= 3.0e38f;
+            }
+            SDL_memcpy(&ua, &a, 4);
+            SDL_memcpy(&ub, &b, 4);
+            _audioPutSample(src + k * 4, ua, 4, SDL_AUDIO_ISBIGENDIAN(formats[i]));
+            _audioPutSample(dst + k * 4, ub, 4, SDL_AUDIO_ISBIGENDIAN(formats[i]));
+          }
+        } else if (pass == 3) {
+          /* Full scale samples, to check clamping */
+          for (k = 0; k < samples * size; k++) {
+            src[k] = (SDLTest_RandomUint8() & 1) ? 0x80 : 0x7F;
+            dst[k] = (SDLTest_RandomUint8() & 1) ? 0x80 : 0x7F;
+          }
+        }
+        SDL_memcpy(expected, dst, maxsamples * 4);
+        _audioReferenceMix(expected, src, formats[i], samples, volumes[j]);
+        SDL_MixAudioFormat(dst, src, formats[i], samples * size, volumes[j]);
+        if (SDL_memcmp(expected, dst, maxsamples * 4) != 0) {
+          mismatches++;
+        }
+      }
+      SDLTest_AssertCheck(mismatches == 0, "Verify SDL_MixAudioFormat(format=0x%04x, volume=%i) is bit-exact; got %i mismatching buffers", formats[i], volumes[j], mismatches);
+    }
+  }
+
+  SDL_free(expected);
+  SDL_free(dst);
+  SDL_free(src);
+  return TEST_COMPLETED;
+}
+
+
 /**
  * \brief Opens, checks current connected status, and closes a device.
  *
@@ -1022,11 +1328,20 @@ static const SDLTest_TestCaseReference audioTest14 =
 static const SDLTest_TestCaseReference audioTest15 =
         { (SDLTest_TestCaseFp)audio_pauseUnpauseAudio, "audio_pauseUnpauseAudio", "Pause and Unpause audio for various audio specs while testing callback.", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference audioTest16 =
+        { (SDLTest_TestCaseFp)audio_resampleSine, "audio_resampleSine", "Resample a sine wave and check the converted length and signal quality.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest17 =
+        { (SDLTest_TestCaseFp)audio_audioStream, "audio_audioStream", "Convert audio in pieces with SDL_AudioStream and compare with one-shot conversion.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest18 =
+        { (SDLTest_TestCaseFp)audio_mixAudioFormat, "audio_mixAudioFormat", "Mix 16-bit, 32-bit and float audio and compare with a reference mixer.", TEST_ENABLED };
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] =  {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16, &audioTest17, &audioTest18, NULL
 };
 
 /* Audio test suite (global) */
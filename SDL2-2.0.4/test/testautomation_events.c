@@ -175,6 +175,71 @@ events_addDelEventWatchWithUserdata(void *arg)
 }
 
 
+/* Event filter that only lets even user event codes through */
+int _events_evenCodeFilter(void *userdata, SDL_Event *event)
+{
+   if (event->type == SDL_USEREVENT) {
+      return (event->user.code % 2) == 0;
+   }
+   return 1;
+}
+
+/**
+ * @brief Pushes batches of user events through an event filter and checks they come out in order.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PushEvents
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PeepEvents
+ */
+int
+events_pushEvents(void *arg)
+{
+   SDL_Event events[100];
+   SDL_Event event;
+   int i, j, result, total, expected;
+
+   SDL_FlushEvents(SDL_USEREVENT, SDL_USEREVENT);
+   SDL_SetEventFilter(_events_evenCodeFilter, NULL);
+   SDLTest_AssertPass("Call to SDL_SetEventFilter()");
+
+   /* Push more events than the lock-free ring holds */
+   total = 0;
+   for (i = 0; i < 100; ++i) {
+      for (j = 0; j < SDL_arraysize(events); ++j) {
+         SDL_zero(events[j]);
+         events[j].type = SDL_USEREVENT;
+         events[j].user.code = i * SDL_arraysize(events) + j;
+      }
+      result = SDL_PushEvents(events, SDL_arraysize(events));
+      SDLTest_AssertCheck(result == SDL_arraysize(events) / 2, "Check result from SDL_PushEvents, expected: %d, got: %d", (int)SDL_arraysize(events) / 2, result);
+      total += result;
+   }
+   SDLTest_AssertCheck(SDL_HasEvent(SDL_USEREVENT), "Check that SDL_HasEvent() finds the user events");
+
+   /* Everything must come back in the order it was pushed */
+   expected = 0;
+   while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_USEREVENT, SDL_USEREVENT) == 1) {
+      if (event.user.code != expected) {
+         break;
+      }
+      expected += 2;
+   }
+   SDLTest_AssertCheck(expected == total * 2, "Check user events were received in order, expected: %d, got: %d", total * 2, expected);
+   SDLTest_AssertCheck(!SDL_HasEvent(SDL_USEREVENT), "Check that the user events were all removed");
+
+   /* A batch that is entirely filtered adds nothing */
+   for (j = 0; j < SDL_arraysize(events); ++j) {
+      events[j].user.code = 2 * j + 1;
+   }
+   result = SDL_PushEvents(events, SDL_arraysize(events));
+   SDLTest_AssertCheck(result == 0, "Check result from SDL_PushEvents, expected: 0, got: %d", result);
+   SDLTest_AssertCheck(!SDL_HasEvent(SDL_USEREVENT), "Check that filtered events were not queued");
+
+   SDL_SetEventFilter(NULL, NULL);
+
+   return TEST_COMPLETED;
+}
+
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -187,9 +252,12 @@ static const SDLTest_TestCaseReference eventsTest2 =
 static const SDLTest_TestCaseReference eventsTest3 =
         { (SDLTest_TestCaseFp)events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference eventsTest4 =
+        { (SDLTest_TestCaseFp)events_pushEvents, "events_pushEvents", "Pushes batches of events through a filter and polls them in order", TEST_ENABLED };
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] =  {
-    &eventsTest1, &eventsTest2, &eventsTest3, NULL
+    &eventsTest1, &eventsTest2, &eventsTest3, &eventsTest4, NULL
 };
 
 /* Events test suite (global) */
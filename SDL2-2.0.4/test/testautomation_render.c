@@ -1023,6 +1023,192 @@ _compare(SDL_Surface *referenceSurface, int allowable_error)
    SDL_FreeSurface(testSurface);
 }
 
+/**
+ * @brief Draws the same scene with and without draw call batching on software renderers and compares the output.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopy
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderFillRect
+ */
+int
+render_testBatching (void *arg)
+{
+   SDL_Surface *targets[2];
+   SDL_Surface *face;
+   int i, j, ret;
+
+   face = SDLTest_ImageFace();
+   SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+   if (face == NULL) return TEST_ABORTED;
+
+   for (i = 0; i < 2; i++) {
+      SDL_Renderer *swrenderer;
+      SDL_Texture *tface;
+      SDL_Rect rect;
+
+      SDL_SetHint(SDL_HINT_RENDER_BATCHING, i ? "1" : "0");
+      targets[i] = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+                                        RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+      SDLTest_AssertCheck(targets[i] != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+      if (targets[i] == NULL) return TEST_ABORTED;
+
+      swrenderer = SDL_CreateSoftwareRenderer(targets[i]);
+      SDLTest_AssertCheck(swrenderer != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+      if (swrenderer == NULL) return TEST_ABORTED;
+      tface = SDL_CreateTextureFromSurface(swrenderer, face);
+      SDLTest_AssertCheck(tface != NULL, "Verify result from SDL_CreateTextureFromSurface is not NULL");
+      if (tface == NULL) return TEST_ABORTED;
+
+      SDL_SetRenderDrawColor(swrenderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+      SDL_RenderClear(swrenderer);
+
+      /* Runs of fills that merge, separated by color changes that must flush */
+      for (j = 0; j < 20; j++) {
+         rect.x = j * 4;
+         rect.y = j * 3;
+         rect.w = 10;
+         rect.h = 10;
+         if ((j % 5) == 0) {
+            SDL_SetRenderDrawColor(swrenderer, (Uint8)(j * 12), 255 - (Uint8)(j * 12), 128, SDL_ALPHA_OPAQUE);
+         }
+         ret = SDL_RenderFillRect(swrenderer, &rect);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+      }
+
+      /* Overlapping copies, with texture state changes in the middle of the run */
+      SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+      for (j = 0; j < 24; j++) {
+         rect.x = (j * 7) % TESTRENDER_SCREEN_W - 20;
+         rect.y = (j * 5) % TESTRENDER_SCREEN_H - 20;
+         rect.w = face->w / 2;
+         rect.h = face->h / 2;
+         if ((j % 8) == 0) {
+            SDL_SetTextureColorMod(tface, (Uint8)(j * 10), 200, 255 - (Uint8)(j * 10));
+         }
+         ret = SDL_RenderCopy(swrenderer, tface, NULL, &rect);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+      }
+      SDL_RenderPresent(swrenderer);
+
+      SDL_DestroyTexture(tface);
+      SDL_DestroyRenderer(swrenderer);
+   }
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, "0");
+
+   /* Batched output must match the immediate output exactly */
+   ret = SDLTest_CompareSurfaces(targets[1], targets[0], ALLOWABLE_ERROR_OPAQUE);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+
+   SDL_FreeSurface(targets[0]);
+   SDL_FreeSurface(targets[1]);
+   SDL_FreeSurface(face);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws the same scene on software renderers using different numbers of worker threads and compares the output.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopy
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderFillRect
+ */
+int
+render_testSoftwareThreads (void *arg)
+{
+   const char *threads[] = { "0", "1", "3", "4" };
+   SDL_Surface *targets[SDL_arraysize(threads)];
+   SDL_Surface *face;
+   int i, j, ret;
+
+   face = SDLTest_ImageFace();
+   SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+   if (face == NULL) return TEST_ABORTED;
+
+   for (i = 0; i < SDL_arraysize(threads); i++) {
+      SDL_Renderer *swrenderer;
+      SDL_Texture *tface;
+      SDL_Rect rect;
+
+      SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, threads[i]);
+      targets[i] = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+                                        RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+      SDLTest_AssertCheck(targets[i] != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+      if (targets[i] == NULL) return TEST_ABORTED;
+
+      swrenderer = SDL_CreateSoftwareRenderer(targets[i]);
+      SDLTest_AssertCheck(swrenderer != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+      if (swrenderer == NULL) return TEST_ABORTED;
+      tface = SDL_CreateTextureFromSurface(swrenderer, face);
+      SDLTest_AssertCheck(tface != NULL, "Verify result from SDL_CreateTextureFromSurface is not NULL");
+      if (tface == NULL) return TEST_ABORTED;
+
+      SDL_SetRenderDrawColor(swrenderer, 30, 60, 90, SDL_ALPHA_OPAQUE);
+      SDL_RenderClear(swrenderer);
+
+      /* Opaque and blended fills straddling the band boundaries */
+      for (j = 0; j < 20; j++) {
+         rect.x = j * 13 - 10;
+         rect.y = j * 11 - 10;
+         rect.w = 40;
+         rect.h = 50;
+         SDL_SetRenderDrawBlendMode(swrenderer, (j & 1) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+         SDL_SetRenderDrawColor(swrenderer, (Uint8)(j * 12), 255 - (Uint8)(j * 12), 128, 100);
+         ret = SDL_RenderFillRect(swrenderer, &rect);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+      }
+
+      /* Lines are drawn on the calling thread and must see the queued fills */
+      SDL_SetRenderDrawColor(swrenderer, 255, 255, 255, SDL_ALPHA_OPAQUE);
+      ret = SDL_RenderDrawLine(swrenderer, 0, 0, TESTRENDER_SCREEN_W - 1, TESTRENDER_SCREEN_H - 1);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderDrawLine, expected: 0, got: %i", ret);
+
+      /* Clipped copies, plus a scaled copy that falls back to the calling thread */
+      SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+      rect.x = 10;
+      rect.y = 20;
+      rect.w = TESTRENDER_SCREEN_W - 40;
+      rect.h = TESTRENDER_SCREEN_H - 60;
+      SDL_RenderSetClipRect(swrenderer, &rect);
+      for (j = 0; j < 24; j++) {
+         rect.x = (j * 37) % TESTRENDER_SCREEN_W - 30;
+         rect.y = (j * 23) % TESTRENDER_SCREEN_H - 30;
+         rect.w = face->w;
+         rect.h = face->h;
+         if ((j % 8) == 0) {
+            SDL_SetTextureColorMod(tface, (Uint8)(j * 10), 200, 255 - (Uint8)(j * 10));
+            SDL_SetTextureAlphaMod(tface, 255 - (Uint8)(j * 4));
+         }
+         if (j == 12) {
+            rect.w *= 2;
+         }
+         ret = SDL_RenderCopy(swrenderer, tface, NULL, &rect);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+      }
+      SDL_RenderSetClipRect(swrenderer, NULL);
+      SDL_RenderPresent(swrenderer);
+
+      SDL_DestroyTexture(tface);
+      SDL_DestroyRenderer(swrenderer);
+   }
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, "0");
+
+   /* Threaded output must match the single threaded output exactly */
+   for (i = 1; i < SDL_arraysize(threads); i++) {
+      ret = SDLTest_CompareSurfaces(targets[i], targets[0], ALLOWABLE_ERROR_OPAQUE);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces with %s threads, expected: 0, got: %i", threads[i], ret);
+   }
+
+   for (i = 0; i < SDL_arraysize(threads); i++) {
+      SDL_FreeSurface(targets[i]);
+   }
+   SDL_FreeSurface(face);
+
+   return TEST_COMPLETED;
+}
+
 /**
  * @brief Clears the screen. Helper function.
  *
@@ -1085,9 +1271,15 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        {  (SDLTest_TestCaseFp)render_testBatching, "render_testBatching", "Tests that batched draw calls match immediate drawing", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest9 =
+        {  (SDLTest_TestCaseFp)render_testSoftwareThreads, "render_testSoftwareThreads", "Tests that threaded software rendering matches single threaded rendering", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, NULL
 };
 
 /* Render test suite (global) */
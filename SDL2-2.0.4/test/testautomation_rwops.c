@@ -699,6 +699,183 @@ rwops_testFileWriteReadEndian(void)
    return TEST_COMPLETED;
 }
 
+/**
+ * @brief Tests reading from a file mapped into memory.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWFromFileMapped
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWGetMemory
+ */
+int
+rwops_testFileMapped(void)
+{
+   SDL_RWops *rw;
+   const void *mem;
+   Sint64 size = -1;
+   int result;
+
+   /* Negative tests */
+   rw = SDL_RWFromFileMapped(NULL);
+   SDLTest_AssertPass("Call to SDL_RWFromFileMapped(NULL) succeeded");
+   SDLTest_AssertCheck(rw == NULL, "Verify SDL_RWFromFileMapped(NULL) returns NULL");
+   rw = SDL_RWFromFileMapped("something_which_does_not_exist");
+   SDLTest_AssertPass("Call to SDL_RWFromFileMapped(\"something_which_does_not_exist\") succeeded");
+   SDLTest_AssertCheck(rw == NULL, "Verify SDL_RWFromFileMapped(\"something_which_does_not_exist\") returns NULL");
+
+   /* Open handle */
+   rw = SDL_RWFromFileMapped(RWopsReadTestFilename);
+   SDLTest_AssertPass("Call to SDL_RWFromFileMapped() succeeded");
+   SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFileMapped does not return NULL");
+
+   /* Bail out if NULL */
+   if (rw == NULL) return TEST_ABORTED;
+
+   /* Check type */
+   SDLTest_AssertCheck(
+      rw->type == SDL_RWOPS_MAPPED || rw->type == SDL_RWOPS_MEMORY_RO,
+      "Verify RWops type is SDL_RWOPS_MAPPED or SDL_RWOPS_MEMORY_RO; expected: %d|%d, got: %d", SDL_RWOPS_MAPPED, SDL_RWOPS_MEMORY_RO, rw->type);
+
+   /* Check direct access */
+   mem = SDL_RWGetMemory(rw, &size);
+   SDLTest_AssertPass("Call to SDL_RWGetMemory() succeeded");
+   SDLTest_AssertCheck(mem != NULL, "Verify SDL_RWGetMemory does not return NULL");
+   SDLTest_AssertCheck(
+      size == (Sint64)(sizeof(RWopsHelloWorldTestString)-1),
+      "Verify size of the mapped file, expected %i, got %i",
+      (int)(sizeof(RWopsHelloWorldTestString)-1), (int)size);
+   if (mem != NULL) {
+      SDLTest_AssertCheck(
+         SDL_memcmp(mem, RWopsHelloWorldTestString, sizeof(RWopsHelloWorldTestString)-1) == 0,
+         "Verify mapped bytes match the file contents");
+   }
+
+   /* Run generic tests */
+   _testGenericRWopsValidations( rw, 0 );
+
+   /* Close handle */
+   result = SDL_RWclose(rw);
+   SDLTest_AssertPass("Call to SDL_RWclose() succeeded");
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+   /* Streams that aren't in memory have no data pointer */
+   rw = SDL_RWFromFile(RWopsReadTestFilename, "r");
+   if (rw != NULL) {
+      mem = SDL_RWGetMemory(rw, NULL);
+      SDLTest_AssertPass("Call to SDL_RWGetMemory() on a file succeeded");
+      SDLTest_AssertCheck(mem == NULL, "Verify SDL_RWGetMemory returns NULL for a file");
+      SDL_RWclose(rw);
+   }
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests reading and writing through a buffered stream.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWFromRW
+ */
+int
+rwops_testBuffered(void)
+{
+   char mem[sizeof(RWopsHelloWorldTestString)];
+   char buf[4];
+   SDL_RWops *src, *rw;
+   Sint64 pos;
+   size_t s;
+   int result;
+
+   /* Negative tests */
+   rw = SDL_RWFromRW(NULL, 0, SDL_FALSE);
+   SDLTest_AssertPass("Call to SDL_RWFromRW(NULL, 0, SDL_FALSE) succeeded");
+   SDLTest_AssertCheck(rw == NULL, "Verify SDL_RWFromRW(NULL, 0, SDL_FALSE) returns NULL");
+
+   /* Buffered memory, with a buffer smaller than the data */
+   SDL_zero(mem);
+   src = SDL_RWFromMem(mem, sizeof(RWopsHelloWorldTestString)-1);
+   SDLTest_AssertCheck(src != NULL, "Verify opening memory with SDL_RWFromMem does not return NULL");
+   if (src == NULL) return TEST_ABORTED;
+   rw = SDL_RWFromRW(src, 4, SDL_TRUE);
+   SDLTest_AssertPass("Call to SDL_RWFromRW(.., 4, SDL_TRUE) succeeded");
+   SDLTest_AssertCheck(rw != NULL, "Verify SDL_RWFromRW does not return NULL");
+   if (rw == NULL) {
+      SDL_RWclose(src);
+      return TEST_ABORTED;
+   }
+
+   /* Check type */
+   SDLTest_AssertCheck(rw->type == SDL_RWOPS_BUFFERED, "Verify RWops type is SDL_RWOPS_BUFFERED; expected: %d, got: %d", SDL_RWOPS_BUFFERED, rw->type);
+
+   /* Run generic tests */
+   _testGenericRWopsValidations(rw, 1);
+
+   /* Close, which also closes the memory */
+   result = SDL_RWclose(rw);
+   SDLTest_AssertPass("Call to SDL_RWclose() succeeded");
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+   SDLTest_AssertCheck(
+      SDL_memcmp(mem, RWopsHelloWorldTestString, sizeof(RWopsHelloWorldTestString)-1) == 0,
+      "Verify buffered writes reached memory, expected '%s', got '%.*s'",
+      RWopsHelloWorldTestString, (int)(sizeof(RWopsHelloWorldTestString)-1), mem);
+
+   /* Seek back over writes still in the buffer, then read and write there */
+   SDL_zero(mem);
+   src = SDL_RWFromMem(mem, 8);
+   SDLTest_AssertCheck(src != NULL, "Verify opening memory with SDL_RWFromMem does not return NULL");
+   if (src == NULL) return TEST_ABORTED;
+   rw = SDL_RWFromRW(src, 16, SDL_FALSE);
+   SDLTest_AssertCheck(rw != NULL, "Verify SDL_RWFromRW does not return NULL");
+   if (rw == NULL) {
+      SDL_RWclose(src);
+      return TEST_ABORTED;
+   }
+   SDL_RWwrite(rw, "ABCD", 1, 4);
+   SDL_RWwrite(rw, "EF", 1, 2);
+   pos = SDL_RWseek(rw, 4, RW_SEEK_SET);
+   SDLTest_AssertPass("Call to SDL_RWseek(...,4,RW_SEEK_SET) over buffered writes succeeded");
+   SDLTest_AssertCheck(pos == 4, "Verify seek to 4 with SDL_RWseek (RW_SEEK_SET), expected 4, got %i", (int)pos);
+   s = SDL_RWread(rw, buf, 1, 2);
+   SDLTest_AssertCheck(
+      s == 2 && SDL_memcmp(buf, "EF", 2) == 0,
+      "Verify reading back buffered writes, expected 'EF', got %i bytes '%.*s'", (int)s, (int)s, buf);
+   SDL_RWseek(rw, 4, RW_SEEK_SET);
+   s = SDL_RWwrite(rw, "XY", 1, 2);
+   SDLTest_AssertCheck(s == 2, "Verify writing after a seek back, expected 2, got %i", (int)s);
+   pos = SDL_RWtell(rw);
+   SDLTest_AssertCheck(pos == 6, "Verify position after writing, expected 6, got %i", (int)pos);
+   result = SDL_RWclose(rw);
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+   SDLTest_AssertCheck(
+      SDL_memcmp(mem, "ABCDXY\0\0", 8) == 0,
+      "Verify the seek back overwrote the buffered writes, expected 'ABCDXY', got '%.*s'", 8, mem);
+   SDL_RWclose(src);
+
+   /* Buffered file */
+   src = SDL_RWFromFile(RWopsReadTestFilename, "r");
+   SDLTest_AssertCheck(src != NULL, "Verify opening file with SDL_RWFromFile in read mode does not return NULL");
+   if (src == NULL) return TEST_ABORTED;
+   rw = SDL_RWFromRW(src, 0, SDL_FALSE);
+   SDLTest_AssertPass("Call to SDL_RWFromRW(.., 0, SDL_FALSE) succeeded");
+   SDLTest_AssertCheck(rw != NULL, "Verify SDL_RWFromRW does not return NULL");
+   if (rw == NULL) {
+      SDL_RWclose(src);
+      return TEST_ABORTED;
+   }
+   _testGenericRWopsValidations(rw, 0);
+
+   /* The file is read ahead, but is left where the buffered stream was */
+   SDL_RWseek(rw, 0, RW_SEEK_SET);
+   SDL_RWread(rw, buf, 1, 3);
+   result = SDL_RWclose(rw);
+   SDLTest_AssertPass("Call to SDL_RWclose() succeeded");
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+   pos = SDL_RWtell(src);
+   SDLTest_AssertCheck(pos == 3, "Verify the file is at the position of the closed buffer, expected 3, got %i", (int)pos);
+   SDL_RWclose(src);
+
+   return TEST_COMPLETED;
+}
+
 
 /* ================= Test References ================== */
 
@@ -733,10 +910,17 @@ static const SDLTest_TestCaseReference rwopsTest9 =
 static const SDLTest_TestCaseReference rwopsTest10 =
         { (SDLTest_TestCaseFp)rwops_testCompareRWFromMemWithRWFromFile, "rwops_testCompareRWFromMemWithRWFromFile", "Compare RWFromMem and RWFromFile RWops for read and seek", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference rwopsTest11 =
+        { (SDLTest_TestCaseFp)rwops_testFileMapped, "rwops_testFileMapped", "Tests reading from a file mapped into memory", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference rwopsTest12 =
+        { (SDLTest_TestCaseFp)rwops_testBuffered, "rwops_testBuffered", "Tests reading and writing through a buffered stream", TEST_ENABLED };
+
 /* Sequence of RWops test cases */
 static const SDLTest_TestCaseReference *rwopsTests[] =  {
     &rwopsTest1, &rwopsTest2, &rwopsTest3, &rwopsTest4, &rwopsTest5, &rwopsTest6,
-    &rwopsTest7, &rwopsTest8, &rwopsTest9, &rwopsTest10, NULL
+    &rwopsTest7, &rwopsTest8, &rwopsTest9, &rwopsTest10, &rwopsTest11,
+    &rwopsTest12, NULL
 };
 
 /* RWops test suite (global) */
@@ -253,6 +253,141 @@ stdlib_getsetenv(void *arg)
   return TEST_COMPLETED;
 }
 
+/**
+ * @brief Call to SDL_TaggedMalloc, SDL_TaggedRealloc and SDL_GetMemoryStats
+ */
+int
+stdlib_memoryStats(void *arg)
+{
+  SDL_MemoryStats before, after;
+  const char *name;
+  void *mem;
+  int result;
+
+  name = SDL_GetMemoryTagName(SDL_MEMTAG_APPLICATION);
+  SDLTest_AssertPass("Call to SDL_GetMemoryTagName(SDL_MEMTAG_APPLICATION)");
+  SDLTest_AssertCheck(name != NULL && SDL_strcmp(name, "application") == 0, "Check name, expected: application, got: %s", name);
+  name = SDL_GetMemoryTagName(SDL_NUM_MEMTAGS);
+  SDLTest_AssertPass("Call to SDL_GetMemoryTagName(SDL_NUM_MEMTAGS)");
+  SDLTest_AssertCheck(name == NULL, "Check name, expected: NULL, got: %s", name);
+
+  result = SDL_GetMemoryStats(SDL_MEMTAG_APPLICATION, &before);
+  SDLTest_AssertPass("Call to SDL_GetMemoryStats(SDL_MEMTAG_APPLICATION)");
+  if (result < 0) {
+    SDLTest_Log("Memory tracking isn't built in: %s", SDL_GetError());
+    mem = SDL_TaggedMalloc(SDL_MEMTAG_APPLICATION, 1000);
+    SDLTest_AssertCheck(mem != NULL, "Check SDL_TaggedMalloc() without tracking, expected: non-NULL");
+    SDL_free(mem);
+    return TEST_SKIPPED;
+  }
+
+  mem = SDL_TaggedMalloc(SDL_MEMTAG_APPLICATION, 1000);
+  SDLTest_AssertPass("Call to SDL_TaggedMalloc(SDL_MEMTAG_APPLICATION, 1000)");
+  SDLTest_AssertCheck(mem != NULL, "Check result, expected: non-NULL");
+  SDL_GetMemoryStats(SDL_MEMTAG_APPLICATION, &after);
+  SDLTest_AssertCheck(after.live_bytes == before.live_bytes + 1000, "Check live bytes, expected: %d more, got: %d more", 1000, (int)(after.live_bytes - before.live_bytes));
+  SDLTest_AssertCheck(after.live_blocks == before.live_blocks + 1, "Check live blocks, expected: 1 more, got: %d more", (int)(after.live_blocks - before.live_blocks));
+  SDLTest_AssertCheck(after.peak_bytes >= after.live_bytes, "Check peak bytes are at least the live bytes");
+
+  mem = SDL_realloc(mem, 3000);
+  SDLTest_AssertPass("Call to SDL_realloc(mem, 3000)");
+  SDL_GetMemoryStats(SDL_MEMTAG_APPLICATION, &after);
+  SDLTest_AssertCheck(after.live_bytes == before.live_bytes + 3000, "Check SDL_realloc() kept the tag, expected: %d more, got: %d more", 3000, (int)(after.live_bytes - before.live_bytes));
+
+  mem = SDL_TaggedRealloc(SDL_MEMTAG_OTHER, mem, 10);
+  SDLTest_AssertPass("Call to SDL_TaggedRealloc(SDL_MEMTAG_OTHER, mem, 10)");
+  SDL_GetMemoryStats(SDL_MEMTAG_APPLICATION, &after);
+  SDLTest_AssertCheck(after.live_bytes == before.live_bytes, "Check the block moved to another tag, expected: 0 more, got: %d more", (int)(after.live_bytes - before.live_bytes));
+  SDLTest_AssertCheck(after.peak_bytes >= before.live_bytes + 3000, "Check peak bytes, expected: at least %d more", 3000);
+
+  SDL_free(mem);
+  SDLTest_AssertPass("Call to SDL_free()");
+
+  result = SDL_GetMemoryStats(SDL_NUM_MEMTAGS, &after);
+  SDLTest_AssertPass("Call to SDL_GetMemoryStats(SDL_NUM_MEMTAGS)");
+  SDLTest_AssertCheck(result == -1, "Check result, expected: -1, got: %i", result);
+
+  return TEST_COMPLETED;
+}
+
+static int
+stdlib_compareSint32(const void *a, const void *b)
+{
+  const Sint32 x = *(const Sint32 *)a, y = *(const Sint32 *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief Call to SDL_qsort, SDL_RadixSort32 and SDL_RadixSortKeyed
+ */
+int
+stdlib_sort(void *arg)
+{
+  Sint32 values[1000];
+  Uint32 keys[1000];
+  Uint32 records[1000][3];
+  int i, j, result, sorted;
+  const int counts[] = { 0, 1, 2, 17, 500, 1000 };
+
+  for (j = 0; j < SDL_arraysize(counts); j++) {
+    const int count = counts[j];
+
+    for (i = 0; i < count; i++) {
+      values[i] = SDLTest_RandomSint32();
+    }
+    SDL_qsort(values, count, sizeof(values[0]), stdlib_compareSint32);
+    SDLTest_AssertPass("Call to SDL_qsort() on %d random values", count);
+    for (i = 1; i < count && values[i - 1] <= values[i]; i++) {
+    }
+    SDLTest_AssertCheck(count <= 1 || i == count, "Check order, expected: sorted, first unsorted at: %d", i);
+
+    for (i = 0; i < count; i++) {
+      values[i] = count - i;
+    }
+    SDL_qsort(values, count, sizeof(values[0]), stdlib_compareSint32);
+    SDLTest_AssertPass("Call to SDL_qsort() on %d reversed values", count);
+    for (i = 0; i < count && values[i] == i + 1; i++) {
+    }
+    SDLTest_AssertCheck(i == count, "Check order, expected: sorted, first unsorted at: %d", i);
+
+    for (i = 0; i < count; i++) {
+      keys[i] = SDLTest_RandomUint32() >> (i & 24);
+    }
+    result = SDL_RadixSort32(keys, count);
+    SDLTest_AssertPass("Call to SDL_RadixSort32() on %d values", count);
+    SDLTest_AssertCheck(result == 0, "Check result, expected: 0, got: %i", result);
+    for (i = 1; i < count && keys[i - 1] <= keys[i]; i++) {
+    }
+    SDLTest_AssertCheck(count <= 1 || i == count, "Check order, expected: sorted, first unsorted at: %d", i);
+
+    for (i = 0; i < count; i++) {
+      records[i][0] = (Uint32)i;
+      records[i][1] = SDLTest_RandomUint32() % 10;
+      records[i][2] = ~(Uint32)i;
+    }
+    result = SDL_RadixSortKeyed(records, count, sizeof(records[0]), sizeof(Uint32));
+    SDLTest_AssertPass("Call to SDL_RadixSortKeyed() on %d records", count);
+    SDLTest_AssertCheck(result == 0, "Check result, expected: 0, got: %i", result);
+    sorted = 1;
+    for (i = 0; i < count; i++) {
+      if (records[i][2] != ~records[i][0]) {
+        sorted = 0;
+      }
+      if (i > 0 && (records[i - 1][1] > records[i][1] ||
+                    (records[i - 1][1] == records[i][1] && records[i - 1][0] > records[i][0]))) {
+        sorted = 0;
+      }
+    }
+    SDLTest_AssertCheck(sorted, "Check records are whole and in stable order");
+  }
+
+  result = SDL_RadixSortKeyed(records, 2, sizeof(records[0]), 2 * sizeof(Uint32) + 1);
+  SDLTest_AssertPass("Call to SDL_RadixSortKeyed() with the key outside the record");
+  SDLTest_AssertCheck(result == -1, "Check result, expected: -1, got: %i", result);
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Standard C routine test cases */
@@ -265,9 +400,15 @@ static const SDLTest_TestCaseReference stdlibTest2 =
 static const SDLTest_TestCaseReference stdlibTest3 =
         { (SDLTest_TestCaseFp)stdlib_getsetenv, "stdlib_getsetenv", "Call to SDL_getenv and SDL_setenv", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference stdlibTest4 =
+        { (SDLTest_TestCaseFp)stdlib_memoryStats, "stdlib_memoryStats", "Call to SDL_TaggedMalloc and SDL_GetMemoryStats", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference stdlibTest5 =
+        { (SDLTest_TestCaseFp)stdlib_sort, "stdlib_sort", "Call to SDL_qsort, SDL_RadixSort32 and SDL_RadixSortKeyed", TEST_ENABLED };
+
 /* Sequence of Standard C routine test cases */
 static const SDLTest_TestCaseReference *stdlibTests[] =  {
-    &stdlibTest1, &stdlibTest2, &stdlibTest3, NULL
+    &stdlibTest1, &stdlibTest2, &stdlibTest3, &stdlibTest4, &stdlibTest5, NULL
 };
 
 /* Timer test suite (global) */
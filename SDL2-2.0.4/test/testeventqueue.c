@@ -0,0 +1,167 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program:  Measure event queue throughput with 1 to 32 threads
+   pushing user events while the main thread drains the queue, and check
+   that each thread's events arrive complete and in order.
+
+   Usage: testeventqueue [events per thread] [batch size]
+   A batch size of 1 uses SDL_PushEvent(), larger sizes use SDL_PushEvents().
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define MAX_PRODUCERS   32
+
+typedef struct
+{
+    int index;
+    int num_events;
+    int batch_size;
+    int failed_pushes;
+    int next_expected;
+    SDL_Thread *thread;
+} Producer;
+
+static SDL_atomic_t producers_running;
+
+static int SDLCALL
+ProducerThread(void *data)
+{
+    Producer *producer = (Producer *) data;
+    SDL_Event events[256];
+    int sent = 0;
+
+    while (sent < producer->num_events) {
+        int i, count = SDL_min(producer->batch_size, producer->num_events - sent);
+        int pushed;
+
+        for (i = 0; i < count; ++i) {
+            SDL_zero(events[i]);
+            events[i].type = SDL_USEREVENT;
+            events[i].user.code = sent + i;
+            events[i].user.data1 = producer;
+        }
+        if (count == 1) {
+            pushed = SDL_PushEvent(&events[0]);
+        } else {
+            pushed = SDL_PushEvents(events, count);
+        }
+        if (pushed <= 0) {
+            /* The queue is full, give the consumer a chance to catch up */
+            ++producer->failed_pushes;
+            SDL_Delay(0);
+            continue;
+        }
+        sent += pushed;
+    }
+    SDL_AtomicAdd(&producers_running, -1);
+    return 0;
+}
+
+static int
+RunTest(Producer *producers, int num_producers, int num_events, int batch_size)
+{
+    SDL_Event events[256];
+    Uint64 start, end;
+    int i, received = 0, errors = 0, failed_pushes = 0;
+    int total = num_producers * num_events;
+    double seconds;
+
+    SDL_AtomicSet(&producers_running, num_producers);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_producers; ++i) {
+        char name[32];
+
+        producers[i].index = i;
+        producers[i].num_events = num_events;
+        producers[i].batch_size = batch_size;
+        producers[i].failed_pushes = 0;
+        producers[i].next_expected = 0;
+        SDL_snprintf(name, sizeof(name), "Producer%d", i);
+        producers[i].thread = SDL_CreateThread(ProducerThread, name, &producers[i]);
+    }
+
+    while (received < total) {
+        int count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_USEREVENT, SDL_USEREVENT);
+        if (count <= 0) {
+            if (SDL_AtomicGet(&producers_running) == 0 &&
+                !SDL_HasEvent(SDL_USEREVENT)) {
+                break;
+            }
+            continue;
+        }
+        for (i = 0; i < count; ++i) {
+            Producer *producer = (Producer *) events[i].user.data1;
+            if (events[i].user.code != producer->next_expected) {
+                ++errors;
+            }
+            producer->next_expected = events[i].user.code + 1;
+        }
+        received += count;
+    }
+    end = SDL_GetPerformanceCounter();
+
+    for (i = 0; i < num_producers; ++i) {
+        SDL_WaitThread(producers[i].thread, NULL);
+        failed_pushes += producers[i].failed_pushes;
+    }
+
+    seconds = (double) (end - start) / SDL_GetPerformanceFrequency();
+    SDL_Log("%2d producers: %8d events in %7.3f s, %7.2f M events/s, %d full queue retries%s\n",
+            num_producers, received, seconds, received / seconds / 1000000.0, failed_pushes,
+            (received != total || errors) ? " LOST OR REORDERED EVENTS" : "");
+
+    return (received == total && !errors) ? 0 : -1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    Producer producers[MAX_PRODUCERS];
+    int num_events = 100000;
+    int batch_size = 1;
+    int num_producers, status = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_events = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+    if (argc > 2) {
+        batch_size = SDL_atoi(argv[2]);
+        batch_size = SDL_max(batch_size, 1);
+        batch_size = SDL_min(batch_size, 256);
+    }
+
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("%d events per producer, %s\n", num_events,
+            batch_size > 1 ? "batched with SDL_PushEvents()" : "pushed with SDL_PushEvent()");
+    for (num_producers = 1; num_producers <= MAX_PRODUCERS; num_producers *= 2) {
+        if (RunTest(producers, num_producers, num_events, batch_size) < 0) {
+            status = 1;
+        }
+    }
+
+    SDL_Quit();
+    return status;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,228 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program:  Churn small allocations through SDL_malloc() and
+   SDL_free() on 1, 2, 4 and so on up to one thread per CPU core, and report
+   how many calls a second each thread count manages.  Each thread keeps a
+   set of live blocks of 8 to 512 bytes and replaces a random one at a time,
+   the way worker threads create and destroy surfaces, events and RWops.
+   With -handoff the threads free each other's blocks instead, every thread
+   passing the blocks it allocates on to the next one.
+
+   The per-thread caches only exist when SDL is built without the C
+   runtime, otherwise this measures the C runtime's malloc().
+
+   Usage: testmallocbench [-handoff] [-threads count] [calls per thread]
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "SDL.h"
+
+#define LIVE_BLOCKS 256
+#define HANDOFF_SIZE 1024
+
+typedef struct
+{
+    int index;
+    int calls;
+    Uint32 seed;
+    SDL_bool handoff;
+    /* A ring of blocks handed to the next thread */
+    void *handoff_ring[HANDOFF_SIZE];
+    SDL_atomic_t head;
+    SDL_atomic_t tail;
+} Worker;
+
+static int thread_count;
+static Worker *workers;
+
+static Uint32
+Random(Uint32 *seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 8;
+}
+
+static size_t
+RandomSize(Uint32 *seed)
+{
+    /* Mostly small, like the structures SDL allocates */
+    Uint32 r = Random(seed);
+    return (r & 3) ? 8 + (r >> 4) % 120 : 8 + (r >> 4) % 504;
+}
+
+/* Give a block to the next thread, or free it if its ring is full */
+static void
+HandOff(Worker *worker, void *mem)
+{
+    Worker *next = &workers[(worker->index + 1) % thread_count];
+    int head = SDL_AtomicGet(&next->head);
+
+    if (head - SDL_AtomicGet(&next->tail) < HANDOFF_SIZE) {
+        next->handoff_ring[head % HANDOFF_SIZE] = mem;
+        SDL_AtomicSet(&next->head, head + 1);
+    } else {
+        SDL_free(mem);
+    }
+}
+
+static void *
+TakeHandOff(Worker *worker)
+{
+    int tail = SDL_AtomicGet(&worker->tail);
+    void *mem;
+
+    if (tail == SDL_AtomicGet(&worker->head)) {
+        return NULL;
+    }
+    mem = worker->handoff_ring[tail % HANDOFF_SIZE];
+    SDL_AtomicSet(&worker->tail, tail + 1);
+    return mem;
+}
+
+static int SDLCALL
+Churn(void *data)
+{
+    Worker *worker = (Worker *) data;
+    void *live[LIVE_BLOCKS];
+    void *mem;
+    int i, slot;
+
+    for (i = 0; i < LIVE_BLOCKS; ++i) {
+        live[i] = SDL_malloc(RandomSize(&worker->seed));
+    }
+    for (i = 0; i < worker->calls; i += 2) {
+        slot = Random(&worker->seed) % LIVE_BLOCKS;
+        if (worker->handoff && thread_count > 1) {
+            HandOff(worker, live[slot]);
+            while ((mem = TakeHandOff(worker)) != NULL) {
+                SDL_free(mem);
+            }
+        } else {
+            SDL_free(live[slot]);
+        }
+        live[slot] = SDL_malloc(RandomSize(&worker->seed));
+        if (!live[slot]) {
+            SDL_Log("Out of memory\n");
+            return 1;
+        }
+        *(Uint8 *) live[slot] = (Uint8) i;
+    }
+    for (i = 0; i < LIVE_BLOCKS; ++i) {
+        SDL_free(live[i]);
+    }
+    return 0;
+}
+
+static double
+Run(int threads, int calls, SDL_bool handoff)
+{
+    SDL_Thread **handles;
+    Uint64 start, end;
+    void *mem;
+    int i;
+
+    thread_count = threads;
+    workers = (Worker *) SDL_calloc(threads, sizeof(Worker));
+    handles = (SDL_Thread **) SDL_calloc(threads, sizeof(SDL_Thread *));
+    if (!workers || !handles) {
+        return 0.0;
+    }
+    for (i = 0; i < threads; ++i) {
+        workers[i].index = i;
+        workers[i].calls = calls;
+        workers[i].seed = i + 1;
+        workers[i].handoff = handoff;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < threads; ++i) {
+        handles[i] = SDL_CreateThread(Churn, "Churn", &workers[i]);
+    }
+    for (i = 0; i < threads; ++i) {
+        SDL_WaitThread(handles[i], NULL);
+    }
+    end = SDL_GetPerformanceCounter();
+
+    /* Blocks still waiting to be handed off */
+    for (i = 0; i < threads; ++i) {
+        while ((mem = TakeHandOff(&workers[i])) != NULL) {
+            SDL_free(mem);
+        }
+    }
+    SDL_free(handles);
+    SDL_free(workers);
+
+    return (double) threads * calls * SDL_GetPerformanceFrequency() / (end - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_bool handoff = SDL_FALSE;
+    int max_threads = 0;
+    int calls = 2000000;
+    int threads, i;
+    double single = 0.0, rate;
+    SDL_MallocCacheStats stats;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "-handoff") == 0) {
+            handoff = SDL_TRUE;
+        } else if (SDL_strcmp(argv[i], "-threads") == 0 && argv[i + 1]) {
+            max_threads = SDL_atoi(argv[++i]);
+        } else if (argv[i][0] != '-') {
+            calls = SDL_atoi(argv[i]);
+            calls = SDL_max(calls, 2);
+        } else {
+            SDL_Log("Usage: %s [-handoff] [-threads count] [calls per thread]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (max_threads <= 0) {
+        max_threads = SDL_GetCPUCount();
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("%d calls per thread%s\n", calls, handoff ? ", freeing each other's blocks" : "");
+    for (threads = 1; ; threads *= 2) {
+        threads = SDL_min(threads, max_threads);
+        rate = Run(threads, calls, handoff);
+        if (threads == 1) {
+            single = rate;
+        }
+        SDL_Log("%2d thread%s %8.2f M calls/s, %.2fx one thread\n", threads,
+                threads == 1 ? ": " : "s:", rate / 1000000.0, single > 0.0 ? rate / single : 0.0);
+        if (threads == max_threads) {
+            break;
+        }
+    }
+
+    SDL_GetMallocCacheStats(&stats);
+    SDL_Log("Thread caches: %" SDL_PRIu64 " hits, %" SDL_PRIu64 " misses, %" SDL_PRIu64 " blocks released, %u bytes cached by %d threads\n",
+            stats.hits, stats.misses, stats.released, (unsigned int) stats.cached, stats.threads);
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
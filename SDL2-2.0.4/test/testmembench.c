@@ -0,0 +1,207 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program:  Time SDL_memset() and SDL_memcpy() against the C
+   runtime's memset() and memcpy(), and SDL_memset4() against the inline
+   version SDL_stdinc.h used to have, from 16 bytes up to a 1080p
+   framebuffer and beyond, with the destination aligned and off by one or
+   four bytes, and check every result.
+
+   Usage: testmembench [megabytes per measurement]
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "SDL.h"
+
+#define MAX_SIZE (32 * 1024 * 1024)
+
+static const size_t sizes[] = {
+    16, 64, 256, 1024, 4096, 16384, 65536, 262144, 1024 * 1024,
+    1920 * 1080 * 4, MAX_SIZE
+};
+
+static const size_t offsets[] = { 0, 1, 4 };
+
+static Uint8 *src_buffer;
+static Uint8 *dst_buffer;
+static size_t bytes_per_measurement;
+
+#define PATTERN 0x11223344
+
+typedef void (*MemoryFunc) (Uint8 *dst, const Uint8 *src, size_t len);
+
+static void
+CSet(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    memset(dst, 0x44, len);
+}
+
+static void
+SDLSet(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    SDL_memset(dst, 0x44, len);
+}
+
+/* SDL_memset4() as it was inlined from SDL_stdinc.h */
+static void
+InlineSet4(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    size_t dwords = len / 4;
+    size_t _n = (dwords + 3) / 4;
+    Uint32 *_p = (Uint32 *) dst;
+    Uint32 _val = PATTERN;
+    if (dwords == 0)
+        return;
+    switch (dwords % 4)
+    {
+        case 0: do {    *_p++ = _val;
+        case 3:         *_p++ = _val;
+        case 2:         *_p++ = _val;
+        case 1:         *_p++ = _val;
+        } while ( --_n );
+    }
+}
+
+static void
+SDLSet4(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    SDL_memset4(dst, PATTERN, len / 4);
+}
+
+static void
+CCopy(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    memcpy(dst, src, len);
+}
+
+static void
+SDLCopy(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    SDL_memcpy(dst, src, len);
+}
+
+static SDL_bool
+Check(const Uint8 *dst, const Uint8 *src, size_t len, SDL_bool set4)
+{
+    const Uint32 pattern = PATTERN;
+    size_t i;
+
+    if (src) {
+        return (memcmp(dst, src, len) == 0) ? SDL_TRUE : SDL_FALSE;
+    }
+    for (i = 0; i < len; ++i) {
+        if (dst[i] != (set4 ? ((const Uint8 *) &pattern)[i % 4] : 0x44)) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+/* Returns GB/s */
+static double
+Measure(MemoryFunc func, SDL_bool copy, size_t size, size_t offset, SDL_bool *ok)
+{
+    Uint8 *dst = dst_buffer + offset;
+    const Uint8 *src = copy ? src_buffer + 3 : NULL;
+    size_t runs = SDL_max(bytes_per_measurement / size, 1);
+    size_t i;
+    Uint64 start, end;
+
+    SDL_memset(dst_buffer, 0, size + offset);
+    func(dst, src, size);
+    *ok = Check(dst, src, size, (func == InlineSet4 || func == SDLSet4) ? SDL_TRUE : SDL_FALSE);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < runs; ++i) {
+        func(dst, src, size);
+    }
+    end = SDL_GetPerformanceCounter();
+    return (double) size * runs * SDL_GetPerformanceFrequency() / (end - start) / 1e9;
+}
+
+static void
+Bench(const char *title, SDL_bool copy, const char **names, const MemoryFunc *funcs, int count)
+{
+    char line[256];
+    size_t s, o;
+    int i;
+    SDL_bool ok;
+    double rate;
+
+    SDL_Log("%s, GB/s:\n", title);
+    SDL_snprintf(line, sizeof(line), "%10s %6s", "bytes", "offset");
+    for (i = 0; i < count; ++i) {
+        SDL_snprintf(line + SDL_strlen(line), sizeof(line) - SDL_strlen(line), " %12s", names[i]);
+    }
+    SDL_Log("%s\n", line);
+
+    for (s = 0; s < SDL_arraysize(sizes); ++s) {
+        for (o = 0; o < SDL_arraysize(offsets); ++o) {
+            SDL_snprintf(line, sizeof(line), "%10.0f %6.0f", (double) sizes[s], (double) offsets[o]);
+            for (i = 0; i < count; ++i) {
+                rate = Measure(funcs[i], copy, sizes[s], offsets[o], &ok);
+                SDL_snprintf(line + SDL_strlen(line), sizeof(line) - SDL_strlen(line), " %12.2f%s", rate, ok ? "" : "!");
+            }
+            SDL_Log("%s\n", line);
+        }
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    static const char *set_names[] = { "memset", "SDL_memset", "old memset4", "SDL_memset4" };
+    static const MemoryFunc set_funcs[] = { CSet, SDLSet, InlineSet4, SDLSet4 };
+    static const char *copy_names[] = { "memcpy", "SDL_memcpy" };
+    static const MemoryFunc copy_funcs[] = { CCopy, SDLCopy };
+    int megabytes = 256;
+    size_t i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        megabytes = SDL_atoi(argv[1]);
+        megabytes = SDL_max(megabytes, 1);
+    }
+    bytes_per_measurement = (size_t) megabytes * 1024 * 1024;
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    src_buffer = (Uint8 *) SDL_malloc(MAX_SIZE + 64);
+    dst_buffer = (Uint8 *) SDL_malloc(MAX_SIZE + 64);
+    if (!src_buffer || !dst_buffer) {
+        SDL_Log("Out of memory\n");
+        return 1;
+    }
+    for (i = 0; i < MAX_SIZE + 64; ++i) {
+        src_buffer[i] = (Uint8) (i * 7);
+    }
+
+    SDL_Log("CPU: SSE2 %s, AVX2 %s, %d megabytes per measurement, '!' marks a wrong result\n",
+            SDL_HasSSE2() ? "yes" : "no", SDL_HasAVX2() ? "yes" : "no", megabytes);
+    Bench("Fill", SDL_FALSE, set_names, set_funcs, SDL_arraysize(set_funcs));
+    Bench("Copy", SDL_TRUE, copy_names, copy_funcs, SDL_arraysize(copy_funcs));
+
+    SDL_free(dst_buffer);
+    SDL_free(src_buffer);
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,140 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program:  Time SDL_ConvertAudio() sample rate conversion for
+   common rate pairs and channel counts, and measure the signal to noise
+   ratio of a resampled sine wave.  Runs with both values of
+   SDL_HINT_AUDIO_RESAMPLING_MODE so the two resamplers can be compared.
+
+   Usage: testresamplebench [seconds of audio]
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define TEST_FREQUENCY  997.0
+
+static const double pi = 3.14159265358979323846;
+
+static double
+MeasureSNR(const float *samples, int frames, int channels, int rate)
+{
+    const int margin = rate / 50;
+    double signal = 0.0, noise = 0.0;
+    int i;
+
+    /* Skip the edges, the resampler extends the input by repeating the end frames */
+    for (i = margin; i < frames - margin; ++i) {
+        const double target = SDL_sin(2.0 * pi * TEST_FREQUENCY * i / rate) * 0.5;
+        const double error = samples[i * channels] - target;
+        signal += target * target;
+        noise += error * error;
+    }
+    if (noise <= 0.0) {
+        return 999.0;
+    }
+    return 10.0 * SDL_log(signal / noise) / SDL_log(10.0);
+}
+
+static int
+RunTest(int src_rate, int dst_rate, int channels, double seconds)
+{
+    const int src_frames = (int) (src_rate * seconds);
+    const int iterations = 10;
+    SDL_AudioCVT cvt;
+    Uint8 *buf;
+    float *samples;
+    Uint64 start, end;
+    double ns, snr;
+    int i, j, dst_frames;
+
+    if (SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, channels, src_rate,
+                          AUDIO_F32SYS, channels, dst_rate) < 0) {
+        SDL_Log("%6d -> %6d Hz, %d channels: %s\n", src_rate, dst_rate, channels, SDL_GetError());
+        return -1;
+    }
+
+    cvt.len = src_frames * channels * sizeof (float);
+    buf = (Uint8 *) SDL_malloc(cvt.len * cvt.len_mult);
+    if (!buf) {
+        SDL_OutOfMemory();
+        return -1;
+    }
+    cvt.buf = buf;
+
+    end = 0;
+    for (i = 0; i < iterations; ++i) {
+        samples = (float *) buf;
+        for (j = 0; j < src_frames * channels; ++j) {
+            samples[j] = (float) (SDL_sin(2.0 * pi * TEST_FREQUENCY * (j / channels) / src_rate) * 0.5);
+        }
+        start = SDL_GetPerformanceCounter();
+        SDL_ConvertAudio(&cvt);
+        end += SDL_GetPerformanceCounter() - start;
+    }
+
+    dst_frames = cvt.len_cvt / (channels * sizeof (float));
+    ns = (double) end * 1000000000.0 / SDL_GetPerformanceFrequency() / iterations / dst_frames;
+    snr = MeasureSNR((const float *) buf, dst_frames, channels, dst_rate);
+    SDL_Log("%6d -> %6d Hz, %d channels: %7.2f ns/frame, SNR %6.1f dB\n",
+            src_rate, dst_rate, channels, ns, snr);
+
+    SDL_free(buf);
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    static const int rates[][2] = {
+        { 44100, 48000 }, { 48000, 44100 }, { 22050, 48000 },
+        { 48000, 22050 }, { 8000, 48000 }, { 96000, 48000 }
+    };
+    static const int channels[] = { 1, 2, 6, 8 };
+    static const char *modes[] = { "fast", "default" };
+    double seconds = 1.0;
+    int i, j, k, status = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        seconds = SDL_atof(argv[1]);
+        if (seconds <= 0.0) {
+            seconds = 1.0;
+        }
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    for (k = 0; k < SDL_arraysize(modes); ++k) {
+        SDL_SetHint(SDL_HINT_AUDIO_RESAMPLING_MODE, modes[k]);
+        SDL_Log("Resampling mode \"%s\":\n", modes[k]);
+        for (i = 0; i < SDL_arraysize(rates); ++i) {
+            for (j = 0; j < SDL_arraysize(channels); ++j) {
+                if (RunTest(rates[i][0], rates[i][1], channels[j], seconds) < 0) {
+                    status = 1;
+                }
+            }
+        }
+    }
+
+    SDL_Quit();
+    return status;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,219 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program:  Compare reading and writing a slow stream directly and
+   through SDL_RWFromRW().  The slow stream is a memory stream that waits
+   on every call, the way a stream reading from the network or out of an
+   archive costs a lot more per call than per byte.
+
+   Usage: testrwbench [microseconds per call]
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DATA_SIZE   (256 * 1024)
+
+static double latency = 5.0;
+static int calls = 0;
+
+static void
+Wait(void)
+{
+    const Uint64 end = SDL_GetPerformanceCounter() +
+        (Uint64) (latency * SDL_GetPerformanceFrequency() / 1000000.0);
+
+    ++calls;
+    while (SDL_GetPerformanceCounter() < end) {
+        /* spin */
+    }
+}
+
+static Sint64 SDLCALL
+slow_size(SDL_RWops * context)
+{
+    Wait();
+    return SDL_RWsize((SDL_RWops *) context->hidden.unknown.data1);
+}
+
+static Sint64 SDLCALL
+slow_seek(SDL_RWops * context, Sint64 offset, int whence)
+{
+    Wait();
+    return SDL_RWseek((SDL_RWops *) context->hidden.unknown.data1, offset, whence);
+}
+
+static size_t SDLCALL
+slow_read(SDL_RWops * context, void *ptr, size_t size, size_t maxnum)
+{
+    Wait();
+    return SDL_RWread((SDL_RWops *) context->hidden.unknown.data1, ptr, size, maxnum);
+}
+
+static size_t SDLCALL
+slow_write(SDL_RWops * context, const void *ptr, size_t size, size_t num)
+{
+    Wait();
+    return SDL_RWwrite((SDL_RWops *) context->hidden.unknown.data1, ptr, size, num);
+}
+
+static int SDLCALL
+slow_close(SDL_RWops * context)
+{
+    SDL_RWclose((SDL_RWops *) context->hidden.unknown.data1);
+    SDL_FreeRW(context);
+    return 0;
+}
+
+static SDL_RWops *
+OpenSlow(void *mem, int size, SDL_bool buffered)
+{
+    SDL_RWops *rw = SDL_AllocRW();
+
+    if (!rw) {
+        return NULL;
+    }
+    rw->size = slow_size;
+    rw->seek = slow_seek;
+    rw->read = slow_read;
+    rw->write = slow_write;
+    rw->close = slow_close;
+    rw->hidden.unknown.data1 = SDL_RWFromMem(mem, size);
+    if (buffered) {
+        return SDL_RWFromRW(rw, 0, SDL_TRUE);
+    }
+    return rw;
+}
+
+/* A second of 16-bit stereo sound */
+static Uint8 *
+MakeWave(int *size)
+{
+    const int rate = 44100, channels = 2;
+    const int data_size = rate * channels * 2;
+    SDL_RWops *rw;
+    Uint8 *wave;
+    int i;
+
+    *size = 44 + data_size;
+    wave = (Uint8 *) SDL_malloc(*size);
+    if (!wave) {
+        return NULL;
+    }
+    rw = SDL_RWFromMem(wave, *size);
+    SDL_RWwrite(rw, "RIFF", 4, 1);
+    SDL_WriteLE32(rw, *size - 8);
+    SDL_RWwrite(rw, "WAVEfmt ", 8, 1);
+    SDL_WriteLE32(rw, 16);
+    SDL_WriteLE16(rw, 1);
+    SDL_WriteLE16(rw, channels);
+    SDL_WriteLE32(rw, rate);
+    SDL_WriteLE32(rw, rate * channels * 2);
+    SDL_WriteLE16(rw, channels * 2);
+    SDL_WriteLE16(rw, 16);
+    SDL_RWwrite(rw, "data", 4, 1);
+    SDL_WriteLE32(rw, data_size);
+    for (i = 0; i < data_size / 2; ++i) {
+        SDL_WriteLE16(rw, (Uint16) (i * 31));
+    }
+    SDL_RWclose(rw);
+    return wave;
+}
+
+static void
+Report(const char *what, SDL_bool buffered, Uint64 start, Uint64 end)
+{
+    SDL_Log("%-32s %-10s %9.2f ms, %7d calls to the stream\n", what,
+            buffered ? "buffered" : "direct",
+            (double) (end - start) * 1000.0 / SDL_GetPerformanceFrequency(),
+            calls);
+}
+
+int
+main(int argc, char *argv[])
+{
+    Uint8 *data, *wave;
+    int wave_size, i, j;
+    SDL_bool buffered;
+    SDL_RWops *rw;
+    Uint64 start, end;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        latency = SDL_atof(argv[1]);
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    data = (Uint8 *) SDL_calloc(1, DATA_SIZE);
+    wave = MakeWave(&wave_size);
+    if (!data || !wave) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        return 1;
+    }
+
+    SDL_Log("Slow stream waiting %.1f us per call\n", latency);
+    for (i = 0; i < 2; ++i) {
+        buffered = i ? SDL_TRUE : SDL_FALSE;
+
+        calls = 0;
+        start = SDL_GetPerformanceCounter();
+        rw = OpenSlow(data, DATA_SIZE, buffered);
+        for (j = 0; j < DATA_SIZE / 2; ++j) {
+            SDL_ReadLE16(rw);
+        }
+        SDL_RWclose(rw);
+        end = SDL_GetPerformanceCounter();
+        Report("Read 256 KB with SDL_ReadLE16()", buffered, start, end);
+
+        calls = 0;
+        start = SDL_GetPerformanceCounter();
+        rw = OpenSlow(data, DATA_SIZE, buffered);
+        for (j = 0; j < DATA_SIZE / 4; ++j) {
+            SDL_WriteBE32(rw, j);
+        }
+        SDL_RWclose(rw);
+        end = SDL_GetPerformanceCounter();
+        Report("Write 256 KB with SDL_WriteBE32()", buffered, start, end);
+
+        calls = 0;
+        start = SDL_GetPerformanceCounter();
+        for (j = 0; j < 100; ++j) {
+            SDL_AudioSpec spec;
+            Uint8 *buf;
+            Uint32 len;
+
+            rw = OpenSlow(wave, wave_size, buffered);
+            if (!SDL_LoadWAV_RW(rw, 1, &spec, &buf, &len)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't load wave: %s\n", SDL_GetError());
+                return 1;
+            }
+            SDL_FreeWAV(buf);
+        }
+        end = SDL_GetPerformanceCounter();
+        Report("Load a wave 100 times", buffered, start, end);
+    }
+
+    SDL_free(wave);
+    SDL_free(data);
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,228 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program:  Time the C runtime's qsort(), SDL_qsort() and the radix
+   sorts on arrays of Uint32 and on 16 byte sprite records sorted by depth,
+   with random, sorted, reversed and mostly equal values, and check that
+   every result is sorted.
+
+   Usage: testsortbench [count]
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "SDL.h"
+
+typedef struct
+{
+    Sint16 x, y;
+    Uint32 texture;
+    Uint32 depth;
+    Uint32 flags;
+} Sprite;
+
+typedef enum
+{
+    ORDER_RANDOM,
+    ORDER_SORTED,
+    ORDER_REVERSED,
+    ORDER_FEW_UNIQUE,
+    NUM_ORDERS
+} Order;
+
+static const char *order_names[NUM_ORDERS] = {
+    "random", "sorted", "reversed", "few unique"
+};
+
+static Uint32 seed = 1;
+
+static Uint32
+Random(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) | (seed << 16);
+}
+
+static Uint32
+Value(Order order, size_t i, size_t count)
+{
+    switch (order) {
+    case ORDER_SORTED:
+        return (Uint32) i;
+    case ORDER_REVERSED:
+        return (Uint32) (count - i);
+    case ORDER_FEW_UNIQUE:
+        return Random() % 16;
+    default:
+        return Random();
+    }
+}
+
+static int
+CompareUint32(const void *a, const void *b)
+{
+    const Uint32 x = *(const Uint32 *) a, y = *(const Uint32 *) b;
+    return (x > y) - (x < y);
+}
+
+static int
+CompareSprite(const void *a, const void *b)
+{
+    const Uint32 x = ((const Sprite *) a)->depth, y = ((const Sprite *) b)->depth;
+    return (x > y) - (x < y);
+}
+
+static double
+Elapsed(Uint64 start)
+{
+    return (double) (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+static SDL_bool
+CheckValues(const Uint32 *values, size_t count)
+{
+    size_t i;
+    for (i = 1; i < count; ++i) {
+        if (values[i - 1] > values[i]) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+static SDL_bool
+CheckSprites(const Sprite *sprites, size_t count, SDL_bool stable)
+{
+    size_t i;
+    for (i = 1; i < count; ++i) {
+        if (sprites[i - 1].depth > sprites[i].depth) {
+            return SDL_FALSE;
+        }
+        /* The texture holds the original position */
+        if (stable && sprites[i - 1].depth == sprites[i].depth &&
+            sprites[i - 1].texture > sprites[i].texture) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+static void
+Report(const char *name, double ms, SDL_bool ok)
+{
+    SDL_Log("  %-20s %9.2f ms%s\n", name, ms, ok ? "" : "  NOT SORTED");
+}
+
+static void
+BenchValues(Uint32 *original, Uint32 *values, size_t count)
+{
+    Uint64 start;
+
+    SDL_memcpy(values, original, count * sizeof(*values));
+    start = SDL_GetPerformanceCounter();
+    qsort(values, count, sizeof(*values), CompareUint32);
+    Report("qsort()", Elapsed(start), CheckValues(values, count));
+
+    SDL_memcpy(values, original, count * sizeof(*values));
+    start = SDL_GetPerformanceCounter();
+    SDL_qsort(values, count, sizeof(*values), CompareUint32);
+    Report("SDL_qsort()", Elapsed(start), CheckValues(values, count));
+
+    SDL_memcpy(values, original, count * sizeof(*values));
+    start = SDL_GetPerformanceCounter();
+    if (SDL_RadixSort32(values, count) < 0) {
+        SDL_Log("SDL_RadixSort32() failed: %s\n", SDL_GetError());
+    }
+    Report("SDL_RadixSort32()", Elapsed(start), CheckValues(values, count));
+}
+
+static void
+BenchSprites(Sprite *original, Sprite *sprites, size_t count)
+{
+    Uint64 start;
+
+    SDL_memcpy(sprites, original, count * sizeof(*sprites));
+    start = SDL_GetPerformanceCounter();
+    qsort(sprites, count, sizeof(*sprites), CompareSprite);
+    Report("qsort()", Elapsed(start), CheckSprites(sprites, count, SDL_FALSE));
+
+    SDL_memcpy(sprites, original, count * sizeof(*sprites));
+    start = SDL_GetPerformanceCounter();
+    SDL_qsort(sprites, count, sizeof(*sprites), CompareSprite);
+    Report("SDL_qsort()", Elapsed(start), CheckSprites(sprites, count, SDL_FALSE));
+
+    SDL_memcpy(sprites, original, count * sizeof(*sprites));
+    start = SDL_GetPerformanceCounter();
+    if (SDL_RadixSortKeyed(sprites, count, sizeof(*sprites), offsetof(Sprite, depth)) < 0) {
+        SDL_Log("SDL_RadixSortKeyed() failed: %s\n", SDL_GetError());
+    }
+    Report("SDL_RadixSortKeyed()", Elapsed(start), CheckSprites(sprites, count, SDL_TRUE));
+}
+
+int
+main(int argc, char *argv[])
+{
+    size_t count = 1000000;
+    Uint32 *original, *values;
+    Sprite *sprite_original, *sprites;
+    size_t i;
+    int order;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        count = (size_t) SDL_atoi(argv[1]);
+        count = SDL_max(count, 1);
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    original = (Uint32 *) SDL_malloc(count * sizeof(*original));
+    values = (Uint32 *) SDL_malloc(count * sizeof(*values));
+    sprite_original = (Sprite *) SDL_malloc(count * sizeof(*sprite_original));
+    sprites = (Sprite *) SDL_malloc(count * sizeof(*sprites));
+    if (!original || !values || !sprite_original || !sprites) {
+        SDL_Log("Out of memory\n");
+        return 1;
+    }
+
+    for (order = 0; order < NUM_ORDERS; ++order) {
+        for (i = 0; i < count; ++i) {
+            original[i] = Value((Order) order, i, count);
+            sprite_original[i].x = (Sint16) i;
+            sprite_original[i].y = (Sint16) (i >> 16);
+            sprite_original[i].texture = (Uint32) i;
+            sprite_original[i].depth = Value((Order) order, i, count);
+            sprite_original[i].flags = 0;
+        }
+
+        SDL_Log("%u Uint32 values, %s:\n", (unsigned int) count, order_names[order]);
+        BenchValues(original, values, count);
+        SDL_Log("%u sprites by depth, %s:\n", (unsigned int) count, order_names[order]);
+        BenchSprites(sprite_original, sprites, count);
+    }
+
+    SDL_free(sprites);
+    SDL_free(sprite_original);
+    SDL_free(values);
+    SDL_free(original);
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
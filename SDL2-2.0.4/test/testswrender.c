@@ -0,0 +1,207 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program:  Time the software renderer with different numbers of
+   worker threads (SDL_HINT_RENDER_SOFTWARE_THREADS) and check that every
+   configuration draws exactly the same frame.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define SCREEN_W    1920
+#define SCREEN_H    1080
+#define SPRITE_SIZE 64
+
+static SDL_Surface *
+CreateSprite(void)
+{
+    SDL_Surface *sprite;
+    int x, y;
+
+    sprite = SDL_CreateRGBSurface(0, SPRITE_SIZE, SPRITE_SIZE, 32,
+                                  0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+    if (!sprite) {
+        return NULL;
+    }
+    for (y = 0; y < SPRITE_SIZE; ++y) {
+        Uint32 *row = (Uint32 *) ((Uint8 *) sprite->pixels + y * sprite->pitch);
+        for (x = 0; x < SPRITE_SIZE; ++x) {
+            int dx = x - SPRITE_SIZE / 2;
+            int dy = y - SPRITE_SIZE / 2;
+            Uint8 a = (dx * dx + dy * dy < (SPRITE_SIZE * SPRITE_SIZE) / 4) ? 200 : 0;
+            row[x] = ((Uint32) a << 24) | ((x * 4) << 16) | ((y * 4) << 8) | 0x80;
+        }
+    }
+    return sprite;
+}
+
+static void
+DrawFrame(SDL_Renderer *renderer, SDL_Texture *texture, int frame, int num_sprites)
+{
+    SDL_Rect rect;
+    int i;
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0xA0, 0xA0, 0xA0, 0xFF);
+    SDL_RenderClear(renderer);
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0x20, 0x40, 0xC0, 0x80);
+    for (i = 0; i < 16; ++i) {
+        rect.x = (i * 113 + frame * 7) % SCREEN_W - 100;
+        rect.y = (i * 67) % SCREEN_H;
+        rect.w = 300;
+        rect.h = 200;
+        SDL_RenderFillRect(renderer, &rect);
+    }
+
+    rect.w = SPRITE_SIZE;
+    rect.h = SPRITE_SIZE;
+    for (i = 0; i < num_sprites; ++i) {
+        rect.x = (i * 97 + frame * 3) % (SCREEN_W + SPRITE_SIZE) - SPRITE_SIZE;
+        rect.y = (i * 53 + frame * 5) % (SCREEN_H + SPRITE_SIZE) - SPRITE_SIZE;
+        SDL_RenderCopy(renderer, texture, NULL, &rect);
+    }
+
+    SDL_RenderPresent(renderer);
+}
+
+static double
+RunTest(const char *threads, SDL_Surface *sprite, SDL_Surface *target,
+        int num_frames, int num_sprites)
+{
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    Uint64 start, end;
+    int frame;
+
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, threads);
+    renderer = SDL_CreateSoftwareRenderer(target);
+    if (!renderer) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create renderer: %s\n", SDL_GetError());
+        return -1.0;
+    }
+    /* Use a streaming texture so the single threaded run doesn't RLE encode it,
+       RLE blending rounds differently from the regular blitters.
+     */
+    texture = SDL_CreateTexture(renderer, sprite->format->format,
+                                SDL_TEXTUREACCESS_STREAMING, sprite->w, sprite->h);
+    if (!texture) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create texture: %s\n", SDL_GetError());
+        SDL_DestroyRenderer(renderer);
+        return -1.0;
+    }
+    SDL_UpdateTexture(texture, NULL, sprite->pixels, sprite->pitch);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    /* Warm up the blit mappings before timing */
+    DrawFrame(renderer, texture, 0, num_sprites);
+
+    start = SDL_GetPerformanceCounter();
+    for (frame = 0; frame < num_frames; ++frame) {
+        DrawFrame(renderer, texture, frame, num_sprites);
+    }
+    end = SDL_GetPerformanceCounter();
+
+    /* Leave a known frame in the target for comparison */
+    DrawFrame(renderer, texture, num_frames, num_sprites);
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+
+    return (double) (end - start) * 1000.0 / SDL_GetPerformanceFrequency() / num_frames;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int thread_counts[] = { 0, 1, 2, 4, 8, 0 };
+    int num_frames = 100;
+    int num_sprites = 1000;
+    int i, status = 0;
+    SDL_Surface *sprite, *reference, *target;
+    double base_ms = 0.0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_frames = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+    if (argc > 2) {
+        num_sprites = SDL_max(SDL_atoi(argv[2]), 0);
+    }
+    thread_counts[SDL_arraysize(thread_counts) - 1] = SDL_GetCPUCount();
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    sprite = CreateSprite();
+    reference = SDL_CreateRGBSurface(0, SCREEN_W, SCREEN_H, 32,
+                                     0x00FF0000, 0x0000FF00, 0x000000FF, 0);
+    target = SDL_CreateRGBSurface(0, SCREEN_W, SCREEN_H, 32,
+                                  0x00FF0000, 0x0000FF00, 0x000000FF, 0);
+    if (!sprite || !reference || !target) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces: %s\n", SDL_GetError());
+        SDL_Quit();
+        return 1;
+    }
+
+    SDL_Log("%dx%d target, %d sprites, %d frames, %d CPUs\n",
+            SCREEN_W, SCREEN_H, num_sprites, num_frames, SDL_GetCPUCount());
+
+    for (i = 0; i < SDL_arraysize(thread_counts); ++i) {
+        SDL_Surface *surface = (i == 0) ? reference : target;
+        char threads[16];
+        double ms;
+
+        SDL_snprintf(threads, sizeof(threads), "%d", thread_counts[i]);
+        ms = RunTest(threads, sprite, surface, num_frames, num_sprites);
+        if (ms < 0.0) {
+            status = 1;
+            break;
+        }
+        if (i == 0) {
+            base_ms = ms;
+            SDL_Log("%2d threads: %8.3f ms/frame\n", thread_counts[i], ms);
+        } else {
+            int y;
+            SDL_bool same = SDL_TRUE;
+
+            for (y = 0; y < SCREEN_H && same; ++y) {
+                if (SDL_memcmp((Uint8 *) reference->pixels + y * reference->pitch,
+                               (Uint8 *) target->pixels + y * target->pitch,
+                               SCREEN_W * 4) != 0) {
+                    same = SDL_FALSE;
+                }
+            }
+            SDL_Log("%2d threads: %8.3f ms/frame (%.2fx)%s\n", thread_counts[i], ms,
+                    base_ms / ms, same ? "" : " OUTPUT DIFFERS");
+            if (!same) {
+                status = 1;
+            }
+        }
+    }
+
+    SDL_FreeSurface(target);
+    SDL_FreeSurface(reference);
+    SDL_FreeSurface(sprite);
+    SDL_Quit();
+    return status;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
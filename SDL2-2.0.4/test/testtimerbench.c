@@ -0,0 +1,154 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program:  Stress the timer thread with lots of timers at once.
+   Adds the timers with random intervals, cancels half of them, then waits
+   for the rest to fire and reports how late they were. Canceled timers
+   must never fire.
+
+   Usage: testtimerbench [timers] [longest interval in ms]
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+typedef struct
+{
+    SDL_TimerID id;
+    Uint32 due;
+    Uint32 fired;
+    SDL_bool canceled;
+} TimerInfo;
+
+static SDL_atomic_t fired_count;
+
+static Uint32 SDLCALL
+Fire(Uint32 interval, void *param)
+{
+    TimerInfo *info = (TimerInfo *) param;
+
+    info->fired = SDL_GetTicks();
+    SDL_AtomicIncRef(&fired_count);
+    return 0;
+}
+
+static double
+Milliseconds(Uint64 start, Uint64 end)
+{
+    return (double) (end - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+int
+main(int argc, char *argv[])
+{
+    TimerInfo *timers;
+    int num_timers = 100000;
+    int max_interval = 2000;
+    int i, expected = 0, missed = 0, wrong = 0;
+    Uint64 start, end;
+    Uint32 deadline, late, worst = 0;
+    double total_late = 0.0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_timers = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+    if (argc > 2) {
+        max_interval = SDL_max(SDL_atoi(argv[2]), 1);
+    }
+
+    if (SDL_Init(SDL_INIT_TIMER) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    timers = (TimerInfo *) SDL_calloc(num_timers, sizeof(*timers));
+    if (!timers) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_Quit();
+        return 1;
+    }
+    srand(1);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_timers; ++i) {
+        Uint32 interval = 1 + (rand() % max_interval);
+        timers[i].due = SDL_GetTicks() + interval;
+        timers[i].id = SDL_AddTimer(interval, Fire, &timers[i]);
+        if (!timers[i].id) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't add timer: %s\n", SDL_GetError());
+            SDL_free(timers);
+            SDL_Quit();
+            return 1;
+        }
+    }
+    end = SDL_GetPerformanceCounter();
+    SDL_Log("Added %d timers in %.2f ms\n", num_timers, Milliseconds(start, end));
+
+    /* Cancel every other timer, from the back so the order isn't trivial */
+    start = SDL_GetPerformanceCounter();
+    for (i = num_timers - 1; i >= 0; --i) {
+        if (i & 1) {
+            timers[i].canceled = SDL_RemoveTimer(timers[i].id);
+        }
+    }
+    end = SDL_GetPerformanceCounter();
+    SDL_Log("Canceled %d timers in %.2f ms\n", num_timers / 2, Milliseconds(start, end));
+
+    for (i = 0; i < num_timers; ++i) {
+        if (!timers[i].canceled) {
+            ++expected;
+        }
+    }
+
+    /* Wait for the rest, with some slack for a busy machine */
+    deadline = SDL_GetTicks() + max_interval + 5000;
+    while (SDL_AtomicGet(&fired_count) < expected &&
+           !SDL_TICKS_PASSED(SDL_GetTicks(), deadline)) {
+        SDL_Delay(10);
+    }
+    /* Give any canceled timer that wrongly fires a chance to show up */
+    SDL_Delay(100);
+
+    for (i = 0; i < num_timers; ++i) {
+        if (timers[i].canceled) {
+            if (timers[i].fired) {
+                ++wrong;
+            }
+        } else if (!timers[i].fired) {
+            ++missed;
+        } else {
+            late = timers[i].fired - timers[i].due;
+            if ((Sint32) late < 0) {
+                late = 0;
+            }
+            total_late += late;
+            worst = SDL_max(worst, late);
+        }
+    }
+
+    SDL_Log("Fired %d of %d timers, %.2f ms late on average, %u ms worst\n",
+            expected - missed, expected, expected ? total_late / expected : 0.0, worst);
+    if (missed || wrong) {
+        SDL_Log("%d timers never fired, %d canceled timers fired\n", missed, wrong);
+    }
+
+    SDL_free(timers);
+    SDL_Quit();
+    return (missed || wrong) ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
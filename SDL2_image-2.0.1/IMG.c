@@ -29,18 +29,28 @@
 
 #define ARRAYSIZE(a) (sizeof(a) / sizeof((a)[0]))
 
+/* Loaders count as SDL_MEMTAG_IMAGE when SDL tracks its memory */
+#ifdef SDL_MEMTAG_IMAGE
+#define IMG_calloc(n, size)     SDL_TaggedCalloc(SDL_MEMTAG_IMAGE, n, size)
+#define IMG_realloc(mem, size)  SDL_TaggedRealloc(SDL_MEMTAG_IMAGE, mem, size)
+#else
+#define IMG_calloc(n, size)     SDL_calloc(n, size)
+#define IMG_realloc(mem, size)  SDL_realloc(mem, size)
+#endif
+
 /* Table of image detection and loading functions */
 static struct {
     char *type;
     int (SDLCALL *is)(SDL_RWops *src);
     SDL_Surface *(SDLCALL *load)(SDL_RWops *src);
+    int not_reentrant;  /* the loader keeps its state in static variables */
 } supported[] = {
     /* keep magicless formats first */
     { "TGA", NULL,      IMG_LoadTGA_RW },
     { "CUR", IMG_isCUR, IMG_LoadCUR_RW },
     { "ICO", IMG_isICO, IMG_LoadICO_RW },
     { "BMP", IMG_isBMP, IMG_LoadBMP_RW },
-    { "GIF", IMG_isGIF, IMG_LoadGIF_RW },
+    { "GIF", IMG_isGIF, IMG_LoadGIF_RW, 1 },
     { "JPG", IMG_isJPG, IMG_LoadJPG_RW },
     { "LBM", IMG_isLBM, IMG_LoadLBM_RW },
     { "PCX", IMG_isPCX, IMG_LoadPCX_RW },
@@ -48,7 +58,7 @@ static struct {
     { "PNM", IMG_isPNM, IMG_LoadPNM_RW }, /* P[BGP]M share code */
     { "TIF", IMG_isTIF, IMG_LoadTIF_RW },
     { "XCF", IMG_isXCF, IMG_LoadXCF_RW },
-    { "XPM", IMG_isXPM, IMG_LoadXPM_RW },
+    { "XPM", IMG_isXPM, IMG_LoadXPM_RW, 1 },
     { "XV",  IMG_isXV,  IMG_LoadXV_RW  },
     { "WEBP", IMG_isWEBP, IMG_LoadWEBP_RW },
 };
@@ -101,7 +111,11 @@ int IMG_Init(int flags)
             result |= IMG_INIT_WEBP;
         }
     }
-    initialized |= result;
+    /* The loaders call this for every image, maybe on IMG_Loader threads,
+       so only write when something new was initialized */
+    if (result & ~initialized) {
+        initialized |= result;
+    }
 
     return result;
 }
@@ -159,8 +173,10 @@ static int IMG_string_equals(const char *str1, const char *str2)
     return (!*str1 && !*str2);
 }
 
-/* Load an image from an SDL datasource, optionally specifying the type */
-SDL_Surface *IMG_LoadTyped_RW(SDL_RWops *src, int freesrc, const char *type)
+/* Load an image from an SDL datasource, optionally specifying the type.
+   If 'serial' is set, it's held while loaders that aren't reentrant run.
+ */
+static SDL_Surface *IMG_LoadTypedSerial_RW(SDL_RWops *src, int freesrc, const char *type, SDL_mutex *serial)
 {
     int i;
     SDL_Surface *image;
@@ -195,7 +211,13 @@ SDL_Surface *IMG_LoadTyped_RW(SDL_RWops *src, int freesrc, const char *type)
         fprintf(stderr, "IMGLIB: Loading image as %s\n",
             supported[i].type);
 #endif
-        image = supported[i].load(src);
+        if(serial && supported[i].not_reentrant) {
+            SDL_LockMutex(serial);
+            image = supported[i].load(src);
+            SDL_UnlockMutex(serial);
+        } else {
+            image = supported[i].load(src);
+        }
         if(freesrc)
             SDL_RWclose(src);
         return image;
@@ -208,6 +230,12 @@ SDL_Surface *IMG_LoadTyped_RW(SDL_RWops *src, int freesrc, const char *type)
     return NULL;
 }
 
+/* Load an image from an SDL datasource, optionally specifying the type */
+SDL_Surface *IMG_LoadTyped_RW(SDL_RWops *src, int freesrc, const char *type)
+{
+    return IMG_LoadTypedSerial_RW(src, freesrc, type, NULL);
+}
+
 #if SDL_VERSION_ATLEAST(2,0,0)
 SDL_Texture *IMG_LoadTexture(SDL_Renderer *renderer, const char *file)
 {
@@ -242,3 +270,364 @@ SDL_Texture *IMG_LoadTextureTyped_RW(SDL_Renderer *renderer, SDL_RWops *src, int
     return texture;
 }
 #endif /* SDL 2.0 */
+
+/* A batch of images queued on an IMG_Loader */
+typedef struct IMG_LoadJob {
+    int id;
+    int priority;
+    char *file;
+    SDL_RWops *src;
+    int freesrc;
+    char *type;
+    SDL_Surface *surface;
+    char *error;
+    struct IMG_LoadJob *next;
+} IMG_LoadJob;
+
+struct IMG_Loader {
+    SDL_mutex *lock;
+    SDL_mutex *serial;      /* held while a loader that isn't reentrant runs */
+    SDL_cond *work;         /* signaled when jobs are queued or the loader quits */
+    SDL_cond *finished;     /* signaled when a job is done */
+    SDL_Thread **threads;
+    int num_threads;
+    IMG_LoadJob **queue;    /* heap of jobs waiting for a thread */
+    int num_queued;
+    int max_queued;
+    int num_running;
+    IMG_LoadJob *done;      /* jobs waiting to be picked up, oldest first */
+    IMG_LoadJob *done_tail;
+    int next_id;
+    SDL_bool quit;
+};
+
+static void IMG_FreeLoadJob(IMG_LoadJob *job)
+{
+    if (job->src && job->freesrc) {
+        SDL_RWclose(job->src);
+    }
+    if (job->surface) {
+        SDL_FreeSurface(job->surface);
+    }
+    SDL_free(job->file);
+    SDL_free(job->type);
+    SDL_free(job->error);
+    SDL_free(job);
+}
+
+/* Higher priority first, then in the order the jobs were queued */
+static SDL_bool IMG_LoadJobBefore(const IMG_LoadJob *a, const IMG_LoadJob *b)
+{
+    if (a->priority != b->priority) {
+        return (a->priority > b->priority);
+    }
+    return (a->id < b->id);
+}
+
+static void IMG_PushLoadJob(IMG_Loader *loader, IMG_LoadJob *job)
+{
+    int i = loader->num_queued++;
+
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!IMG_LoadJobBefore(job, loader->queue[parent])) {
+            break;
+        }
+        loader->queue[i] = loader->queue[parent];
+        i = parent;
+    }
+    loader->queue[i] = job;
+}
+
+static IMG_LoadJob *IMG_PopLoadJob(IMG_Loader *loader)
+{
+    IMG_LoadJob *first = loader->queue[0];
+    IMG_LoadJob *last = loader->queue[--loader->num_queued];
+    int i = 0;
+
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= loader->num_queued) {
+            break;
+        }
+        if (child + 1 < loader->num_queued &&
+            IMG_LoadJobBefore(loader->queue[child + 1], loader->queue[child])) {
+            ++child;
+        }
+        if (!IMG_LoadJobBefore(loader->queue[child], last)) {
+            break;
+        }
+        loader->queue[i] = loader->queue[child];
+        i = child;
+    }
+    loader->queue[i] = last;
+    return first;
+}
+
+static int SDLCALL IMG_LoaderThread(void *data)
+{
+    IMG_Loader *loader = (IMG_Loader *)data;
+    IMG_LoadJob *job;
+
+    SDL_LockMutex(loader->lock);
+    for (;;) {
+        while (!loader->quit && loader->num_queued == 0) {
+            SDL_CondWait(loader->work, loader->lock);
+        }
+        if (loader->quit) {
+            break;
+        }
+        job = IMG_PopLoadJob(loader);
+        ++loader->num_running;
+        SDL_UnlockMutex(loader->lock);
+
+        /* This is what IMG_Load() and IMG_LoadTyped_RW() do */
+        if (job->file) {
+            const char *ext = SDL_strrchr(job->file, '.');
+            if (ext) {
+                ext++;
+            }
+            job->src = SDL_RWFromFile(job->file, "rb");
+            job->freesrc = 1;
+            if (job->src) {
+                job->surface = IMG_LoadTypedSerial_RW(job->src, 1, ext, loader->serial);
+            }
+        } else {
+            job->surface = IMG_LoadTypedSerial_RW(job->src, job->freesrc, job->type, loader->serial);
+        }
+        job->src = NULL;
+        if (!job->surface) {
+            job->error = SDL_strdup(IMG_GetError());
+        }
+
+        SDL_LockMutex(loader->lock);
+        --loader->num_running;
+        if (loader->done_tail) {
+            loader->done_tail->next = job;
+        } else {
+            loader->done = job;
+        }
+        loader->done_tail = job;
+        SDL_CondBroadcast(loader->finished);
+    }
+    SDL_UnlockMutex(loader->lock);
+    return 0;
+}
+
+IMG_Loader *IMG_CreateLoader(int threads)
+{
+    IMG_Loader *loader;
+    int i;
+
+    if (threads <= 0) {
+        threads = SDL_GetCPUCount();
+    }
+
+    /* Bring up every image library now, so the threads never race to do it */
+    IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG | IMG_INIT_TIF | IMG_INIT_WEBP);
+
+    loader = (IMG_Loader *)IMG_calloc(1, sizeof(*loader));
+    if (!loader) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    loader->next_id = 1;
+    loader->lock = SDL_CreateMutex();
+    loader->serial = SDL_CreateMutex();
+    loader->work = SDL_CreateCond();
+    loader->finished = SDL_CreateCond();
+    loader->threads = (SDL_Thread **)IMG_calloc(threads, sizeof(*loader->threads));
+    if (!loader->lock || !loader->serial || !loader->work || !loader->finished || !loader->threads) {
+        if (!loader->threads) {
+            SDL_OutOfMemory();
+        }
+        IMG_DestroyLoader(loader);
+        return NULL;
+    }
+    for (i = 0; i < threads; ++i) {
+        loader->threads[i] = SDL_CreateThread(IMG_LoaderThread, "SDL_image loader", loader);
+        if (!loader->threads[i]) {
+            IMG_DestroyLoader(loader);
+            return NULL;
+        }
+        ++loader->num_threads;
+    }
+    return loader;
+}
+
+static int IMG_QueueLoadJob(IMG_Loader *loader, IMG_LoadJob *job, int priority)
+{
+    int id;
+
+    SDL_LockMutex(loader->lock);
+    if (loader->num_queued == loader->max_queued) {
+        int max_queued = loader->max_queued ? 2 * loader->max_queued : 64;
+        IMG_LoadJob **queue = (IMG_LoadJob **)IMG_realloc(loader->queue, max_queued * sizeof(*queue));
+        if (!queue) {
+            SDL_UnlockMutex(loader->lock);
+            IMG_FreeLoadJob(job);
+            return SDL_OutOfMemory();
+        }
+        loader->queue = queue;
+        loader->max_queued = max_queued;
+    }
+    id = job->id = loader->next_id++;
+    job->priority = priority;
+    IMG_PushLoadJob(loader, job);
+    SDL_CondSignal(loader->work);
+    SDL_UnlockMutex(loader->lock);
+    return id;
+}
+
+int IMG_QueueLoad(IMG_Loader *loader, const char *file, int priority)
+{
+    IMG_LoadJob *job;
+
+    if (!loader || !file) {
+        IMG_SetError("Passed a NULL loader or file");
+        return -1;
+    }
+    job = (IMG_LoadJob *)IMG_calloc(1, sizeof(*job));
+    if (!job || !(job->file = SDL_strdup(file))) {
+        SDL_free(job);
+        return SDL_OutOfMemory();
+    }
+    return IMG_QueueLoadJob(loader, job, priority);
+}
+
+int IMG_QueueLoadTyped_RW(IMG_Loader *loader, SDL_RWops *src, int freesrc, const char *type, int priority)
+{
+    IMG_LoadJob *job;
+
+    if (!loader || !src) {
+        IMG_SetError("Passed a NULL loader or data source");
+        if (src && freesrc) {
+            SDL_RWclose(src);
+        }
+        return -1;
+    }
+    job = (IMG_LoadJob *)IMG_calloc(1, sizeof(*job));
+    if (!job || (type && !(job->type = SDL_strdup(type)))) {
+        SDL_free(job);
+        if (freesrc) {
+            SDL_RWclose(src);
+        }
+        return SDL_OutOfMemory();
+    }
+    job->src = src;
+    job->freesrc = freesrc;
+    return IMG_QueueLoadJob(loader, job, priority);
+}
+
+int IMG_GetLoaderPending(IMG_Loader *loader)
+{
+    int pending;
+
+    if (!loader) {
+        return 0;
+    }
+    SDL_LockMutex(loader->lock);
+    pending = loader->num_queued + loader->num_running;
+    SDL_UnlockMutex(loader->lock);
+    return pending;
+}
+
+/* Hand over the oldest finished job, with the loader locked */
+static int IMG_TakeLoadJob(IMG_Loader *loader, SDL_Surface **surface)
+{
+    IMG_LoadJob *job = loader->done;
+    int id;
+
+    loader->done = job->next;
+    if (!loader->done) {
+        loader->done_tail = NULL;
+    }
+    id = job->id;
+    if (job->surface) {
+        *surface = job->surface;
+        job->surface = NULL;
+    } else {
+        *surface = NULL;
+        IMG_SetError("%s", job->error ? job->error : "Out of memory");
+    }
+    IMG_FreeLoadJob(job);
+    return id;
+}
+
+int IMG_PollLoader(IMG_Loader *loader, SDL_Surface **surface)
+{
+    int id = 0;
+
+    *surface = NULL;
+    if (!loader) {
+        return 0;
+    }
+    SDL_LockMutex(loader->lock);
+    if (loader->done) {
+        id = IMG_TakeLoadJob(loader, surface);
+    }
+    SDL_UnlockMutex(loader->lock);
+    return id;
+}
+
+int IMG_WaitLoader(IMG_Loader *loader, SDL_Surface **surface)
+{
+    int id = 0;
+
+    *surface = NULL;
+    if (!loader) {
+        return 0;
+    }
+    SDL_LockMutex(loader->lock);
+    while (!loader->done && (loader->num_queued + loader->num_running) > 0) {
+        SDL_CondWait(loader->finished, loader->lock);
+    }
+    if (loader->done) {
+        id = IMG_TakeLoadJob(loader, surface);
+    }
+    SDL_UnlockMutex(loader->lock);
+    return id;
+}
+
+void IMG_DestroyLoader(IMG_Loader *loader)
+{
+    int i;
+
+    if (!loader) {
+        return;
+    }
+
+    /* Images being decoded are finished, the rest are dropped */
+    if (loader->lock) {
+        SDL_LockMutex(loader->lock);
+        loader->quit = SDL_TRUE;
+        SDL_CondBroadcast(loader->work);
+        SDL_UnlockMutex(loader->lock);
+    }
+    for (i = 0; i < loader->num_threads; ++i) {
+        SDL_WaitThread(loader->threads[i], NULL);
+    }
+    for (i = 0; i < loader->num_queued; ++i) {
+        IMG_FreeLoadJob(loader->queue[i]);
+    }
+    while (loader->done) {
+        IMG_LoadJob *job = loader->done;
+        loader->done = job->next;
+        IMG_FreeLoadJob(job);
+    }
+    SDL_free(loader->queue);
+    SDL_free(loader->threads);
+    if (loader->finished) {
+        SDL_DestroyCond(loader->finished);
+    }
+    if (loader->work) {
+        SDL_DestroyCond(loader->work);
+    }
+    if (loader->serial) {
+        SDL_DestroyMutex(loader->serial);
+    }
+    if (loader->lock) {
+        SDL_DestroyMutex(loader->lock);
+    }
+    SDL_free(loader);
+}
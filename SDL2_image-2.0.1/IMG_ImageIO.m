@@ -747,6 +747,73 @@ SDL_Surface* IMG_LoadPNG_RW (SDL_RWops *src)
     return LoadImageFromRWops (src, kUTTypePNG);
 }
 
+/* ImageIO decodes the whole image at once, so it's copied into the target
+   afterwards and the callback gets all the rows in one go */
+static SDL_Surface* LoadPNGForTarget (SDL_RWops *src, int w, int h)
+{
+    SDL_Surface *image = IMG_LoadPNG_RW(src);
+    if (image && (image->w > w || image->h > h)) {
+        SDL_FreeSurface(image);
+        IMG_SetError("PNG image is larger than the target");
+        return NULL;
+    }
+    return image;
+}
+
+static int FinishPNGForTarget (SDL_Surface *image, int result, IMG_RowCallback callback, void *userdata)
+{
+    if (result == 0 && callback && callback(userdata, 0, image->h, image->h) < 0) {
+        IMG_SetError("PNG decoding was stopped");
+        result = -1;
+    }
+    SDL_FreeSurface(image);
+    return result;
+}
+
+int IMG_LoadPNGToSurface_RW (SDL_RWops *src, SDL_Surface *surface, IMG_RowCallback callback, void *userdata)
+{
+    SDL_Surface *image;
+
+    if (!surface) {
+        IMG_SetError("Passed a NULL surface");
+        return -1;
+    }
+    image = LoadPNGForTarget(src, surface->w, surface->h);
+    if (!image) {
+        return -1;
+    }
+    SDL_SetColorKey(image, SDL_FALSE, 0);
+    SDL_SetSurfaceBlendMode(image, SDL_BLENDMODE_NONE);
+    return FinishPNGForTarget(image, SDL_BlitSurface(image, NULL, surface, NULL), callback, userdata);
+}
+
+int IMG_LoadPNGToTexture_RW (SDL_RWops *src, SDL_Texture *texture, IMG_RowCallback callback, void *userdata)
+{
+    SDL_Surface *image, *converted;
+    SDL_Rect rect;
+    Uint32 format;
+    int w, h, result;
+
+    if (SDL_QueryTexture(texture, &format, NULL, &w, &h) < 0) {
+        return -1;
+    }
+    image = LoadPNGForTarget(src, w, h);
+    if (!image) {
+        return -1;
+    }
+    result = -1;
+    converted = SDL_ConvertSurfaceFormat(image, format, 0);
+    if (converted) {
+        rect.x = 0;
+        rect.y = 0;
+        rect.w = converted->w;
+        rect.h = converted->h;
+        result = SDL_UpdateTexture(texture, &rect, converted->pixels, converted->pitch);
+        SDL_FreeSurface(converted);
+    }
+    return FinishPNGForTarget(image, result, callback, userdata);
+}
+
 SDL_Surface* IMG_LoadTGA_RW (SDL_RWops *src)
 {
     return LoadImageFromRWops(src, CFSTR("com.truevision.tga-image"));
@@ -79,6 +79,13 @@ typedef png_infop png_const_inforp;
 #endif
 #endif
 
+/* Decode buffers count as SDL_MEMTAG_IMAGE when SDL tracks its memory */
+#ifdef SDL_MEMTAG_IMAGE
+#define IMG_malloc(size)    SDL_TaggedMalloc(SDL_MEMTAG_IMAGE, size)
+#else
+#define IMG_malloc(size)    SDL_malloc(size)
+#endif
+
 static struct {
     int loaded;
     void *handle;
@@ -92,13 +99,17 @@ static struct {
     png_uint_32 (*png_get_tRNS) (png_const_structrp png_ptr, png_infop info_ptr, png_bytep *trans, int *num_trans, png_color_16p *trans_values);
     png_uint_32 (*png_get_valid) (png_const_structrp png_ptr, png_const_inforp info_ptr, png_uint_32 flag);
     void (*png_read_image) (png_structp png_ptr, png_bytepp image);
+    void (*png_read_rows) (png_structp png_ptr, png_bytepp row, png_bytepp display_row, png_uint_32 num_rows);
     void (*png_read_info) (png_structp png_ptr, png_infop info_ptr);
     void (*png_read_update_info) (png_structp png_ptr, png_infop info_ptr);
     void (*png_set_expand) (png_structp png_ptr);
     void (*png_set_gray_to_rgb) (png_structp png_ptr);
+    void (*png_set_filler) (png_structp png_ptr, png_uint_32 filler, int flags);
+    int (*png_set_interlace_handling) (png_structp png_ptr);
     void (*png_set_packing) (png_structp png_ptr);
     void (*png_set_read_fn) (png_structp png_ptr, png_voidp io_ptr, png_rw_ptr read_data_fn);
     void (*png_set_strip_16) (png_structp png_ptr);
+    void (*png_set_swap_alpha) (png_structp png_ptr);
     int (*png_sig_cmp) (png_const_bytep sig, png_size_t start, png_size_t num_to_check);
 	void (*png_set_bgr) (png_structp png_ptr);
 #ifndef LIBPNG_VERSION_12
@@ -184,6 +195,13 @@ int IMG_InitPNG()
             SDL_UnloadObject(lib.handle);
             return -1;
         }
+        lib.png_read_rows =
+            (void (*) (png_structp, png_bytepp, png_bytepp, png_uint_32))
+            SDL_LoadFunction(lib.handle, "png_read_rows");
+        if ( lib.png_read_rows == NULL ) {
+            SDL_UnloadObject(lib.handle);
+            return -1;
+        }
         lib.png_read_info =
             (void (*) (png_structp, png_infop))
             SDL_LoadFunction(lib.handle, "png_read_info");
@@ -212,6 +230,20 @@ int IMG_InitPNG()
             SDL_UnloadObject(lib.handle);
             return -1;
         }
+        lib.png_set_filler =
+            (void (*) (png_structp, png_uint_32, int))
+            SDL_LoadFunction(lib.handle, "png_set_filler");
+        if ( lib.png_set_filler == NULL ) {
+            SDL_UnloadObject(lib.handle);
+            return -1;
+        }
+        lib.png_set_interlace_handling =
+            (int (*) (png_structp))
+            SDL_LoadFunction(lib.handle, "png_set_interlace_handling");
+        if ( lib.png_set_interlace_handling == NULL ) {
+            SDL_UnloadObject(lib.handle);
+            return -1;
+        }
         lib.png_set_packing =
             (void (*) (png_structp))
             SDL_LoadFunction(lib.handle, "png_set_packing");
@@ -233,6 +265,13 @@ int IMG_InitPNG()
             SDL_UnloadObject(lib.handle);
             return -1;
         }
+        lib.png_set_swap_alpha =
+            (void (*) (png_structp))
+            SDL_LoadFunction(lib.handle, "png_set_swap_alpha");
+        if ( lib.png_set_swap_alpha == NULL ) {
+            SDL_UnloadObject(lib.handle);
+            return -1;
+        }
         lib.png_sig_cmp =
             (int (*) (png_const_bytep, png_size_t, png_size_t))
             SDL_LoadFunction(lib.handle, "png_sig_cmp");
@@ -285,15 +324,19 @@ int IMG_InitPNG()
         lib.png_get_tRNS = png_get_tRNS;
         lib.png_get_valid = png_get_valid;
         lib.png_read_image = png_read_image;
+        lib.png_read_rows = png_read_rows;
         lib.png_read_info = png_read_info;
         lib.png_read_update_info = png_read_update_info;
         lib.png_set_expand = png_set_expand;
         lib.png_set_gray_to_rgb = png_set_gray_to_rgb;
+        lib.png_set_filler = png_set_filler;
+        lib.png_set_interlace_handling = png_set_interlace_handling;
         lib.png_set_packing = png_set_packing;
         lib.png_set_read_fn = png_set_read_fn;
         lib.png_set_strip_16 = png_set_strip_16;
+        lib.png_set_swap_alpha = png_set_swap_alpha;
         lib.png_sig_cmp = png_sig_cmp;
-		lib.png_sig_bgr = png_sig_bgr;
+		lib.png_set_bgr = png_set_bgr;
 #ifndef LIBPNG_VERSION_12
         lib.png_set_longjmp_fn = png_set_longjmp_fn;
 #endif
@@ -508,7 +551,7 @@ SDL_Surface *IMG_LoadPNG_RW(SDL_RWops *src)
     }
 
     /* Create the array of pointers to image data */
-    row_pointers = (png_bytep*) SDL_malloc(sizeof(png_bytep)*height);
+    row_pointers = (png_bytep*) IMG_malloc(sizeof(png_bytep)*height);
     if ( (row_pointers == NULL) ) {
         error = "Out of memory";
         goto done;
@@ -567,11 +610,315 @@ done:   /* Clean up and return */
             SDL_FreeSurface(surface);
             surface = NULL;
         }
-        IMG_SetError(error);
+        IMG_SetError("%s", error);
     }
     return(surface);
 }
 
+/* Rows decoded at a time into a texture or a conversion buffer */
+#define PNG_STRIPE_ROWS 64
+
+/* Where IMG_LoadPNGToSurface_RW() and IMG_LoadPNGToTexture_RW() put the rows */
+typedef struct {
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    Uint32 format;
+    int w, h;
+} PNG_Target;
+
+/* Find the byte a channel takes up in a 32-bit pixel in memory, or -1 if
+   the channel isn't a whole byte */
+static int PNG_ByteIndex(Uint32 mask)
+{
+    int shift = 0;
+
+    if ( mask == 0 ) {
+        return -1;
+    }
+    while ( !(mask & 1) ) {
+        mask >>= 1;
+        ++shift;
+    }
+    if ( mask != 0xFF ) {
+        return -1;
+    }
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    return shift / 8;
+#else
+    return 3 - shift / 8;
+#endif
+}
+
+/* See if libpng can write pixels in a format itself, which it can for
+   32-bit formats with the bytes in RGBA, BGRA, ARGB or ABGR order */
+static SDL_bool PNG_DirectFormat(Uint32 format, int *bgr, int *alpha_first)
+{
+    int bpp, r, g, b, first;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+
+    if ( SDL_ISPIXELFORMAT_FOURCC(format) ||
+         !SDL_PixelFormatEnumToMasks(format, &bpp, &Rmask, &Gmask, &Bmask, &Amask) ||
+         bpp != 32 ) {
+        return SDL_FALSE;
+    }
+    r = PNG_ByteIndex(Rmask);
+    g = PNG_ByteIndex(Gmask);
+    b = PNG_ByteIndex(Bmask);
+    if ( r < 0 || g < 0 || b < 0 ) {
+        return SDL_FALSE;
+    }
+    if ( g == r + 1 && b == g + 1 ) {
+        *bgr = 0;
+        first = r;
+    } else if ( g == b + 1 && r == g + 1 ) {
+        *bgr = 1;
+        first = b;
+    } else {
+        return SDL_FALSE;
+    }
+    if ( first > 1 || (Amask && PNG_ByteIndex(Amask) != (first ? 0 : 3)) ) {
+        return SDL_FALSE;
+    }
+    *alpha_first = first;
+    return SDL_TRUE;
+}
+
+/* Get at rows y through y+rows-1 of the target */
+static int PNG_LockRows(PNG_Target *target, int y, int w, int rows, Uint8 **pixels, int *pitch)
+{
+    if ( target->texture ) {
+        SDL_Rect rect;
+        void *locked;
+
+        rect.x = 0;
+        rect.y = y;
+        rect.w = w;
+        rect.h = rows;
+        if ( SDL_LockTexture(target->texture, &rect, &locked, pitch) < 0 ) {
+            return -1;
+        }
+        *pixels = (Uint8 *)locked;
+    } else {
+        if ( SDL_MUSTLOCK(target->surface) && SDL_LockSurface(target->surface) < 0 ) {
+            return -1;
+        }
+        *pixels = (Uint8 *)target->surface->pixels + y * target->surface->pitch;
+        *pitch = target->surface->pitch;
+    }
+    return 0;
+}
+
+static void PNG_UnlockRows(PNG_Target *target)
+{
+    if ( target->texture ) {
+        SDL_UnlockTexture(target->texture);
+    } else if ( SDL_MUSTLOCK(target->surface) ) {
+        SDL_UnlockSurface(target->surface);
+    }
+}
+
+/* Decode a PNG image into the top left corner of a target.
+
+   If libpng can write the target's format itself, surface rows are decoded
+   in place and texture rows into the locked texture, a stripe at a time.
+   Otherwise a stripe at a time is decoded into a small buffer and converted
+   into the target.  Interlaced images are read in several passes over the
+   whole image, so unless they can be decoded in place they go through a
+   buffer the size of the image.
+ */
+static int PNG_LoadInto(SDL_RWops *src, PNG_Target *target, IMG_RowCallback callback, void *userdata)
+{
+    Sint64 start;
+    const char *error;
+    png_structp png_ptr;
+    png_infop info_ptr;
+    png_uint_32 width, height;
+    int bit_depth, color_type, interlace_type;
+    int bgr = 0, alpha_first = 0;
+    SDL_bool direct;
+    Uint32 format;
+    Uint8 *volatile buffer;
+    volatile int locked;
+    png_bytep row_pointers[PNG_STRIPE_ROWS];
+    Uint8 *pixels, *dst;
+    int pitch, dst_pitch;
+    int passes, pass, y, rows, i;
+
+    if ( !src ) {
+        /* The error message has been set in SDL_RWFromFile */
+        return -1;
+    }
+    start = SDL_RWtell(src);
+
+    if ( !IMG_Init(IMG_INIT_PNG) ) {
+        return -1;
+    }
+
+    /* Initialize the data we will clean up when we're done */
+    error = NULL;
+    png_ptr = NULL; info_ptr = NULL; buffer = NULL; locked = 0;
+
+    png_ptr = lib.png_create_read_struct(PNG_LIBPNG_VER_STRING,
+                      NULL,NULL,NULL);
+    if (png_ptr == NULL){
+        error = "Couldn't allocate memory for PNG file or incompatible PNG dll";
+        goto done;
+    }
+    info_ptr = lib.png_create_info_struct(png_ptr);
+    if (info_ptr == NULL) {
+        error = "Couldn't create image information for PNG file";
+        goto done;
+    }
+#ifndef LIBPNG_VERSION_12
+    if ( setjmp(*lib.png_set_longjmp_fn(png_ptr, longjmp, sizeof (jmp_buf))) )
+#else
+    if ( setjmp(png_ptr->jmpbuf) )
+#endif
+    {
+        error = "Error reading the PNG file.";
+        goto done;
+    }
+
+    lib.png_set_read_fn(png_ptr, src, png_read_data);
+    lib.png_read_info(png_ptr, info_ptr);
+    lib.png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth,
+            &color_type, &interlace_type, NULL, NULL);
+    if ( width > (png_uint_32)target->w || height > (png_uint_32)target->h ) {
+        error = "PNG image is larger than the target";
+        goto done;
+    }
+
+    /* Expand everything to 8-bit RGB, with alpha if there is transparency
+       and filler otherwise, in the byte order of the target if possible */
+    direct = PNG_DirectFormat(target->format, &bgr, &alpha_first);
+    if ( direct ) {
+        format = target->format;
+    } else {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+        format = SDL_PIXELFORMAT_ABGR8888;
+#else
+        format = SDL_PIXELFORMAT_RGBA8888;
+#endif
+    }
+    lib.png_set_strip_16(png_ptr);
+    lib.png_set_packing(png_ptr);
+    lib.png_set_expand(png_ptr);
+    if ( !(color_type & PNG_COLOR_MASK_COLOR) ) {
+        lib.png_set_gray_to_rgb(png_ptr);
+    }
+    if ( bgr ) {
+        lib.png_set_bgr(png_ptr);
+    }
+    if ( (color_type & PNG_COLOR_MASK_ALPHA) ||
+         lib.png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS) ) {
+        if ( alpha_first ) {
+            lib.png_set_swap_alpha(png_ptr);
+        }
+    } else {
+        lib.png_set_filler(png_ptr, 0xFF, alpha_first ? PNG_FILLER_BEFORE : PNG_FILLER_AFTER);
+    }
+    passes = lib.png_set_interlace_handling(png_ptr);
+    lib.png_read_update_info(png_ptr, info_ptr);
+
+    if ( !direct || (passes > 1 && target->texture) ) {
+        buffer = (Uint8 *)IMG_malloc((size_t)width * 4 *
+                                     (passes > 1 ? height : PNG_STRIPE_ROWS));
+        if ( buffer == NULL ) {
+            error = "Out of memory";
+            goto done;
+        }
+    }
+
+    for ( pass = 0; pass < passes; ++pass ) {
+        for ( y = 0; y < (int)height; y += rows ) {
+            rows = SDL_min(PNG_STRIPE_ROWS, (int)height - y);
+
+            if ( buffer ) {
+                pitch = width * 4;
+                pixels = buffer + (passes > 1 ? y * pitch : 0);
+            } else {
+                if ( PNG_LockRows(target, y, width, rows, &pixels, &pitch) < 0 ) {
+                    error = SDL_GetError();
+                    goto done;
+                }
+                locked = 1;
+            }
+            for ( i = 0; i < rows; ++i ) {
+                row_pointers[i] = pixels + i * pitch;
+            }
+            lib.png_read_rows(png_ptr, row_pointers, NULL, rows);
+
+            /* The rows are only done after the last pass */
+            if ( pass == passes - 1 && buffer ) {
+                if ( PNG_LockRows(target, y, width, rows, &dst, &dst_pitch) < 0 ) {
+                    error = SDL_GetError();
+                    goto done;
+                }
+                locked = 1;
+                if ( SDL_ConvertPixels(width, rows, format, pixels, pitch,
+                                       target->format, dst, dst_pitch) < 0 ) {
+                    error = SDL_GetError();
+                    goto done;
+                }
+            }
+            if ( locked ) {
+                PNG_UnlockRows(target);
+                locked = 0;
+            }
+            if ( pass == passes - 1 && callback &&
+                 callback(userdata, y, rows, height) < 0 ) {
+                error = "PNG decoding was stopped";
+                goto done;
+            }
+        }
+    }
+
+done:   /* Clean up and return */
+    if ( locked ) {
+        PNG_UnlockRows(target);
+    }
+    if ( png_ptr ) {
+        lib.png_destroy_read_struct(&png_ptr,
+                                info_ptr ? &info_ptr : (png_infopp)0,
+                                (png_infopp)0);
+    }
+    SDL_free(buffer);
+    if ( error ) {
+        SDL_RWseek(src, start, RW_SEEK_SET);
+        IMG_SetError("%s", error);
+        return(-1);
+    }
+    return(0);
+}
+
+int IMG_LoadPNGToSurface_RW(SDL_RWops *src, SDL_Surface *surface, IMG_RowCallback callback, void *userdata)
+{
+    PNG_Target target;
+
+    if ( !surface ) {
+        IMG_SetError("Passed a NULL surface");
+        return(-1);
+    }
+    target.surface = surface;
+    target.texture = NULL;
+    target.format = surface->format->format;
+    target.w = surface->w;
+    target.h = surface->h;
+    return PNG_LoadInto(src, &target, callback, userdata);
+}
+
+int IMG_LoadPNGToTexture_RW(SDL_RWops *src, SDL_Texture *texture, IMG_RowCallback callback, void *userdata)
+{
+    PNG_Target target;
+
+    target.surface = NULL;
+    target.texture = texture;
+    if ( SDL_QueryTexture(texture, &target.format, NULL, &target.w, &target.h) < 0 ) {
+        return(-1);
+    }
+    return PNG_LoadInto(src, &target, callback, userdata);
+}
+
 #else
 
 int IMG_InitPNG()
@@ -596,10 +943,52 @@ SDL_Surface *IMG_LoadPNG_RW(SDL_RWops *src)
     return(NULL);
 }
 
+int IMG_LoadPNGToSurface_RW(SDL_RWops *src, SDL_Surface *surface, IMG_RowCallback callback, void *userdata)
+{
+    IMG_SetError("PNG images are not supported");
+    return(-1);
+}
+
+int IMG_LoadPNGToTexture_RW(SDL_RWops *src, SDL_Texture *texture, IMG_RowCallback callback, void *userdata)
+{
+    IMG_SetError("PNG images are not supported");
+    return(-1);
+}
+
 #endif /* LOAD_PNG */
 
 #endif /* !defined(__APPLE__) || defined(SDL_IMAGE_USE_COMMON_BACKEND) */
 
+/* The IHDR chunk always comes first, right after the signature */
+int IMG_QueryPNG_RW(SDL_RWops *src, int *w, int *h)
+{
+    static const Uint8 signature[12] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n', 0, 0, 0, 13 };
+    Sint64 start;
+    Uint8 header[24];
+    int result = -1;
+
+    if ( !src ) {
+        /* The error message has been set in SDL_RWFromFile */
+        return(-1);
+    }
+    start = SDL_RWtell(src);
+    if ( SDL_RWread(src, header, sizeof(header), 1) == 1 &&
+         SDL_memcmp(header, signature, sizeof(signature)) == 0 &&
+         SDL_memcmp(&header[12], "IHDR", 4) == 0 ) {
+        if ( w ) {
+            *w = (int)((header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19]);
+        }
+        if ( h ) {
+            *h = (int)((header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23]);
+        }
+        result = 0;
+    } else {
+        IMG_SetError("Not a PNG image");
+    }
+    SDL_RWseek(src, start, RW_SEEK_SET);
+    return(result);
+}
+
 /* We'll always have PNG save support */
 #define SAVE_PNG
 
@@ -93,6 +93,49 @@ extern DECLSPEC SDL_Texture * SDLCALL IMG_LoadTexture_RW(SDL_Renderer *renderer,
 extern DECLSPEC SDL_Texture * SDLCALL IMG_LoadTextureTyped_RW(SDL_Renderer *renderer, SDL_RWops *src, int freesrc, const char *type);
 #endif /* SDL 2.0 */
 
+/* Load a batch of images in the background.
+   A loader decodes queued images into surfaces on a pool of threads,
+   highest priority first and in the order they were queued otherwise.
+   Finished surfaces are picked up with IMG_PollLoader() or IMG_WaitLoader(),
+   and textures can then be created from them on the rendering thread.
+
+   GIF and XPM images are decoded one at a time, and shouldn't be loaded
+   on other threads while a loader is working.
+ */
+typedef struct IMG_Loader IMG_Loader;
+
+/* Create a loader with 'threads' threads, or one per CPU core if 0.
+   This initializes all the image libraries, see IMG_Init().
+ */
+extern DECLSPEC IMG_Loader * SDLCALL IMG_CreateLoader(int threads);
+
+/* Queue an image to be loaded, like IMG_Load() or IMG_LoadTyped_RW().
+   The data source must not be used again until the image is picked up.
+   These return an ID for the image greater than 0, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL IMG_QueueLoad(IMG_Loader *loader, const char *file, int priority);
+extern DECLSPEC int SDLCALL IMG_QueueLoadTyped_RW(IMG_Loader *loader, SDL_RWops *src, int freesrc, const char *type, int priority);
+
+/* Get the number of images queued or being decoded */
+extern DECLSPEC int SDLCALL IMG_GetLoaderPending(IMG_Loader *loader);
+
+/* Pick up the oldest image the loader has finished, without waiting.
+   This returns the ID of the image and sets 'surface', which is NULL if
+   the image couldn't be loaded and IMG_GetError() says why.  It returns 0
+   if no image is finished.
+ */
+extern DECLSPEC int SDLCALL IMG_PollLoader(IMG_Loader *loader, SDL_Surface **surface);
+
+/* Like IMG_PollLoader(), but waits for an image to finish.
+   This returns 0 only once nothing is left in the queue.
+ */
+extern DECLSPEC int SDLCALL IMG_WaitLoader(IMG_Loader *loader, SDL_Surface **surface);
+
+/* Stop a loader, after the images being decoded are done.  Images still
+   queued and images not picked up are freed.
+ */
+extern DECLSPEC void SDLCALL IMG_DestroyLoader(IMG_Loader *loader);
+
 /* Functions to detect a file type, given a seekable source */
 extern DECLSPEC int SDLCALL IMG_isICO(SDL_RWops *src);
 extern DECLSPEC int SDLCALL IMG_isCUR(SDL_RWops *src);
@@ -128,6 +171,32 @@ extern DECLSPEC SDL_Surface * SDLCALL IMG_LoadWEBP_RW(SDL_RWops *src);
 
 extern DECLSPEC SDL_Surface * SDLCALL IMG_ReadXPMFromArray(char **xpm);
 
+/* Called by IMG_LoadPNGToSurface_RW() and IMG_LoadPNGToTexture_RW() each
+   time 'rows' more rows of the image, starting at row 'y', are done and
+   the target is unlocked.  'h' is the height of the image.
+   Return 0 to keep decoding, or -1 to stop.
+ */
+typedef int (SDLCALL *IMG_RowCallback)(void *userdata, int y, int rows, int h);
+
+/* Get the size of a PNG image from its header, without decoding it.
+   This returns 0, or -1 if the data source doesn't start with a PNG image.
+ */
+extern DECLSPEC int SDLCALL IMG_QueryPNG_RW(SDL_RWops *src, int *w, int *h);
+
+/* Decode a PNG image into the top left corner of an existing surface or
+   streaming texture, which must be at least as big as the image.
+   The pixels are written in the target's format, a stripe of rows at a
+   time, so there is no second copy of the image and no conversion
+   afterwards.  Transparency is kept if the target format has alpha.
+   The callback may be NULL.
+   These return 0, or -1 if there was an error or the callback stopped
+   decoding, in which case only some of the rows may have been written.
+ */
+extern DECLSPEC int SDLCALL IMG_LoadPNGToSurface_RW(SDL_RWops *src, SDL_Surface *surface, IMG_RowCallback callback, void *userdata);
+#if SDL_VERSION_ATLEAST(2,0,0)
+extern DECLSPEC int SDLCALL IMG_LoadPNGToTexture_RW(SDL_RWops *src, SDL_Texture *texture, IMG_RowCallback callback, void *userdata);
+#endif /* SDL 2.0 */
+
 /* Individual saving functions */
 extern DECLSPEC int SDLCALL IMG_SavePNG(SDL_Surface *surface, const char *file);
 extern DECLSPEC int SDLCALL IMG_SavePNG_RW(SDL_Surface *surface, SDL_RWops *dst, int freedst);
@@ -0,0 +1,160 @@
+/*
+  loadbench:  A benchmark for loading a batch of images with SDL_image
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* Loads every image given on the command line, such as all the files in a
+   directory of test images, first one after another with IMG_Load() and then with an IMG_Loader
+   using 1, 2, 4 and so on up to one thread per CPU core, and reports how
+   much faster each run is than loading on one thread.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "SDL.h"
+#include "SDL_image.h"
+
+static char *Usage =
+"Usage: %s [-threads count] [-repeat count] <image> ...\n";
+
+static double Milliseconds(Uint64 start, Uint64 end)
+{
+    return (double)(end - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+/* Load the images on this thread, returns the number that loaded */
+static int LoadSerial(char **files, int count, int repeat)
+{
+    SDL_Surface *surface;
+    int i, loaded = 0;
+
+    while (repeat--) {
+        for (i = 0; i < count; ++i) {
+            surface = IMG_Load(files[i]);
+            if (surface) {
+                SDL_FreeSurface(surface);
+                ++loaded;
+            }
+        }
+    }
+    return loaded;
+}
+
+/* Load the images with a loader, returns the number that loaded */
+static int LoadBatch(char **files, int count, int repeat, int threads)
+{
+    IMG_Loader *loader;
+    SDL_Surface *surface;
+    int i, loaded = 0;
+
+    loader = IMG_CreateLoader(threads);
+    if (loader == NULL) {
+        fprintf(stderr, "Couldn't create loader: %s\n", IMG_GetError());
+        return -1;
+    }
+    while (repeat--) {
+        for (i = 0; i < count; ++i) {
+            if (IMG_QueueLoad(loader, files[i], 0) < 0) {
+                fprintf(stderr, "Couldn't queue %s: %s\n", files[i], IMG_GetError());
+            }
+        }
+    }
+    while (IMG_WaitLoader(loader, &surface) > 0) {
+        if (surface) {
+            SDL_FreeSurface(surface);
+            ++loaded;
+        }
+    }
+    IMG_DestroyLoader(loader);
+    return loaded;
+}
+
+int main(int argc, char *argv[])
+{
+    char *argv0 = argv[0];
+    int max_threads = 0;
+    int repeat = 1;
+    int threads, loaded, expected;
+    Uint64 start, end;
+    double serial, ms;
+
+    for (argc--, argv++; argc > 0 && argv[0][0] == '-'; argc--, argv++) {
+        if (strcmp(argv[0], "-threads") == 0 && argv[1]) {
+            max_threads = atoi(argv[1]);
+            argc--, argv++;
+        } else if (strcmp(argv[0], "-repeat") == 0 && argv[1]) {
+            repeat = atoi(argv[1]);
+            repeat = SDL_max(repeat, 1);
+            argc--, argv++;
+        } else {
+            fprintf(stderr, Usage, argv0);
+            return(1);
+        }
+    }
+    if (argc == 0) {
+        fprintf(stderr, Usage, argv0);
+        return(1);
+    }
+    if (max_threads <= 0) {
+        max_threads = SDL_GetCPUCount();
+    }
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return(2);
+    }
+    IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG | IMG_INIT_TIF | IMG_INIT_WEBP);
+
+    /* The first pass warms up the disk cache */
+    expected = LoadSerial(argv, argc, 1) * repeat;
+    if (expected == 0) {
+        fprintf(stderr, "None of the images could be loaded: %s\n", IMG_GetError());
+        IMG_Quit();
+        SDL_Quit();
+        return(1);
+    }
+
+    start = SDL_GetPerformanceCounter();
+    LoadSerial(argv, argc, repeat);
+    end = SDL_GetPerformanceCounter();
+    serial = Milliseconds(start, end);
+    printf("%d images with IMG_Load(): %.1f ms\n", expected, serial);
+
+    for (threads = 1; ; threads *= 2) {
+        threads = SDL_min(threads, max_threads);
+        start = SDL_GetPerformanceCounter();
+        loaded = LoadBatch(argv, argc, repeat, threads);
+        end = SDL_GetPerformanceCounter();
+        if (loaded < 0) {
+            break;
+        }
+        ms = Milliseconds(start, end);
+        printf("%d images with %2d thread%s: %.1f ms, %.2fx\n",
+               loaded, threads, threads == 1 ? " " : "s", ms, serial / ms);
+        if (threads == max_threads) {
+            break;
+        }
+    }
+
+    IMG_Quit();
+    SDL_Quit();
+    return(0);
+}
@@ -594,6 +594,20 @@ extern DECLSPEC int SDLCALL Mix_PausedMusic(void);
 */
 extern DECLSPEC int SDLCALL Mix_SetMusicPosition(double position);
 
+/* Decode the music ahead on a thread of its own, keeping up to 'ms'
+   milliseconds of audio ready, so the audio callback only has to copy it.
+   This works for OGG, FLAC and MP3_MAD music, and is done while the music
+   isn't playing, after the audio device has been opened.  A 'ms' of 0
+   goes back to decoding in the audio callback.
+   This returns 0 if successful, or -1 if it failed or isn't supported.
+*/
+extern DECLSPEC int SDLCALL Mix_SetMusicDecodeAhead(Mix_Music *music, int ms);
+
+/* Get the number of times the decoding thread fell behind the audio
+   callback since decoding ahead was turned on for the music.
+*/
+extern DECLSPEC int SDLCALL Mix_GetMusicUnderruns(const Mix_Music *music);
+
 /* Check the status of a specific channel.
    If the specified channel is -1, check all channels.
 */
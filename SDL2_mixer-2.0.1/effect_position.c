@@ -37,6 +37,10 @@
 #define __MIX_INTERNAL_EFFECT__
 #include "effects_internal.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /* profile code:
     #include <sys/time.h>
     #include <unistd.h>
@@ -97,257 +101,311 @@ void _Eff_PositionDeinit(void)
 }
 
 
-/* This just frees up the callback-specific data. */
+static void init_position_args(position_args *args);
+
+/*
+ * This just resets the callback-specific data. It's kept allocated for the
+ *  next positional effect on the channel, since this is usually called from
+ *  the audio callback when the channel finishes playing.
+ */
 static void _Eff_PositionDone(int channel, void *udata)
 {
-    if (channel < 0) {
-        if (pos_args_global != NULL) {
-            SDL_free(pos_args_global);
-            pos_args_global = NULL;
-        }
-    }
-
-    else if (pos_args_array[channel] != NULL) {
-        SDL_free(pos_args_array[channel]);
-        pos_args_array[channel] = NULL;
-    }
+    init_position_args((position_args *) udata);
 }
 
 
-static void _Eff_position_u8(int chan, void *stream, int len, void *udata)
+/*
+ * The positional effects all boil down to a gain per output channel, plus
+ *  a shuffle of the input channels when the room is rotated. That's worked
+ *  out once per callback from the position args into a layout, and then run
+ *  over the samples by one kernel per sample format.
+ */
+typedef struct _Eff_positionlayout
 {
-    volatile position_args *args = (volatile position_args *) udata;
-    Uint8 *ptr = (Uint8 *) stream;
+    int channels;
+    int source[6];      /* input channel feeding each output channel */
+    float gain[6];      /* gain of that input channel */
+    float distance;
+    int center_mix;     /* 6 channels rotated: center averages the front pair */
+} position_layout;
+
+static void get_position_layout(volatile position_args *args, position_layout *layout)
+{
+    static const int rotations[4][4] = {
+        { 0, 1, 2, 3 },     /* room_angle 0 */
+        { 1, 3, 0, 2 },     /* room_angle 90 */
+        { 3, 2, 1, 0 },     /* room_angle 180 */
+        { 2, 0, 3, 1 }      /* room_angle 270 */
+    };
+    const float gains[6] = {
+        args->left_f, args->right_f, args->left_rear_f,
+        args->right_rear_f, args->center_f, args->lfe_f
+    };
+    const int *rotation = rotations[(args->room_angle / 90) & 3];
     int i;
 
-        /*
-         * if there's only a mono channnel (the only way we wouldn't have
-         *  a len divisible by 2 here), then left_f and right_f are always
-         *  1.0, and are therefore throwaways.
-         */
-    if (len % sizeof (Uint16) != 0) {
-        *ptr = (Uint8) (((float) *ptr) * args->distance_f);
-        ptr++;
-        len--;
-    }
+    layout->channels = args->channels;
+    layout->distance = args->distance_f;
+    layout->center_mix = 0;
 
-    if (args->room_angle == 180)
-    for (i = 0; i < len; i += sizeof (Uint8) * 2) {
-        /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f) + 128);
-        ptr++;
+    switch (layout->channels) {
+        case 1:
+            layout->source[0] = 0;
+            layout->gain[0] = gains[0];
+            break;
+
+        case 2:
+            /* a stereo room only turns around */
+            layout->source[0] = (args->room_angle == 180) ? 1 : 0;
+            layout->source[1] = (args->room_angle == 180) ? 0 : 1;
+            break;
+
+        case 4:
+        case 6:
+            for (i = 0; i < 4; i++) {
+                layout->source[i] = rotation[i];
+            }
+            if (layout->channels == 6) {
+                layout->source[4] = 4;
+                layout->source[5] = 5;
+                layout->center_mix = (args->room_angle != 0);
+            }
+            break;
     }
-    else for (i = 0; i < len; i += sizeof (Uint8) * 2) {
-        /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f) + 128);
-        ptr++;
+
+    if (layout->channels > 1) {
+        for (i = 0; i < layout->channels; i++) {
+            layout->gain[i] = gains[layout->source[i]];
+        }
     }
 }
-static void _Eff_position_u8_c4(int chan, void *stream, int len, void *udata)
-{
-    volatile position_args *args = (volatile position_args *) udata;
-    Uint8 *ptr = (Uint8 *) stream;
-    int i;
 
-        /*
-         * if there's only a mono channnel (the only way we wouldn't have
-         *  a len divisible by 2 here), then left_f and right_f are always
-         *  1.0, and are therefore throwaways.
-         */
-    if (len % sizeof (Uint16) != 0) {
-        *ptr = (Uint8) (((float) *ptr) * args->distance_f);
-        ptr++;
-        len--;
-    }
+/*
+ * Samples are scaled as (sample * gain) * distance and truncated, in the
+ *  same order everywhere, so the SIMD and scalar loops agree exactly.
+ */
+#define POSITION_KERNEL(name, type, load, store) \
+SDL_FORCE_INLINE void name##_frames(const position_layout *layout, \
+                                   type *ptr, int frames, const int channels) \
+{ \
+    const float distance = layout->distance; \
+    const int center_mix = layout->center_mix; \
+    int source[6]; \
+    float gain[6]; \
+    Sint32 out[6]; \
+    int i, c; \
+\
+    for (c = 0; c < channels; c++) { \
+        source[c] = layout->source[c]; \
+        gain[c] = layout->gain[c]; \
+    } \
+    for (i = 0; i < frames; i++, ptr += channels) { \
+        for (c = 0; c < channels; c++) { \
+            out[c] = (Sint32) (((float) load(ptr[source[c]]) * gain[c]) * distance); \
+        } \
+        if (channels == 6 && center_mix) { \
+            out[4] = (out[0] / 2) + (out[1] / 2); \
+        } \
+        for (c = 0; c < channels; c++) { \
+            ptr[c] = store(out[c]); \
+        } \
+    } \
+} \
+\
+static void name(const position_layout *layout, void *stream, int len, int frame) \
+{ \
+    type *ptr = ((type *) stream) + (frame * layout->channels); \
+    const int frames = ((len / (int) sizeof (type)) / layout->channels) - frame; \
+\
+    switch (layout->channels) { \
+        case 1: name##_frames(layout, ptr, frames, 1); break; \
+        case 2: name##_frames(layout, ptr, frames, 2); break; \
+        case 4: name##_frames(layout, ptr, frames, 4); break; \
+        case 6: name##_frames(layout, ptr, frames, 6); break; \
+    } \
+}
 
-    if (args->room_angle == 0)
-    for (i = 0; i < len; i += sizeof (Uint8) * 6) {
-        /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_rear_f) * args->distance_f) + 128);
-        ptr++;
-    }
-    else if (args->room_angle == 90)
-    for (i = 0; i < len; i += sizeof (Uint8) * 6) {
-        /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_rear_f) * args->distance_f) + 128);
-        ptr++;
-    }
-    else if (args->room_angle == 180)
-    for (i = 0; i < len; i += sizeof (Uint8) * 6) {
-        /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f) + 128);
-        ptr++;
+#define LOAD_U8(x)      ((Sint8) ((x) - 128))
+#define STORE_U8(x)     ((Uint8) ((x) + 128))
+#define LOAD_S8(x)      (x)
+#define STORE_S8(x)     ((Sint8) (x))
+#define LOAD_U16LSB(x)  ((Sint16) (SDL_SwapLE16(x) - 32768))
+#define STORE_U16LSB(x) ((Uint16) SDL_SwapLE16((Uint16) ((x) + 32768)))
+#define LOAD_S16LSB(x)  ((Sint16) SDL_SwapLE16(x))
+#define STORE_S16LSB(x) ((Sint16) SDL_SwapLE16((Uint16) (x)))
+#define LOAD_U16MSB(x)  ((Sint16) (SDL_SwapBE16(x) - 32768))
+#define STORE_U16MSB(x) ((Uint16) SDL_SwapBE16((Uint16) ((x) + 32768)))
+#define LOAD_S16MSB(x)  ((Sint16) SDL_SwapBE16(x))
+#define STORE_S16MSB(x) ((Sint16) SDL_SwapBE16((Uint16) (x)))
+
+POSITION_KERNEL(_Eff_position_kernel_u8, Uint8, LOAD_U8, STORE_U8)
+POSITION_KERNEL(_Eff_position_kernel_s8, Sint8, LOAD_S8, STORE_S8)
+POSITION_KERNEL(_Eff_position_kernel_u16lsb, Uint16, LOAD_U16LSB, STORE_U16LSB)
+POSITION_KERNEL(_Eff_position_kernel_s16lsb, Sint16, LOAD_S16LSB, STORE_S16LSB)
+POSITION_KERNEL(_Eff_position_kernel_u16msb, Uint16, LOAD_U16MSB, STORE_U16MSB)
+POSITION_KERNEL(_Eff_position_kernel_s16msb, Sint16, LOAD_S16MSB, STORE_S16MSB)
+
+#ifdef __SSE2__
+/*
+ * Native 16-bit stereo and quad, eight samples at a time, and 5.1 two
+ *  frames at a time. Returns the number of samples done; the scalar kernel
+ *  finishes the rest.
+ */
+#define POSITION_S16_SSE2(shuffle) \
+    for (; i + 8 <= samples; i += 8, ptr += 8) { \
+        const __m128i s = _mm_loadu_si128((const __m128i *) ptr); \
+        __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16)); \
+        __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16)); \
+        lo = _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(lo, lo, shuffle), gain), distance); \
+        hi = _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(hi, hi, shuffle), gain), distance); \
+        _mm_storeu_si128((__m128i *) ptr, \
+            _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi))); \
     }
-    else if (args->room_angle == 270)
-    for (i = 0; i < len; i += sizeof (Uint8) * 6) {
-        /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f) + 128);
-        ptr++;
+
+/*
+ * Two 5.1 frames at a time: the front four channels are shuffled like quad,
+ *  center and LFE are scaled together, and a rotated room averages the new
+ *  front pair into the center.
+ */
+#define HALVE_EPI32(x) _mm_srai_epi32(_mm_add_epi32((x), _mm_srli_epi32((x), 31)), 1)
+#define POSITION_S16_SSE2_C6(shuffle) \
+    for (; i + 12 <= samples; i += 12, ptr += 12) { \
+        const __m128i s0 = _mm_loadu_si128((const __m128i *) ptr); \
+        const __m128i s1 = _mm_loadl_epi64((const __m128i *) (ptr + 8)); \
+        const __m128 v0 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s0, s0), 16)); \
+        const __m128 v1 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s0, s0), 16)); \
+        const __m128 v2 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s1, s1), 16)); \
+        const __m128 f1 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(1, 0, 3, 2)); \
+        const __m128 ce = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(3, 2, 1, 0)); \
+        const __m128i a = _mm_cvttps_epi32(_mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(v0, v0, shuffle), gain), distance)); \
+        const __m128i b = _mm_cvttps_epi32(_mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(f1, f1, shuffle), gain), distance)); \
+        __m128i c = _mm_cvttps_epi32(_mm_mul_ps(_mm_mul_ps(ce, gain_ce), distance)); \
+        if (center_mix) { \
+            const __m128i ha = HALVE_EPI32(a); \
+            const __m128i hb = HALVE_EPI32(b); \
+            const __m128i sa = _mm_add_epi32(ha, _mm_shuffle_epi32(ha, _MM_SHUFFLE(2, 3, 0, 1))); \
+            const __m128i sb = _mm_add_epi32(hb, _mm_shuffle_epi32(hb, _MM_SHUFFLE(2, 3, 0, 1))); \
+            c = _mm_unpacklo_epi32(_mm_unpacklo_epi32(sa, sb), \
+                                   _mm_shuffle_epi32(c, _MM_SHUFFLE(3, 1, 3, 1))); \
+        } \
+        _mm_storeu_si128((__m128i *) ptr, _mm_packs_epi32(a, _mm_unpacklo_epi64(c, b))); \
+        _mm_storel_epi64((__m128i *) (ptr + 8), \
+            _mm_packs_epi32(_mm_unpackhi_epi64(b, c), _mm_setzero_si128())); \
+    }
+
+static int _Eff_position_s16_sse2(const position_layout *layout, void *stream, int len)
+{
+    Sint16 *ptr = (Sint16 *) stream;
+    const int samples = len / (int) sizeof (Sint16);
+    const __m128 distance = _mm_set1_ps(layout->distance);
+    __m128 gain;
+    int i = 0;
+
+    if (layout->channels == 2) {
+        gain = _mm_setr_ps(layout->gain[0], layout->gain[1],
+                           layout->gain[0], layout->gain[1]);
+        if (layout->source[0] == 0) {
+            POSITION_S16_SSE2(_MM_SHUFFLE(3, 2, 1, 0))
+        } else {
+            POSITION_S16_SSE2(_MM_SHUFFLE(2, 3, 0, 1))
+        }
+    } else if (layout->channels == 4) {
+        gain = _mm_setr_ps(layout->gain[0], layout->gain[1],
+                           layout->gain[2], layout->gain[3]);
+        switch (layout->source[0]) {
+            case 0:
+                POSITION_S16_SSE2(_MM_SHUFFLE(3, 2, 1, 0))
+                break;
+            case 1:
+                POSITION_S16_SSE2(_MM_SHUFFLE(2, 0, 3, 1))
+                break;
+            case 3:
+                POSITION_S16_SSE2(_MM_SHUFFLE(0, 1, 2, 3))
+                break;
+            case 2:
+                POSITION_S16_SSE2(_MM_SHUFFLE(1, 3, 0, 2))
+                break;
+        }
+    } else if (layout->channels == 6) {
+        const __m128 gain_ce = _mm_setr_ps(layout->gain[4], layout->gain[5],
+                                           layout->gain[4], layout->gain[5]);
+        const int center_mix = layout->center_mix;
+        gain = _mm_setr_ps(layout->gain[0], layout->gain[1],
+                           layout->gain[2], layout->gain[3]);
+        switch (layout->source[0]) {
+            case 0:
+                POSITION_S16_SSE2_C6(_MM_SHUFFLE(3, 2, 1, 0))
+                break;
+            case 1:
+                POSITION_S16_SSE2_C6(_MM_SHUFFLE(2, 0, 3, 1))
+                break;
+            case 3:
+                POSITION_S16_SSE2_C6(_MM_SHUFFLE(0, 1, 2, 3))
+                break;
+            case 2:
+                POSITION_S16_SSE2_C6(_MM_SHUFFLE(1, 3, 0, 2))
+                break;
+        }
     }
+    return i;
 }
+#endif
 
+static void _Eff_position_u8(int chan, void *stream, int len, void *udata)
+{
+    position_layout layout;
+    get_position_layout((volatile position_args *) udata, &layout);
+    _Eff_position_kernel_u8(&layout, stream, len, 0);
+}
 
-static void _Eff_position_u8_c6(int chan, void *stream, int len, void *udata)
+static void _Eff_position_s8(int chan, void *stream, int len, void *udata)
 {
-    volatile position_args *args = (volatile position_args *) udata;
-    Uint8 *ptr = (Uint8 *) stream;
-    int i;
+    position_layout layout;
+    get_position_layout((volatile position_args *) udata, &layout);
+    _Eff_position_kernel_s8(&layout, stream, len, 0);
+}
 
-        /*
-         * if there's only a mono channnel (the only way we wouldn't have
-         *  a len divisible by 2 here), then left_f and right_f are always
-         *  1.0, and are therefore throwaways.
-         */
-    if (len % sizeof (Uint16) != 0) {
-        *ptr = (Uint8) (((float) *ptr) * args->distance_f);
-        ptr++;
-        len--;
-    }
+static void _Eff_position_u16lsb(int chan, void *stream, int len, void *udata)
+{
+    position_layout layout;
+    get_position_layout((volatile position_args *) udata, &layout);
+    _Eff_position_kernel_u16lsb(&layout, stream, len, 0);
+}
 
-    if (args->room_angle == 0)
-    for (i = 0; i < len; i += sizeof (Uint8) * 6) {
-        /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->center_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->lfe_f) * args->distance_f) + 128);
-        ptr++;
-    }
-    else if (args->room_angle == 90)
-    for (i = 0; i < len; i += sizeof (Uint8) * 6) {
-        /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_rear_f) * args->distance_f/2) + 128)
-            + (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f/2) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->lfe_f) * args->distance_f) + 128);
-        ptr++;
-    }
-    else if (args->room_angle == 180)
-    for (i = 0; i < len; i += sizeof (Uint8) * 6) {
-        /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_rear_f) * args->distance_f/2) + 128)
-            + (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_rear_f) * args->distance_f/2) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->lfe_f) * args->distance_f) + 128);
-        ptr++;
-    }
-    else if (args->room_angle == 270)
-    for (i = 0; i < len; i += sizeof (Uint8) * 6) {
-        /* must adjust the sample so that 0 is the center */
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_rear_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->right_f) * args->distance_f) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_f) * args->distance_f/2) + 128)
-            + (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->left_rear_f) * args->distance_f/2) + 128);
-        ptr++;
-        *ptr = (Uint8) ((Sint8) ((((float) (Sint8) (*ptr - 128))
-            * args->lfe_f) * args->distance_f) + 128);
-        ptr++;
+static void _Eff_position_s16lsb(int chan, void *stream, int len, void *udata)
+{
+    position_layout layout;
+    int done = 0;
+
+    get_position_layout((volatile position_args *) udata, &layout);
+#if defined(__SSE2__) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    if (SDL_HasSSE2()) {
+        done = _Eff_position_s16_sse2(&layout, stream, len);
     }
+#endif
+    _Eff_position_kernel_s16lsb(&layout, stream, len, done / layout.channels);
 }
 
+static void _Eff_position_u16msb(int chan, void *stream, int len, void *udata)
+{
+    position_layout layout;
+    get_position_layout((volatile position_args *) udata, &layout);
+    _Eff_position_kernel_u16msb(&layout, stream, len, 0);
+}
+
+static void _Eff_position_s16msb(int chan, void *stream, int len, void *udata)
+{
+    position_layout layout;
+    int done = 0;
+
+    get_position_layout((volatile position_args *) udata, &layout);
+#if defined(__SSE2__) && (SDL_BYTEORDER == SDL_BIG_ENDIAN)
+    if (SDL_HasSSE2()) {
+        done = _Eff_position_s16_sse2(&layout, stream, len);
+    }
+#endif
+    _Eff_position_kernel_s16msb(&layout, stream, len, done / layout.channels);
+}
 
 /*
  * This one runs about 10.1 times faster than the non-table version, with
@@ -406,142 +464,6 @@ static void _Eff_position_table_u8(int chan, void *stream, int len, void *udata)
 }
 
 
-static void _Eff_position_s8(int chan, void *stream, int len, void *udata)
-{
-    volatile position_args *args = (volatile position_args *) udata;
-    Sint8 *ptr = (Sint8 *) stream;
-    int i;
-
-        /*
-         * if there's only a mono channnel (the only way we wouldn't have
-         *  a len divisible by 2 here), then left_f and right_f are always
-         *  1.0, and are therefore throwaways.
-         */
-    if (len % sizeof (Sint16) != 0) {
-        *ptr = (Sint8) (((float) *ptr) * args->distance_f);
-        ptr++;
-        len--;
-    }
-
-    if (args->room_angle == 180)
-    for (i = 0; i < len; i += sizeof (Sint8) * 2) {
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f);
-        ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f);
-        ptr++;
-    }
-    else
-    for (i = 0; i < len; i += sizeof (Sint8) * 2) {
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f);
-        ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f);
-        ptr++;
-    }
-}
-static void _Eff_position_s8_c4(int chan, void *stream, int len, void *udata)
-{
-    volatile position_args *args = (volatile position_args *) udata;
-    Sint8 *ptr = (Sint8 *) stream;
-    int i;
-
-        /*
-         * if there's only a mono channnel (the only way we wouldn't have
-         *  a len divisible by 2 here), then left_f and right_f are always
-         *  1.0, and are therefore throwaways.
-         */
-    if (len % sizeof (Sint16) != 0) {
-        *ptr = (Sint8) (((float) *ptr) * args->distance_f);
-        ptr++;
-        len--;
-    }
-
-    for (i = 0; i < len; i += sizeof (Sint8) * 4) {
-      switch (args->room_angle) {
-       case 0:
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_rear_f) * args->distance_f); ptr++;
-    break;
-       case 90:
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_rear_f) * args->distance_f); ptr++;
-    break;
-       case 180:
-        *ptr = (Sint8)((((float) *ptr) * args->right_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f); ptr++;
-    break;
-       case 270:
-        *ptr = (Sint8)((((float) *ptr) * args->left_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f); ptr++;
-    break;
-      }
-    }
-}
-static void _Eff_position_s8_c6(int chan, void *stream, int len, void *udata)
-{
-    volatile position_args *args = (volatile position_args *) udata;
-    Sint8 *ptr = (Sint8 *) stream;
-    int i;
-
-        /*
-         * if there's only a mono channnel (the only way we wouldn't have
-         *  a len divisible by 2 here), then left_f and right_f are always
-         *  1.0, and are therefore throwaways.
-         */
-    if (len % sizeof (Sint16) != 0) {
-        *ptr = (Sint8) (((float) *ptr) * args->distance_f);
-        ptr++;
-        len--;
-    }
-
-    for (i = 0; i < len; i += sizeof (Sint8) * 6) {
-      switch (args->room_angle) {
-       case 0:
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->center_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->lfe_f) * args->distance_f); ptr++;
-    break;
-       case 90:
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_rear_f) * args->distance_f / 2)
-           + (Sint8)((((float) *ptr) * args->right_f) * args->distance_f / 2); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->lfe_f) * args->distance_f); ptr++;
-    break;
-       case 180:
-        *ptr = (Sint8)((((float) *ptr) * args->right_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_rear_f) * args->distance_f / 2)
-           + (Sint8)((((float) *ptr) * args->left_rear_f) * args->distance_f / 2); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->lfe_f) * args->distance_f); ptr++;
-    break;
-       case 270:
-        *ptr = (Sint8)((((float) *ptr) * args->left_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_rear_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->right_f) * args->distance_f); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->left_f) * args->distance_f / 2)
-           + (Sint8)((((float) *ptr) * args->left_rear_f) * args->distance_f / 2); ptr++;
-        *ptr = (Sint8)((((float) *ptr) * args->lfe_f) * args->distance_f); ptr++;
-    break;
-      }
-    }
-}
-
 
 /*
  * This one runs about 10.1 times faster than the non-table version, with
@@ -599,536 +521,6 @@ static void _Eff_position_table_s8(int chan, void *stream, int len, void *udata)
 }
 
 
-/* !!! FIXME : Optimize the code for 16-bit samples? */
-
-static void _Eff_position_u16lsb(int chan, void *stream, int len, void *udata)
-{
-    volatile position_args *args = (volatile position_args *) udata;
-    Uint16 *ptr = (Uint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Uint16) * 2) {
-        Sint16 sampl = (Sint16) (SDL_SwapLE16(*(ptr+0)) - 32768);
-        Sint16 sampr = (Sint16) (SDL_SwapLE16(*(ptr+1)) - 32768);
-
-        Uint16 swapl = (Uint16) ((Sint16) (((float) sampl * args->left_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swapr = (Uint16) ((Sint16) (((float) sampr * args->right_f)
-                                    * args->distance_f) + 32768);
-
-    if (args->room_angle == 180) {
-            *(ptr++) = (Uint16) SDL_SwapLE16(swapr);
-            *(ptr++) = (Uint16) SDL_SwapLE16(swapl);
-    }
-    else {
-            *(ptr++) = (Uint16) SDL_SwapLE16(swapl);
-            *(ptr++) = (Uint16) SDL_SwapLE16(swapr);
-    }
-    }
-}
-static void _Eff_position_u16lsb_c4(int chan, void *stream, int len, void *udata)
-{
-    volatile position_args *args = (volatile position_args *) udata;
-    Uint16 *ptr = (Uint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Uint16) * 4) {
-        Sint16 sampl = (Sint16) (SDL_SwapLE16(*(ptr+0)) - 32768);
-        Sint16 sampr = (Sint16) (SDL_SwapLE16(*(ptr+1)) - 32768);
-        Sint16 samplr = (Sint16) (SDL_SwapLE16(*(ptr+2)) - 32768);
-        Sint16 samprr = (Sint16) (SDL_SwapLE16(*(ptr+3)) - 32768);
-
-        Uint16 swapl = (Uint16) ((Sint16) (((float) sampl * args->left_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swapr = (Uint16) ((Sint16) (((float) sampr * args->right_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swaplr = (Uint16) ((Sint16) (((float) samplr * args->left_rear_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swaprr = (Uint16) ((Sint16) (((float) samprr * args->right_rear_f)
-                                    * args->distance_f) + 32768);
-
-    switch (args->room_angle) {
-        case 0:
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaprr);
-            break;
-        case 90:
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaplr);
-            break;
-        case 180:
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapl);
-            break;
-        case 270:
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapr);
-            break;
-    }
-    }
-}
-static void _Eff_position_u16lsb_c6(int chan, void *stream, int len, void *udata)
-{
-    volatile position_args *args = (volatile position_args *) udata;
-    Uint16 *ptr = (Uint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Uint16) * 6) {
-        Sint16 sampl = (Sint16) (SDL_SwapLE16(*(ptr+0)) - 32768);
-        Sint16 sampr = (Sint16) (SDL_SwapLE16(*(ptr+1)) - 32768);
-        Sint16 samplr = (Sint16) (SDL_SwapLE16(*(ptr+2)) - 32768);
-        Sint16 samprr = (Sint16) (SDL_SwapLE16(*(ptr+3)) - 32768);
-        Sint16 sampce = (Sint16) (SDL_SwapLE16(*(ptr+4)) - 32768);
-        Sint16 sampwf = (Sint16) (SDL_SwapLE16(*(ptr+5)) - 32768);
-
-        Uint16 swapl = (Uint16) ((Sint16) (((float) sampl * args->left_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swapr = (Uint16) ((Sint16) (((float) sampr * args->right_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swaplr = (Uint16) ((Sint16) (((float) samplr * args->left_rear_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swaprr = (Uint16) ((Sint16) (((float) samprr * args->right_rear_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swapce = (Uint16) ((Sint16) (((float) sampce * args->center_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swapwf = (Uint16) ((Sint16) (((float) sampwf * args->lfe_f)
-                                    * args->distance_f) + 32768);
-
-    switch (args->room_angle) {
-        case 0:
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapce);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapwf);
-            break;
-        case 90:
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapr)/2 + (Uint16) SDL_SwapLE16(swaprr)/2;
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapwf);
-            break;
-        case 180:
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaprr)/2 + (Uint16) SDL_SwapLE16(swaplr)/2;
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapwf);
-            break;
-        case 270:
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapl)/2 + (Uint16) SDL_SwapLE16(swaplr)/2;
-                *(ptr++) = (Uint16) SDL_SwapLE16(swapwf);
-            break;
-    }
-    }
-}
-
-static void _Eff_position_s16lsb(int chan, void *stream, int len, void *udata)
-{
-    /* 16 signed bits (lsb) * 2 channels. */
-    volatile position_args *args = (volatile position_args *) udata;
-    Sint16 *ptr = (Sint16 *) stream;
-    int i;
-
-#if 0
-    if (len % (sizeof(Sint16) * 2)) {
-        fprintf(stderr,"Not an even number of frames! len=%d\n", len);
-        return;
-    }
-#endif
-
-    for (i = 0; i < len; i += sizeof (Sint16) * 2) {
-        Sint16 swapl = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+0))) *
-                                    args->left_f) * args->distance_f);
-        Sint16 swapr = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+1))) *
-                                    args->right_f) * args->distance_f);
-    if (args->room_angle == 180) {
-            *(ptr++) = (Sint16) SDL_SwapLE16(swapr);
-            *(ptr++) = (Sint16) SDL_SwapLE16(swapl);
-    }
-    else {
-            *(ptr++) = (Sint16) SDL_SwapLE16(swapl);
-            *(ptr++) = (Sint16) SDL_SwapLE16(swapr);
-    }
-    }
-}
-static void _Eff_position_s16lsb_c4(int chan, void *stream, int len, void *udata)
-{
-    /* 16 signed bits (lsb) * 4 channels. */
-    volatile position_args *args = (volatile position_args *) udata;
-    Sint16 *ptr = (Sint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Sint16) * 4) {
-        Sint16 swapl = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+0))) *
-                                    args->left_f) * args->distance_f);
-        Sint16 swapr = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+1))) *
-                                    args->right_f) * args->distance_f);
-        Sint16 swaplr = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+1))) *
-                                    args->left_rear_f) * args->distance_f);
-        Sint16 swaprr = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+2))) *
-                                    args->right_rear_f) * args->distance_f);
-    switch (args->room_angle) {
-        case 0:
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaprr);
-            break;
-        case 90:
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaplr);
-            break;
-        case 180:
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapl);
-            break;
-        case 270:
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapr);
-            break;
-    }
-    }
-}
-
-static void _Eff_position_s16lsb_c6(int chan, void *stream, int len, void *udata)
-{
-    /* 16 signed bits (lsb) * 6 channels. */
-    volatile position_args *args = (volatile position_args *) udata;
-    Sint16 *ptr = (Sint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Sint16) * 6) {
-        Sint16 swapl = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+0))) *
-                                    args->left_f) * args->distance_f);
-        Sint16 swapr = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+1))) *
-                                    args->right_f) * args->distance_f);
-        Sint16 swaplr = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+2))) *
-                                    args->left_rear_f) * args->distance_f);
-        Sint16 swaprr = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+3))) *
-                                    args->right_rear_f) * args->distance_f);
-        Sint16 swapce = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+4))) *
-                                    args->center_f) * args->distance_f);
-        Sint16 swapwf = (Sint16) ((((float) (Sint16) SDL_SwapLE16(*(ptr+5))) *
-                                    args->lfe_f) * args->distance_f);
-    switch (args->room_angle) {
-        case 0:
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapce);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapwf);
-            break;
-        case 90:
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapr)/2 + (Sint16) SDL_SwapLE16(swaprr)/2;
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapwf);
-            break;
-        case 180:
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaprr)/2 + (Sint16) SDL_SwapLE16(swaplr)/2;
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapwf);
-            break;
-        case 270:
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapl)/2 + (Sint16) SDL_SwapLE16(swaplr)/2;
-                *(ptr++) = (Sint16) SDL_SwapLE16(swapwf);
-            break;
-    }
-    }
-}
-
-static void _Eff_position_u16msb(int chan, void *stream, int len, void *udata)
-{
-    /* 16 signed bits (lsb) * 2 channels. */
-    volatile position_args *args = (volatile position_args *) udata;
-    Uint16 *ptr = (Uint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Sint16) * 2) {
-        Sint16 sampl = (Sint16) (SDL_SwapBE16(*(ptr+0)) - 32768);
-        Sint16 sampr = (Sint16) (SDL_SwapBE16(*(ptr+1)) - 32768);
-
-        Uint16 swapl = (Uint16) ((Sint16) (((float) sampl * args->left_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swapr = (Uint16) ((Sint16) (((float) sampr * args->right_f)
-                                    * args->distance_f) + 32768);
-
-    if (args->room_angle == 180) {
-            *(ptr++) = (Uint16) SDL_SwapBE16(swapr);
-            *(ptr++) = (Uint16) SDL_SwapBE16(swapl);
-    }
-    else {
-            *(ptr++) = (Uint16) SDL_SwapBE16(swapl);
-            *(ptr++) = (Uint16) SDL_SwapBE16(swapr);
-    }
-    }
-}
-static void _Eff_position_u16msb_c4(int chan, void *stream, int len, void *udata)
-{
-    /* 16 signed bits (lsb) * 4 channels. */
-    volatile position_args *args = (volatile position_args *) udata;
-    Uint16 *ptr = (Uint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Sint16) * 4) {
-        Sint16 sampl = (Sint16) (SDL_SwapBE16(*(ptr+0)) - 32768);
-        Sint16 sampr = (Sint16) (SDL_SwapBE16(*(ptr+1)) - 32768);
-        Sint16 samplr = (Sint16) (SDL_SwapBE16(*(ptr+2)) - 32768);
-        Sint16 samprr = (Sint16) (SDL_SwapBE16(*(ptr+3)) - 32768);
-
-        Uint16 swapl = (Uint16) ((Sint16) (((float) sampl * args->left_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swapr = (Uint16) ((Sint16) (((float) sampr * args->right_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swaplr = (Uint16) ((Sint16) (((float) samplr * args->left_rear_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swaprr = (Uint16) ((Sint16) (((float) samprr * args->right_rear_f)
-                                    * args->distance_f) + 32768);
-
-    switch (args->room_angle) {
-        case 0:
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaprr);
-            break;
-        case 90:
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaplr);
-            break;
-        case 180:
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapl);
-            break;
-        case 270:
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapr);
-            break;
-    }
-    }
-}
-static void _Eff_position_u16msb_c6(int chan, void *stream, int len, void *udata)
-{
-    /* 16 signed bits (lsb) * 6 channels. */
-    volatile position_args *args = (volatile position_args *) udata;
-    Uint16 *ptr = (Uint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Sint16) * 6) {
-        Sint16 sampl = (Sint16) (SDL_SwapBE16(*(ptr+0)) - 32768);
-        Sint16 sampr = (Sint16) (SDL_SwapBE16(*(ptr+1)) - 32768);
-        Sint16 samplr = (Sint16) (SDL_SwapBE16(*(ptr+2)) - 32768);
-        Sint16 samprr = (Sint16) (SDL_SwapBE16(*(ptr+3)) - 32768);
-        Sint16 sampce = (Sint16) (SDL_SwapBE16(*(ptr+4)) - 32768);
-        Sint16 sampwf = (Sint16) (SDL_SwapBE16(*(ptr+5)) - 32768);
-
-        Uint16 swapl = (Uint16) ((Sint16) (((float) sampl * args->left_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swapr = (Uint16) ((Sint16) (((float) sampr * args->right_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swaplr = (Uint16) ((Sint16) (((float) samplr * args->left_rear_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swaprr = (Uint16) ((Sint16) (((float) samprr * args->right_rear_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swapce = (Uint16) ((Sint16) (((float) sampce * args->center_f)
-                                    * args->distance_f) + 32768);
-        Uint16 swapwf = (Uint16) ((Sint16) (((float) sampwf * args->lfe_f)
-                                    * args->distance_f) + 32768);
-
-    switch (args->room_angle) {
-        case 0:
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapce);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapwf);
-            break;
-        case 90:
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapr)/2 + (Uint16) SDL_SwapBE16(swaprr)/2;
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapwf);
-            break;
-        case 180:
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaprr)/2 + (Uint16) SDL_SwapBE16(swaplr)/2;
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapwf);
-            break;
-        case 270:
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapl)/2 + (Uint16) SDL_SwapBE16(swaplr)/2;
-                *(ptr++) = (Uint16) SDL_SwapBE16(swapwf);
-            break;
-    }
-    }
-}
-
-static void _Eff_position_s16msb(int chan, void *stream, int len, void *udata)
-{
-    /* 16 signed bits (lsb) * 2 channels. */
-    volatile position_args *args = (volatile position_args *) udata;
-    Sint16 *ptr = (Sint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Sint16) * 2) {
-        Sint16 swapl = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+0))) *
-                                    args->left_f) * args->distance_f);
-        Sint16 swapr = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+1))) *
-                                    args->right_f) * args->distance_f);
-        *(ptr++) = (Sint16) SDL_SwapBE16(swapl);
-        *(ptr++) = (Sint16) SDL_SwapBE16(swapr);
-    }
-}
-static void _Eff_position_s16msb_c4(int chan, void *stream, int len, void *udata)
-{
-    /* 16 signed bits (lsb) * 4 channels. */
-    volatile position_args *args = (volatile position_args *) udata;
-    Sint16 *ptr = (Sint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Sint16) * 4) {
-        Sint16 swapl = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+0))) *
-                                    args->left_f) * args->distance_f);
-        Sint16 swapr = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+1))) *
-                                    args->right_f) * args->distance_f);
-        Sint16 swaplr = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+2))) *
-                                    args->left_rear_f) * args->distance_f);
-        Sint16 swaprr = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+3))) *
-                                    args->right_rear_f) * args->distance_f);
-    switch (args->room_angle) {
-        case 0:
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaprr);
-            break;
-        case 90:
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaplr);
-            break;
-        case 180:
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapl);
-            break;
-        case 270:
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapr);
-            break;
-    }
-    }
-}
-static void _Eff_position_s16msb_c6(int chan, void *stream, int len, void *udata)
-{
-    /* 16 signed bits (lsb) * 6 channels. */
-    volatile position_args *args = (volatile position_args *) udata;
-    Sint16 *ptr = (Sint16 *) stream;
-    int i;
-
-    for (i = 0; i < len; i += sizeof (Sint16) * 6) {
-        Sint16 swapl = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+0))) *
-                                    args->left_f) * args->distance_f);
-        Sint16 swapr = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+1))) *
-                                    args->right_f) * args->distance_f);
-        Sint16 swaplr = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+2))) *
-                                    args->left_rear_f) * args->distance_f);
-        Sint16 swaprr = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+3))) *
-                                    args->right_rear_f) * args->distance_f);
-        Sint16 swapce = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+4))) *
-                                    args->center_f) * args->distance_f);
-        Sint16 swapwf = (Sint16) ((((float) (Sint16) SDL_SwapBE16(*(ptr+5))) *
-                                    args->lfe_f) * args->distance_f);
-
-    switch (args->room_angle) {
-        case 0:
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapce);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapwf);
-            break;
-        case 90:
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapr)/2 + (Sint16) SDL_SwapBE16(swaprr)/2;
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapwf);
-            break;
-        case 180:
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaprr)/2 + (Sint16) SDL_SwapBE16(swaplr)/2;
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapwf);
-            break;
-        case 270:
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaplr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapl);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swaprr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapr);
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapl)/2 + (Sint16) SDL_SwapBE16(swaplr)/2;
-                *(ptr++) = (Sint16) SDL_SwapBE16(swapwf);
-            break;
-    }
-    }
-}
-
 static void init_position_args(position_args *args)
 {
     SDL_memset(args, '\0', sizeof (position_args));
@@ -1190,97 +582,40 @@ static Mix_EffectFunc_t get_position_effect_func(Uint16 format, int channels)
 {
     Mix_EffectFunc_t f = NULL;
 
+    if (channels != 1 && channels != 2 && channels != 4 && channels != 6) {
+        Mix_SetError("Unsupported audio channels");
+        return(NULL);
+    }
+
     switch (format) {
         case AUDIO_U8:
-        switch (channels) {
-            case 1:
-            case 2:
-                    f = (_Eff_build_volume_table_u8()) ? _Eff_position_table_u8 :
-                                                        _Eff_position_u8;
-                break;
-                case 4:
-                        f = _Eff_position_u8_c4;
-                break;
-                case 6:
-                        f = _Eff_position_u8_c6;
-                break;
-        }
+            f = _Eff_position_u8;
+            if (channels <= 2 && _Eff_build_volume_table_u8()) {
+                f = _Eff_position_table_u8;
+            }
             break;
 
         case AUDIO_S8:
-        switch (channels) {
-            case 1:
-            case 2:
-                    f = (_Eff_build_volume_table_s8()) ? _Eff_position_table_s8 :
-                                                        _Eff_position_s8;
-                break;
-                case 4:
-                        f = _Eff_position_s8_c4;
-                break;
-                case 6:
-                        f = _Eff_position_s8_c6;
-                break;
-        }
+            f = _Eff_position_s8;
+            if (channels <= 2 && _Eff_build_volume_table_s8()) {
+                f = _Eff_position_table_s8;
+            }
             break;
 
         case AUDIO_U16LSB:
-        switch (channels) {
-            case 1:
-            case 2:
-                    f = _Eff_position_u16lsb;
-                break;
-                case 4:
-                    f = _Eff_position_u16lsb_c4;
-                break;
-                case 6:
-                    f = _Eff_position_u16lsb_c6;
-                break;
-        }
+            f = _Eff_position_u16lsb;
             break;
 
         case AUDIO_S16LSB:
-        switch (channels) {
-            case 1:
-            case 2:
-                    f = _Eff_position_s16lsb;
-                break;
-                case 4:
-                    f = _Eff_position_s16lsb_c4;
-                break;
-                case 6:
-                    f = _Eff_position_s16lsb_c6;
-                break;
-        }
+            f = _Eff_position_s16lsb;
             break;
 
         case AUDIO_U16MSB:
-        switch (channels) {
-            case 1:
-            case 2:
-                    f = _Eff_position_u16msb;
-                break;
-                case 4:
-                    f = _Eff_position_u16msb_c4;
-                break;
-                case 6:
-                    f = _Eff_position_u16msb_c6;
-                break;
-        }
+            f = _Eff_position_u16msb;
             break;
 
         case AUDIO_S16MSB:
-        switch (channels) {
-            case 1:
-            case 2:
-                    f = _Eff_position_s16msb;
-                break;
-                case 4:
-                    f = _Eff_position_s16msb_c4;
-                break;
-                case 6:
-                    f = _Eff_position_s16msb_c6;
-                break;
-        }
+            f = _Eff_position_s16msb;
             break;
 
         default:
@@ -0,0 +1,299 @@
+/*
+  MIXBENCH:  A mixing benchmark for the SDL mixer library.
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* $Id$ */
+
+/*
+ * Plays looping tones on 8, 32 and 128 channels at once and reports how
+ *  long the mixer callback takes. The time is measured from the music hook,
+ *  which runs first in the callback, to the postmix callback, which runs
+ *  last. Use SDL_AUDIODRIVER=dummy to benchmark without a sound card.
+ *
+ * With -p, each test is run again with every channel positioned by
+ *  Mix_SetPosition(), and the extra time per channel is reported.
+ *
+ * With -e, every channel is panned and the sounds keep expiring and being
+ *  restarted, so effects are registered and dropped all the time. On glibc
+ *  the allocator is wrapped to count heap calls made inside the callback,
+ *  which should stay at zero.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "SDL.h"
+#include "SDL_mixer.h"
+
+#define NUM_TONES   8
+
+static const int channel_counts[] = { 8, 32, 128 };
+
+static Uint64 callback_start = 0;
+static Uint64 callback_total = 0;
+static Uint64 callback_worst = 0;
+static int callback_count = 0;
+static SDL_threadID callback_thread = 0;
+static volatile int in_callback = 0;
+static int callback_allocs = 0;
+
+#if defined(__GLIBC__)
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+#define COUNT_ALLOC() \
+    if (in_callback && SDL_ThreadID() == callback_thread) ++callback_allocs
+
+void *malloc(size_t size)
+{
+    COUNT_ALLOC();
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+    COUNT_ALLOC();
+    return __libc_calloc(nmemb, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    COUNT_ALLOC();
+    return __libc_realloc(ptr, size);
+}
+
+void free(void *ptr)
+{
+    if (ptr) {
+        COUNT_ALLOC();
+    }
+    __libc_free(ptr);
+}
+#define HAVE_ALLOC_COUNT
+#endif
+
+static void SDLCALL hook_start(void *udata, Uint8 *stream, int len)
+{
+    callback_thread = SDL_ThreadID();
+    in_callback = 1;
+    callback_start = SDL_GetPerformanceCounter();
+}
+
+static void SDLCALL postmix_end(void *udata, Uint8 *stream, int len)
+{
+    Uint64 elapsed = SDL_GetPerformanceCounter() - callback_start;
+
+    in_callback = 0;
+    callback_total += elapsed;
+    if (elapsed > callback_worst) {
+        callback_worst = elapsed;
+    }
+    ++callback_count;
+}
+
+/* Make a one second tone in the device format */
+static Mix_Chunk *make_tone(int frequency, Uint16 format, int channels, double pitch)
+{
+    SDL_AudioCVT cvt;
+    Sint16 *samples;
+    Mix_Chunk *chunk;
+    int i, c;
+
+    if (SDL_BuildAudioCVT(&cvt, AUDIO_S16SYS, channels, frequency, format, channels, frequency) < 0) {
+        return NULL;
+    }
+    cvt.len = frequency * channels * sizeof(Sint16);
+    cvt.buf = (Uint8 *)SDL_malloc(cvt.len * cvt.len_mult);
+    if (cvt.buf == NULL) {
+        return NULL;
+    }
+    samples = (Sint16 *)cvt.buf;
+    for (i = 0; i < frequency; ++i) {
+        Sint16 value = (Sint16)(SDL_sin(2.0 * M_PI * pitch * i / frequency) * 24000.0);
+        for (c = 0; c < channels; ++c) {
+            samples[i * channels + c] = value;
+        }
+    }
+    if (SDL_ConvertAudio(&cvt) < 0) {
+        SDL_free(cvt.buf);
+        return NULL;
+    }
+
+    chunk = Mix_QuickLoad_RAW(cvt.buf, cvt.len_cvt);
+    if (chunk == NULL) {
+        SDL_free(cvt.buf);
+    }
+    return chunk;
+}
+
+/* Play tones on the first count channels and report the callback time */
+static double run_test(Mix_Chunk **tones, int count, int seconds, int effects, int positioned)
+{
+    double frequency = (double)SDL_GetPerformanceFrequency();
+    double average = 0.0;
+    Uint32 end;
+    int i;
+
+    SDL_LockAudio();
+    for (i = 0; i < count; ++i) {
+        Mix_Volume(i, 32 + (i * 96) / count);
+        if (!effects) {
+            Mix_PlayChannel(i, tones[i % NUM_TONES], -1);
+        }
+        if (positioned) {
+            Mix_SetPosition(i, (Sint16)((i * 360) / count), (Uint8)(i % 200));
+        }
+    }
+    callback_total = 0;
+    callback_worst = 0;
+    callback_count = 0;
+    callback_allocs = 0;
+    SDL_UnlockAudio();
+
+    end = SDL_GetTicks() + seconds * 1000;
+    while (!SDL_TICKS_PASSED(SDL_GetTicks(), end)) {
+        if (effects) {
+            /* Restart finished channels with a short sound and a new pan */
+            for (i = 0; i < count; ++i) {
+                if (!Mix_Playing(i)) {
+                    Uint8 left = (Uint8)(rand() % 256);
+                    Mix_PlayChannelTimed(i, tones[i % NUM_TONES], -1, 50 + rand() % 200);
+                    Mix_SetPanning(i, left, 255 - left);
+                }
+            }
+        }
+        SDL_Delay(10);
+    }
+
+    SDL_LockAudio();
+    Mix_HaltChannel(-1);
+    if (callback_count > 0) {
+        average = (callback_total * 1000000.0) / frequency / callback_count;
+        printf("%3d channels%s: %5d callbacks, %8.2f us average, %8.2f us worst",
+               count, positioned ? " positioned" : "", callback_count,
+               average, (callback_worst * 1000000.0) / frequency);
+#ifdef HAVE_ALLOC_COUNT
+        printf(", %d heap calls", callback_allocs);
+#endif
+        printf("\n");
+    }
+    SDL_UnlockAudio();
+
+    return average;
+}
+
+static void Usage(char *argv0)
+{
+    fprintf(stderr, "Usage: %s [-8] [-32] [-f] [-r rate] [-c channels] [-b buffer] [-s seconds] [-e] [-p]\n", argv0);
+}
+
+int main(int argc, char *argv[])
+{
+    Mix_Chunk *tones[NUM_TONES];
+    int audio_rate = MIX_DEFAULT_FREQUENCY;
+    Uint16 audio_format = MIX_DEFAULT_FORMAT;
+    int audio_channels = 2;
+    int audio_buffers = 1024;
+    int seconds = 2;
+    int effects = 0;
+    int positioned = 0;
+    int i, test;
+
+    for (i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-8") == 0) {
+            audio_format = AUDIO_U8;
+        } else if (strcmp(argv[i], "-32") == 0) {
+            audio_format = AUDIO_S32SYS;
+        } else if (strcmp(argv[i], "-f") == 0) {
+            audio_format = AUDIO_F32SYS;
+        } else if (strcmp(argv[i], "-r") == 0 && argv[i+1]) {
+            audio_rate = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-c") == 0 && argv[i+1]) {
+            audio_channels = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-b") == 0 && argv[i+1]) {
+            audio_buffers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0 && argv[i+1]) {
+            seconds = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-e") == 0) {
+            effects = 1;
+        } else if (strcmp(argv[i], "-p") == 0) {
+            positioned = 1;
+        } else {
+            Usage(argv[0]);
+            return(1);
+        }
+    }
+
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return(255);
+    }
+    if (Mix_OpenAudio(audio_rate, audio_format, audio_channels, audio_buffers) < 0) {
+        fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+        SDL_Quit();
+        return(2);
+    }
+    Mix_QuerySpec(&audio_rate, &audio_format, &audio_channels);
+    printf("Mixing %d Hz %d bit %s %d channels, %d sample buffer\n", audio_rate,
+           (int)SDL_AUDIO_BITSIZE(audio_format),
+           SDL_AUDIO_ISFLOAT(audio_format) ? "float" : "integer",
+           audio_channels, audio_buffers);
+
+    for (i = 0; i < NUM_TONES; ++i) {
+        tones[i] = make_tone(audio_rate, audio_format, audio_channels, 220.0 + 55.0 * i);
+        if (tones[i] == NULL) {
+            fprintf(stderr, "Couldn't make tone: %s\n", SDL_GetError());
+            Mix_CloseAudio();
+            SDL_Quit();
+            return(2);
+        }
+    }
+
+    Mix_AllocateChannels(channel_counts[SDL_arraysize(channel_counts) - 1]);
+    Mix_HookMusic(hook_start, NULL);
+    Mix_SetPostMix(postmix_end, NULL);
+
+    for (test = 0; test < (int)SDL_arraysize(channel_counts); ++test) {
+        const int count = channel_counts[test];
+        double average = run_test(tones, count, seconds, effects, 0);
+
+        if (positioned) {
+            /* The difference is what Mix_SetPosition() costs */
+            double cost = run_test(tones, count, seconds, effects, 1) - average;
+            printf("%3d channels: %8.3f us per positioned channel\n", count, cost / count);
+        }
+    }
+
+    Mix_HookMusic(NULL, NULL);
+    Mix_SetPostMix(NULL, NULL);
+    Mix_CloseAudio();
+    for (i = 0; i < NUM_TONES; ++i) {
+        Uint8 *abuf = tones[i]->abuf;
+        Mix_FreeChunk(tones[i]);
+        SDL_free(abuf);
+    }
+    SDL_Quit();
+    return(0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -28,6 +28,11 @@
 #include "SDL_mutex.h"
 #include "SDL_endian.h"
 #include "SDL_timer.h"
+#include "SDL_cpuinfo.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "SDL_mixer.h"
 #include "load_aiff.h"
@@ -45,6 +50,18 @@
 #define __MIX_INTERNAL_EFFECT__
 #include "effects_internal.h"
 
+/* Chunks, music and the mixing buffers count as SDL_MEMTAG_MIXER when SDL
+   tracks its memory */
+#ifdef SDL_MEMTAG_MIXER
+#define mixer_malloc(size)          SDL_TaggedMalloc(SDL_MEMTAG_MIXER, size)
+#define mixer_calloc(n, size)       SDL_TaggedCalloc(SDL_MEMTAG_MIXER, n, size)
+#define mixer_realloc(mem, size)    SDL_TaggedRealloc(SDL_MEMTAG_MIXER, mem, size)
+#else
+#define mixer_malloc(size)          SDL_malloc(size)
+#define mixer_calloc(n, size)       SDL_calloc(n, size)
+#define mixer_realloc(mem, size)    SDL_realloc(mem, size)
+#endif
+
 /* Magic numbers for various audio file formats */
 #define RIFF        0x46464952      /* "RIFF" */
 #define WAVE        0x45564157      /* "WAVE" */
@@ -56,6 +73,20 @@
 static int audio_opened = 0;
 static SDL_AudioSpec mixer;
 
+/* Channels and music are summed into this float bus, one entry per
+   sample of the callback buffer, and clipped to the device format once.
+   Samples keep their device scale, e.g. [-32768, 32767] for 16-bit. */
+static float *mix_bus = NULL;
+static int mix_bus_samples = 0;
+#ifdef __SSE2__
+static SDL_bool mix_bus_sse2 = SDL_FALSE;
+#endif
+
+/* Channel effects run on a copy of the samples in this buffer, so the
+   audio callback never has to allocate. It's the size of the callback
+   buffer, and shared since channels are mixed one at a time. */
+static Uint8 *mix_effect_buf = NULL;
+
 typedef struct _Mix_effectinfo
 {
     Mix_EffectFunc_t callback;
@@ -84,6 +115,10 @@ static struct _Mix_Channel {
 
 static effect_info *posteffects = NULL;
 
+/* Unregistered effect_info nodes are kept here for reuse, since channels
+   can drop their effects from inside the audio callback. */
+static effect_info *free_effects = NULL;
+
 static int num_channels;
 static int reserved_channels = 0;
 
@@ -283,10 +318,7 @@ static void *Mix_DoEffects(int chan, void *snd, int len)
     if (e != NULL) {    /* are there any registered effects? */
         /* if this is the postmix, we can just overwrite the original. */
         if (!posteffect) {
-            buf = SDL_malloc(len);
-            if (buf == NULL) {
-                return(snd);
-            }
+            buf = mix_effect_buf;
             SDL_memcpy(buf, snd, len);
         }
 
@@ -297,7 +329,7 @@ static void *Mix_DoEffects(int chan, void *snd, int len)
         }
     }
 
-    /* be sure to SDL_free() the return value if != snd ... */
+    /* the return value is only valid until the next call... */
     return(buf);
 }
 
@@ -315,11 +347,256 @@ int Mix_GetPersistXmit()
 	return persist_xmit_audio;
 }
 
+#define MIX_BUS_CLAMP(x, lo, hi) (((x) < (lo)) ? (lo) : (((x) > (hi)) ? (hi) : (x)))
+#define MIX_BUS_ROUND(x) (((x) < 0.0f) ? (Sint32)((x) - 0.5f) : (Sint32)((x) + 0.5f))
+
+#ifdef __SSE2__
+/* MIX_BUS_ROUND() on four samples, with the same additions and truncation
+   so the result doesn't depend on where a sample is in the buffer */
+static __m128i mix_bus_round_sse2(__m128 x)
+{
+    const __m128 half = _mm_or_ps(_mm_and_ps(x, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f));
+    return _mm_cvttps_epi32(_mm_add_ps(x, half));
+}
+#endif
+
+/* Add device format samples, scaled by volume, to the bus */
+static void mix_bus_add(float *bus, const Uint8 *src, int samples, int volume)
+{
+    const float gain = (float)volume / MIX_MAX_VOLUME;
+    int i = 0;
+
+    if ( volume == 0 ) {
+        return;
+    }
+
+    switch (mixer.format) {
+    case AUDIO_U8:
+    case AUDIO_S8: {
+        const int bias = (mixer.format == AUDIO_U8) ? 0x80 : 0;
+#ifdef __SSE2__
+        if ( mix_bus_sse2 ) {
+            const __m128 vgain = _mm_set1_ps(gain);
+            const __m128i vbias = _mm_set1_epi8((char)bias);
+            for ( ; i + 16 <= samples; i += 16 ) {
+                /* Flip unsigned samples to signed, then sign extend to 32 bits */
+                const __m128i s = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(src + i)), vbias);
+                const __m128i lo = _mm_unpacklo_epi8(s, s);
+                const __m128i hi = _mm_unpackhi_epi8(s, s);
+                const __m128i s0 = _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 24);
+                const __m128i s1 = _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 24);
+                const __m128i s2 = _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 24);
+                const __m128i s3 = _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 24);
+                _mm_storeu_ps(bus + i, _mm_add_ps(_mm_loadu_ps(bus + i), _mm_mul_ps(_mm_cvtepi32_ps(s0), vgain)));
+                _mm_storeu_ps(bus + i + 4, _mm_add_ps(_mm_loadu_ps(bus + i + 4), _mm_mul_ps(_mm_cvtepi32_ps(s1), vgain)));
+                _mm_storeu_ps(bus + i + 8, _mm_add_ps(_mm_loadu_ps(bus + i + 8), _mm_mul_ps(_mm_cvtepi32_ps(s2), vgain)));
+                _mm_storeu_ps(bus + i + 12, _mm_add_ps(_mm_loadu_ps(bus + i + 12), _mm_mul_ps(_mm_cvtepi32_ps(s3), vgain)));
+            }
+        }
+#endif
+        for ( ; i < samples; ++i ) {
+            bus[i] += (float)(Sint8)(src[i] ^ bias) * gain;
+        }
+        break;
+    }
+
+    case AUDIO_S16LSB:
+    case AUDIO_S16MSB: {
+        const Sint16 *src16 = (const Sint16 *)src;
+        if ( mixer.format != AUDIO_S16SYS ) {
+            for ( ; i < samples; ++i ) {
+                bus[i] += (float)(Sint16)SDL_Swap16(src16[i]) * gain;
+            }
+            break;
+        }
+#ifdef __SSE2__
+        if ( mix_bus_sse2 ) {
+            const __m128 vgain = _mm_set1_ps(gain);
+            for ( ; i + 8 <= samples; i += 8 ) {
+                const __m128i s = _mm_loadu_si128((const __m128i *)(src16 + i));
+                /* Sign extend to 32 bits by unpacking into the high halves */
+                const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);
+                const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+                _mm_storeu_ps(bus + i, _mm_add_ps(_mm_loadu_ps(bus + i), _mm_mul_ps(_mm_cvtepi32_ps(lo), vgain)));
+                _mm_storeu_ps(bus + i + 4, _mm_add_ps(_mm_loadu_ps(bus + i + 4), _mm_mul_ps(_mm_cvtepi32_ps(hi), vgain)));
+            }
+        }
+#endif
+        for ( ; i < samples; ++i ) {
+            bus[i] += (float)src16[i] * gain;
+        }
+        break;
+    }
+
+    case AUDIO_S32LSB:
+    case AUDIO_S32MSB: {
+        const Sint32 *src32 = (const Sint32 *)src;
+        if ( mixer.format != AUDIO_S32SYS ) {
+            for ( ; i < samples; ++i ) {
+                bus[i] += (float)(Sint32)SDL_Swap32(src32[i]) * gain;
+            }
+            break;
+        }
+#ifdef __SSE2__
+        if ( mix_bus_sse2 ) {
+            const __m128 vgain = _mm_set1_ps(gain);
+            for ( ; i + 4 <= samples; i += 4 ) {
+                const __m128 s = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(src32 + i)));
+                _mm_storeu_ps(bus + i, _mm_add_ps(_mm_loadu_ps(bus + i), _mm_mul_ps(s, vgain)));
+            }
+        }
+#endif
+        for ( ; i < samples; ++i ) {
+            bus[i] += (float)src32[i] * gain;
+        }
+        break;
+    }
+
+    case AUDIO_F32LSB:
+    case AUDIO_F32MSB: {
+        const float *srcf = (const float *)src;
+        if ( mixer.format != AUDIO_F32SYS ) {
+            for ( ; i < samples; ++i ) {
+                bus[i] += SDL_SwapFloat(srcf[i]) * gain;
+            }
+            break;
+        }
+#ifdef __SSE2__
+        if ( mix_bus_sse2 ) {
+            const __m128 vgain = _mm_set1_ps(gain);
+            for ( ; i + 4 <= samples; i += 4 ) {
+                _mm_storeu_ps(bus + i, _mm_add_ps(_mm_loadu_ps(bus + i), _mm_mul_ps(_mm_loadu_ps(srcf + i), vgain)));
+            }
+        }
+#endif
+        for ( ; i < samples; ++i ) {
+            bus[i] += srcf[i] * gain;
+        }
+        break;
+    }
+    }
+}
+
+/* Clip the bus to the device format range and convert it, rounding to nearest */
+static void mix_bus_clip(Uint8 *dst, const float *bus, int samples)
+{
+    int i = 0;
+
+    switch (mixer.format) {
+    case AUDIO_U8:
+    case AUDIO_S8: {
+        const int bias = (mixer.format == AUDIO_U8) ? 0x80 : 0;
+#ifdef __SSE2__
+        if ( mix_bus_sse2 ) {
+            const __m128 vmin = _mm_set1_ps(-128.0f);
+            const __m128 vmax = _mm_set1_ps(127.0f);
+            const __m128i vbias = _mm_set1_epi8((char)bias);
+            for ( ; i + 16 <= samples; i += 16 ) {
+                const __m128i s0 = mix_bus_round_sse2(_mm_max_ps(_mm_min_ps(_mm_loadu_ps(bus + i), vmax), vmin));
+                const __m128i s1 = mix_bus_round_sse2(_mm_max_ps(_mm_min_ps(_mm_loadu_ps(bus + i + 4), vmax), vmin));
+                const __m128i s2 = mix_bus_round_sse2(_mm_max_ps(_mm_min_ps(_mm_loadu_ps(bus + i + 8), vmax), vmin));
+                const __m128i s3 = mix_bus_round_sse2(_mm_max_ps(_mm_min_ps(_mm_loadu_ps(bus + i + 12), vmax), vmin));
+                const __m128i s = _mm_packs_epi16(_mm_packs_epi32(s0, s1), _mm_packs_epi32(s2, s3));
+                _mm_storeu_si128((__m128i *)(dst + i), _mm_xor_si128(s, vbias));
+            }
+        }
+#endif
+        for ( ; i < samples; ++i ) {
+            const float x = MIX_BUS_CLAMP(bus[i], -128.0f, 127.0f);
+            dst[i] = (Uint8)(MIX_BUS_ROUND(x) ^ bias);
+        }
+        break;
+    }
+
+    case AUDIO_S16LSB:
+    case AUDIO_S16MSB: {
+        Sint16 *dst16 = (Sint16 *)dst;
+        if ( mixer.format != AUDIO_S16SYS ) {
+            for ( ; i < samples; ++i ) {
+                const float x = MIX_BUS_CLAMP(bus[i], -32768.0f, 32767.0f);
+                dst16[i] = (Sint16)SDL_Swap16((Uint16)MIX_BUS_ROUND(x));
+            }
+            break;
+        }
+#ifdef __SSE2__
+        if ( mix_bus_sse2 ) {
+            const __m128 vmin = _mm_set1_ps(-32768.0f);
+            const __m128 vmax = _mm_set1_ps(32767.0f);
+            for ( ; i + 8 <= samples; i += 8 ) {
+                /* Clamp before converting so huge sums can't wrap, then pack */
+                const __m128 lo = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(bus + i), vmax), vmin);
+                const __m128 hi = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(bus + i + 4), vmax), vmin);
+                _mm_storeu_si128((__m128i *)(dst16 + i), _mm_packs_epi32(mix_bus_round_sse2(lo), mix_bus_round_sse2(hi)));
+            }
+        }
+#endif
+        for ( ; i < samples; ++i ) {
+            const float x = MIX_BUS_CLAMP(bus[i], -32768.0f, 32767.0f);
+            dst16[i] = (Sint16)MIX_BUS_ROUND(x);
+        }
+        break;
+    }
+
+    case AUDIO_S32LSB:
+    case AUDIO_S32MSB: {
+        /* 2147483520.0f is the largest float below 2^31 */
+        Sint32 *dst32 = (Sint32 *)dst;
+        if ( mixer.format != AUDIO_S32SYS ) {
+            for ( ; i < samples; ++i ) {
+                const float x = MIX_BUS_CLAMP(bus[i], -2147483648.0f, 2147483520.0f);
+                dst32[i] = (Sint32)SDL_Swap32((Uint32)MIX_BUS_ROUND(x));
+            }
+            break;
+        }
+#ifdef __SSE2__
+        if ( mix_bus_sse2 ) {
+            const __m128 vmin = _mm_set1_ps(-2147483648.0f);
+            const __m128 vmax = _mm_set1_ps(2147483520.0f);
+            for ( ; i + 4 <= samples; i += 4 ) {
+                const __m128 x = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(bus + i), vmax), vmin);
+                _mm_storeu_si128((__m128i *)(dst32 + i), mix_bus_round_sse2(x));
+            }
+        }
+#endif
+        for ( ; i < samples; ++i ) {
+            const float x = MIX_BUS_CLAMP(bus[i], -2147483648.0f, 2147483520.0f);
+            dst32[i] = MIX_BUS_ROUND(x);
+        }
+        break;
+    }
+
+    case AUDIO_F32LSB:
+    case AUDIO_F32MSB: {
+        float *dstf = (float *)dst;
+        if ( mixer.format != AUDIO_F32SYS ) {
+            for ( ; i < samples; ++i ) {
+                dstf[i] = SDL_SwapFloat(MIX_BUS_CLAMP(bus[i], -1.0f, 1.0f));
+            }
+            break;
+        }
+#ifdef __SSE2__
+        if ( mix_bus_sse2 ) {
+            const __m128 vmin = _mm_set1_ps(-1.0f);
+            const __m128 vmax = _mm_set1_ps(1.0f);
+            for ( ; i + 4 <= samples; i += 4 ) {
+                _mm_storeu_ps(dstf + i, _mm_max_ps(_mm_min_ps(_mm_loadu_ps(bus + i), vmax), vmin));
+            }
+        }
+#endif
+        for ( ; i < samples; ++i ) {
+            dstf[i] = MIX_BUS_CLAMP(bus[i], -1.0f, 1.0f);
+        }
+        break;
+    }
+    }
+}
+
 /* Mixing function */
 static void mix_channels(void *udata, Uint8 *stream, int len)
 {
     Uint8 *mix_input;
     int i, mixable, volume = SDL_MIX_MAXVOLUME;
+    int samplesize = SDL_AUDIO_BITSIZE(mixer.format) / 8;
     Uint32 sdl_ticks;
 	SDL_bool require_xmit = Mix_PlayingMusic()? SDL_TRUE: SDL_FALSE;
 	static int suspend_audio_ticks = -1;
@@ -327,9 +604,26 @@ static void mix_channels(void *udata, Uint8 *stream, int len)
     /* Need to initialize the stream in SDL 1.3+ */
     SDL_memset(stream, mixer.silence, len);
 
+    if ( len / samplesize > mix_bus_samples ) {
+        float *bus = (float *) mixer_realloc(mix_bus, (len / samplesize) * sizeof(float));
+        Uint8 *effect_buf = (Uint8 *) mixer_realloc(mix_effect_buf, len);
+        if ( bus != NULL ) {
+            mix_bus = bus;
+        }
+        if ( effect_buf != NULL ) {
+            mix_effect_buf = effect_buf;
+        }
+        if ( bus == NULL || effect_buf == NULL ) {
+            return;
+        }
+        mix_bus_samples = len / samplesize;
+    }
+    SDL_memset(mix_bus, 0, (len / samplesize) * sizeof(float));
+
     /* Mix the music (must be done before the channels are added) */
     if ( music_active || (mix_music != music_mixer) ) {
         mix_music(music_data, stream, len);
+        mix_bus_add(mix_bus, stream, len / samplesize, MIX_MAX_VOLUME);
     }
 
     /* Mix any playing channels... */
@@ -378,9 +672,7 @@ static void mix_channels(void *udata, Uint8 *stream, int len)
                     }
 
                     mix_input = Mix_DoEffects(i, mix_channel[i].samples, mixable);
-                    SDL_MixAudio(stream+index,mix_input,mixable,volume);
-                    if (mix_input != mix_channel[i].samples)
-                        SDL_free(mix_input);
+                    mix_bus_add(mix_bus + index / samplesize, mix_input, mixable / samplesize, volume);
 
                     mix_channel[i].samples += mixable;
                     mix_channel[i].playing -= mixable;
@@ -402,9 +694,7 @@ static void mix_channels(void *udata, Uint8 *stream, int len)
                     }
 
                     mix_input = Mix_DoEffects(i, mix_channel[i].chunk->abuf, remaining);
-                    SDL_MixAudio(stream+index, mix_input, remaining, volume);
-                    if (mix_input != mix_channel[i].chunk->abuf)
-                        SDL_free(mix_input);
+                    mix_bus_add(mix_bus + index / samplesize, mix_input, remaining / samplesize, volume);
 
                     if (mix_channel[i].looping > 0) {
                         --mix_channel[i].looping;
@@ -424,6 +714,9 @@ static void mix_channels(void *udata, Uint8 *stream, int len)
         }
     }
 
+    /* Clip everything back to the device format in a single pass */
+    mix_bus_clip(stream, mix_bus, len / samplesize);
+
     /* rcg06122001 run posteffects... */
     Mix_DoEffects(MIX_CHANNEL_POST, stream, len);
 
@@ -493,14 +786,36 @@ int Mix_OpenAudio(int frequency, Uint16 format, int nchannels, int chunksize)
     PrintFormat("Audio device", &mixer);
 #endif
 
+    mix_bus_samples = mixer.size / (SDL_AUDIO_BITSIZE(mixer.format) / 8);
+    mix_bus = (float *) mixer_malloc(mix_bus_samples * sizeof(float));
+    mix_effect_buf = (Uint8 *) mixer_malloc(mixer.size);
+    if ( mix_bus == NULL || mix_effect_buf == NULL ) {
+        SDL_CloseAudio();
+        SDL_free(mix_bus);
+        mix_bus = NULL;
+        mix_bus_samples = 0;
+        SDL_free(mix_effect_buf);
+        mix_effect_buf = NULL;
+        SDL_OutOfMemory();
+        return(-1);
+    }
+#ifdef __SSE2__
+    mix_bus_sse2 = SDL_HasSSE2();
+#endif
+
     /* Initialize the music players */
     if ( open_music(&mixer) < 0 ) {
         SDL_CloseAudio();
+        SDL_free(mix_bus);
+        mix_bus = NULL;
+        mix_bus_samples = 0;
+        SDL_free(mix_effect_buf);
+        mix_effect_buf = NULL;
         return(-1);
     }
 
     num_channels = MIX_CHANNELS;
-    mix_channel = (struct _Mix_Channel *) SDL_malloc(num_channels * sizeof(struct _Mix_Channel));
+    mix_channel = (struct _Mix_Channel *) mixer_malloc(num_channels * sizeof(struct _Mix_Channel));
 
     /* Clear out the audio channels */
     for ( i=0; i<num_channels; ++i ) {
@@ -557,7 +872,7 @@ int Mix_AllocateChannels(int numchans)
         }
     }
     SDL_LockAudio();
-    mix_channel = (struct _Mix_Channel *) SDL_realloc(mix_channel, numchans * sizeof(struct _Mix_Channel));
+    mix_channel = (struct _Mix_Channel *) mixer_realloc(mix_channel, numchans * sizeof(struct _Mix_Channel));
     if ( numchans > num_channels ) {
         /* Initialize the new channels */
         int i;
@@ -640,7 +955,7 @@ Mix_Chunk *Mix_LoadWAV_RW(SDL_RWops *src, int freesrc)
     }
 
     /* Allocate the chunk memory */
-    chunk = (Mix_Chunk *)SDL_malloc(sizeof(Mix_Chunk));
+    chunk = (Mix_Chunk *)mixer_malloc(sizeof(Mix_Chunk));
     if ( chunk == NULL ) {
         SDL_SetError("Out of memory");
         if ( freesrc ) {
@@ -722,7 +1037,7 @@ Mix_Chunk *Mix_LoadWAV_RW(SDL_RWops *src, int freesrc)
         }
         samplesize = ((wavespec.format & 0xFF)/8)*wavespec.channels;
         wavecvt.len = chunk->alen & ~(samplesize-1);
-        wavecvt.buf = (Uint8 *)SDL_calloc(1, wavecvt.len*wavecvt.len_mult);
+        wavecvt.buf = (Uint8 *)mixer_calloc(1, wavecvt.len*wavecvt.len_mult);
         if ( wavecvt.buf == NULL ) {
             SDL_SetError("Out of memory");
             SDL_free(chunk->abuf);
@@ -741,6 +1056,12 @@ Mix_Chunk *Mix_LoadWAV_RW(SDL_RWops *src, int freesrc)
 
         chunk->abuf = wavecvt.buf;
         chunk->alen = wavecvt.len_cvt;
+    } else if ( chunk->alen > 0 ) {
+        /* The loader allocated the samples, count them as the mixer's */
+        Uint8 *abuf = (Uint8 *)mixer_realloc(chunk->abuf, chunk->alen);
+        if ( abuf != NULL ) {
+            chunk->abuf = abuf;
+        }
     }
 
     chunk->allocated = 1;
@@ -762,7 +1083,7 @@ Mix_Chunk *Mix_QuickLoad_WAV(Uint8 *mem)
     }
 
     /* Allocate the chunk memory */
-    chunk = (Mix_Chunk *)SDL_calloc(1,sizeof(Mix_Chunk));
+    chunk = (Mix_Chunk *)mixer_calloc(1,sizeof(Mix_Chunk));
     if ( chunk == NULL ) {
         SDL_SetError("Out of memory");
         return(NULL);
@@ -796,7 +1117,7 @@ Mix_Chunk *Mix_QuickLoad_RAW(Uint8 *mem, Uint32 len)
     }
 
     /* Allocate the chunk memory */
-    chunk = (Mix_Chunk *)SDL_malloc(sizeof(Mix_Chunk));
+    chunk = (Mix_Chunk *)mixer_malloc(sizeof(Mix_Chunk));
     if ( chunk == NULL ) {
         SDL_SetError("Out of memory");
         return(NULL);
@@ -1224,6 +1545,16 @@ void Mix_CloseAudio(void)
             SDL_CloseAudio();
             SDL_free(mix_channel);
             mix_channel = NULL;
+            SDL_free(mix_bus);
+            mix_bus = NULL;
+            mix_bus_samples = 0;
+            SDL_free(mix_effect_buf);
+            mix_effect_buf = NULL;
+            while (free_effects != NULL) {
+                effect_info *next = free_effects->next;
+                SDL_free(free_effects);
+                free_effects = next;
+            }
 
             /* rcg06042009 report available decoders at runtime. */
             SDL_free((void *)chunk_decoders);
@@ -1398,10 +1729,15 @@ static int _Mix_register_effect(effect_info **e, Mix_EffectFunc_t f,
         return(0);
     }
 
-    new_e = SDL_malloc(sizeof (effect_info));
-    if (new_e == NULL) {
-        Mix_SetError("Out of memory");
-        return(0);
+    if (free_effects != NULL) {
+        new_e = free_effects;
+        free_effects = new_e->next;
+    } else {
+        new_e = SDL_malloc(sizeof (effect_info));
+        if (new_e == NULL) {
+            Mix_SetError("Out of memory");
+            return(0);
+        }
     }
 
     new_e->callback = f;
@@ -1445,7 +1781,8 @@ static int _Mix_remove_effect(int channel, effect_info **e, Mix_EffectFunc_t f)
             if (cur->done_callback != NULL) {
                 cur->done_callback(channel, cur->udata);
             }
-            SDL_free(cur);
+            cur->next = free_effects;
+            free_effects = cur;
 
             if (prev == NULL) {   /* removing first item of list? */
                 *e = next;
@@ -1478,7 +1815,8 @@ static int _Mix_remove_all_effects(int channel, effect_info **e)
         if (cur->done_callback != NULL) {
             cur->done_callback(channel, cur->udata);
         }
-        SDL_free(cur);
+        cur->next = free_effects;
+        free_effects = cur;
     }
     *e = NULL;
 
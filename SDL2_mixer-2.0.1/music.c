@@ -28,6 +28,9 @@
 #include "SDL_endian.h"
 #include "SDL_audio.h"
 #include "SDL_timer.h"
+#include "SDL_atomic.h"
+#include "SDL_mutex.h"
+#include "SDL_thread.h"
 
 #include "SDL_mixer.h"
 
@@ -67,8 +70,52 @@
 #include "music_flac.h"
 #endif
 
-#if defined(MP3_MUSIC) || defined(MP3_MAD_MUSIC)
+/* Music and the decode ahead rings count as SDL_MEMTAG_MIXER when SDL
+   tracks its memory */
+#ifdef SDL_MEMTAG_MIXER
+#define mixer_malloc(size)          SDL_TaggedMalloc(SDL_MEMTAG_MIXER, size)
+#define mixer_calloc(n, size)       SDL_TaggedCalloc(SDL_MEMTAG_MIXER, n, size)
+#else
+#define mixer_malloc(size)          SDL_malloc(size)
+#define mixer_calloc(n, size)       SDL_calloc(n, size)
+#endif
+
 static SDL_AudioSpec used_mixer;
+
+#if defined(OGG_MUSIC) || defined(FLAC_MUSIC) || defined(MP3_MAD_MUSIC)
+#define DECODE_AHEAD
+
+/* The decoder thread works in pieces of this many bytes */
+#define DECODE_AHEAD_CHUNK  4096
+
+/* Music can be decoded ahead on its own thread, into a ring of audio in
+   the mixer format, so the audio callback only has to copy it out.  The
+   ring needs no lock: only the thread moves 'head' and only the callback
+   moves 'tail', both count bytes and are allowed to wrap.  'lock' is held
+   by the thread while it decodes, and by anything else that uses the
+   decoder or empties the ring, which is done with the audio locked.
+   The callback never waits for it, it leaves a stop or a loop in
+   'request' for the thread.
+*/
+#define DECODE_AHEAD_STOP   1
+#define DECODE_AHEAD_LOOP   2
+
+typedef struct _DecodeAhead {
+    SDL_Thread *thread;
+    SDL_mutex *lock;
+    SDL_cond *wake;
+    Uint8 *ring;
+    Uint32 size;
+    SDL_atomic_t head;
+    SDL_atomic_t tail;
+    SDL_atomic_t finished;
+    SDL_atomic_t underruns;
+    SDL_atomic_t request;
+    int active;
+    int quit;
+    int volume;
+    Uint8 chunk[DECODE_AHEAD_CHUNK];
+} DecodeAhead;
 #endif
 
 
@@ -123,6 +170,9 @@ struct _Mix_Music {
     int fade_steps;
     int error;
 	int played;
+#ifdef DECODE_AHEAD
+    DecodeAhead *ahead;
+#endif
 };
 #ifdef MID_MUSIC
 #ifdef USE_TIMIDITY_MIDI
@@ -201,10 +251,294 @@ void Mix_HookMusicPlaying(void (*music_playing)(int, int))
     SDL_UnlockAudio();
 }
 
+#ifdef DECODE_AHEAD
+/* Decode some music at full volume, with the decoder locked.
+   This returns the number of bytes decoded, and notes when the music ends.
+ */
+static int decode_ahead_decode(Mix_Music *music, Uint8 *stream, int len)
+{
+    int left = len;
+    int playing = 0;
+
+    switch (music->type) {
+#ifdef OGG_MUSIC
+        case MUS_OGG:
+        if ( OGG_playing(music->data.ogg) ) {
+            left = OGG_playAudio(music->data.ogg, stream, len);
+        }
+        playing = OGG_playing(music->data.ogg);
+        break;
+#endif
+#ifdef FLAC_MUSIC
+        case MUS_FLAC:
+        if ( FLAC_playing(music->data.flac) ) {
+            left = FLAC_playAudio(music->data.flac, stream, len);
+        }
+        playing = FLAC_playing(music->data.flac);
+        break;
+#endif
+#ifdef MP3_MAD_MUSIC
+        case MUS_MP3_MAD:
+        if ( mad_isPlaying(music->data.mp3_mad) ) {
+            left = mad_getSamples(music->data.mp3_mad, stream, len);
+        }
+        playing = mad_isPlaying(music->data.mp3_mad);
+        break;
+#endif
+        default:
+        break;
+    }
+    if ( !playing ) {
+        SDL_AtomicSet(&music->ahead->finished, 1);
+    }
+    return(len - left);
+}
+
+static void decode_ahead_copy(DecodeAhead *ahead, Uint8 *dst, const Uint8 *src, int len)
+{
+    if ( ahead->volume == MIX_MAX_VOLUME ) {
+        SDL_memcpy(dst, src, len);
+    } else {
+        SDL_MixAudio(dst, src, len, ahead->volume);
+    }
+}
+
+/* Add decoded music to the ring, there must be room for it */
+static void decode_ahead_write(DecodeAhead *ahead, const Uint8 *data, int len)
+{
+    Uint32 head = (Uint32)SDL_AtomicGet(&ahead->head);
+    Uint32 offset = head & (ahead->size - 1);
+    Uint32 first = ahead->size - offset;
+
+    if ( first > (Uint32)len ) {
+        first = len;
+    }
+    SDL_memcpy(ahead->ring + offset, data, first);
+    SDL_memcpy(ahead->ring, data + first, len - first);
+    SDL_AtomicSet(&ahead->head, (int)(head + len));
+}
+
+/* Mix music out of the ring, returns the number of bytes there were */
+static int decode_ahead_read(DecodeAhead *ahead, Uint8 *stream, int len)
+{
+    Uint32 tail = (Uint32)SDL_AtomicGet(&ahead->tail);
+    Uint32 available = (Uint32)SDL_AtomicGet(&ahead->head) - tail;
+    Uint32 offset = tail & (ahead->size - 1);
+    Uint32 amount, first;
+
+    amount = ((Uint32)len < available) ? (Uint32)len : available;
+    first = ahead->size - offset;
+    if ( first > amount ) {
+        first = amount;
+    }
+    decode_ahead_copy(ahead, stream, ahead->ring + offset, first);
+    decode_ahead_copy(ahead, stream + first, ahead->ring, amount - first);
+    SDL_AtomicSet(&ahead->tail, (int)(tail + amount));
+    return(amount);
+}
+
+/* Start the music over from the beginning, with the decoder locked */
+static void decode_ahead_rewind(Mix_Music *music)
+{
+    switch (music->type) {
+#ifdef OGG_MUSIC
+        case MUS_OGG:
+        OGG_play(music->data.ogg);
+        OGG_jump_to_time(music->data.ogg, 0.0);
+        break;
+#endif
+#ifdef FLAC_MUSIC
+        case MUS_FLAC:
+        FLAC_play(music->data.flac);
+        FLAC_jump_to_time(music->data.flac, 0.0);
+        break;
+#endif
+#ifdef MP3_MAD_MUSIC
+        case MUS_MP3_MAD:
+        mad_start(music->data.mp3_mad);
+        mad_seek(music->data.mp3_mad, 0.0);
+        break;
+#endif
+        default:
+        break;
+    }
+}
+
+/* Carry out a stop or a loop the callback asked for, with the decoder locked.
+   The request is only cleared once it's done, so looping music never looks
+   finished in between.
+ */
+static void decode_ahead_request(Mix_Music *music)
+{
+    DecodeAhead *ahead = music->ahead;
+    int request = SDL_AtomicGet(&ahead->request);
+
+    switch (request) {
+        case DECODE_AHEAD_STOP:
+        ahead->active = 0;
+        break;
+        case DECODE_AHEAD_LOOP:
+        decode_ahead_rewind(music);
+        SDL_AtomicSet(&ahead->finished, 0);
+        ahead->active = 1;
+        break;
+        default:
+        return;
+    }
+    SDL_AtomicCAS(&ahead->request, request, 0);
+}
+
+static int SDLCALL decode_ahead_thread(void *data)
+{
+    Mix_Music *music = (Mix_Music *)data;
+    DecodeAhead *ahead = music->ahead;
+    Uint32 used;
+    int len;
+
+    SDL_LockMutex(ahead->lock);
+    while ( !ahead->quit ) {
+        decode_ahead_request(music);
+        used = (Uint32)SDL_AtomicGet(&ahead->head) - (Uint32)SDL_AtomicGet(&ahead->tail);
+        if ( !ahead->active || SDL_AtomicGet(&ahead->finished) ||
+             ahead->size - used < DECODE_AHEAD_CHUNK ) {
+            /* The callback wakes us up as it empties the ring */
+            SDL_CondWaitTimeout(ahead->wake, ahead->lock, 10);
+            continue;
+        }
+        len = decode_ahead_decode(music, ahead->chunk, DECODE_AHEAD_CHUNK);
+        decode_ahead_write(ahead, ahead->chunk, len);
+
+        /* Let a seek or a new start in between pieces */
+        SDL_UnlockMutex(ahead->lock);
+        SDL_LockMutex(ahead->lock);
+    }
+    SDL_UnlockMutex(ahead->lock);
+    return(0);
+}
+
+/* Empty the ring after the music has been started or moved, and decode
+   the first callback's worth right away.  The decoder and the audio must
+   be locked, this drops anything the callback asked for before.
+ */
+static void decode_ahead_restart(Mix_Music *music)
+{
+    DecodeAhead *ahead = music->ahead;
+    Uint32 primed = 0;
+    int len;
+
+    SDL_AtomicSet(&ahead->request, 0);
+    SDL_AtomicSet(&ahead->tail, SDL_AtomicGet(&ahead->head));
+    SDL_AtomicSet(&ahead->finished, 0);
+    ahead->active = 1;
+    while ( primed < used_mixer.size && primed < ahead->size &&
+            !SDL_AtomicGet(&ahead->finished) ) {
+        len = decode_ahead_decode(music, ahead->chunk, DECODE_AHEAD_CHUNK);
+        if ( len == 0 ) {
+            break;
+        }
+        decode_ahead_write(ahead, ahead->chunk, len);
+        primed += len;
+    }
+    SDL_CondSignal(ahead->wake);
+}
+
+/* Play music from the ring in the audio callback, returns the bytes left */
+static int decode_ahead_play(Mix_Music *music, Uint8 *stream, int len)
+{
+    DecodeAhead *ahead = music->ahead;
+    int amount, decoded;
+    int looping;
+
+    amount = decode_ahead_read(ahead, stream, len);
+    looping = (SDL_AtomicGet(&ahead->request) == DECODE_AHEAD_LOOP);
+    if ( amount < len && (looping || !SDL_AtomicGet(&ahead->finished)) ) {
+        /* The thread fell behind, decode the rest here if it isn't busy,
+           otherwise the rest is silence.  Starting the music over is left
+           to the thread. */
+        SDL_AtomicIncRef(&ahead->underruns);
+        if ( !looping && SDL_TryLockMutex(ahead->lock) == 0 ) {
+            amount += decode_ahead_read(ahead, stream + amount, len - amount);
+            while ( amount < len && !SDL_AtomicGet(&ahead->finished) ) {
+                decoded = len - amount;
+                if ( decoded > DECODE_AHEAD_CHUNK ) {
+                    decoded = DECODE_AHEAD_CHUNK;
+                }
+                decoded = decode_ahead_decode(music, ahead->chunk, decoded);
+                if ( decoded == 0 ) {
+                    break;
+                }
+                decode_ahead_copy(ahead, stream + amount, ahead->chunk, decoded);
+                amount += decoded;
+            }
+            SDL_UnlockMutex(ahead->lock);
+        }
+        if ( SDL_AtomicGet(&ahead->request) == DECODE_AHEAD_LOOP ||
+             !SDL_AtomicGet(&ahead->finished) ) {
+            amount = len;
+        }
+    }
+    SDL_CondSignal(ahead->wake);
+    return(len - amount);
+}
+
+/* These are safe in the audio callback, the thread does the work.
+   Looping is asked for as soon as the decoder reaches the end, so the
+   thread can decode the start again while the ring plays out.
+ */
+static void decode_ahead_stop(Mix_Music *music)
+{
+    SDL_AtomicSet(&music->ahead->request, DECODE_AHEAD_STOP);
+    SDL_CondSignal(music->ahead->wake);
+}
+
+static void decode_ahead_loop(Mix_Music *music)
+{
+    SDL_AtomicSet(&music->ahead->request, DECODE_AHEAD_LOOP);
+    SDL_CondSignal(music->ahead->wake);
+}
+
+static void decode_ahead_free(Mix_Music *music)
+{
+    DecodeAhead *ahead = music->ahead;
+
+    if ( ahead->thread ) {
+        SDL_LockMutex(ahead->lock);
+        ahead->quit = 1;
+        SDL_CondSignal(ahead->wake);
+        SDL_UnlockMutex(ahead->lock);
+        SDL_WaitThread(ahead->thread, NULL);
+    }
+    if ( ahead->wake ) {
+        SDL_DestroyCond(ahead->wake);
+    }
+    if ( ahead->lock ) {
+        SDL_DestroyMutex(ahead->lock);
+    }
+    SDL_free(ahead->ring);
+    SDL_free(ahead);
+    music->ahead = NULL;
+}
+#endif /* DECODE_AHEAD */
+
 /* If music isn't playing, halt it if no looping is required, restart it */
 /* othesrchise. NOP if the music is playing */
 static int music_halt_or_loop (void)
 {
+#ifdef DECODE_AHEAD
+    if ( music_playing->ahead ) {
+        DecodeAhead *ahead = music_playing->ahead;
+
+        if ( music_loops && SDL_AtomicGet(&ahead->finished) &&
+             !SDL_AtomicGet(&ahead->request) ) {
+            if ( music_loops > 0 ) {
+                --music_loops;
+            }
+            music_playing->played = 0;
+            decode_ahead_loop(music_playing);
+        }
+    }
+#endif
+
     /* Restart music if it has to loop */
 
     if (!music_internal_playing())
@@ -277,6 +611,11 @@ void music_mixer(void *udata, Uint8 *stream, int len)
         if (!music_internal_playing())
             return;
 
+#ifdef DECODE_AHEAD
+        if ( music_playing->ahead ) {
+            left = decode_ahead_play(music_playing, stream, len);
+        } else
+#endif
         switch (music_playing->type) {
 #ifdef CMD_MUSIC
             case MUS_CMD:
@@ -426,9 +765,9 @@ int open_music(SDL_AudioSpec *mixer)
         add_music_decoder("FLAC");
     }
 #endif
-#if defined(MP3_MUSIC) || defined(MP3_MAD_MUSIC)
     /* Keep a copy of the mixer */
     used_mixer = *mixer;
+#if defined(MP3_MUSIC) || defined(MP3_MAD_MUSIC)
     add_music_decoder("MP3");
 #endif
 
@@ -537,12 +876,15 @@ Mix_Music *Mix_LoadMUS(const char *file)
 #ifdef CMD_MUSIC
     if ( music_cmd ) {
         /* Allocate memory for the music structure */
-        music = (Mix_Music *)SDL_malloc(sizeof(Mix_Music));
+        music = (Mix_Music *)mixer_malloc(sizeof(Mix_Music));
         if ( music == NULL ) {
             Mix_SetError("Out of memory");
             return(NULL);
         }
         music->error = 0;
+#ifdef DECODE_AHEAD
+        music->ahead = NULL;
+#endif
         music->type = MUS_CMD;
         music->data.cmd = MusicCMD_LoadSong(music_cmd, file);
         if ( music->data.cmd == NULL ) {
@@ -627,7 +969,7 @@ Mix_Music *Mix_LoadMUSType_RW(SDL_RWops *src, Mix_MusicType type, int freesrc)
     }
 
     /* Allocate memory for the music structure */
-    music = (Mix_Music *)SDL_malloc(sizeof(Mix_Music));
+    music = (Mix_Music *)mixer_malloc(sizeof(Mix_Music));
     if (music == NULL ) {
         Mix_SetError("Out of memory");
         if (freesrc) {
@@ -636,6 +978,9 @@ Mix_Music *Mix_LoadMUSType_RW(SDL_RWops *src, Mix_MusicType type, int freesrc)
         return NULL;
     }
     music->error = 1;
+#ifdef DECODE_AHEAD
+    music->ahead = NULL;
+#endif
 
     switch (type) {
 #ifdef WAV_MUSIC
@@ -793,6 +1138,11 @@ void Mix_FreeMusic(Mix_Music *music)
             }
         }
         SDL_UnlockAudio();
+#ifdef DECODE_AHEAD
+        if ( music->ahead ) {
+            decode_ahead_free(music);
+        }
+#endif
         switch (music->type) {
 #ifdef CMD_MUSIC
             case MUS_CMD:
@@ -909,6 +1259,13 @@ static int music_internal_play(Mix_Music *music, double position)
 
 	SDL_XmitAudio(SDL_TRUE);
 
+#ifdef DECODE_AHEAD
+    /* The thread may still be finishing a stop the callback asked for */
+    if ( music->ahead ) {
+        SDL_LockMutex(music->ahead->lock);
+    }
+#endif
+
     music_playing = music;
 	music_playing->played = 0;
 
@@ -1006,6 +1363,12 @@ skip:
         }
     }
 
+#ifdef DECODE_AHEAD
+    if ( music->ahead ) {
+        SDL_UnlockMutex(music->ahead->lock);
+    }
+#endif
+
     /* If the setup failed, we're not playing any music anymore */
     if ( retval < 0 ) {
         music_playing = NULL;
@@ -1069,6 +1432,11 @@ int music_internal_position(double position)
 {
     int retval = 0;
 
+#ifdef DECODE_AHEAD
+    if ( music_playing->ahead ) {
+        SDL_LockMutex(music_playing->ahead->lock);
+    }
+#endif
     switch (music_playing->type) {
 #ifdef WAV_MUSIC
 	case MUS_WAV:
@@ -1114,6 +1482,12 @@ int music_internal_position(double position)
         retval = -1;
         break;
     }
+#ifdef DECODE_AHEAD
+    if ( music_playing->ahead ) {
+        decode_ahead_restart(music_playing);
+        SDL_UnlockMutex(music_playing->ahead->lock);
+    }
+#endif
     return(retval);
 }
 int Mix_SetMusicPosition(double position)
@@ -1135,6 +1509,105 @@ int Mix_SetMusicPosition(double position)
     return(retval);
 }
 
+int Mix_SetMusicDecodeAhead(Mix_Music *music, int ms)
+{
+#ifdef DECODE_AHEAD
+    DecodeAhead *ahead;
+    Uint32 size, wanted;
+    int playing;
+
+    if ( music == NULL ) {
+        Mix_SetError("music parameter was NULL");
+        return(-1);
+    }
+    if ( ms_per_step == 0 ) {
+        Mix_SetError("Audio device hasn't been opened");
+        return(-1);
+    }
+    SDL_LockAudio();
+    playing = (music == music_playing);
+    SDL_UnlockAudio();
+    if ( playing ) {
+        Mix_SetError("Can't change decoding ahead while the music is playing");
+        return(-1);
+    }
+
+    if ( music->ahead ) {
+        decode_ahead_free(music);
+    }
+    if ( ms <= 0 ) {
+        return(0);
+    }
+
+    switch (music->type) {
+#ifdef OGG_MUSIC
+        case MUS_OGG:
+        OGG_setvolume(music->data.ogg, MIX_MAX_VOLUME);
+        break;
+#endif
+#ifdef FLAC_MUSIC
+        case MUS_FLAC:
+        FLAC_setvolume(music->data.flac, MIX_MAX_VOLUME);
+        break;
+#endif
+#ifdef MP3_MAD_MUSIC
+        case MUS_MP3_MAD:
+        mad_setVolume(music->data.mp3_mad, MIX_MAX_VOLUME);
+        break;
+#endif
+        default:
+        Mix_SetError("Decoding ahead isn't supported for this music type");
+        return(-1);
+    }
+
+    /* The ring is a power of two, and always holds a couple of callbacks */
+    wanted = (Uint32)((double)ms * used_mixer.freq / 1000.0) *
+             used_mixer.channels * (SDL_AUDIO_BITSIZE(used_mixer.format) / 8);
+    if ( wanted < 2 * used_mixer.size ) {
+        wanted = 2 * used_mixer.size;
+    }
+    for ( size = 2 * DECODE_AHEAD_CHUNK; size < wanted; size *= 2 ) {
+        continue;
+    }
+
+    ahead = (DecodeAhead *)mixer_calloc(1, sizeof(*ahead));
+    if ( ahead == NULL ) {
+        Mix_SetError("Out of memory");
+        return(-1);
+    }
+    music->ahead = ahead;
+    ahead->size = size;
+    ahead->volume = music_volume;
+    ahead->ring = (Uint8 *)mixer_malloc(size);
+    ahead->lock = SDL_CreateMutex();
+    ahead->wake = SDL_CreateCond();
+    if ( ahead->ring && ahead->lock && ahead->wake ) {
+        ahead->thread = SDL_CreateThread(decode_ahead_thread, "SDL_mixer music", music);
+    }
+    if ( ahead->thread == NULL ) {
+        if ( ahead->ring == NULL ) {
+            Mix_SetError("Out of memory");
+        }
+        decode_ahead_free(music);
+        return(-1);
+    }
+    return(0);
+#else
+    Mix_SetError("Decoding ahead isn't supported for this music type");
+    return(-1);
+#endif /* DECODE_AHEAD */
+}
+
+int Mix_GetMusicUnderruns(const Mix_Music *music)
+{
+#ifdef DECODE_AHEAD
+    if ( music && music->ahead ) {
+        return SDL_AtomicGet(&music->ahead->underruns);
+    }
+#endif
+    return(0);
+}
+
 /* Set the music's initial volume */
 static void music_internal_initialize_volume(void)
 {
@@ -1148,6 +1621,13 @@ static void music_internal_initialize_volume(void)
 /* Set the music volume */
 static void music_internal_volume(int volume)
 {
+#ifdef DECODE_AHEAD
+    /* The music is decoded at full volume and mixed out of the ring */
+    if ( music_playing->ahead ) {
+        music_playing->ahead->volume = volume;
+        return;
+    }
+#endif
     switch (music_playing->type) {
 #ifdef CMD_MUSIC
         case MUS_CMD:
@@ -1240,6 +1720,13 @@ int Mix_VolumeMusic(int volume)
 /* Halt playing of music */
 static void music_internal_halt(void)
 {
+#ifdef DECODE_AHEAD
+    /* The decoder is left alone, playing the music again starts it over */
+    if ( music_playing->ahead ) {
+        decode_ahead_stop(music_playing);
+        goto skip;
+    }
+#endif
     switch (music_playing->type) {
 #ifdef CMD_MUSIC
         case MUS_CMD:
@@ -1410,6 +1897,16 @@ static int music_internal_playing()
         return 0;
     }
 
+#ifdef DECODE_AHEAD
+    /* Decoded music is still playing until the ring runs dry */
+    if ( music_playing->ahead ) {
+        DecodeAhead *ahead = music_playing->ahead;
+        return SDL_AtomicGet(&ahead->request) == DECODE_AHEAD_LOOP ||
+               !SDL_AtomicGet(&ahead->finished) ||
+               SDL_AtomicGet(&ahead->head) != SDL_AtomicGet(&ahead->tail);
+    }
+#endif
+
     switch (music_playing->type) {
 #ifdef CMD_MUSIC
         case MUS_CMD:
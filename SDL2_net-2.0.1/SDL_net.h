@@ -166,7 +166,32 @@ extern DECLSPEC int SDLCALL SDLNet_TCP_Send(TCPsocket sock, const void *data,
 */
 extern DECLSPEC int SDLCALL SDLNet_TCP_Recv(TCPsocket sock, void *data, int maxlen);
 
-/* Close a TCP network socket */
+/* Put the connected, non-server socket 'sock' in non-blocking mode, with
+   user-space send and receive queues of 'bufsize' bytes each, or 64K each
+   if 'bufsize' is 0.  Do this before adding the socket to a socket set.
+   In non-blocking mode:
+   SDLNet_TCP_Send() sends what the socket takes right away and queues the
+   rest, and returns the number of bytes sent or queued.  If that is less
+   than 'len', the queue is full or the connection failed.
+   SDLNet_TCP_Recv() returns 0 if no data is available yet, and -1 once the
+   remote connection was closed or an error occurred.
+   SDLNet_CheckSockets() writes out queued data whenever the socket can
+   take it, and reports the socket ready while it has buffered input.
+   This function returns 0, or -1 if the queues couldn't be allocated or
+   the socket is already in a socket set.
+*/
+extern DECLSPEC int SDLCALL SDLNet_TCP_SetNonBlocking(TCPsocket sock, int bufsize);
+
+/* Write out as much of the send queue of a non-blocking socket as it takes
+   without blocking.  This function returns the number of bytes still
+   queued, or -1 if the connection failed.
+*/
+extern DECLSPEC int SDLCALL SDLNet_TCP_Flush(TCPsocket sock);
+
+/* Close a TCP network socket
+   A non-blocking socket sends what it can of its queue without waiting,
+   queued data that the socket doesn't take right away is dropped.
+*/
 extern DECLSPEC void SDLCALL SDLNet_TCP_Close(TCPsocket sock);
 
 
@@ -337,6 +362,8 @@ SDL_FORCE_INLINE int SDLNet_UDP_DelSocket(SDLNet_SocketSet set, UDPsocket sock)
    reading, or the timeout in milliseconds has elapsed, which ever occurs
    first.  This function returns the number of sockets ready for reading,
    or -1 if there was an error with the select() system call.
+   On Linux the sockets are registered with epoll() when they are added to
+   the set, so checking a large set doesn't cost a pass over every socket.
 */
 extern DECLSPEC int SDLCALL SDLNet_CheckSockets(SDLNet_SocketSet set, Uint32 timeout);
 
@@ -350,6 +377,15 @@ SDL_FORCE_INLINE int _SDLNet_SocketReady(SDLNet_GenericSocket sock)
     return (sock != NULL) && (sock->ready);
 }
 
+/* After calling SDLNet_CheckSockets(), you can use this function to get
+   the sockets that it found ready, instead of checking every socket in a
+   large set with SDLNet_SocketReady().  The number of sockets in the
+   returned array is stored in 'numready' if it isn't NULL.  The array is
+   valid until the next call to SDLNet_CheckSockets() or SDLNet_DelSocket()
+   on the set.
+*/
+extern DECLSPEC SDLNet_GenericSocket * SDLCALL SDLNet_GetReadySockets(SDLNet_SocketSet set, int *numready);
+
 /* Free a set of sockets allocated by SDL_NetAllocSocketSet() */
 extern DECLSPEC void SDLCALL SDLNet_FreeSocketSet(SDLNet_SocketSet set);
 
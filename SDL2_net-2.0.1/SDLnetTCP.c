@@ -33,11 +33,48 @@
 struct _TCPsocket {
     int ready;
     SOCKET channel;
+    struct SDLNet_SocketQueue *queue;
     IPaddress remoteAddress;
     IPaddress localAddress;
     int sflag;
 };
 
+/* The size of each queue of a non-blocking socket if none is given */
+#define SDLNET_DEFAULT_QUEUE_SIZE   65536
+
+/* Put a socket in or out of non-blocking mode */
+static void SetNonBlocking(SOCKET channel, int nonblocking)
+{
+#if defined(__BEOS__) && defined(SO_NONBLOCK)
+    /* On BeOS r5 there is O_NONBLOCK but it's for files only */
+    {
+        long b = nonblocking;
+        setsockopt(channel, SOL_SOCKET, SO_NONBLOCK, &b, sizeof(b));
+    }
+#elif defined(O_NONBLOCK)
+    {
+        int flags = fcntl(channel, F_GETFL, 0);
+        if ( nonblocking ) {
+            fcntl(channel, F_SETFL, flags | O_NONBLOCK);
+        } else {
+            fcntl(channel, F_SETFL, flags & ~O_NONBLOCK);
+        }
+    }
+#elif defined(WIN32)
+    {
+        unsigned long mode = nonblocking;
+        ioctlsocket (channel, FIONBIO, &mode);
+    }
+#elif defined(__OS2__)
+    {
+        int dontblock = nonblocking;
+        ioctl(channel, FIONBIO, &dontblock);
+    }
+#else
+#warning How do we set non-blocking mode on other operating systems?
+#endif
+}
+
 /* Open a TCP network socket
    If 'remote' is NULL, this creates a local server socket on the given port,
    otherwise a TCP connection to the remote host and port is attempted.
@@ -54,6 +91,7 @@ TCPsocket SDLNet_TCP_Open(IPaddress *ip)
         SDLNet_SetError("Out of memory");
         goto error_return;
     }
+    sock->queue = NULL;
 
     /* Open the socket */
     sock->channel = socket(AF_INET, SOCK_STREAM, 0);
@@ -112,29 +150,7 @@ TCPsocket SDLNet_TCP_Open(IPaddress *ip)
         }
 
         /* Set the socket to non-blocking mode for accept() */
-#if defined(__BEOS__) && defined(SO_NONBLOCK)
-        /* On BeOS r5 there is O_NONBLOCK but it's for files only */
-        {
-            long b = 1;
-            setsockopt(sock->channel, SOL_SOCKET, SO_NONBLOCK, &b, sizeof(b));
-        }
-#elif defined(O_NONBLOCK)
-        {
-            fcntl(sock->channel, F_SETFL, O_NONBLOCK);
-        }
-#elif defined(WIN32)
-        {
-            unsigned long mode = 1;
-            ioctlsocket (sock->channel, FIONBIO, &mode);
-        }
-#elif defined(__OS2__)
-        {
-            int dontblock = 1;
-            ioctl(sock->channel, FIONBIO, &dontblock);
-        }
-#else
-#warning How do we set non-blocking mode on other operating systems?
-#endif
+        SetNonBlocking(sock->channel, 1);
         sock->sflag = 1;
     }
     sock->ready = 0;
@@ -182,6 +198,7 @@ TCPsocket SDLNet_TCP_Accept(TCPsocket server)
         SDLNet_SetError("Out of memory");
         goto error_return;
     }
+    sock->queue = NULL;
 
     /* Accept a new TCP connection on a server socket */
     sock_alen = sizeof(sock_addr);
@@ -191,18 +208,8 @@ TCPsocket SDLNet_TCP_Accept(TCPsocket server)
         SDLNet_SetError("accept() failed");
         goto error_return;
     }
-#ifdef WIN32
-    {
-        /* passing a zero value, socket mode set to block on */
-        unsigned long mode = 0;
-        ioctlsocket (sock->channel, FIONBIO, &mode);
-    }
-#elif defined(O_NONBLOCK)
-    {
-        int flags = fcntl(sock->channel, F_GETFL, 0);
-        fcntl(sock->channel, F_SETFL, flags & ~O_NONBLOCK);
-    }
-#endif /* WIN32 */
+    /* The server socket is non-blocking, but the new one shouldn't be */
+    SetNonBlocking(sock->channel, 0);
     sock->remoteAddress.host = sock_addr.sin_addr.s_addr;
     sock->remoteAddress.port = sock_addr.sin_port;
 
@@ -228,6 +235,235 @@ IPaddress *SDLNet_TCP_GetPeerAddress(TCPsocket sock)
     return(&sock->remoteAddress);
 }
 
+/* Copy as much of 'data' into the ring as fits, returns the bytes copied */
+static int RingWrite(SDLNet_Ring *ring, const Uint8 *data, int len)
+{
+    int tail, chunk, copied = 0;
+
+    len = SDL_min(len, ring->size - ring->len);
+    while ( copied < len ) {
+        tail = (ring->head + ring->len) % ring->size;
+        chunk = SDL_min(len - copied, ring->size - tail);
+        SDL_memcpy(ring->data + tail, data + copied, chunk);
+        ring->len += chunk;
+        copied += chunk;
+    }
+    return(copied);
+}
+
+/* Copy up to 'len' bytes out of the ring, returns the bytes copied */
+static int RingRead(SDLNet_Ring *ring, Uint8 *data, int len)
+{
+    int chunk, copied = 0;
+
+    len = SDL_min(len, ring->len);
+    while ( copied < len ) {
+        chunk = SDL_min(len - copied, ring->size - ring->head);
+        SDL_memcpy(data + copied, ring->data + ring->head, chunk);
+        ring->head = (ring->head + chunk) % ring->size;
+        ring->len -= chunk;
+        copied += chunk;
+    }
+    if ( ring->len == 0 ) {
+        ring->head = 0;
+    }
+    return(copied);
+}
+
+static void FreeQueue(struct SDLNet_SocketQueue *queue)
+{
+    SDL_free(queue->send.data);
+    SDL_free(queue->recv.data);
+    SDL_free(queue);
+}
+
+/* Send without blocking, returns the bytes sent, 0 if the socket would
+   block, or -1 if the connection failed.
+ */
+static int SendNow(SOCKET channel, const Uint8 *data, int len)
+{
+    int sent;
+
+    do {
+        SDLNet_SetLastError(0);
+        sent = send(channel, (const char *) data, len, 0);
+    } while ( (sent < 0) && (SDLNet_GetLastError() == EINTR) );
+
+    if ( sent < 0 ) {
+        if ( SDLNET_WOULDBLOCK(SDLNet_GetLastError()) ) {
+            return(0);
+        }
+        SDLNet_SetError("Couldn't send data: %s", strerror(SDLNet_GetLastError()));
+    }
+    return(sent);
+}
+
+int SDLNet_FlushSocketQueue(struct SDLNet_Socket *sock)
+{
+    struct SDLNet_SocketQueue *queue = sock->queue;
+    SDLNet_Ring *ring = &queue->send;
+    int sent;
+
+    if ( queue->error ) {
+        return(-1);
+    }
+    while ( ring->len > 0 ) {
+        /* Send the part up to the end of the buffer, then the wrapped part */
+        sent = SendNow(sock->channel, ring->data + ring->head,
+                       SDL_min(ring->len, ring->size - ring->head));
+        if ( sent < 0 ) {
+            queue->error = 1;
+            return(-1);
+        }
+        if ( sent == 0 ) {
+            break;
+        }
+        ring->head = (ring->head + sent) % ring->size;
+        ring->len -= sent;
+    }
+    if ( ring->len == 0 ) {
+        ring->head = 0;
+    }
+    return(ring->len);
+}
+
+/* Send what the socket takes right away and queue the rest */
+static int SendQueued(TCPsocket sock, const Uint8 *data, int len)
+{
+    struct SDLNet_SocketQueue *queue = sock->queue;
+    int sent = 0;
+
+    if ( queue->error ) {
+        SDLNet_SetError("The connection was closed");
+        return(-1);
+    }
+
+    /* Data can only skip the queue if nothing is waiting in it */
+    if ( queue->send.len == 0 ) {
+        while ( sent < len ) {
+            int result = SendNow(sock->channel, data + sent, len - sent);
+            if ( result < 0 ) {
+                queue->error = 1;
+                SDLNet_UpdateSocketQueue((struct SDLNet_Socket *)sock);
+                return(sent > 0 ? sent : -1);
+            }
+            if ( result == 0 ) {
+                break;
+            }
+            sent += result;
+        }
+    }
+    if ( sent < len ) {
+        sent += RingWrite(&queue->send, data + sent, len - sent);
+        if ( sent < len ) {
+            SDLNet_SetError("The send queue is full");
+        }
+        SDLNet_UpdateSocketQueue((struct SDLNet_Socket *)sock);
+    }
+    return(sent);
+}
+
+/* Hand out buffered data, reading a buffer full from the socket when the
+   buffer is empty.
+ */
+static int RecvQueued(TCPsocket sock, Uint8 *data, int maxlen)
+{
+    struct SDLNet_SocketQueue *queue = sock->queue;
+    SDLNet_Ring *ring = &queue->recv;
+    int len;
+
+    if ( ring->len == 0 && !queue->error ) {
+        do {
+            SDLNet_SetLastError(0);
+            len = recv(sock->channel, (char *) ring->data, ring->size, 0);
+        } while ( (len < 0) && (SDLNet_GetLastError() == EINTR) );
+
+        if ( len > 0 ) {
+            ring->head = 0;
+            ring->len = len;
+        } else if ( len == 0 ) {
+            queue->error = 1;
+            SDLNet_SetError("The connection was closed");
+        } else if ( !SDLNET_WOULDBLOCK(SDLNet_GetLastError()) ) {
+            queue->error = 1;
+            SDLNet_SetError("Couldn't receive data: %s", strerror(SDLNet_GetLastError()));
+        }
+    }
+
+    sock->ready = 0;
+    if ( ring->len > 0 ) {
+        len = RingRead(ring, data, maxlen);
+    } else if ( queue->error ) {
+        len = -1;
+    } else {
+        len = 0;
+    }
+    SDLNet_UpdateSocketQueue((struct SDLNet_Socket *)sock);
+    return(len);
+}
+
+/* Put a connected socket in non-blocking mode with send and receive queues
+   of 'bufsize' bytes each, or a default size if 'bufsize' is 0.
+   This function returns 0, or -1 if the queues couldn't be allocated.
+*/
+int SDLNet_TCP_SetNonBlocking(TCPsocket sock, int bufsize)
+{
+    struct SDLNet_SocketQueue *queue;
+
+    /* Server sockets are for accepting connections only */
+    if ( sock->sflag ) {
+        SDLNet_SetError("Server sockets cannot have send queues");
+        return(-1);
+    }
+    if ( sock->queue ) {
+        return(0);
+    }
+    /* The socket set only services queues it knows about from the start */
+    if ( SDLNet_SocketInAnySet((struct SDLNet_Socket *)sock) ) {
+        SDLNet_SetError("Sockets must be made non-blocking before they are added to a socketset");
+        return(-1);
+    }
+    if ( bufsize <= 0 ) {
+        bufsize = SDLNET_DEFAULT_QUEUE_SIZE;
+    }
+
+    queue = (struct SDLNet_SocketQueue *)SDL_calloc(1, sizeof(*queue));
+    if ( queue == NULL ) {
+        SDLNet_SetError("Out of memory");
+        return(-1);
+    }
+    queue->send.data = (Uint8 *)SDL_malloc(bufsize);
+    queue->recv.data = (Uint8 *)SDL_malloc(bufsize);
+    if ( queue->send.data == NULL || queue->recv.data == NULL ) {
+        FreeQueue(queue);
+        SDLNet_SetError("Out of memory");
+        return(-1);
+    }
+    queue->send.size = bufsize;
+    queue->recv.size = bufsize;
+    queue->active = -1;
+
+    SetNonBlocking(sock->channel, 1);
+    sock->queue = queue;
+    return(0);
+}
+
+/* Write out as much queued data as the socket takes without blocking.
+   This function returns the number of bytes still queued, or -1 if the
+   connection failed.
+*/
+int SDLNet_TCP_Flush(TCPsocket sock)
+{
+    int left;
+
+    if ( sock->queue == NULL ) {
+        return(0);
+    }
+    left = SDLNet_FlushSocketQueue((struct SDLNet_Socket *)sock);
+    SDLNet_UpdateSocketQueue((struct SDLNet_Socket *)sock);
+    return(left);
+}
+
 /* Send 'len' bytes of 'data' over the non-server socket 'sock'
    This function returns the actual amount of data sent.  If the return value
    is less than the amount of data sent, then either the remote connection was
@@ -244,6 +480,10 @@ int SDLNet_TCP_Send(TCPsocket sock, const void *datap, int len)
         return(-1);
     }
 
+    if ( sock->queue ) {
+        return(SendQueued(sock, data, len));
+    }
+
     /* Keep sending data until it's sent or an error occurs */
     left = len;
     sent = 0;
@@ -276,6 +516,10 @@ int SDLNet_TCP_Recv(TCPsocket sock, void *data, int maxlen)
         return(-1);
     }
 
+    if ( sock->queue ) {
+        return(RecvQueued(sock, (Uint8 *)data, maxlen));
+    }
+
     SDLNet_SetLastError(0);
     do {
         len = recv(sock->channel, (char *) data, maxlen, 0);
@@ -289,6 +533,14 @@ int SDLNet_TCP_Recv(TCPsocket sock, void *data, int maxlen)
 void SDLNet_TCP_Close(TCPsocket sock)
 {
     if ( sock != NULL ) {
+        if ( sock->queue ) {
+            /* Send what the socket takes now, the rest is dropped */
+            SDLNet_FlushSocketQueue((struct SDLNet_Socket *)sock);
+            if ( sock->queue->set ) {
+                SDLNet_DelSocket(sock->queue->set, (SDLNet_GenericSocket)sock);
+            }
+            FreeQueue(sock->queue);
+        }
         if ( sock->channel != INVALID_SOCKET ) {
             closesocket(sock->channel);
         }
@@ -21,9 +21,20 @@
 
 /* $Id$ */
 
+/* sendmmsg() and recvmmsg() are GNU extensions */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include "SDLnetsys.h"
 #include "SDL_net.h"
 
+/* Send and receive packet vectors with one system call on Linux */
+#if defined(__linux__) && defined(MSG_WAITFORONE) && !defined(SDLNET_NO_MMSG)
+#define HAVE_MMSG
+#define MMSG_BATCH  64
+#endif
+
 #ifdef __WIN32__
 #define srandom srand
 #define random  rand
@@ -37,6 +48,7 @@ struct UDP_channel {
 struct _UDPsocket {
     int ready;
     SOCKET channel;
+    struct SDLNet_SocketQueue *queue;   /* always NULL */
     IPaddress address;
 
     struct UDP_channel binding[SDLNET_MAX_UDPCHANNELS];
@@ -316,6 +328,166 @@ IPaddress *SDLNet_UDP_GetPeerAddress(UDPsocket sock, int channel)
     return(address);
 }
 
+/* Set the channel of a received packet from its source address */
+static void FindChannel(UDPsocket sock, UDPpacket *packet)
+{
+    struct UDP_channel *binding;
+    int i, j;
+
+    packet->channel = -1;
+
+    for (i=(SDLNET_MAX_UDPCHANNELS-1); i>=0; --i )
+    {
+        binding = &sock->binding[i];
+
+        for ( j=binding->numbound-1; j>=0; --j )
+        {
+            if ( (packet->address.host == binding->address[j].host) &&
+                 (packet->address.port == binding->address[j].port) )
+            {
+                packet->channel = i;
+                return;
+            }
+        }
+    }
+}
+
+#ifdef HAVE_MMSG
+/* The messages queued for one sendmmsg() call */
+struct UDP_batch {
+    int count;
+    struct mmsghdr msgs[MMSG_BATCH];
+    struct iovec iov[MMSG_BATCH];
+    struct sockaddr_in addrs[MMSG_BATCH];
+    UDPpacket *packets[MMSG_BATCH];
+};
+
+/* Send the queued messages, returns the number of them that were sent */
+static int FlushBatch(UDPsocket sock, struct UDP_batch *batch)
+{
+    int numsent = 0;
+    int i = 0;
+
+    while ( i < batch->count ) {
+        int status = sendmmsg(sock->channel, &batch->msgs[i], batch->count - i, 0);
+        if ( status > 0 ) {
+            for ( ; status > 0; --status, ++i ) {
+                batch->packets[i]->status = batch->msgs[i].msg_len;
+                ++numsent;
+            }
+        } else {
+            /* Skip the message that failed, marking its packet failed */
+            status = -1;
+            if ( SDLNet_GetLastError() == ENOSYS ) {
+                status = sendto(sock->channel,
+                        batch->iov[i].iov_base, batch->iov[i].iov_len, 0,
+                        (struct sockaddr *)&batch->addrs[i], sizeof(batch->addrs[i]));
+            }
+            if ( status >= 0 ) {
+                batch->packets[i]->status = status;
+                ++numsent;
+            } else {
+                batch->packets[i]->status = -1;
+            }
+            ++i;
+        }
+    }
+    batch->count = 0;
+    return(numsent);
+}
+
+/* Queue a packet for an address, returns the number of messages sent */
+static int QueuePacket(UDPsocket sock, struct UDP_batch *batch, UDPpacket *packet, IPaddress *address)
+{
+    struct mmsghdr *msg = &batch->msgs[batch->count];
+    struct sockaddr_in *sock_addr = &batch->addrs[batch->count];
+    struct iovec *iov = &batch->iov[batch->count];
+
+    SDL_memset(sock_addr, 0, sizeof(*sock_addr));
+    sock_addr->sin_addr.s_addr = address->host;
+    sock_addr->sin_port = address->port;
+    sock_addr->sin_family = AF_INET;
+    iov->iov_base = packet->data;
+    iov->iov_len = packet->len;
+    SDL_memset(msg, 0, sizeof(*msg));
+    msg->msg_hdr.msg_name = sock_addr;
+    msg->msg_hdr.msg_namelen = sizeof(*sock_addr);
+    msg->msg_hdr.msg_iov = iov;
+    msg->msg_hdr.msg_iovlen = 1;
+    batch->packets[batch->count] = packet;
+
+    if ( ++batch->count == MMSG_BATCH ) {
+        return(FlushBatch(sock, batch));
+    }
+    return(0);
+}
+
+/* Receive as many packets as are pending and fit, returns -1 if recvmmsg()
+   isn't available.
+ */
+static int RecvMMsg(UDPsocket sock, UDPpacket **packets)
+{
+    struct mmsghdr msgs[MMSG_BATCH];
+    struct iovec iov[MMSG_BATCH];
+    struct sockaddr_in addrs[MMSG_BATCH];
+    int numrecv = 0;
+    int count, status, i;
+
+    while ( packets[numrecv] ) {
+        /* Set up a message for each free packet */
+        SDL_memset(msgs, 0, sizeof(msgs));
+        for ( count=0; count<MMSG_BATCH && packets[numrecv+count]; ++count ) {
+            iov[count].iov_base = packets[numrecv+count]->data;
+            iov[count].iov_len = packets[numrecv+count]->maxlen;
+            msgs[count].msg_hdr.msg_name = &addrs[count];
+            msgs[count].msg_hdr.msg_namelen = sizeof(addrs[count]);
+            msgs[count].msg_hdr.msg_iov = &iov[count];
+            msgs[count].msg_hdr.msg_iovlen = 1;
+        }
+
+        status = recvmmsg(sock->channel, msgs, count, MSG_DONTWAIT, NULL);
+        if ( status <= 0 ) {
+            if ( status < 0 ) {
+                int error = SDLNet_GetLastError();
+                if ( error == ENOSYS && numrecv == 0 ) {
+                    return(-1);
+                }
+                /* Nothing is pending, the packet isn't touched */
+                if ( SDLNET_WOULDBLOCK(error) ) {
+                    break;
+                }
+                packets[numrecv]->status = -1;
+                packets[numrecv]->len = 0;
+                /* A failed earlier send can leave an error on the socket,
+                   which is cleared by reading it. Other packets may follow.
+                 */
+                if ( error == ECONNREFUSED ) {
+                    continue;
+                }
+            }
+            break;
+        }
+
+        for ( i=0; i<status; ++i ) {
+            UDPpacket *packet = packets[numrecv+i];
+
+            packet->status = msgs[i].msg_len;
+            packet->len = packet->status;
+            packet->address.host = addrs[i].sin_addr.s_addr;
+            packet->address.port = addrs[i].sin_port;
+            FindChannel(sock, packet);
+        }
+        numrecv += status;
+
+        /* Nothing more is pending */
+        if ( status < count ) {
+            break;
+        }
+    }
+    return(numrecv);
+}
+#endif /* HAVE_MMSG */
+
 /* Send a vector of packets to the the channels specified within the packet.
    If the channel specified in the packet is -1, the packet will be sent to
    the address in the 'src' member of the packet.
@@ -336,6 +508,45 @@ int SDLNet_UDP_SendV(UDPsocket sock, UDPpacket **packets, int npackets)
         return(0);
     }
 
+#ifdef HAVE_MMSG
+    {
+        struct UDP_batch batch;
+
+        batch.count = 0;
+        numsent = 0;
+        for ( i=0; i<npackets; ++i )
+        {
+            /* Simulate packet loss, if desired */
+            if (sock->packetloss) {
+                if ((random()%100) <= sock->packetloss) {
+                    packets[i]->status = packets[i]->len;
+                    ++numsent;
+                    continue;
+                }
+            }
+
+            /* if channel is < 0, then use channel specified in sock */
+
+            if ( packets[i]->channel < 0 )
+            {
+                numsent += QueuePacket(sock, &batch, packets[i], &packets[i]->address);
+            }
+            else
+            {
+                /* Send to each of the bound addresses on the channel */
+                binding = &sock->binding[packets[i]->channel];
+
+                for ( j=binding->numbound-1; j>=0; --j )
+                {
+                    numsent += QueuePacket(sock, &batch, packets[i], &binding->address[j]);
+                }
+            }
+        }
+        numsent += FlushBatch(sock, &batch);
+        return(numsent);
+    }
+#endif
+
     /* Set up the variables to send packets */
     sock_len = sizeof(sock_addr);
 
@@ -438,8 +649,7 @@ static int SocketReady(SOCKET sock)
 */
 extern int SDLNet_UDP_RecvV(UDPsocket sock, UDPpacket **packets)
 {
-    int numrecv, i, j;
-    struct UDP_channel *binding;
+    int numrecv;
     socklen_t sock_len;
     struct sockaddr_in sock_addr;
 
@@ -447,6 +657,15 @@ extern int SDLNet_UDP_RecvV(UDPsocket sock, UDPpacket **packets)
         return(0);
     }
 
+#ifdef HAVE_MMSG
+    /* This doesn't need to check the socket first, it never blocks */
+    numrecv = RecvMMsg(sock, packets);
+    if ( numrecv >= 0 ) {
+        sock->ready = 0;
+        return(numrecv);
+    }
+#endif
+
     numrecv = 0;
     while ( packets[numrecv] && SocketReady(sock->channel) )
     {
@@ -463,23 +682,7 @@ extern int SDLNet_UDP_RecvV(UDPsocket sock, UDPpacket **packets)
             packet->len = packet->status;
             packet->address.host = sock_addr.sin_addr.s_addr;
             packet->address.port = sock_addr.sin_port;
-            packet->channel = -1;
-
-            for (i=(SDLNET_MAX_UDPCHANNELS-1); i>=0; --i )
-            {
-                binding = &sock->binding[i];
-
-                for ( j=binding->numbound-1; j>=0; --j )
-                {
-                    if ( (packet->address.host == binding->address[j].host) &&
-                         (packet->address.port == binding->address[j].port) )
-                    {
-                        packet->channel = i;
-                        goto foundit; /* break twice */
-                    }
-                }
-            }
-foundit:
+            FindChannel(sock, packet);
             ++numrecv;
         }
 
@@ -24,19 +24,39 @@
 #include "SDLnetsys.h"
 #include "SDL_net.h"
 
-/* The select() API for network sockets */
-
-struct SDLNet_Socket {
-    int ready;
-    SOCKET channel;
-};
+/* The select() API for network sockets, using epoll() on Linux so that
+   sockets stay registered and a check doesn't scan the whole set.
+ */
+#if defined(__linux__) && !defined(SDLNET_NO_EPOLL)
+#define HAVE_EPOLL
+#include <sys/epoll.h>
+#endif
 
+/* Non-blocking TCP sockets with something queued are on the active list,
+   so each check writes out their queued data and reports the ones with
+   buffered input as ready.
+ */
 struct _SDLNet_SocketSet {
     int numsockets;
     int maxsockets;
     struct SDLNet_Socket **sockets;
+    SOCKET *channels;   /* their descriptors when added, sockets may be closed */
+    struct SDLNet_SocketQueue **queues; /* the non-blocking sockets' queues */
+    int numready;
+    struct SDLNet_Socket **ready;
+    int numactive;
+    struct SDLNet_Socket **active;
+    Uint32 generation;
+#ifdef HAVE_EPOLL
+    int epollfd;
+    struct epoll_event *events;
+#endif
+    struct _SDLNet_SocketSet *next;
 };
 
+/* Every allocated set, to find the sockets that are in one */
+static struct _SDLNet_SocketSet *socket_sets = NULL;
+
 /* Allocate a socket set for use with SDLNet_CheckSockets()
    This returns a socket set for up to 'maxsockets' sockets, or NULL if
    the function ran out of memory.
@@ -50,29 +70,189 @@ SDLNet_SocketSet SDLNet_AllocSocketSet(int maxsockets)
     if ( set != NULL ) {
         set->numsockets = 0;
         set->maxsockets = maxsockets;
+        set->numready = 0;
+        set->numactive = 0;
+        set->generation = 0;
         set->sockets = (struct SDLNet_Socket **)SDL_malloc
                     (maxsockets*sizeof(*set->sockets));
-        if ( set->sockets != NULL ) {
+        set->ready = (struct SDLNet_Socket **)SDL_malloc
+                    (maxsockets*sizeof(*set->ready));
+        set->active = (struct SDLNet_Socket **)SDL_malloc
+                    (maxsockets*sizeof(*set->active));
+        set->channels = (SOCKET *)SDL_malloc
+                    (maxsockets*sizeof(*set->channels));
+        set->queues = (struct SDLNet_SocketQueue **)SDL_malloc
+                    (maxsockets*sizeof(*set->queues));
+#ifdef HAVE_EPOLL
+        set->events = (struct epoll_event *)SDL_malloc
+                    (maxsockets*sizeof(*set->events));
+        set->epollfd = epoll_create(maxsockets > 0 ? maxsockets : 1);
+        /* Without epoll the set falls back to select() */
+        if ( set->epollfd >= 0 ) {
+            fcntl(set->epollfd, F_SETFD, FD_CLOEXEC);
+        }
+#endif
+        if ( set->sockets != NULL && set->ready != NULL &&
+             set->active != NULL && set->channels != NULL &&
+             set->queues != NULL
+#ifdef HAVE_EPOLL
+             && set->events != NULL
+#endif
+           ) {
             for ( i=0; i<maxsockets; ++i ) {
                 set->sockets[i] = NULL;
             }
+            set->next = socket_sets;
+            socket_sets = set;
         } else {
-            SDL_free(set);
+            SDLNet_FreeSocketSet(set);
             set = NULL;
         }
     }
     return(set);
 }
 
+/* Wait for a socket to be writable, or stop waiting */
+static void WatchOutput(SDLNet_SocketSet set, struct SDLNet_Socket *sock, int on)
+{
+    sock->queue->polling_output = on;
+#ifdef HAVE_EPOLL
+    if ( set->epollfd >= 0 ) {
+        struct epoll_event event;
+
+        SDL_zero(event);
+        event.events = on ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+        event.data.ptr = sock;
+        epoll_ctl(set->epollfd, EPOLL_CTL_MOD, sock->channel, &event);
+    }
+#endif
+}
+
+/* Take a socket off the active list, filling the hole from the end */
+static void RemoveActive(SDLNet_SocketSet set, int i)
+{
+    struct SDLNet_Socket *sock = set->active[i];
+    struct SDLNet_Socket *last = set->active[--set->numactive];
+
+    set->active[i] = last;
+    last->queue->active = i;
+    sock->queue->active = -1;
+}
+
+void SDLNet_UpdateSocketQueue(struct SDLNet_Socket *sock)
+{
+    struct SDLNet_SocketQueue *queue = sock->queue;
+    struct _SDLNet_SocketSet *set = queue->set;
+    int busy;
+
+    if ( set == NULL ) {
+        return;
+    }
+    busy = (queue->send.len > 0 || queue->recv.len > 0 || queue->error);
+    if ( busy && queue->active < 0 ) {
+        queue->active = set->numactive;
+        set->active[set->numactive++] = sock;
+    } else if ( !busy && queue->active >= 0 ) {
+        RemoveActive(set, queue->active);
+    }
+    if ( queue->send.len == 0 && queue->polling_output ) {
+        WatchOutput(set, sock, 0);
+    }
+}
+
+int SDLNet_SocketInAnySet(struct SDLNet_Socket *sock)
+{
+    struct _SDLNet_SocketSet *set;
+    int i;
+
+    /* Only pointers are compared, the other sockets may have been closed */
+    for ( set=socket_sets; set; set=set->next ) {
+        for ( i=0; i<set->numsockets; ++i ) {
+            if ( set->sockets[i] == sock ) {
+                return(1);
+            }
+        }
+    }
+    return(0);
+}
+
+/* Add a socket to the list of sockets found ready by this check */
+static void MarkReady(SDLNet_SocketSet set, struct SDLNet_Socket *sock)
+{
+    if ( sock->queue ) {
+        /* It may be found both by its buffered input and by the poll */
+        if ( sock->queue->checked == set->generation ) {
+            return;
+        }
+        sock->queue->checked = set->generation;
+    }
+    sock->ready = 1;
+    set->ready[set->numready++] = sock;
+}
+
+/* Write out queued data, waiting for the socket to be writable if it
+   doesn't take all of it.
+ */
+static void ServiceOutput(SDLNet_SocketSet set, struct SDLNet_Socket *sock)
+{
+    if ( SDLNet_FlushSocketQueue(sock) > 0 ) {
+        if ( !sock->queue->polling_output ) {
+            WatchOutput(set, sock, 1);
+        }
+    } else if ( sock->queue->polling_output ) {
+        WatchOutput(set, sock, 0);
+    }
+}
+
 /* Add a socket to a set of sockets to be checked for available data */
 int SDLNet_AddSocket(SDLNet_SocketSet set, SDLNet_GenericSocket sock)
 {
+    int i;
+
     if ( sock != NULL ) {
+        struct SDLNet_SocketQueue *queue = ((struct SDLNet_Socket *)sock)->queue;
+
         if ( set->numsockets == set->maxsockets ) {
             SDLNet_SetError("socketset is full");
             return(-1);
         }
+        if ( queue && queue->set ) {
+            SDLNet_SetError("socket is already in a socketset");
+            return(-1);
+        }
+#ifdef HAVE_EPOLL
+        if ( set->epollfd >= 0 ) {
+            struct epoll_event event;
+
+            SDL_zero(event);
+            event.events = EPOLLIN;
+            event.data.ptr = sock;
+            if ( epoll_ctl(set->epollfd, EPOLL_CTL_ADD,
+                    ((struct SDLNet_Socket *)sock)->channel, &event) < 0 ) {
+                SDLNet_SetError("Couldn't add socket to socketset: %s", strerror(errno));
+                return(-1);
+            }
+        }
+#endif
+        /* A socket closed without being removed may have left its
+           descriptor to this one, it mustn't unregister it later.
+         */
+        for ( i=0; i<set->numsockets; ++i ) {
+            if ( set->channels[i] == ((struct SDLNet_Socket *)sock)->channel ) {
+                set->channels[i] = INVALID_SOCKET;
+            }
+        }
+        set->channels[set->numsockets] = ((struct SDLNet_Socket *)sock)->channel;
+        set->queues[set->numsockets] = queue;
         set->sockets[set->numsockets++] = (struct SDLNet_Socket *)sock;
+
+        /* Anything queued before the socket was added is serviced now */
+        if ( queue ) {
+            queue->set = set;
+            /* It may have been found ready by another set's check */
+            queue->checked = set->generation;
+            SDLNet_UpdateSocketQueue((struct SDLNet_Socket *)sock);
+        }
     }
     return(set->numsockets);
 }
@@ -92,10 +272,34 @@ int SDLNet_DelSocket(SDLNet_SocketSet set, SDLNet_GenericSocket sock)
             SDLNet_SetError("socket not found in socketset");
             return(-1);
         }
-        --set->numsockets;
-        for ( ; i<set->numsockets; ++i ) {
-            set->sockets[i] = set->sockets[i+1];
+        /* The socket may have been closed already, only what the set kept
+           is used.  Closing a non-blocking socket takes it out of its set
+           first, so a queue is still there.
+         */
+#ifdef HAVE_EPOLL
+        if ( set->epollfd >= 0 && set->channels[i] != INVALID_SOCKET ) {
+            struct epoll_event event;
+
+            /* This fails harmlessly if the descriptor was closed */
+            SDL_zero(event);
+            epoll_ctl(set->epollfd, EPOLL_CTL_DEL, set->channels[i], &event);
+        }
+#endif
+        if ( set->queues[i] ) {
+            struct SDLNet_SocketQueue *queue = set->queues[i];
+
+            if ( queue->active >= 0 ) {
+                RemoveActive(set, queue->active);
+            }
+            queue->set = NULL;
+            queue->polling_output = 0;
         }
+        /* The order of the set doesn't matter, fill the hole from the end */
+        set->sockets[i] = set->sockets[--set->numsockets];
+        set->channels[i] = set->channels[set->numsockets];
+        set->queues[i] = set->queues[set->numsockets];
+        set->sockets[set->numsockets] = NULL;
+        set->numready = 0;
     }
     return(set->numsockets);
 }
@@ -106,6 +310,7 @@ int SDLNet_DelSocket(SDLNet_SocketSet set, SDLNet_GenericSocket sock)
    reading, or the timeout in milliseconds has elapsed, which ever occurs
    first.  This function returns the number of sockets ready for reading,
    or -1 if there was an error with the select() system call.
+   Queued data of non-blocking TCP sockets in the set is written out here.
 */
 int SDLNet_CheckSockets(SDLNet_SocketSet set, Uint32 timeout)
 {
@@ -114,6 +319,67 @@ int SDLNet_CheckSockets(SDLNet_SocketSet set, Uint32 timeout)
     int retval;
     struct timeval tv;
     fd_set mask;
+    fd_set wmask;
+
+    set->numready = 0;
+    ++set->generation;
+
+    /* Write out queued data and report buffered input, dropping sockets
+       that have nothing queued anymore.  A socket waiting to be writable
+       is left for the poll below.
+     */
+    for ( i=set->numactive-1; i>=0; --i ) {
+        struct SDLNet_Socket *sock = set->active[i];
+        struct SDLNet_SocketQueue *queue = sock->queue;
+
+        if ( queue->send.len > 0 && !queue->polling_output ) {
+            ServiceOutput(set, sock);
+        }
+        if ( queue->recv.len > 0 || queue->error ) {
+            MarkReady(set, sock);
+        }
+        SDLNet_UpdateSocketQueue(sock);
+    }
+    /* Don't wait if there is buffered input to read */
+    if ( set->numready > 0 ) {
+        timeout = 0;
+    }
+
+#ifdef HAVE_EPOLL
+    if ( set->epollfd >= 0 ) {
+        if ( set->numsockets == 0 ) {
+            /* Nothing to wait for, but honor the timeout like select() */
+            SDL_Delay(timeout);
+            return(0);
+        }
+        do {
+            retval = epoll_wait(set->epollfd, set->events, set->numsockets,
+                                (int)SDL_min(timeout, 0x7FFFFFFF));
+        } while ( retval < 0 && errno == EINTR );
+        if ( retval < 0 ) {
+            return(retval);
+        }
+
+        /* Mark the sockets that have data available */
+        for ( i=0; i<retval; ++i ) {
+            struct SDLNet_Socket *sock = (struct SDLNet_Socket *)set->events[i].data.ptr;
+            Uint32 events = set->events[i].events;
+
+            if ( sock->queue && sock->queue->polling_output &&
+                 (events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) ) {
+                ServiceOutput(set, sock);
+                if ( sock->queue->error ) {
+                    MarkReady(set, sock);
+                }
+                SDLNet_UpdateSocketQueue(sock);
+            }
+            if ( events & (EPOLLIN | EPOLLERR | EPOLLHUP) ) {
+                MarkReady(set, sock);
+            }
+        }
+        return(set->numready);
+    }
+#endif
 
     /* Find the largest file descriptor */
     maxfd = 0;
@@ -132,30 +398,93 @@ int SDLNet_CheckSockets(SDLNet_SocketSet set, Uint32 timeout)
         for ( i=set->numsockets-1; i>=0; --i ) {
             FD_SET(set->sockets[i]->channel, &mask);
         }
+        FD_ZERO(&wmask);
+        for ( i=set->numactive-1; i>=0; --i ) {
+            if ( set->active[i]->queue->polling_output ) {
+                FD_SET(set->active[i]->channel, &wmask);
+            }
+        }
 
         /* Set up the timeout */
         tv.tv_sec = timeout/1000;
         tv.tv_usec = (timeout%1000)*1000;
 
         /* Look! */
-        retval = select(maxfd+1, &mask, NULL, NULL, &tv);
+        retval = select(maxfd+1, &mask, &wmask, NULL, &tv);
     } while ( SDLNet_GetLastError() == EINTR );
 
-    /* Mark all file descriptors ready that have data available */
+    if ( retval < 0 ) {
+        return(retval);
+    }
     if ( retval > 0 ) {
+        /* Write out queued data on the sockets that became writable */
+        for ( i=set->numactive-1; i>=0; --i ) {
+            struct SDLNet_Socket *sock = set->active[i];
+
+            if ( sock->queue->polling_output && FD_ISSET(sock->channel, &wmask) ) {
+                ServiceOutput(set, sock);
+                if ( sock->queue->error ) {
+                    MarkReady(set, sock);
+                }
+                SDLNet_UpdateSocketQueue(sock);
+            }
+        }
+
+        /* Mark all file descriptors ready that have data available */
         for ( i=set->numsockets-1; i>=0; --i ) {
             if ( FD_ISSET(set->sockets[i]->channel, &mask) ) {
-                set->sockets[i]->ready = 1;
+                MarkReady(set, set->sockets[i]);
             }
         }
     }
-    return(retval);
+    return(set->numready);
+}
+
+/* Get the sockets found ready by the last call to SDLNet_CheckSockets() */
+SDLNet_GenericSocket *SDLNet_GetReadySockets(SDLNet_SocketSet set, int *numready)
+{
+    if ( numready ) {
+        *numready = set->numready;
+    }
+    return((SDLNet_GenericSocket *)set->ready);
 }
 
 /* Free a set of sockets allocated by SDL_NetAllocSocketSet() */
 extern void SDLNet_FreeSocketSet(SDLNet_SocketSet set)
 {
+    int i;
+
     if ( set ) {
+        struct _SDLNet_SocketSet **prev;
+
+        for ( prev=&socket_sets; *prev; prev=&(*prev)->next ) {
+            if ( *prev == set ) {
+                *prev = set->next;
+                break;
+            }
+        }
+#ifdef HAVE_EPOLL
+        if ( set->epollfd >= 0 ) {
+            close(set->epollfd);
+        }
+        SDL_free(set->events);
+#endif
+        /* Non-blocking sockets outlive the set, they shouldn't point at it.
+           The other sockets may have been closed already.
+         */
+        if ( set->queues ) {
+            for ( i=set->numsockets-1; i>=0; --i ) {
+                if ( set->queues[i] ) {
+                    set->queues[i]->set = NULL;
+                    set->queues[i]->active = -1;
+                    set->queues[i]->polling_output = 0;
+                }
+            }
+        }
+        SDL_free(set->queues);
+        SDL_free(set->channels);
+        SDL_free(set->active);
+        SDL_free(set->ready);
         SDL_free(set->sockets);
         SDL_free(set);
     }
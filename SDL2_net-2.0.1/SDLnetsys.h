@@ -91,3 +91,50 @@ int SDLNet_GetLastError(void);
 void SDLNet_SetLastError(int err);
 #endif
 
+/* The error a non-blocking socket reports when it has to wait */
+#ifdef __USE_W32_SOCKETS
+#define SDLNET_WOULDBLOCK(err)  ((err) == WSAEWOULDBLOCK)
+#elif defined(EWOULDBLOCK) && (EWOULDBLOCK != EAGAIN)
+#define SDLNET_WOULDBLOCK(err)  (((err) == EAGAIN) || ((err) == EWOULDBLOCK))
+#else
+#define SDLNET_WOULDBLOCK(err)  ((err) == EAGAIN)
+#endif
+
+#include "SDL_net.h"
+
+/* The user-space buffers of a non-blocking TCP socket */
+typedef struct SDLNet_Ring {
+    Uint8 *data;
+    int size;
+    int head;
+    int len;
+} SDLNet_Ring;
+
+struct SDLNet_SocketQueue {
+    SDLNet_Ring send;
+    SDLNet_Ring recv;
+    int error;                      /* the connection closed or failed */
+    struct _SDLNet_SocketSet *set;  /* the socket set that services it */
+    int active;                     /* index in the set's active list, or -1 */
+    int polling_output;             /* the set waits for it to be writable */
+    Uint32 checked;                 /* the last set check that found it ready */
+};
+
+/* Every TCP and UDP socket starts like this, so socket sets can handle them */
+struct SDLNet_Socket {
+    int ready;
+    SOCKET channel;
+    struct SDLNet_SocketQueue *queue;   /* only non-blocking TCP sockets */
+};
+
+/* Write out as much queued data as the socket takes without blocking,
+   returns the number of bytes still queued, or -1 if the connection failed.
+ */
+int SDLNet_FlushSocketQueue(struct SDLNet_Socket *sock);
+
+/* Tell the socket set servicing a socket that its queue has changed */
+void SDLNet_UpdateSocketQueue(struct SDLNet_Socket *sock);
+
+/* Returns 1 if any socket set holds the socket, or 0 */
+int SDLNet_SocketInAnySet(struct SDLNet_Socket *sock);
+
@@ -0,0 +1,255 @@
+/*
+  SOCKETBENCH:  A socket set benchmark for the SDL example network library
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* Opens lots of loopback TCP connections, puts the server side of each one
+   in a socket set, and times SDLNet_CheckSockets() the way a busy server
+   would use it: each round a few clients send a byte and the server finds
+   and reads them.  With -scan the server looks for ready sockets with
+   SDLNet_SocketReady() on every connection instead of using the list from
+   SDLNet_GetReadySockets().
+
+   With -reply the server answers every message with that many bytes, and
+   the clients never read the answers, like clients on a slow link.  Once a
+   client's socket buffer fills up a blocking server stalls on it for good,
+   so use -nonblock to put the server side of each connection in
+   non-blocking mode with SDLNet_TCP_SetNonBlocking(): the answers are
+   queued, and dropped once a queue is full, and the server keeps going.
+
+   Every connection needs two file descriptors, so 10000 connections need
+   the open file limit raised, e.g. "ulimit -n 25000".
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "SDL.h"
+#include "SDL_net.h"
+
+#define DEFAULT_PORT    7777
+#define SENDERS         16
+
+static char *reply_data = NULL;
+static int reply_size = 0;
+static Sint64 reply_sent = 0;
+static Sint64 reply_dropped = 0;
+
+static double Microseconds(Uint64 start, Uint64 end)
+{
+    return (double)(end - start) * 1000000.0 / SDL_GetPerformanceFrequency();
+}
+
+/* Answer a message, if answers were asked for */
+static void Reply(TCPsocket sock)
+{
+    int sent;
+
+    if ( reply_size > 0 ) {
+        sent = SDLNet_TCP_Send(sock, reply_data, reply_size);
+        sent = SDL_max(sent, 0);
+        reply_sent += sent;
+        reply_dropped += reply_size - sent;
+    }
+}
+
+/* Wait for the bytes the senders wrote, returns the number of bytes read */
+static int ReadRound(SDLNet_SocketSet set, TCPsocket *accepted, int count, int expected, int scan)
+{
+    int received = 0;
+    char data;
+    int i, numready;
+
+    while ( received < expected ) {
+        numready = SDLNet_CheckSockets(set, 1000);
+        if ( numready <= 0 ) {
+            break;
+        }
+        if ( scan ) {
+            for ( i=0; i<count; ++i ) {
+                if ( SDLNet_SocketReady(accepted[i]) &&
+                     SDLNet_TCP_Recv(accepted[i], &data, 1) == 1 ) {
+                    Reply(accepted[i]);
+                    ++received;
+                }
+            }
+        } else {
+            SDLNet_GenericSocket *ready = SDLNet_GetReadySockets(set, &numready);
+            for ( i=0; i<numready; ++i ) {
+                if ( SDLNet_TCP_Recv((TCPsocket)ready[i], &data, 1) == 1 ) {
+                    Reply((TCPsocket)ready[i]);
+                    ++received;
+                }
+            }
+        }
+    }
+    return(received);
+}
+
+int main(int argc, char *argv[])
+{
+    IPaddress address;
+    TCPsocket server = NULL;
+    TCPsocket *clients = NULL;
+    TCPsocket *accepted = NULL;
+    SDLNet_SocketSet set = NULL;
+    int connections = 10000;
+    int rounds = 1000;
+    int port = DEFAULT_PORT;
+    int scan = 0;
+    int nonblock = 0;
+    int opened = 0;
+    int status = 1;
+    int i, round, received = 0;
+    Uint64 start, end;
+    Uint32 deadline;
+    double idle, busy;
+
+    for ( i=1; i<argc; ++i ) {
+        if ( strcmp(argv[i], "-scan") == 0 ) {
+            scan = 1;
+        } else if ( strcmp(argv[i], "-nonblock") == 0 ) {
+            nonblock = 1;
+        } else if ( strcmp(argv[i], "-reply") == 0 && argv[i+1] ) {
+            reply_size = atoi(argv[++i]);
+            reply_size = SDL_max(reply_size, 0);
+        } else if ( strcmp(argv[i], "-port") == 0 && argv[i+1] ) {
+            port = atoi(argv[++i]);
+        } else if ( strcmp(argv[i], "-rounds") == 0 && argv[i+1] ) {
+            rounds = atoi(argv[++i]);
+            rounds = SDL_max(rounds, 1);
+        } else if ( argv[i][0] != '-' ) {
+            connections = atoi(argv[i]);
+            connections = SDL_max(connections, 1);
+        } else {
+            fprintf(stderr, "Usage: %s [-scan] [-nonblock] [-reply bytes] [-port port] [-rounds rounds] [connections]\n", argv[0]);
+            return(1);
+        }
+    }
+
+    if ( SDL_Init(0) < 0 ) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return(1);
+    }
+    if ( SDLNet_Init() < 0 ) {
+        fprintf(stderr, "Couldn't initialize net: %s\n", SDLNet_GetError());
+        SDL_Quit();
+        return(1);
+    }
+
+    clients = (TCPsocket *)SDL_calloc(connections, sizeof(*clients));
+    accepted = (TCPsocket *)SDL_calloc(connections, sizeof(*accepted));
+    set = SDLNet_AllocSocketSet(connections);
+    if ( reply_size > 0 ) {
+        reply_data = (char *)SDL_calloc(1, reply_size);
+    }
+    if ( clients == NULL || accepted == NULL || set == NULL ||
+         (reply_size > 0 && reply_data == NULL) ) {
+        fprintf(stderr, "Out of memory\n");
+        goto done;
+    }
+
+    SDLNet_ResolveHost(&address, NULL, (Uint16)port);
+    server = SDLNet_TCP_Open(&address);
+    if ( server == NULL ) {
+        fprintf(stderr, "Couldn't create server socket: %s\n", SDLNet_GetError());
+        goto done;
+    }
+
+    /* Connect one client at a time, the server only has a short backlog */
+    SDLNet_ResolveHost(&address, "127.0.0.1", (Uint16)port);
+    start = SDL_GetPerformanceCounter();
+    for ( opened=0; opened<connections; ++opened ) {
+        clients[opened] = SDLNet_TCP_Open(&address);
+        if ( clients[opened] == NULL ) {
+            fprintf(stderr, "Couldn't open connection %d: %s\n", opened, SDLNet_GetError());
+            goto done;
+        }
+        deadline = SDL_GetTicks() + 1000;
+        while ( (accepted[opened] = SDLNet_TCP_Accept(server)) == NULL ) {
+            if ( SDL_TICKS_PASSED(SDL_GetTicks(), deadline) ) {
+                fprintf(stderr, "Couldn't accept connection %d: %s\n", opened, SDLNet_GetError());
+                ++opened;
+                goto done;
+            }
+            SDL_Delay(0);
+        }
+        if ( nonblock && SDLNet_TCP_SetNonBlocking(accepted[opened], 0) < 0 ) {
+            fprintf(stderr, "Couldn't make connection %d non-blocking: %s\n", opened, SDLNet_GetError());
+            ++opened;
+            goto done;
+        }
+        if ( SDLNet_TCP_AddSocket(set, accepted[opened]) < 0 ) {
+            fprintf(stderr, "Couldn't add connection %d: %s\n", opened, SDLNet_GetError());
+            ++opened;
+            goto done;
+        }
+    }
+    end = SDL_GetPerformanceCounter();
+    printf("%d connections opened in %.1f ms\n", connections, Microseconds(start, end) / 1000.0);
+
+    /* Nothing is ready, this is the cost of looking */
+    start = SDL_GetPerformanceCounter();
+    for ( round=0; round<rounds; ++round ) {
+        SDLNet_CheckSockets(set, 0);
+    }
+    end = SDL_GetPerformanceCounter();
+    idle = Microseconds(start, end) / rounds;
+
+    srand(1);
+    start = SDL_GetPerformanceCounter();
+    for ( round=0; round<rounds; ++round ) {
+        int senders = SDL_min(SENDERS, connections);
+
+        for ( i=0; i<senders; ++i ) {
+            SDLNet_TCP_Send(clients[rand() % connections], "x", 1);
+        }
+        received += ReadRound(set, accepted, connections, senders, scan);
+    }
+    end = SDL_GetPerformanceCounter();
+    busy = Microseconds(start, end) / rounds;
+
+    printf("%d connections, %s: %.2f us per idle check, %.2f us per round of %d messages\n",
+           connections, scan ? "scanning every socket" : "using the ready list",
+           idle, busy, SDL_min(SENDERS, connections));
+    if ( reply_size > 0 ) {
+        printf("Answered with %.1f MB sent or queued, %.1f MB dropped on full queues\n",
+               reply_sent / 1048576.0, reply_dropped / 1048576.0);
+    }
+    if ( received != rounds * SDL_min(SENDERS, connections) ) {
+        printf("Only %d of %d messages arrived\n", received, rounds * SDL_min(SENDERS, connections));
+    } else {
+        status = 0;
+    }
+
+done:
+    for ( i=0; i<opened; ++i ) {
+        SDLNet_TCP_Close(clients[i]);
+        SDLNet_TCP_Close(accepted[i]);
+    }
+    SDLNet_FreeSocketSet(set);
+    SDLNet_TCP_Close(server);
+    SDL_free(reply_data);
+    SDL_free(accepted);
+    SDL_free(clients);
+    SDLNet_Quit();
+    SDL_Quit();
+    return(status);
+}
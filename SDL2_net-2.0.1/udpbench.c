@@ -0,0 +1,152 @@
+/*
+  UDPBENCH:  A UDP throughput benchmark for the SDL example network library
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* Sends small datagrams over loopback from one UDP socket to another, in
+   batches with SDLNet_UDP_SendV() and SDLNet_UDP_RecvV(), and reports how
+   many packets per second go through.  With -single every packet is sent
+   with SDLNet_UDP_Send() and received with SDLNet_UDP_Recv() instead.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "SDL.h"
+#include "SDL_net.h"
+
+#define DEFAULT_PORT    7777
+#define PACKET_SIZE     32
+
+int main(int argc, char *argv[])
+{
+    IPaddress address;
+    UDPsocket server = NULL;
+    UDPsocket client = NULL;
+    UDPpacket **sendV = NULL;
+    UDPpacket **recvV = NULL;
+    int total = 1000000;
+    int batch = 64;
+    int port = DEFAULT_PORT;
+    int single = 0;
+    int status = 1;
+    int i, sent = 0, received = 0;
+    Uint64 start, end;
+    double seconds;
+
+    for ( i=1; i<argc; ++i ) {
+        if ( strcmp(argv[i], "-single") == 0 ) {
+            single = 1;
+        } else if ( strcmp(argv[i], "-port") == 0 && argv[i+1] ) {
+            port = atoi(argv[++i]);
+        } else if ( strcmp(argv[i], "-batch") == 0 && argv[i+1] ) {
+            batch = atoi(argv[++i]);
+            batch = SDL_max(batch, 1);
+        } else if ( argv[i][0] != '-' ) {
+            total = atoi(argv[i]);
+            total = SDL_max(total, 1);
+        } else {
+            fprintf(stderr, "Usage: %s [-single] [-port port] [-batch packets] [packets]\n", argv[0]);
+            return(1);
+        }
+    }
+
+    if ( SDL_Init(0) < 0 ) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return(1);
+    }
+    if ( SDLNet_Init() < 0 ) {
+        fprintf(stderr, "Couldn't initialize net: %s\n", SDLNet_GetError());
+        SDL_Quit();
+        return(1);
+    }
+
+    server = SDLNet_UDP_Open((Uint16)port);
+    client = SDLNet_UDP_Open(0);
+    if ( server == NULL || client == NULL ) {
+        fprintf(stderr, "Couldn't open UDP sockets: %s\n", SDLNet_GetError());
+        goto done;
+    }
+    SDLNet_ResolveHost(&address, "127.0.0.1", (Uint16)port);
+    if ( SDLNet_UDP_Bind(client, 0, &address) < 0 ) {
+        fprintf(stderr, "Couldn't bind channel: %s\n", SDLNet_GetError());
+        goto done;
+    }
+
+    sendV = SDLNet_AllocPacketV(batch, PACKET_SIZE);
+    recvV = SDLNet_AllocPacketV(batch, PACKET_SIZE);
+    if ( sendV == NULL || recvV == NULL ) {
+        fprintf(stderr, "Couldn't allocate packets: %s\n", SDLNet_GetError());
+        goto done;
+    }
+    for ( i=0; i<batch; ++i ) {
+        SDL_memset(sendV[i]->data, i, PACKET_SIZE);
+        sendV[i]->len = PACKET_SIZE;
+        sendV[i]->channel = 0;
+    }
+
+    /* Send a batch, then read it back, so the socket buffer never overflows */
+    start = SDL_GetPerformanceCounter();
+    while ( sent < total ) {
+        int count = SDL_min(batch, total - sent);
+        int pending = 0;
+        Uint32 deadline;
+
+        if ( single ) {
+            for ( i=0; i<count; ++i ) {
+                pending += SDLNet_UDP_Send(client, 0, sendV[i]);
+            }
+        } else {
+            pending = SDLNet_UDP_SendV(client, sendV, count);
+        }
+        sent += count;
+
+        deadline = SDL_GetTicks() + 100;
+        while ( pending > 0 && !SDL_TICKS_PASSED(SDL_GetTicks(), deadline) ) {
+            int numrecv;
+
+            if ( single ) {
+                numrecv = SDLNet_UDP_Recv(server, recvV[0]);
+            } else {
+                numrecv = SDLNet_UDP_RecvV(server, recvV);
+            }
+            if ( numrecv > 0 ) {
+                pending -= numrecv;
+                received += numrecv;
+            }
+        }
+    }
+    end = SDL_GetPerformanceCounter();
+    seconds = (double)(end - start) / SDL_GetPerformanceFrequency();
+
+    printf("%d packets of %d bytes %s: %.3f s, %.0f packets per second, %d lost\n",
+           total, PACKET_SIZE, single ? "one at a time" : "in batches",
+           seconds, received / seconds, total - received);
+    status = 0;
+
+done:
+    SDLNet_FreePacketV(recvV);
+    SDLNet_FreePacketV(sendV);
+    SDLNet_UDP_Close(client);
+    SDLNet_UDP_Close(server);
+    SDLNet_Quit();
+    SDL_Quit();
+    return(status);
+}
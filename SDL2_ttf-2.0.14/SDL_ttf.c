@@ -40,6 +40,18 @@
    in the result FT_Bitmap after the FT_Render_Glyph() call. */
 #define NUM_GRAYS       256
 
+/* Fonts, glyph bitmaps and atlases count as SDL_MEMTAG_FONT when SDL
+   tracks its memory */
+#ifdef SDL_MEMTAG_FONT
+#define TTF_malloc(size)        SDL_TaggedMalloc(SDL_MEMTAG_FONT, size)
+#define TTF_calloc(n, size)     SDL_TaggedCalloc(SDL_MEMTAG_FONT, n, size)
+#define TTF_realloc(mem, size)  SDL_TaggedRealloc(SDL_MEMTAG_FONT, mem, size)
+#else
+#define TTF_malloc(size)        SDL_malloc(size)
+#define TTF_calloc(n, size)     SDL_calloc(n, size)
+#define TTF_realloc(mem, size)  SDL_realloc(mem, size)
+#endif
+
 /* Handy routines for converting from fixed point */
 #define FT_FLOOR(X) ((X & -64) / 64)
 #define FT_CEIL(X)  (((X + 63) & -64) / 64)
@@ -60,9 +72,36 @@ typedef struct cached_glyph {
     int maxy;
     int yoffset;
     int advance;
-    Uint16 cached;
+    Uint32 cached;
+
+    /* Links in the font's hash chains and LRU list, by cache index */
+    int hash_next;
+    int lru_prev;
+    int lru_next;
 } c_glyph;
 
+/* Glyph bitmaps are carved out of big blocks.  Freed pieces up to
+   GLYPH_ARENA_CLASSES * GLYPH_ARENA_GRANULE bytes are kept on free lists
+   by size and reused, bigger ones come from TTF_malloc().
+ */
+#define GLYPH_ARENA_BLOCK   65536
+#define GLYPH_ARENA_GRANULE 64
+#define GLYPH_ARENA_CLASSES 64
+
+typedef struct glyph_block {
+    struct glyph_block *next;
+} glyph_block;
+
+typedef struct glyph_arena {
+    glyph_block *blocks;
+    Uint8 *next;
+    size_t left;
+    void *free[GLYPH_ARENA_CLASSES];
+} glyph_arena;
+
+/* The number of glyphs cached per font if the application doesn't set it */
+#define DEFAULT_CACHE_SIZE  512
+
 /* The structure used to hold internal font information */
 struct _TTF_Font {
     /* Freetype2 maintains all sorts of useful info itself */
@@ -90,9 +129,20 @@ struct _TTF_Font {
     int underline_offset;
     int underline_height;
 
-    /* Cache for style-transformed glyphs */
+    /* Cache for style-transformed glyphs, hashed by character.
+       When it is full the least recently used glyph is replaced.
+     */
     c_glyph *current;
-    c_glyph cache[257]; /* 257 is a prime */
+    c_glyph *cache;
+    int cache_size;
+    int num_cached;
+    int *buckets;
+    int num_buckets;
+    int lru_head;
+    int lru_tail;
+    Uint32 cache_hits;
+    Uint32 cache_misses;
+    glyph_arena arena;
 
     /* We are responsible for closing the font stream */
     SDL_RWops *src;
@@ -104,6 +154,9 @@ struct _TTF_Font {
 
     /* really just flags passed into FT_Load_Glyph */
     int hinting;
+
+    /* Identifies the font in glyph atlases, since addresses get reused */
+    Uint32 id;
 };
 
 /* Handle a style only if the font does not already handle it */
@@ -121,6 +174,7 @@ struct _TTF_Font {
 static FT_Library library;
 static int TTF_initialized = 0;
 static int TTF_byteswapped = 0;
+static Uint32 TTF_next_font_id = 0;
 
 #define TTF_CHECKPOINTER(p, errval)                 \
     if ( !TTF_initialized ) {                   \
@@ -365,6 +419,8 @@ static unsigned long RWread(
     return (unsigned long)SDL_RWread( src, buffer, 1, (int)count );
 }
 
+static int Alloc_Cache( TTF_Font* font, int size );
+
 TTF_Font* TTF_OpenFontIndexRW( SDL_RWops *src, int freesrc, int ptsize, long index )
 {
     TTF_Font* font;
@@ -399,7 +455,7 @@ TTF_Font* TTF_OpenFontIndexRW( SDL_RWops *src, int freesrc, int ptsize, long ind
         return NULL;
     }
 
-    font = (TTF_Font*)SDL_malloc(sizeof *font);
+    font = (TTF_Font*)TTF_malloc(sizeof *font);
     if ( font == NULL ) {
         TTF_SetError( "Out of memory" );
         if ( freesrc ) {
@@ -409,10 +465,16 @@ TTF_Font* TTF_OpenFontIndexRW( SDL_RWops *src, int freesrc, int ptsize, long ind
     }
     SDL_memset(font, 0, sizeof(*font));
 
+    font->id = ++TTF_next_font_id;
     font->src = src;
     font->freesrc = freesrc;
 
-    stream = (FT_Stream)SDL_malloc(sizeof(*stream));
+    if ( Alloc_Cache( font, DEFAULT_CACHE_SIZE ) < 0 ) {
+        TTF_CloseFont( font );
+        return NULL;
+    }
+
+    stream = (FT_Stream)TTF_malloc(sizeof(*stream));
     if ( stream == NULL ) {
         TTF_SetError( "Out of memory" );
         TTF_CloseFont( font );
@@ -420,10 +482,24 @@ TTF_Font* TTF_OpenFontIndexRW( SDL_RWops *src, int freesrc, int ptsize, long ind
     }
     SDL_memset(stream, 0, sizeof(*stream));
 
-    stream->read = RWread;
-    stream->descriptor.pointer = src;
-    stream->pos = (unsigned long)position;
-    stream->size = (unsigned long)(SDL_RWsize(src) - position);
+#ifdef SDL_RWOPS_MAPPED
+    /* FreeType reads fonts that are already in memory directly */
+    {
+        Sint64 size;
+        const Uint8 *mem = (const Uint8 *)SDL_RWGetMemory( src, &size );
+        if ( mem ) {
+            stream->base = (unsigned char *)mem + position;
+            stream->size = (unsigned long)(size - position);
+        }
+    }
+    if ( stream->base == NULL )
+#endif
+    {
+        stream->read = RWread;
+        stream->descriptor.pointer = src;
+        stream->pos = (unsigned long)position;
+        stream->size = (unsigned long)(SDL_RWsize(src) - position);
+    }
 
     font->args.flags = FT_OPEN_STREAM;
     font->args.stream = stream;
@@ -436,9 +512,20 @@ TTF_Font* TTF_OpenFontIndexRW( SDL_RWops *src, int freesrc, int ptsize, long ind
     }
     face = font->face;
 
-    /* Set charmap for loaded font */
+    /* Set charmap for loaded font, one with characters beyond U+FFFF if
+       there is one.
+     */
     found = 0;
     for (i = 0; i < face->num_charmaps; i++) {
+        FT_CharMap charmap = face->charmaps[i];
+        if ((charmap->platform_id == 3 && charmap->encoding_id == 10) /* Windows UCS-4 */
+         || (charmap->platform_id == 0 && charmap->encoding_id == 4) /* Apple Unicode 2.0 full */
+         || (charmap->platform_id == 0 && charmap->encoding_id == 6)) { /* Apple Unicode full */
+            found = charmap;
+            break;
+        }
+    }
+    for (i = 0; !found && i < face->num_charmaps; i++) {
         FT_CharMap charmap = face->charmaps[i];
         if ((charmap->platform_id == 3 && charmap->encoding_id == 1) /* Windows Unicode */
          || (charmap->platform_id == 3 && charmap->encoding_id == 0) /* Windows Symbol */
@@ -541,7 +628,11 @@ TTF_Font* TTF_OpenFontRW( SDL_RWops *src, int freesrc, int ptsize )
 
 TTF_Font* TTF_OpenFontIndex( const char *file, int ptsize, long index )
 {
+#ifdef SDL_RWOPS_MAPPED
+    SDL_RWops *rw = SDL_RWFromFileMapped(file);
+#else
     SDL_RWops *rw = SDL_RWFromFile(file, "rb");
+#endif
     if ( rw == NULL ) {
         return NULL;
     }
@@ -553,16 +644,73 @@ TTF_Font* TTF_OpenFont( const char *file, int ptsize )
     return TTF_OpenFontIndex(file, ptsize, 0);
 }
 
-static void Flush_Glyph( c_glyph* glyph )
+static void *Arena_Alloc( glyph_arena *arena, size_t size )
+{
+    size_t cls;
+    void *mem;
+
+    if ( size > GLYPH_ARENA_CLASSES * GLYPH_ARENA_GRANULE ) {
+        return TTF_malloc( size );
+    }
+    /* An empty bitmap still gets a slot of the smallest class */
+    cls = size ? (size - 1) / GLYPH_ARENA_GRANULE : 0;
+    if ( arena->free[cls] ) {
+        mem = arena->free[cls];
+        arena->free[cls] = *(void **)mem;
+        return mem;
+    }
+    size = (cls + 1) * GLYPH_ARENA_GRANULE;
+    if ( arena->left < size ) {
+        glyph_block *block = (glyph_block *)TTF_malloc( sizeof(*block) + GLYPH_ARENA_BLOCK );
+        if ( !block ) {
+            return NULL;
+        }
+        block->next = arena->blocks;
+        arena->blocks = block;
+        arena->next = (Uint8 *)(block + 1);
+        arena->left = GLYPH_ARENA_BLOCK;
+    }
+    mem = arena->next;
+    arena->next += size;
+    arena->left -= size;
+    return mem;
+}
+
+static void Arena_Free( glyph_arena *arena, void *mem, size_t size )
+{
+    size_t cls;
+
+    if ( size > GLYPH_ARENA_CLASSES * GLYPH_ARENA_GRANULE ) {
+        SDL_free( mem );
+        return;
+    }
+    cls = size ? (size - 1) / GLYPH_ARENA_GRANULE : 0;
+    *(void **)mem = arena->free[cls];
+    arena->free[cls] = mem;
+}
+
+/* Free the blocks, once no glyph uses them anymore */
+static void Arena_Reset( glyph_arena *arena )
+{
+    glyph_block *block, *next;
+
+    for ( block = arena->blocks; block; block = next ) {
+        next = block->next;
+        SDL_free( block );
+    }
+    SDL_memset( arena, 0, sizeof(*arena) );
+}
+
+static void Flush_Glyph( TTF_Font* font, c_glyph* glyph )
 {
     glyph->stored = 0;
     glyph->index = 0;
     if ( glyph->bitmap.buffer ) {
-        SDL_free( glyph->bitmap.buffer );
+        Arena_Free( &font->arena, glyph->bitmap.buffer, glyph->bitmap.pitch * glyph->bitmap.rows );
         glyph->bitmap.buffer = 0;
     }
     if ( glyph->pixmap.buffer ) {
-        SDL_free( glyph->pixmap.buffer );
+        Arena_Free( &font->arena, glyph->pixmap.buffer, glyph->pixmap.pitch * glyph->pixmap.rows );
         glyph->pixmap.buffer = 0;
     }
     glyph->cached = 0;
@@ -571,17 +719,93 @@ static void Flush_Glyph( c_glyph* glyph )
 static void Flush_Cache( TTF_Font* font )
 {
     int i;
-    int size = sizeof( font->cache ) / sizeof( font->cache[0] );
 
-    for ( i = 0; i < size; ++i ) {
-        if ( font->cache[i].cached ) {
-            Flush_Glyph( &font->cache[i] );
-        }
+    for ( i = 0; i < font->num_cached; ++i ) {
+        Flush_Glyph( font, &font->cache[i] );
+    }
+    for ( i = 0; i < font->num_buckets; ++i ) {
+        font->buckets[i] = -1;
+    }
+    font->num_cached = 0;
+    font->lru_head = -1;
+    font->lru_tail = -1;
+    font->current = NULL;
+    Arena_Reset( &font->arena );
+}
+
+/* Allocate room for 'size' glyphs, flushing the glyphs cached so far */
+static int Alloc_Cache( TTF_Font* font, int size )
+{
+    c_glyph *cache;
+    int *buckets;
+    int num_buckets;
+    int i;
+
+    /* Keep the hash chains short */
+    num_buckets = 16;
+    while ( num_buckets < size ) {
+        num_buckets *= 2;
+    }
+    cache = (c_glyph *)TTF_calloc( size, sizeof(*cache) );
+    buckets = (int *)TTF_malloc( num_buckets * sizeof(*buckets) );
+    if ( !cache || !buckets ) {
+        SDL_free( cache );
+        SDL_free( buckets );
+        TTF_SetError( "Out of memory" );
+        return -1;
+    }
+    /* The old glyphs have to be freed while the old array holds them */
+    Flush_Cache( font );
+    SDL_free( font->cache );
+    SDL_free( font->buckets );
+    font->cache = cache;
+    font->cache_size = size;
+    font->buckets = buckets;
+    font->num_buckets = num_buckets;
+    for ( i = 0; i < num_buckets; ++i ) {
+        font->buckets[i] = -1;
+    }
+    font->cache_hits = 0;
+    font->cache_misses = 0;
+    return 0;
+}
+
+static int Hash_Glyph( const TTF_Font* font, Uint32 ch )
+{
+    return (int)((ch * 0x9E3779B1u) >> 8) & (font->num_buckets - 1);
+}
+
+static void LRU_Unlink( TTF_Font* font, int i )
+{
+    c_glyph *glyph = &font->cache[i];
+
+    if ( glyph->lru_prev >= 0 ) {
+        font->cache[glyph->lru_prev].lru_next = glyph->lru_next;
+    } else {
+        font->lru_head = glyph->lru_next;
+    }
+    if ( glyph->lru_next >= 0 ) {
+        font->cache[glyph->lru_next].lru_prev = glyph->lru_prev;
+    } else {
+        font->lru_tail = glyph->lru_prev;
+    }
+}
+
+static void LRU_PushFront( TTF_Font* font, int i )
+{
+    c_glyph *glyph = &font->cache[i];
 
+    glyph->lru_prev = -1;
+    glyph->lru_next = font->lru_head;
+    if ( font->lru_head >= 0 ) {
+        font->cache[font->lru_head].lru_prev = i;
+    } else {
+        font->lru_tail = i;
     }
+    font->lru_head = i;
 }
 
-static FT_Error Load_Glyph( TTF_Font* font, Uint16 ch, c_glyph* cached, int want )
+static FT_Error Load_Glyph( TTF_Font* font, Uint32 ch, c_glyph* cached, int want )
 {
     FT_Face face;
     FT_Error error;
@@ -729,7 +953,7 @@ static FT_Error Load_Glyph( TTF_Font* font, Uint16 ch, c_glyph* cached, int want
         }
 
         if (dst->rows != 0) {
-            dst->buffer = (unsigned char *)SDL_malloc( dst->pitch * dst->rows );
+            dst->buffer = (unsigned char *)Arena_Alloc( &font->arena, dst->pitch * dst->rows );
             if ( !dst->buffer ) {
                 return FT_Err_Out_Of_Memory;
             }
@@ -847,6 +1071,8 @@ static FT_Error Load_Glyph( TTF_Font* font, Uint16 ch, c_glyph* cached, int want
                            src->buffer+soffset, src->pitch);
                 }
             }
+        } else {
+            dst->buffer = NULL;
         }
 
         /* Handle the bold style */
@@ -889,25 +1115,54 @@ static FT_Error Load_Glyph( TTF_Font* font, Uint16 ch, c_glyph* cached, int want
         }
     }
 
-    /* We're done, mark this glyph cached */
-    cached->cached = ch;
-
     return 0;
 }
 
-static FT_Error Find_Glyph( TTF_Font* font, Uint16 ch, int want )
+static FT_Error Find_Glyph( TTF_Font* font, Uint32 ch, int want )
 {
     int retval = 0;
-    int hsize = sizeof( font->cache ) / sizeof( font->cache[0] );
+    int h = Hash_Glyph( font, ch );
+    int i;
+    int *link;
 
-    int h = ch % hsize;
-    font->current = &font->cache[h];
+    for ( i = font->buckets[h]; i >= 0; i = font->cache[i].hash_next ) {
+        if ( font->cache[i].cached == ch ) {
+            break;
+        }
+    }
 
-    if (font->current->cached != ch)
-        Flush_Glyph( font->current );
+    if ( i >= 0 ) {
+        /* Move it to the front of the LRU list */
+        if ( i != font->lru_head ) {
+            LRU_Unlink( font, i );
+            LRU_PushFront( font, i );
+        }
+    } else {
+        if ( font->num_cached < font->cache_size ) {
+            i = font->num_cached++;
+        } else {
+            /* Replace the least recently used glyph */
+            i = font->lru_tail;
+            LRU_Unlink( font, i );
+            link = &font->buckets[Hash_Glyph( font, font->cache[i].cached )];
+            while ( *link != i ) {
+                link = &font->cache[*link].hash_next;
+            }
+            *link = font->cache[i].hash_next;
+            Flush_Glyph( font, &font->cache[i] );
+        }
+        font->cache[i].cached = ch;
+        font->cache[i].hash_next = font->buckets[h];
+        font->buckets[h] = i;
+        LRU_PushFront( font, i );
+    }
+    font->current = &font->cache[i];
 
     if ( (font->current->stored & want) != want ) {
+        ++font->cache_misses;
         retval = Load_Glyph( font, ch, font->current, want );
+    } else {
+        ++font->cache_hits;
     }
     return retval;
 }
@@ -915,7 +1170,11 @@ static FT_Error Find_Glyph( TTF_Font* font, Uint16 ch, int want )
 void TTF_CloseFont( TTF_Font* font )
 {
     if ( font ) {
-        Flush_Cache( font );
+        if ( font->cache ) {
+            Flush_Cache( font );
+            SDL_free( font->cache );
+            SDL_free( font->buckets );
+        }
         if ( font->face ) {
             FT_Done_Face( font->face );
         }
@@ -954,13 +1213,34 @@ static void LATIN1_to_UTF8(const char *src, Uint8 *dst)
     *dst = '\0';
 }
 
-/* Convert a UCS-2 string to a UTF-8 string */
+/* Convert a UCS-4 character to UTF-8, returns the end of the bytes */
+static Uint8 *UCS4_to_UTF8(Uint32 ch, Uint8 *dst)
+{
+    if (ch <= 0x7F) {
+        *dst++ = (Uint8) ch;
+    } else if (ch <= 0x7FF) {
+        *dst++ = 0xC0 | (Uint8) ((ch >> 6) & 0x1F);
+        *dst++ = 0x80 | (Uint8) (ch & 0x3F);
+    } else if (ch <= 0xFFFF) {
+        *dst++ = 0xE0 | (Uint8) ((ch >> 12) & 0x0F);
+        *dst++ = 0x80 | (Uint8) ((ch >> 6) & 0x3F);
+        *dst++ = 0x80 | (Uint8) (ch & 0x3F);
+    } else {
+        *dst++ = 0xF0 | (Uint8) ((ch >> 18) & 0x07);
+        *dst++ = 0x80 | (Uint8) ((ch >> 12) & 0x3F);
+        *dst++ = 0x80 | (Uint8) ((ch >> 6) & 0x3F);
+        *dst++ = 0x80 | (Uint8) (ch & 0x3F);
+    }
+    return dst;
+}
+
+/* Convert a UCS-2 string to a UTF-8 string, surrogate pairs included */
 static void UCS2_to_UTF8(const Uint16 *src, Uint8 *dst)
 {
     int swapped = TTF_byteswapped;
 
     while (*src) {
-        Uint16 ch = *(Uint16*)src++;
+        Uint32 ch = *(Uint16*)src++;
         if (ch == UNICODE_BOM_NATIVE) {
             swapped = 0;
             continue;
@@ -970,18 +1250,16 @@ static void UCS2_to_UTF8(const Uint16 *src, Uint8 *dst)
             continue;
         }
         if (swapped) {
-            ch = SDL_Swap16(ch);
+            ch = SDL_Swap16((Uint16)ch);
         }
-        if (ch <= 0x7F) {
-            *dst++ = (Uint8) ch;
-        } else if (ch <= 0x7FF) {
-            *dst++ = 0xC0 | (Uint8) ((ch >> 6) & 0x1F);
-            *dst++ = 0x80 | (Uint8) (ch & 0x3F);
-        } else {
-            *dst++ = 0xE0 | (Uint8) ((ch >> 12) & 0x0F);
-            *dst++ = 0x80 | (Uint8) ((ch >> 6) & 0x3F);
-            *dst++ = 0x80 | (Uint8) (ch & 0x3F);
+        if (ch >= 0xD800 && ch <= 0xDBFF && *src) {
+            Uint32 low = swapped ? SDL_Swap16(*src) : *src;
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                ch = 0x10000 + ((ch - 0xD800) << 10) + (low - 0xDC00);
+                ++src;
+            }
         }
+        dst = UCS4_to_UTF8(ch, dst);
     }
     *dst = '\0';
 }
@@ -1131,8 +1409,19 @@ int TTF_GlyphIsProvided(const TTF_Font *font, Uint16 ch)
   return(FT_Get_Char_Index(font->face, ch));
 }
 
+int TTF_GlyphIsProvided32(const TTF_Font *font, Uint32 ch)
+{
+  return(FT_Get_Char_Index(font->face, ch));
+}
+
 int TTF_GlyphMetrics(TTF_Font *font, Uint16 ch,
                      int* minx, int* maxx, int* miny, int* maxy, int* advance)
+{
+    return TTF_GlyphMetrics32(font, ch, minx, maxx, miny, maxy, advance);
+}
+
+int TTF_GlyphMetrics32(TTF_Font *font, Uint32 ch,
+                     int* minx, int* maxx, int* miny, int* maxy, int* advance)
 {
     FT_Error error;
 
@@ -1216,7 +1505,7 @@ int TTF_SizeUTF8(TTF_Font *font, const char *text, int *w, int *h)
     textlen = SDL_strlen(text);
     x= 0;
     while ( textlen > 0 ) {
-        Uint16 c = UTF8_getch(&text, &textlen);
+        Uint32 c = UTF8_getch(&text, &textlen);
         if ( c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED ) {
             continue;
         }
@@ -1397,7 +1686,7 @@ SDL_Surface *TTF_RenderUTF8_Solid(TTF_Font *font,
     first = SDL_TRUE;
     xstart = 0;
     while ( textlen > 0 ) {
-        Uint16 c = UTF8_getch(&text, &textlen);
+        Uint32 c = UTF8_getch(&text, &textlen);
         if ( c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED ) {
             continue;
         }
@@ -1489,10 +1778,14 @@ SDL_Surface *TTF_RenderUNICODE_Solid(TTF_Font *font,
 
 SDL_Surface *TTF_RenderGlyph_Solid(TTF_Font *font, Uint16 ch, SDL_Color fg)
 {
-    Uint16 ucs2[2] = { ch, 0 };
-    Uint8 utf8[4];
+    return TTF_RenderGlyph32_Solid(font, ch, fg);
+}
+
+SDL_Surface *TTF_RenderGlyph32_Solid(TTF_Font *font, Uint32 ch, SDL_Color fg)
+{
+    Uint8 utf8[5];
 
-    UCS2_to_UTF8(ucs2, utf8);
+    *UCS4_to_UTF8(ch, utf8) = '\0';
     return TTF_RenderUTF8_Solid(font, (char *)utf8, fg);
 }
 
@@ -1579,7 +1872,7 @@ SDL_Surface *TTF_RenderUTF8_Shaded(TTF_Font *font,
     first = SDL_TRUE;
     xstart = 0;
     while ( textlen > 0 ) {
-        Uint16 c = UTF8_getch(&text, &textlen);
+        Uint32 c = UTF8_getch(&text, &textlen);
         if ( c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED ) {
             continue;
         }
@@ -1675,10 +1968,17 @@ SDL_Surface* TTF_RenderGlyph_Shaded( TTF_Font* font,
                      SDL_Color fg,
                      SDL_Color bg )
 {
-    Uint16 ucs2[2] = { ch, 0 };
-    Uint8 utf8[4];
+    return TTF_RenderGlyph32_Shaded(font, ch, fg, bg);
+}
+
+SDL_Surface* TTF_RenderGlyph32_Shaded( TTF_Font* font,
+                     Uint32 ch,
+                     SDL_Color fg,
+                     SDL_Color bg )
+{
+    Uint8 utf8[5];
 
-    UCS2_to_UTF8(ucs2, utf8);
+    *UCS4_to_UTF8(ch, utf8) = '\0';
     return TTF_RenderUTF8_Shaded(font, (char *)utf8, fg, bg);
 }
 
@@ -1749,7 +2049,7 @@ SDL_Surface *TTF_RenderUTF8_Blended(TTF_Font *font,
     pixel = (fg.r<<16)|(fg.g<<8)|fg.b;
     SDL_FillRect(textbuf, NULL, pixel); /* Initialize with fg and 0 alpha */
     while ( textlen > 0 ) {
-        Uint16 c = UTF8_getch(&text, &textlen);
+        Uint32 c = UTF8_getch(&text, &textlen);
         if ( c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED ) {
             continue;
         }
@@ -1926,7 +2226,7 @@ SDL_Surface *TTF_RenderUTF8_Blended_Wrapped(TTF_Font *font,
         tok = str;
         end = str + str_len;
         do {
-            strLines = (char **)SDL_realloc(strLines, (numLines+1)*sizeof(*strLines));
+            strLines = (char **)TTF_realloc(strLines, (numLines+1)*sizeof(*strLines));
             if (!strLines) {
                 TTF_SetError("Out of memory");
                 return(NULL);
@@ -2017,7 +2317,7 @@ SDL_Surface *TTF_RenderUTF8_Blended_Wrapped(TTF_Font *font,
         first = SDL_TRUE;
         xstart = 0;
         while ( textlen > 0 ) {
-            Uint16 c = UTF8_getch(&text, &textlen);
+            Uint32 c = UTF8_getch(&text, &textlen);
             if ( c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED ) {
                 continue;
             }
@@ -2121,13 +2421,593 @@ SDL_Surface *TTF_RenderUNICODE_Blended_Wrapped(TTF_Font *font, const Uint16* tex
 
 SDL_Surface *TTF_RenderGlyph_Blended(TTF_Font *font, Uint16 ch, SDL_Color fg)
 {
-    Uint16 ucs2[2] = { ch, 0 };
-    Uint8 utf8[4];
+    return TTF_RenderGlyph32_Blended(font, ch, fg);
+}
+
+SDL_Surface *TTF_RenderGlyph32_Blended(TTF_Font *font, Uint32 ch, SDL_Color fg)
+{
+    Uint8 utf8[5];
 
-    UCS2_to_UTF8(ucs2, utf8);
+    *UCS4_to_UTF8(ch, utf8) = '\0';
     return TTF_RenderUTF8_Blended(font, (char *)utf8, fg);
 }
 
+/* A glyph stored in a texture atlas */
+typedef struct atlas_glyph {
+    /* What was rendered */
+    Uint32 font_id;
+    Uint32 ch;
+    int style;
+    int outline;
+    int hinting;
+
+    /* How to lay it out */
+    FT_UInt index;
+    int minx;
+    int maxx;
+    int miny;
+    int maxy;
+    int yoffset;
+    int advance;
+
+    /* Where it is in the texture, empty for blank glyphs */
+    SDL_Rect rect;
+    int shelf;
+
+    struct atlas_glyph *next;           /* in the same hash bucket */
+    struct atlas_glyph *shelf_next;     /* on the same shelf */
+} atlas_glyph;
+
+/* A row of glyphs across the texture, filled from left to right */
+typedef struct atlas_shelf {
+    int y;
+    int height;
+    int x;
+    Uint32 last_used;
+    atlas_glyph *glyphs;
+} atlas_shelf;
+
+/* The rows at the top of the texture hold a white block for lines, which
+   is stretched from its middle so filtering doesn't pick up the edges.
+ */
+#define ATLAS_SOLID_SIZE    4
+#define ATLAS_PADDING       1
+#define ATLAS_DEFAULT_SIZE  1024
+#define ATLAS_MIN_BUCKETS   256
+
+struct _TTF_Atlas {
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    int width;
+    int height;
+
+    /* The shelves, from the top of the texture down */
+    atlas_shelf *shelves;
+    int num_shelves;
+    int max_shelves;
+    int bottom;
+
+    /* The glyphs, hashed by font and character */
+    atlas_glyph **buckets;
+    int num_buckets;
+    int num_glyphs;
+    atlas_glyph *free_glyphs;
+
+    /* Counts draw calls, to find the least recently used shelf */
+    Uint32 stamp;
+
+    /* The copies waiting to be drawn */
+    SDL_Rect *src;
+    SDL_Rect *dst;
+    int num_copies;
+    int max_copies;
+    SDL_Color color;
+
+    /* Scratch space for uploading a glyph */
+    Uint32 *pixels;
+    int max_pixels;
+};
+
+static Uint32 Atlas_Hash( Uint32 font_id, Uint32 ch )
+{
+    return (font_id * 0x9E3779B1u) ^ ch;
+}
+
+/* Remove the glyphs on a shelf from the atlas, so it can be refilled */
+static void Atlas_EvictShelf( TTF_Atlas *atlas, atlas_shelf *shelf )
+{
+    atlas_glyph *glyph, *next;
+    atlas_glyph **prev;
+
+    for ( glyph = shelf->glyphs; glyph; glyph = next ) {
+        next = glyph->shelf_next;
+
+        prev = &atlas->buckets[Atlas_Hash(glyph->font_id, glyph->ch) & (atlas->num_buckets - 1)];
+        while ( *prev != glyph ) {
+            prev = &(*prev)->next;
+        }
+        *prev = glyph->next;
+
+        glyph->next = atlas->free_glyphs;
+        atlas->free_glyphs = glyph;
+        --atlas->num_glyphs;
+    }
+    shelf->glyphs = NULL;
+    shelf->x = 0;
+}
+
+/* Draw the copies waiting to be drawn, with the current color */
+static int Atlas_Flush( TTF_Atlas *atlas )
+{
+    int i;
+    int status = 0;
+
+    if ( atlas->num_copies > 0 ) {
+        SDL_SetTextureColorMod( atlas->texture, atlas->color.r, atlas->color.g, atlas->color.b );
+        SDL_SetTextureAlphaMod( atlas->texture, atlas->color.a );
+        for ( i = 0; i < atlas->num_copies; ++i ) {
+            if ( SDL_RenderCopy( atlas->renderer, atlas->texture, &atlas->src[i], &atlas->dst[i] ) < 0 ) {
+                status = -1;
+            }
+        }
+        atlas->num_copies = 0;
+    }
+    return status;
+}
+
+static int Atlas_AddCopy( TTF_Atlas *atlas, const SDL_Rect *src, int x, int y, int w, int h )
+{
+    SDL_Rect *dst;
+
+    if ( atlas->num_copies == atlas->max_copies ) {
+        int max_copies = atlas->max_copies ? atlas->max_copies * 2 : 64;
+        SDL_Rect *rects;
+
+        rects = (SDL_Rect *)TTF_realloc( atlas->src, max_copies * sizeof(*rects) );
+        if ( !rects ) {
+            TTF_SetError( "Out of memory" );
+            return -1;
+        }
+        atlas->src = rects;
+        rects = (SDL_Rect *)TTF_realloc( atlas->dst, max_copies * sizeof(*rects) );
+        if ( !rects ) {
+            TTF_SetError( "Out of memory" );
+            return -1;
+        }
+        atlas->dst = rects;
+        atlas->max_copies = max_copies;
+    }
+    atlas->src[atlas->num_copies] = *src;
+    dst = &atlas->dst[atlas->num_copies++];
+    dst->x = x;
+    dst->y = y;
+    dst->w = w;
+    dst->h = h;
+    return 0;
+}
+
+/* Find room for a w by h glyph, returns the shelf or -1 if it won't fit */
+static int Atlas_Pack( TTF_Atlas *atlas, int w, int h )
+{
+    atlas_shelf *shelf;
+    int i, best = -1, oldest = -1;
+
+    w += ATLAS_PADDING;
+    h += ATLAS_PADDING;
+    if ( w > atlas->width || h > atlas->height - (ATLAS_SOLID_SIZE + ATLAS_PADDING) ) {
+        return -1;
+    }
+
+    /* The shortest shelf the glyph fits on wastes the least space */
+    for ( i = 0; i < atlas->num_shelves; ++i ) {
+        shelf = &atlas->shelves[i];
+        if ( shelf->height >= h && shelf->x + w <= atlas->width &&
+             (best < 0 || shelf->height < atlas->shelves[best].height) ) {
+            best = i;
+        }
+    }
+    if ( best >= 0 ) {
+        return best;
+    }
+
+    /* Start a new shelf below the others */
+    if ( atlas->bottom + h <= atlas->height && atlas->num_shelves < atlas->max_shelves ) {
+        shelf = &atlas->shelves[atlas->num_shelves];
+        shelf->y = atlas->bottom;
+        shelf->height = h;
+        shelf->x = 0;
+        shelf->last_used = 0;
+        shelf->glyphs = NULL;
+        atlas->bottom += h;
+        return atlas->num_shelves++;
+    }
+
+    /* The atlas is full, evict the least recently used shelf that fits.
+       The copies waiting to be drawn may come from it, draw them first.
+     */
+    Atlas_Flush( atlas );
+    for ( i = 0; i < atlas->num_shelves; ++i ) {
+        shelf = &atlas->shelves[i];
+        if ( shelf->height >= h &&
+             (oldest < 0 || (Sint32)(shelf->last_used - atlas->shelves[oldest].last_used) < 0) ) {
+            oldest = i;
+        }
+    }
+    if ( oldest >= 0 ) {
+        Atlas_EvictShelf( atlas, &atlas->shelves[oldest] );
+        return oldest;
+    }
+
+    /* No shelf is tall enough, start over with an empty atlas */
+    for ( i = 0; i < atlas->num_shelves; ++i ) {
+        Atlas_EvictShelf( atlas, &atlas->shelves[i] );
+    }
+    atlas->num_shelves = 0;
+    atlas->bottom = ATLAS_SOLID_SIZE + ATLAS_PADDING;
+    return Atlas_Pack( atlas, w - ATLAS_PADDING, h - ATLAS_PADDING );
+}
+
+static int Atlas_Rehash( TTF_Atlas *atlas, int num_buckets )
+{
+    atlas_glyph **buckets;
+    atlas_glyph *glyph, *next;
+    int i, h;
+
+    buckets = (atlas_glyph **)TTF_calloc( num_buckets, sizeof(*buckets) );
+    if ( !buckets ) {
+        return -1;
+    }
+    for ( i = 0; i < atlas->num_buckets; ++i ) {
+        for ( glyph = atlas->buckets[i]; glyph; glyph = next ) {
+            next = glyph->next;
+            h = Atlas_Hash(glyph->font_id, glyph->ch) & (num_buckets - 1);
+            glyph->next = buckets[h];
+            buckets[h] = glyph;
+        }
+    }
+    SDL_free( atlas->buckets );
+    atlas->buckets = buckets;
+    atlas->num_buckets = num_buckets;
+    return 0;
+}
+
+/* Render a glyph with the font cache and copy it into the texture */
+static atlas_glyph *Atlas_Load( TTF_Atlas *atlas, TTF_Font *font, Uint32 ch, int style )
+{
+    atlas_glyph *glyph;
+    c_glyph *cached;
+    FT_Error error;
+    int width, height;
+    int row, col, h;
+    Uint8 *src;
+    Uint32 *dst;
+
+    error = Find_Glyph( font, ch, CACHED_METRICS|CACHED_PIXMAP );
+    if ( error ) {
+        TTF_SetFTError( "Couldn't find glyph", error );
+        return NULL;
+    }
+    cached = font->current;
+
+    /* Same clipping as TTF_RenderUTF8_Blended() */
+    width = cached->pixmap.width;
+    if ( font->outline <= 0 && width > cached->maxx - cached->minx ) {
+        width = cached->maxx - cached->minx;
+    }
+    height = cached->pixmap.rows;
+    if ( width < 0 ) {
+        width = 0;
+    }
+
+    if ( atlas->num_glyphs >= atlas->num_buckets ) {
+        if ( Atlas_Rehash( atlas, atlas->num_buckets * 2 ) < 0 ) {
+            TTF_SetError( "Out of memory" );
+            return NULL;
+        }
+    }
+    if ( atlas->free_glyphs ) {
+        glyph = atlas->free_glyphs;
+        atlas->free_glyphs = glyph->next;
+    } else {
+        glyph = (atlas_glyph *)TTF_malloc( sizeof(*glyph) );
+        if ( !glyph ) {
+            TTF_SetError( "Out of memory" );
+            return NULL;
+        }
+    }
+    glyph->font_id = font->id;
+    glyph->ch = ch;
+    glyph->style = style;
+    glyph->outline = font->outline;
+    glyph->hinting = font->hinting;
+    glyph->index = cached->index;
+    glyph->minx = cached->minx;
+    glyph->maxx = cached->maxx;
+    glyph->miny = cached->miny;
+    glyph->maxy = cached->maxy;
+    glyph->yoffset = cached->yoffset;
+    glyph->advance = cached->advance;
+    glyph->rect.x = 0;
+    glyph->rect.y = 0;
+    glyph->rect.w = 0;
+    glyph->rect.h = 0;
+    glyph->shelf = -1;
+    glyph->shelf_next = NULL;
+
+    if ( width > 0 && height > 0 ) {
+        atlas_shelf *shelf;
+        int i = Atlas_Pack( atlas, width, height );
+
+        if ( i < 0 ) {
+            glyph->next = atlas->free_glyphs;
+            atlas->free_glyphs = glyph;
+            TTF_SetError( "Glyph is too large for the atlas" );
+            return NULL;
+        }
+        shelf = &atlas->shelves[i];
+
+        if ( width * height > atlas->max_pixels ) {
+            Uint32 *pixels = (Uint32 *)TTF_realloc( atlas->pixels, width * height * sizeof(*pixels) );
+            if ( !pixels ) {
+                glyph->next = atlas->free_glyphs;
+                atlas->free_glyphs = glyph;
+                TTF_SetError( "Out of memory" );
+                return NULL;
+            }
+            atlas->pixels = pixels;
+            atlas->max_pixels = width * height;
+        }
+
+        /* White, with the coverage as alpha, so color mod gives the color */
+        dst = atlas->pixels;
+        for ( row = 0; row < height; ++row ) {
+            src = (Uint8 *)(cached->pixmap.buffer + cached->pixmap.pitch * row);
+            for ( col = 0; col < width; ++col ) {
+                *dst++ = ((Uint32)src[col] << 24) | 0x00FFFFFF;
+            }
+        }
+        glyph->rect.x = shelf->x;
+        glyph->rect.y = shelf->y;
+        glyph->rect.w = width;
+        glyph->rect.h = height;
+        if ( SDL_UpdateTexture( atlas->texture, &glyph->rect, atlas->pixels, width * sizeof(*dst) ) < 0 ) {
+            glyph->next = atlas->free_glyphs;
+            atlas->free_glyphs = glyph;
+            return NULL;
+        }
+        shelf->x += width + ATLAS_PADDING;
+        glyph->shelf = i;
+        glyph->shelf_next = shelf->glyphs;
+        shelf->glyphs = glyph;
+    }
+
+    h = Atlas_Hash(font->id, ch) & (atlas->num_buckets - 1);
+    glyph->next = atlas->buckets[h];
+    atlas->buckets[h] = glyph;
+    ++atlas->num_glyphs;
+    return glyph;
+}
+
+static atlas_glyph *Atlas_Find( TTF_Atlas *atlas, TTF_Font *font, Uint32 ch, int style )
+{
+    atlas_glyph *glyph;
+
+    glyph = atlas->buckets[Atlas_Hash(font->id, ch) & (atlas->num_buckets - 1)];
+    for ( ; glyph; glyph = glyph->next ) {
+        if ( glyph->ch == ch && glyph->font_id == font->id && glyph->style == style &&
+             glyph->outline == font->outline && glyph->hinting == font->hinting ) {
+            return glyph;
+        }
+    }
+    return Atlas_Load( atlas, font, ch, style );
+}
+
+TTF_Atlas *TTF_CreateAtlas( SDL_Renderer *renderer, int w, int h )
+{
+    TTF_Atlas *atlas;
+    Uint32 solid[ATLAS_SOLID_SIZE * ATLAS_SOLID_SIZE];
+    SDL_Rect rect;
+    int i;
+
+    TTF_CHECKPOINTER(renderer, NULL);
+
+    if ( w <= 0 ) {
+        w = ATLAS_DEFAULT_SIZE;
+    }
+    if ( h <= 0 ) {
+        h = ATLAS_DEFAULT_SIZE;
+    }
+
+    atlas = (TTF_Atlas *)TTF_calloc( 1, sizeof(*atlas) );
+    if ( !atlas ) {
+        TTF_SetError( "Out of memory" );
+        return NULL;
+    }
+    atlas->renderer = renderer;
+    atlas->width = w;
+    atlas->height = h;
+    atlas->bottom = ATLAS_SOLID_SIZE + ATLAS_PADDING;
+
+    /* Every shelf is at least one pixel plus padding high */
+    atlas->max_shelves = h / (1 + ATLAS_PADDING);
+    atlas->shelves = (atlas_shelf *)TTF_calloc( atlas->max_shelves, sizeof(*atlas->shelves) );
+    atlas->num_buckets = ATLAS_MIN_BUCKETS;
+    atlas->buckets = (atlas_glyph **)TTF_calloc( atlas->num_buckets, sizeof(*atlas->buckets) );
+    if ( !atlas->shelves || !atlas->buckets ) {
+        TTF_SetError( "Out of memory" );
+        TTF_DestroyAtlas( atlas );
+        return NULL;
+    }
+
+    atlas->texture = SDL_CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, w, h );
+    if ( !atlas->texture ) {
+        TTF_DestroyAtlas( atlas );
+        return NULL;
+    }
+    SDL_SetTextureBlendMode( atlas->texture, SDL_BLENDMODE_BLEND );
+
+    for ( i = 0; i < (int)SDL_arraysize(solid); ++i ) {
+        solid[i] = 0xFFFFFFFF;
+    }
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = ATLAS_SOLID_SIZE;
+    rect.h = ATLAS_SOLID_SIZE;
+    SDL_UpdateTexture( atlas->texture, &rect, solid, ATLAS_SOLID_SIZE * sizeof(solid[0]) );
+
+    return atlas;
+}
+
+void TTF_DestroyAtlas( TTF_Atlas *atlas )
+{
+    atlas_glyph *glyph, *next;
+    int i;
+
+    if ( !atlas ) {
+        return;
+    }
+    if ( atlas->buckets ) {
+        for ( i = 0; i < atlas->num_buckets; ++i ) {
+            for ( glyph = atlas->buckets[i]; glyph; glyph = next ) {
+                next = glyph->next;
+                SDL_free( glyph );
+            }
+        }
+        SDL_free( atlas->buckets );
+    }
+    for ( glyph = atlas->free_glyphs; glyph; glyph = next ) {
+        next = glyph->next;
+        SDL_free( glyph );
+    }
+    if ( atlas->texture ) {
+        SDL_DestroyTexture( atlas->texture );
+    }
+    SDL_free( atlas->shelves );
+    SDL_free( atlas->src );
+    SDL_free( atlas->dst );
+    SDL_free( atlas->pixels );
+    SDL_free( atlas );
+}
+
+SDL_Texture *TTF_GetAtlasTexture( TTF_Atlas *atlas )
+{
+    TTF_CHECKPOINTER(atlas, NULL);
+
+    return atlas->texture;
+}
+
+/* Lay out the text the same way as TTF_RenderUTF8_Blended() does, with
+   the top left corner of its surface at x, y.
+ */
+int TTF_DrawUTF8( TTF_Atlas *atlas, TTF_Font *font, const char *text, int x, int y, SDL_Color fg )
+{
+    SDL_bool first;
+    int xstart;
+    int minx, maxx;
+    int z, style;
+    int outline_delta = 0;
+    atlas_glyph *glyph;
+    FT_Long use_kerning;
+    FT_UInt prev_index = 0;
+    size_t textlen;
+
+    TTF_CHECKPOINTER(atlas, -1);
+    TTF_CHECKPOINTER(text, -1);
+
+    atlas->color = fg;
+    ++atlas->stamp;
+
+    /* Underline and strikethrough don't change the glyphs */
+    style = font->style & ~TTF_STYLE_NO_GLYPH_CHANGE;
+
+    /* check kerning */
+    use_kerning = FT_HAS_KERNING( font->face ) && font->kerning;
+
+    /* Init outline handling */
+    if ( font->outline > 0 ) {
+        outline_delta = font->outline * 2;
+    }
+
+    textlen = SDL_strlen(text);
+    first = SDL_TRUE;
+    xstart = 0;
+    minx = maxx = 0;
+    while ( textlen > 0 ) {
+        Uint32 c = UTF8_getch(&text, &textlen);
+        if ( c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED ) {
+            continue;
+        }
+
+        glyph = Atlas_Find( atlas, font, c, style );
+        if ( !glyph ) {
+            Atlas_Flush( atlas );
+            return -1;
+        }
+
+        /* do kerning, if possible AC-Patch */
+        if ( use_kerning && prev_index && glyph->index ) {
+            FT_Vector delta;
+            FT_Get_Kerning( font->face, prev_index, glyph->index, ft_kerning_default, &delta );
+            xstart += delta.x >> 6;
+        }
+
+        /* Compensate for the wrap around bug with negative minx's */
+        if ( first && (glyph->minx < 0) ) {
+            xstart -= glyph->minx;
+        }
+        first = SDL_FALSE;
+
+        if ( glyph->shelf >= 0 ) {
+            atlas->shelves[glyph->shelf].last_used = atlas->stamp;
+            if ( Atlas_AddCopy( atlas, &glyph->rect, x + xstart + glyph->minx,
+                                y + glyph->yoffset, glyph->rect.w, glyph->rect.h ) < 0 ) {
+                Atlas_Flush( atlas );
+                return -1;
+            }
+        }
+
+        /* The text width, as TTF_SizeUTF8() finds it */
+        z = xstart + glyph->minx;
+        if ( minx > z ) {
+            minx = z;
+        }
+        if ( TTF_HANDLE_STYLE_BOLD(font) ) {
+            xstart += font->glyph_overhang;
+        }
+        if ( glyph->advance > glyph->maxx ) {
+            z = xstart + glyph->advance;
+        } else {
+            z = xstart + glyph->maxx;
+        }
+        if ( maxx < z ) {
+            maxx = z;
+        }
+
+        xstart += glyph->advance;
+        prev_index = glyph->index;
+    }
+
+    /* Lines are the white block stretched across the text */
+    if ( TTF_HANDLE_STYLE_UNDERLINE(font) || TTF_HANDLE_STYLE_STRIKETHROUGH(font) ) {
+        SDL_Rect solid;
+        int width = (maxx - minx) + outline_delta;
+        int height = font->underline_height + outline_delta;
+
+        solid.x = ATLAS_SOLID_SIZE / 4;
+        solid.y = ATLAS_SOLID_SIZE / 4;
+        solid.w = ATLAS_SOLID_SIZE / 2;
+        solid.h = ATLAS_SOLID_SIZE / 2;
+        if ( TTF_HANDLE_STYLE_UNDERLINE(font) ) {
+            Atlas_AddCopy( atlas, &solid, x, y + TTF_underline_top_row(font), width, height );
+        }
+        if ( TTF_HANDLE_STYLE_STRIKETHROUGH(font) ) {
+            Atlas_AddCopy( atlas, &solid, x, y + TTF_strikethrough_top_row(font), width, height );
+        }
+    }
+
+    return Atlas_Flush( atlas );
+}
+
 void TTF_SetFontStyle( TTF_Font* font, int style )
 {
     int prev_style = font->style;
@@ -2182,6 +3062,29 @@ int TTF_GetFontHinting( const TTF_Font* font )
     return 0;
 }
 
+int TTF_SetFontCacheSize( TTF_Font* font, int glyphs )
+{
+    if ( glyphs <= 0 ) {
+        glyphs = DEFAULT_CACHE_SIZE;
+    }
+    return Alloc_Cache( font, glyphs );
+}
+
+int TTF_GetFontCacheSize( const TTF_Font* font )
+{
+    return font->cache_size;
+}
+
+void TTF_GetFontCacheStats( TTF_Font* font, Uint32 *hits, Uint32 *misses )
+{
+    if ( hits ) {
+        *hits = font->cache_hits;
+    }
+    if ( misses ) {
+        *misses = font->cache_misses;
+    }
+}
+
 void TTF_Quit( void )
 {
     if ( TTF_initialized ) {
@@ -2205,6 +3108,11 @@ int TTF_GetFontKerningSize(TTF_Font* font, int prev_index, int index)
 }
 
 int TTF_GetFontKerningSizeGlyphs(TTF_Font *font, Uint16 previous_ch, Uint16 ch)
+{
+    return TTF_GetFontKerningSizeGlyphs32(font, previous_ch, ch);
+}
+
+int TTF_GetFontKerningSizeGlyphs32(TTF_Font *font, Uint32 previous_ch, Uint32 ch)
 {
     int error;
     int glyph_index, prev_index;
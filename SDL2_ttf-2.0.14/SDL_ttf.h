@@ -136,6 +136,20 @@ extern DECLSPEC int SDLCALL TTF_FontLineSkip(const TTF_Font *font);
 extern DECLSPEC int SDLCALL TTF_GetFontKerning(const TTF_Font *font);
 extern DECLSPEC void SDLCALL TTF_SetFontKerning(TTF_Font *font, int allowed);
 
+/* Get/Set the number of rendered glyphs kept in the font's cache.
+   The least recently used glyph is dropped when the cache is full.
+   Setting the size empties the cache, a size of 0 sets the default of 512.
+   TTF_SetFontCacheSize() returns 0, or -1 if there was an error.
+ */
+extern DECLSPEC int SDLCALL TTF_GetFontCacheSize(const TTF_Font *font);
+extern DECLSPEC int SDLCALL TTF_SetFontCacheSize(TTF_Font *font, int glyphs);
+
+/* Get the number of glyph lookups the font's cache could and couldn't
+   answer, since the font was opened or the cache size was last set.
+ */
+extern DECLSPEC void SDLCALL TTF_GetFontCacheStats(TTF_Font *font,
+                Uint32 *hits, Uint32 *misses);
+
 /* Get the number of faces of the font */
 extern DECLSPEC long SDLCALL TTF_FontFaces(const TTF_Font *font);
 
@@ -146,6 +160,7 @@ extern DECLSPEC char * SDLCALL TTF_FontFaceStyleName(const TTF_Font *font);
 
 /* Check wether a glyph is provided by the font or not */
 extern DECLSPEC int SDLCALL TTF_GlyphIsProvided(const TTF_Font *font, Uint16 ch);
+extern DECLSPEC int SDLCALL TTF_GlyphIsProvided32(const TTF_Font *font, Uint32 ch);
 
 /* Get the metrics (dimensions) of a glyph
    To understand what these metrics mean, here is a useful link:
@@ -154,6 +169,9 @@ extern DECLSPEC int SDLCALL TTF_GlyphIsProvided(const TTF_Font *font, Uint16 ch)
 extern DECLSPEC int SDLCALL TTF_GlyphMetrics(TTF_Font *font, Uint16 ch,
                      int *minx, int *maxx,
                                      int *miny, int *maxy, int *advance);
+extern DECLSPEC int SDLCALL TTF_GlyphMetrics32(TTF_Font *font, Uint32 ch,
+                     int *minx, int *maxx,
+                                     int *miny, int *maxy, int *advance);
 
 /* Get the dimensions of a rendered string of text */
 extern DECLSPEC int SDLCALL TTF_SizeText(TTF_Font *font, const char *text, int *w, int *h);
@@ -182,6 +200,8 @@ extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderUNICODE_Solid(TTF_Font *font,
 */
 extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderGlyph_Solid(TTF_Font *font,
                     Uint16 ch, SDL_Color fg);
+extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderGlyph32_Solid(TTF_Font *font,
+                    Uint32 ch, SDL_Color fg);
 
 /* Create an 8-bit palettized surface and render the given text at
    high quality with the given font and colors.  The 0 pixel is background,
@@ -204,6 +224,8 @@ extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderUNICODE_Shaded(TTF_Font *font,
 */
 extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderGlyph_Shaded(TTF_Font *font,
                 Uint16 ch, SDL_Color fg, SDL_Color bg);
+extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderGlyph32_Shaded(TTF_Font *font,
+                Uint32 ch, SDL_Color fg, SDL_Color bg);
 
 /* Create a 32-bit ARGB surface and render the given text at high quality,
    using alpha blending to dither the font with the given color.
@@ -238,6 +260,37 @@ extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderUNICODE_Blended_Wrapped(TTF_Font
 */
 extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderGlyph_Blended(TTF_Font *font,
                         Uint16 ch, SDL_Color fg);
+extern DECLSPEC SDL_Surface * SDLCALL TTF_RenderGlyph32_Blended(TTF_Font *font,
+                        Uint32 ch, SDL_Color fg);
+
+/* A texture that glyphs are packed into, for drawing text with a renderer
+   without creating a surface and a texture for every string.
+*/
+typedef struct _TTF_Atlas TTF_Atlas;
+
+/* Create a w by h pixel glyph atlas for the given renderer, 1024 by 1024
+   if w or h is 0.  Glyphs are added to the atlas as they are drawn, and the
+   least recently used ones are dropped when it fills up.  One atlas can
+   hold glyphs of any number of fonts, sizes and styles.
+   This function returns the new atlas, or NULL if there was an error.
+*/
+extern DECLSPEC TTF_Atlas * SDLCALL TTF_CreateAtlas(SDL_Renderer *renderer,
+                int w, int h);
+
+/* Draw the given text with the glyphs in the atlas, in the given color,
+   with the top left corner where TTF_RenderUTF8_Blended() would put the
+   surface's top left corner.  The glyphs are copied from the atlas
+   texture with SDL_RenderCopy().
+   This function returns 0, or -1 if there was an error.
+*/
+extern DECLSPEC int SDLCALL TTF_DrawUTF8(TTF_Atlas *atlas, TTF_Font *font,
+                const char *text, int x, int y, SDL_Color fg);
+
+/* Get the texture of a glyph atlas, for inspection */
+extern DECLSPEC SDL_Texture * SDLCALL TTF_GetAtlasTexture(TTF_Atlas *atlas);
+
+/* Free a glyph atlas and its texture */
+extern DECLSPEC void SDLCALL TTF_DestroyAtlas(TTF_Atlas *atlas);
 
 /* For compatibility with previous versions, here are the old functions */
 #define TTF_RenderText(font, text, fg, bg)  \
@@ -266,6 +319,7 @@ extern DECLSPEC int TTF_GetFontKerningSize(TTF_Font *font, int prev_index, int i
 
 /* Get the kerning size of two glyphs */
 extern DECLSPEC int TTF_GetFontKerningSizeGlyphs(TTF_Font *font, Uint16 previous_ch, Uint16 ch);
+extern DECLSPEC int TTF_GetFontKerningSizeGlyphs32(TTF_Font *font, Uint32 previous_ch, Uint32 ch);
 
 /* We'll use SDL for reporting errors */
 #define TTF_SetError    SDL_SetError
@@ -0,0 +1,317 @@
+/*
+  textbench:  A benchmark for drawing lots of short strings with SDL_ttf
+  Copyright (C) 2001-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* Draws a frame full of short HUD labels, the way a game shows names and
+   hit points over every unit, and reports how long a frame takes.  The
+   labels are drawn with TTF_DrawUTF8() from a glyph atlas, or with -surface
+   the usual way: TTF_RenderUTF8_Blended(), SDL_CreateTextureFromSurface()
+   and SDL_RenderCopy() for every label.
+
+   By default the frames are drawn with the software renderer into a
+   surface, so no display is needed.  With -window they are drawn in a
+   window with the default renderer.
+
+   Before timing anything, a line of text is rendered again after the
+   font's glyph cache is made smaller and then bigger than the number of
+   glyphs in it, and has to come out the same.
+*/
+
+/* quiet windows compiler warnings */
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "SDL.h"
+#include "SDL_ttf.h"
+
+#define DEFAULT_PTSIZE  12
+#define WIDTH   1280
+#define HEIGHT  720
+
+static char *Usage =
+"Usage: %s [-surface] [-window] [-labels count] [-frames count] <font>.ttf [ptsize]\n";
+
+typedef struct {
+    char text[32];
+    int x, y;
+    SDL_Color color;
+} Label;
+
+static void MakeLabels(Label *labels, int count)
+{
+    static const char *names[] = { "Archer", "Knight", "Peasant", "Wizard", "Dragon", "Goblin" };
+    int i;
+
+    srand(1);
+    for (i = 0; i < count; ++i) {
+        Label *label = &labels[i];
+
+        if (i & 1) {
+            SDL_snprintf(label->text, sizeof(label->text), "%s %d", names[rand() % SDL_arraysize(names)], i);
+        } else {
+            SDL_snprintf(label->text, sizeof(label->text), "HP %d/%d", rand() % 1000, 1000);
+        }
+        label->x = rand() % WIDTH;
+        label->y = rand() % HEIGHT;
+        label->color.r = (Uint8)(rand() % 256);
+        label->color.g = (Uint8)(rand() % 256);
+        label->color.b = (Uint8)(rand() % 256);
+        label->color.a = 255;
+    }
+}
+
+static int DrawFrame(SDL_Renderer *renderer, TTF_Font *font, TTF_Atlas *atlas, Label *labels, int count)
+{
+    int i;
+
+    SDL_SetRenderDrawColor(renderer, 0x20, 0x20, 0x20, 0xFF);
+    SDL_RenderClear(renderer);
+
+    for (i = 0; i < count; ++i) {
+        Label *label = &labels[i];
+
+        if (atlas) {
+            if (TTF_DrawUTF8(atlas, font, label->text, label->x, label->y, label->color) < 0) {
+                return -1;
+            }
+        } else {
+            SDL_Surface *text;
+            SDL_Texture *texture;
+            SDL_Rect rect;
+
+            text = TTF_RenderUTF8_Blended(font, label->text, label->color);
+            if (text == NULL) {
+                return -1;
+            }
+            texture = SDL_CreateTextureFromSurface(renderer, text);
+            if (texture == NULL) {
+                SDL_FreeSurface(text);
+                return -1;
+            }
+            rect.x = label->x;
+            rect.y = label->y;
+            rect.w = text->w;
+            rect.h = text->h;
+            SDL_RenderCopy(renderer, texture, NULL, &rect);
+            SDL_DestroyTexture(texture);
+            SDL_FreeSurface(text);
+        }
+    }
+    SDL_RenderPresent(renderer);
+    return 0;
+}
+
+static int CompareSurfaces(SDL_Surface *a, SDL_Surface *b)
+{
+    int y;
+
+    if (a->w != b->w || a->h != b->h) {
+        return -1;
+    }
+    for (y = 0; y < a->h; ++y) {
+        if (SDL_memcmp((Uint8 *)a->pixels + y * a->pitch,
+                       (Uint8 *)b->pixels + y * b->pitch, a->w * 4) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Render the same text with the cache shrunk below and grown above the
+   number of glyphs it holds, then put the default size back */
+static int CheckCacheResize(TTF_Font *font)
+{
+    static const int sizes[] = { 16, 1024, 0 };
+    SDL_Color color = { 0xFF, 0xFF, 0xFF, 0xFF };
+    char text[128];
+    SDL_Surface *expected, *actual;
+    int i, status = 0;
+
+    for (i = 0; i < 95; ++i) {
+        text[i] = (char)(' ' + i);
+    }
+    text[i] = '\0';
+
+    expected = TTF_RenderUTF8_Blended(font, text, color);
+    if (expected == NULL) {
+        return -1;
+    }
+    for (i = 0; i < (int)SDL_arraysize(sizes) && status == 0; ++i) {
+        if (TTF_SetFontCacheSize(font, sizes[i]) < 0) {
+            status = -1;
+            break;
+        }
+        actual = TTF_RenderUTF8_Blended(font, text, color);
+        if (actual == NULL) {
+            status = -1;
+            break;
+        }
+        if (CompareSurfaces(expected, actual) < 0) {
+            SDL_SetError("Text differs with a cache of %d glyphs", TTF_GetFontCacheSize(font));
+            status = -1;
+        }
+        SDL_FreeSurface(actual);
+    }
+    SDL_FreeSurface(expected);
+    return status;
+}
+
+int main(int argc, char *argv[])
+{
+    char *argv0 = argv[0];
+    SDL_Window *window = NULL;
+    SDL_Surface *target = NULL;
+    SDL_Renderer *renderer = NULL;
+    TTF_Font *font = NULL;
+    TTF_Atlas *atlas = NULL;
+    Label *labels = NULL;
+    int use_surface = 0;
+    int use_window = 0;
+    int count = 10000;
+    int frames = 20;
+    int ptsize = DEFAULT_PTSIZE;
+    int i, status = 1;
+    Uint64 start, end;
+    double ms;
+
+    for (argc--, argv++; argc > 0 && argv[0][0] == '-'; argc--, argv++) {
+        if (strcmp(argv[0], "-surface") == 0) {
+            use_surface = 1;
+        } else if (strcmp(argv[0], "-window") == 0) {
+            use_window = 1;
+        } else if (strcmp(argv[0], "-labels") == 0 && argv[1]) {
+            count = atoi(argv[1]);
+            count = SDL_max(count, 1);
+            argc--, argv++;
+        } else if (strcmp(argv[0], "-frames") == 0 && argv[1]) {
+            frames = atoi(argv[1]);
+            frames = SDL_max(frames, 1);
+            argc--, argv++;
+        } else {
+            fprintf(stderr, Usage, argv0);
+            return(1);
+        }
+    }
+    if (!argv[0]) {
+        fprintf(stderr, Usage, argv0);
+        return(1);
+    }
+    if (argv[1]) {
+        ptsize = atoi(argv[1]);
+    }
+
+    if (SDL_Init(use_window ? SDL_INIT_VIDEO : 0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return(2);
+    }
+    if (TTF_Init() < 0) {
+        fprintf(stderr, "Couldn't initialize TTF: %s\n", SDL_GetError());
+        SDL_Quit();
+        return(2);
+    }
+
+    font = TTF_OpenFont(argv[0], ptsize);
+    if (font == NULL) {
+        fprintf(stderr, "Couldn't load %d pt font from %s: %s\n", ptsize, argv[0], SDL_GetError());
+        goto done;
+    }
+
+    if (CheckCacheResize(font) < 0) {
+        fprintf(stderr, "Glyph cache resize check failed: %s\n", SDL_GetError());
+        goto done;
+    }
+
+    if (use_window) {
+        if (SDL_CreateWindowAndRenderer(WIDTH, HEIGHT, 0, &window, &renderer) < 0) {
+            fprintf(stderr, "Couldn't create window: %s\n", SDL_GetError());
+            goto done;
+        }
+    } else {
+        target = SDL_CreateRGBSurface(0, WIDTH, HEIGHT, 32,
+                                      0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+        if (target) {
+            renderer = SDL_CreateSoftwareRenderer(target);
+        }
+        if (renderer == NULL) {
+            fprintf(stderr, "Couldn't create renderer: %s\n", SDL_GetError());
+            goto done;
+        }
+    }
+
+    if (!use_surface) {
+        atlas = TTF_CreateAtlas(renderer, 0, 0);
+        if (atlas == NULL) {
+            fprintf(stderr, "Couldn't create atlas: %s\n", SDL_GetError());
+            goto done;
+        }
+    }
+
+    labels = (Label *)SDL_malloc(count * sizeof(*labels));
+    if (labels == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        goto done;
+    }
+    MakeLabels(labels, count);
+
+    /* The first frame fills the caches */
+    if (DrawFrame(renderer, font, atlas, labels, count) < 0) {
+        fprintf(stderr, "Couldn't draw text: %s\n", SDL_GetError());
+        goto done;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < frames; ++i) {
+        if (DrawFrame(renderer, font, atlas, labels, count) < 0) {
+            fprintf(stderr, "Couldn't draw text: %s\n", SDL_GetError());
+            goto done;
+        }
+    }
+    end = SDL_GetPerformanceCounter();
+    ms = (double)(end - start) * 1000.0 / SDL_GetPerformanceFrequency() / frames;
+
+    printf("%d labels at %d pt %s: %.2f ms per frame, %.2f us per label\n",
+           count, ptsize, use_surface ? "rendered to surfaces" : "drawn from the atlas",
+           ms, ms * 1000.0 / count);
+    status = 0;
+
+done:
+    SDL_free(labels);
+    TTF_DestroyAtlas(atlas);
+    if (renderer) {
+        SDL_DestroyRenderer(renderer);
+    }
+    if (target) {
+        SDL_FreeSurface(target);
+    }
+    if (window) {
+        SDL_DestroyWindow(window);
+    }
+    if (font) {
+        TTF_CloseFont(font);
+    }
+    TTF_Quit();
+    SDL_Quit();
+    return(status);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */